@@ -311,6 +311,19 @@ public:
                             su2double       &dist,
                             unsigned long   &pointID,
                             int             &rankID);
+
+  /*!
+   * \brief Function, which determines all the nodes in the ADT that are
+            within the given distance of the given coordinate.
+   * \param[in]  coor     Coordinate of the center of the search.
+   * \param[in]  radius   Radius of the search, only nodes strictly inside are returned.
+   * \param[out] pointIDs Local point ID's of the nodes found, in no particular order.
+   * \param[out] rankIDs  Ranks on which the nodes found are stored.
+   */
+  void DetermineNodesInRadius(const su2double       *coor,
+                              const su2double       radius,
+                              vector<unsigned long> &pointIDs,
+                              vector<int>           &rankIDs);
 private:
   /*!
    * \brief Default constructor of the class, disabled.
@@ -109,6 +109,19 @@ private:
   const int kc;
   const int nc;
 
+  /* Maximum value of K for which a size specialized kernel is available.
+     This covers the number of DOFs of the standard elements up to at least
+     polynomial degree 3 and the corresponding products with the
+     integration points of the low order elements. */
+  static const int maxKSmallGemm = 64;
+
+  /* Function pointer type of the size specialized gemm kernels. */
+  typedef void (*gemmSmallKernel)(const int M, const int N, const su2double *A,
+                                  const su2double *B, su2double *C);
+
+  gemmSmallKernel gemmKernelsSmallK[maxKSmallGemm+1]; /*!< \brief Size specialized gemm kernels,
+                                                                  indexed by the value of K. */
+
   /*!
    * \brief Function, which perform the implementation of the gemm functionality.
    * \param[in]  m  - Number of rows of a and c.
@@ -116,6 +116,8 @@ private:
   unsigned short FFD_Blending; /*!< \brief Kind of FFD Blending function. */
   su2double* FFD_BSpline_Order; /*!< \brief BSpline order in i,j,k direction. */
   su2double FFD_Tol;  	/*!< \brief Tolerance in the point inversion problem. */
+  bool FFD_ParamCoord_Cache;  /*!< \brief Reuse the parametric coordinates of the point inversion stored in a binary file. */
+  su2double Wall_Distance_Update_Tol; /*!< \brief Relative tolerance on the change of the wall distance below which a point is not searched again. */
   su2double Opt_RelaxFactor;  	/*!< \brief Scale factor for the line search. */
   su2double Opt_LineSearch_Bound;  	/*!< \brief Bounds for the line search. */
   bool Write_Conv_FSI;			/*!< \brief Write convergence file for FSI problems. */
@@ -126,6 +128,7 @@ private:
   InvDesign_Cp,				/*!< \brief Flag to know if the code is going to compute and plot the inverse design. */
   InvDesign_HeatFlux,				/*!< \brief Flag to know if the code is going to compute and plot the inverse design. */
   Grid_Movement,			/*!< \brief Flag to know if there is grid movement. */
+  Wall_Distance_Update,   /*!< \brief Flag to know if the wall distance must be updated after a deformation of the grid. */
   Wind_Gust,              /*!< \brief Flag to know if there is a wind gust. */
   Aeroelastic_Simulation, /*!< \brief Flag to know if there is an aeroelastic simulation. */
   Weakly_Coupled_Heat, /*!< \brief Flag to know if a heat equation should be weakly coupled to the incompressible solver. */
@@ -141,6 +144,7 @@ private:
   Frozen_Visc_Disc,			/*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,			/*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
   Inconsistent_Disc,      /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
+  Jacobian_Prec_Disc,     /*!< \brief Precondition the disc. adjoint update with the transposed primal Jacobian. */
   Sens_Remove_Sharp,			/*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,	/*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric, /*!< \brief Flag for axisymmetric calculations */
@@ -235,6 +239,9 @@ private:
                              from nMarker_All). */
   bool Inlet_From_File; /*!< \brief True if the inlet profile is to be loaded from a file. */
   string Inlet_Filename; /*!< \brief Filename specifying an inlet profile. */
+  string LUT_Filename; /*!< \brief Filename of the thermodynamic look-up table. */
+  unsigned long LUT_nDensity,  /*!< \brief Number of density nodes of the look-up table. */
+  LUT_nEnergy;                 /*!< \brief Number of internal energy nodes of the look-up table. */
   su2double Inlet_Matching_Tol; /*!< \brief Tolerance used when matching a point to a point from the inlet file. */
   string *Marker_Euler,			/*!< \brief Euler wall markers. */
   *Marker_FarField,				/*!< \brief Far field markers. */
@@ -436,6 +443,7 @@ private:
   string DV_Unordered_Sens_Filename;      /*!< \brief Filename of volume sensitivities in an unordered ASCII format. */
   string DV_Sens_Filename;      /*!< \brief Filename of surface sensitivities written to an unordered ASCII format. */
   unsigned short Sensitivity_FileFormat; /*!< \brief Format of the input volume sensitivity files (SU2_DOT). */
+  bool DV_Separate_ObjFunc;        /*!< \brief Project the sensitivities of each objective separately (SU2_DOT). */
   su2double **ParamDV;				/*!< \brief Parameters of the design variable. */
   su2double **CoordFFDBox;				/*!< \brief Coordinates of the FFD boxes. */
   unsigned short **DegreeFFDBox;	/*!< \brief Degree of the FFD boxes. */
@@ -458,6 +466,7 @@ private:
   *Kind_Solver_PerZone,  /*!< \brief Kind of solvers for each zone Euler, NS, Continuous adjoint, etc.  */
   Kind_MZSolver,         /*!< \brief Kind of multizone solver.  */
   Kind_FluidModel,			/*!< \brief Kind of the Fluid Model: Ideal or Van der Walls, ... . */
+  Kind_LUT_BaseModel,			/*!< \brief Kind of the Fluid Model used to generate the look-up table. */
   Kind_ViscosityModel,			/*!< \brief Kind of the Viscosity Model*/
   Kind_ConductivityModel,			/*!< \brief Kind of the Thermal Conductivity Model*/
   Kind_ConductivityModel_Turb,      /*!< \brief Kind of the Turbulent Thermal Conductivity Model*/
@@ -477,6 +486,7 @@ private:
   Kind_AdjTurb_Linear_Prec,		/*!< \brief Preconditioner of the turbulent adjoint linear solver. */
   Kind_DiscAdj_Linear_Solver, /*!< \brief Linear solver for the discrete adjoint system. */
   Kind_DiscAdj_Linear_Prec,  /*!< \brief Preconditioner of the discrete adjoint linear solver. */
+  nJacobian_Prec_Disc,       /*!< \brief Number of transposed Jacobian solves per disc. adjoint iteration. */
   Kind_DiscAdj_Linear_Solver_FSI_Struc, /*!< \brief Linear solver for the discrete adjoint system in the structural side of FSI problems. */
   Kind_DiscAdj_Linear_Prec_FSI_Struc,   /*!< \brief Preconditioner of the discrete adjoint linear solver in the structural side of FSI problems. */
   Kind_SlopeLimit,				/*!< \brief Global slope limiter. */
@@ -590,6 +600,7 @@ private:
   unsigned long GridDef_Nonlinear_Iter, /*!< \brief Number of nonlinear increments for grid deformation. */
   GridDef_Linear_Iter; /*!< \brief Number of linear smoothing iterations for grid deformation. */
   unsigned short Deform_Stiffness_Type; /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  bool Deform_Cache_Stiffness;  /*!< \brief Keep the element stiffness of the first FEA mesh deformation for the following ones. */
   bool Deform_Output;  /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor; /*!< Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff; /*!< Deform coeffienct */
@@ -644,6 +655,8 @@ private:
   bool Restart,	/*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Wrt_Binary_Restart,	/*!< \brief Write binary SU2 native restart files.*/
   Read_Binary_Restart,	/*!< \brief Read binary SU2 native restart files.*/
+  Wrt_Elem_Restart_DG,	/*!< \brief Write the DG-FEM restart files per element in partition order.*/
+  Read_Elem_Restart_DG,	/*!< \brief Read the DG-FEM restart files per element in partition order.*/
   Restart_Flow;	/*!< \brief Restart flow solution for adjoint and linearized problems. */
   unsigned short nMarker_Monitoring,	/*!< \brief Number of markers to monitor. */
   nMarker_Designing,					/*!< \brief Number of markers for the objective function. */
@@ -740,6 +753,8 @@ private:
   Breakdown_FileName,			    /*!< \brief Breakdown output file. */
   Conv_FileName_FSI,					/*!< \brief Convergence history output file. */
   Restart_FlowFileName,			/*!< \brief Restart file for flow variables. */
+  Restart_Elem_DGFileName,		/*!< \brief Restart file of the DG-FEM solver written per element. */
+  Solution_Elem_DGFileName,		/*!< \brief Solution input file of the DG-FEM solver written per element. */
   Restart_HeatFileName,			/*!< \brief Restart file for heat variables. */
   Restart_AdjFileName,			/*!< \brief Restart file for adjoint variables, drag functional. */
   Restart_FEMFileName,			/*!< \brief Restart file for FEM elasticity. */
@@ -796,6 +811,8 @@ private:
   Pressure_Critical,   /*!< \brief Critical Pressure for real fluid model.  */
   Density_Critical,   /*!< \brief Critical Density for real fluid model.  */
   Acentric_Factor,   /*!< \brief Acentric Factor for real fluid model.  */
+  *LUT_Density_Limits,   /*!< \brief Minimum and maximum density of the look-up table.  */
+  *LUT_Temperature_Limits,   /*!< \brief Minimum and maximum temperature of the look-up table.  */
   Mu_Constant,     /*!< \brief Constant viscosity for ConstantViscosity model.  */
   Mu_ConstantND,   /*!< \brief Non-dimensional constant viscosity for ConstantViscosity model.  */
   Kt_Constant,     /*!< \brief Constant thermal conductivity for ConstantConductivity model.  */
@@ -1024,6 +1041,8 @@ private:
   *default_ea_lim,            /*!< \brief Default equivalent area limit array for the COption class. */
   *default_grid_fix,          /*!< \brief Default fixed grid (non-deforming region) array for the COption class. */
   *default_htp_axis,          /*!< \brief Default HTP axis for the COption class. */
+  *default_lut_density,       /*!< \brief Default density limits of the look-up table for the COption class. */
+  *default_lut_temperature,   /*!< \brief Default temperature limits of the look-up table for the COption class. */
   *default_ffd_axis,          /*!< \brief Default FFD axis for the COption class. */
   *default_inc_crit,          /*!< \brief Default incremental criteria array for the COption class. */
   *default_extrarelfac,       /*!< \brief Default extra relaxation factor for Giles BC in the COption class. */
@@ -1054,6 +1073,7 @@ private:
   su2double Restart_Bandwidth_Agg; /*!< \brief The aggregate of the bandwidth for writing binary restarts (to be averaged later). */
   su2double Max_Vel2; /*!< \brief The maximum velocity^2 in the domain for the incompressible preconditioner. */
   bool topology_optimization; /*!< \brief If the structural solver should consider a variable density field to penalize element stiffness. */
+  bool Cache_Elem_Stiffness;  /*!< \brief Store the element stiffness of linear structural problems instead of recomputing it. */
   string top_optim_output_file; /*!< \brief File to where the derivatives w.r.t. element densities will be written to. */
   su2double simp_exponent; /*!< \brief Exponent for the density-based stiffness penalization of the SIMP method. */
   su2double simp_minimum_stiffness; /*!< \brief Lower bound for the stiffness penalization of the SIMP method. */
@@ -1076,6 +1096,16 @@ private:
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
+  unsigned short nNewtonIter_ImplicitDG;     /*!< \brief Number of Newton iterations per time step of the implicit DG scheme. */
+  unsigned short JacobianFreq_ImplicitDG;    /*!< \brief Number of Newton iterations after which the Jacobian of the implicit DG scheme is recomputed. */
+  unsigned short TimeOrder_ImplicitDG;       /*!< \brief Order of the BDF scheme for time accurate implicit DG computations. */
+  unsigned long nIterMeasureWorkDG;          /*!< \brief Number of task list executions during which the work of the DG elements is measured. */
+  bool Use_Measured_Work_DG;                 /*!< \brief Whether or not to use measured work weights in the partitioning of the DG grid. */
+  bool Repartition_Measured_Work_DG;         /*!< \brief Whether or not to repartition the DG grid during the computation once the work has been measured. */
+  string Work_Weights_DG_FileName;           /*!< \brief File name of the measured work weights of the DG elements. */
+  bool Compact_Metric_Affine_DG;             /*!< \brief Whether or not only one set of metric terms is stored for affine DG elements. */
+  bool SinglePrec_Metric_DG;                 /*!< \brief Whether or not the metric terms of curved DG elements are stored in single precision. */
+  bool WarmStart_ADER_Predictor;             /*!< \brief Whether or not the ADER-DG predictor starts from the extrapolated predictor of the previous time step. */
   bool Compute_Average; /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   
 
@@ -3275,6 +3305,12 @@ public:
    */
   unsigned short GetSensitivity_Format(void);
   
+  /*!
+   * \brief Get whether SU2_DOT projects the sensitivities of each objective function separately.
+   * \return <code>TRUE</code> means that one gradient is computed for each objective function.
+   */
+  bool GetDV_Separate_ObjFunc(void);
+  
   /*!
    * \brief Get information about writing sectional force files.
    * \return <code>TRUE</code> means that sectional force files will be written for specified markers.
@@ -3762,6 +3798,44 @@ public:
    * \return Critical pressure.
    */
   su2double GetAcentric_Factor(void);
+
+  /*!
+   * \brief Get the fluid model used to generate the look-up table.
+   * \return Fluid model of the look-up table generator.
+   */
+  unsigned short GetKind_LUT_BaseModel(void);
+
+  /*!
+   * \brief Get the name of the file containing the thermodynamic look-up table.
+   * \return Name of the look-up table file.
+   */
+  string GetLUT_Filename(void);
+
+  /*!
+   * \brief Get the number of density nodes of the look-up table.
+   * \return Number of density nodes.
+   */
+  unsigned long GetLUT_nDensity(void);
+
+  /*!
+   * \brief Get the number of internal energy nodes of the look-up table.
+   * \return Number of internal energy nodes.
+   */
+  unsigned long GetLUT_nEnergy(void);
+
+  /*!
+   * \brief Get the density limits of the look-up table.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Density limit.
+   */
+  su2double GetLUT_Density_Limits(unsigned short val_index);
+
+  /*!
+   * \brief Get the temperature limits of the look-up table.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Temperature limit.
+   */
+  su2double GetLUT_Temperature_Limits(unsigned short val_index);
   
   /*!
    * \brief Get the value of the viscosity model.
@@ -4162,6 +4236,12 @@ public:
    * \return type of stiffness to impose for FEA mesh deformation.
    */
   unsigned short GetDeform_Stiffness_Type(void);
+
+  /*!
+   * \brief Get whether the element stiffness of the FEA mesh deformation is computed once and reused.
+   * \return <code>TRUE</code> if the element stiffness is cached; otherwise <code>FALSE</code>.
+   */
+  bool GetDeform_Cache_Stiffness(void);
   
   /*!
    * \brief Creates a tecplot file to visualize the volume deformation deformation made by the DEF software.
@@ -4341,6 +4421,13 @@ public:
    */
   unsigned short GetKind_ADER_Predictor(void);
 
+  /*!
+   * \brief Get whether or not the predictor step of ADER-DG starts from the
+   *        predictor solution of the previous time step, extrapolated in time.
+   * \return Whether or not a warm start is used in the predictor step of ADER-DG.
+   */
+  bool GetWarmStart_ADER_Predictor(void);
+
   /*!
    * \brief Get the kind of integration scheme (explicit or implicit)
    *        for the flow equations.
@@ -4670,6 +4757,19 @@ public:
    */
   bool GetInconsistent_Disc(void);
 
+  /*!
+   * \brief Provides information about preconditioning the discrete adjoint fixed-point update
+   *        with the transposed Jacobian of the primal implicit scheme.
+   * \return <code>TRUE</code> means that the update is corrected with the primal Jacobian.
+   */
+  bool GetJacobian_Prec_Disc(void);
+
+  /*!
+   * \brief Get the number of terms of the series used to approximate the inverse of the adjoint fixed-point operator.
+   * \return Number of transposed linear solves per adjoint iteration.
+   */
+  unsigned short GetnJacobian_Prec_Disc(void);
+
   /*!
    * \brief Provides information about the way in which the limiter will be treated by the
    *        disc. adjoint method.
@@ -5254,6 +5354,30 @@ public:
    */
   bool GetRead_Binary_Restart(void);
 
+  /*!
+   * \brief Flag for whether the DG-FEM restart files are written per element in partition order.
+   * \return Flag for whether the element based DG-FEM restart files are written.
+   */
+  bool GetWrt_Elem_Restart_DG(void);
+
+  /*!
+   * \brief Flag for whether the DG-FEM restart files are read per element in partition order.
+   * \return Flag for whether the element based DG-FEM restart files are read.
+   */
+  bool GetRead_Elem_Restart_DG(void);
+
+  /*!
+   * \brief Get the name of the DG-FEM restart file written per element.
+   * \return Name of the element based DG-FEM restart file.
+   */
+  string GetRestart_Elem_DGFileName(void);
+
+  /*!
+   * \brief Get the name of the DG-FEM solution file read per element.
+   * \return Name of the element based DG-FEM solution file.
+   */
+  string GetSolution_Elem_DGFileName(void);
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5533,9 +5657,10 @@ public:
   /*!
    * \brief Append the input filename string with the appropriate objective function extension.
    * \param[in] val_filename - String value of the base filename.
+   * \param[in] val_iObj - Index of a single objective function of the list (all of them by default).
    * \return Name of the file with the appropriate objective function extension.
    */
-  string GetObjFunc_Extension(string val_filename);
+  string GetObjFunc_Extension(string val_filename, short val_iObj = -1);
   
   /*!
    * \brief Get the criteria for structural residual (relative/absolute).
@@ -5679,6 +5804,18 @@ public:
    */
   unsigned short GetKind_GridMovement();
 
+  /*!
+   * \brief Get information about the update of the wall distance after a deformation of the grid.
+   * \return <code>TRUE</code> if the wall distance must be updated; otherwise <code>FALSE</code>.
+   */
+  bool GetWall_Distance_Update(void);
+
+  /*!
+   * \brief Get the relative tolerance for the incremental update of the wall distance.
+   * \return Relative change of the wall distance below which a point is not searched again.
+   */
+  su2double GetWall_Distance_Update_Tol(void);
+
   /*!
    * \brief Set the type of dynamic mesh motion.
    * \param[in] val_iZone - Number for the current zone in the mesh (each zone has independent motion).
@@ -8266,6 +8403,12 @@ public:
    * \return Tolerance of the point inversion algorithm.
    */
   su2double GetFFD_Tol(void);
+
+  /*!
+   * \brief Get whether the parametric coordinates of the point inversion are cached in a binary file.
+   * \return <code>TRUE</code> if the cached parametric coordinates are read and written; otherwise <code>FALSE</code>.
+   */
+  bool GetFFD_ParamCoord_Cache(void);
   
   /*!
    * \brief Get the scale factor for the line search.
@@ -8893,6 +9036,83 @@ public:
    */
   bool GetJacobian_Spatial_Discretization_Only(void);
 
+  /*!
+   * \brief Function to make available the number of Newton iterations per
+            time step of the implicit DG time integration.
+   * \return The number of Newton iterations.
+   */
+  unsigned short GetnNewtonIter_ImplicitDG(void);
+
+  /*!
+   * \brief Function to make available the number of Newton iterations after
+            which the Jacobian of the implicit DG time integration is recomputed.
+   * \return The frequency of the Jacobian computation.
+   */
+  unsigned short GetJacobianFreq_ImplicitDG(void);
+
+  /*!
+   * \brief Function to make available the order of the BDF scheme used for
+            time accurate implicit DG computations.
+   * \return The order of the BDF scheme, 1 or 2.
+   */
+  unsigned short GetTimeOrder_ImplicitDG(void);
+
+  /*!
+   * \brief Function to make available the number of task list executions
+            during which the work of the DG elements is measured.
+   * \return The number of measured executions, 0 means no measurement.
+   */
+  unsigned long GetnIterMeasureWorkDG(void);
+
+  /*!
+   * \brief Function to make available whether or not the measured work weights
+            must be used in the partitioning of the DG grid.
+   * \return True if the measured work weights must be used.
+   */
+  bool GetUse_Measured_Work_DG(void);
+
+  /*!
+   * \brief Function to make available whether or not the DG grid must be
+            repartitioned during the computation with the measured work weights.
+   * \return True if the grid must be repartitioned when the measurement is finished.
+   */
+  bool GetRepartition_Measured_Work_DG(void);
+
+  /*!
+   * \brief Function to set the number of task list executions during which
+            the work of the DG elements is measured.
+   * \param[in] val_nIter - Number of measured executions, 0 means no measurement.
+   */
+  void SetnIterMeasureWorkDG(unsigned long val_nIter);
+
+  /*!
+   * \brief Function to set whether or not the measured work weights must be
+            used in the partitioning of the DG grid.
+   * \param[in] val_use - True if the measured work weights must be used.
+   */
+  void SetUse_Measured_Work_DG(bool val_use);
+
+  /*!
+   * \brief Function to make available the file name of the measured work
+            weights of the DG elements.
+   * \return The file name of the work weights.
+   */
+  string GetWork_Weights_DG_FileName(void);
+
+  /*!
+   * \brief Function to make available whether or not only one set of metric
+            terms is stored for affine DG elements.
+   * \return True if the compact storage is used for affine elements.
+   */
+  bool GetCompact_Metric_Affine_DG(void);
+
+  /*!
+   * \brief Function to make available whether or not the metric terms of
+            curved DG elements are stored in single precision.
+   * \return True if single precision storage is used for curved elements.
+   */
+  bool GetSinglePrec_Metric_DG(void);
+
   /*!
    * \brief Get the interpolation method used for matching between zones.
    */
@@ -9039,6 +9259,12 @@ public:
    */
   bool GetTopology_Optimization(void) const;
 
+  /*!
+   * \brief Get whether the element stiffness of linear structural problems is computed once and reused.
+   * \return <code>TRUE</code> if the element stiffness is cached; otherwise <code>FALSE</code>.
+   */
+  bool GetCache_Elem_Stiffness(void) const;
+
   /*!
    * \brief Get name of output file for topology optimization derivatives.
    */
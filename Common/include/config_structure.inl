@@ -873,6 +873,18 @@ inline su2double CConfig::GetTemperature_Critical(void) { return Temperature_Cri
 
 inline su2double CConfig::GetAcentric_Factor(void) { return Acentric_Factor; }
 
+inline unsigned short CConfig::GetKind_LUT_BaseModel(void) { return Kind_LUT_BaseModel; }
+
+inline string CConfig::GetLUT_Filename(void) { return LUT_Filename; }
+
+inline unsigned long CConfig::GetLUT_nDensity(void) { return LUT_nDensity; }
+
+inline unsigned long CConfig::GetLUT_nEnergy(void) { return LUT_nEnergy; }
+
+inline su2double CConfig::GetLUT_Density_Limits(unsigned short val_index) { return LUT_Density_Limits[val_index]; }
+
+inline su2double CConfig::GetLUT_Temperature_Limits(unsigned short val_index) { return LUT_Temperature_Limits[val_index]; }
+
 inline unsigned short CConfig::GetKind_ViscosityModel(void) { return Kind_ViscosityModel; }
 
 inline unsigned short CConfig::GetKind_ConductivityModel(void) { return Kind_ConductivityModel; }
@@ -937,6 +949,10 @@ inline unsigned short CConfig::GetKind_GridMovement(unsigned short val_iZone) {
 
 inline unsigned short CConfig::GetKind_GridMovement(void) { return Kind_GridMovement[0]; }
 
+inline bool CConfig::GetWall_Distance_Update(void) { return Wall_Distance_Update; }
+
+inline su2double CConfig::GetWall_Distance_Update_Tol(void) { return Wall_Distance_Update_Tol; }
+
 inline void CConfig::SetKind_GridMovement(unsigned short val_iZone, unsigned short motion_Type) { Kind_GridMovement[val_iZone] = motion_Type; }
 
 inline su2double CConfig::GetMach_Motion(void) { return Mach_Motion; }
@@ -1079,6 +1095,8 @@ inline su2double CConfig::GetDeform_PoissonRatio(void) { return Deform_PoissonRa
 
 inline unsigned short CConfig::GetDeform_Stiffness_Type(void) { return Deform_Stiffness_Type; }
 
+inline bool CConfig::GetDeform_Cache_Stiffness(void) { return Deform_Cache_Stiffness; }
+
 inline bool CConfig::GetVisualize_Volume_Def(void) { return Visualize_Volume_Def; }
 
 inline bool CConfig::GetVisualize_Surface_Def(void) { return Visualize_Surface_Def; }
@@ -1113,6 +1131,8 @@ inline unsigned short CConfig::GetKind_TimeIntScheme_Flow(void) { return Kind_Ti
 
 inline unsigned short CConfig::GetKind_ADER_Predictor(void) { return Kind_ADER_Predictor; }
 
+inline bool CConfig::GetWarmStart_ADER_Predictor(void) { return WarmStart_ADER_Predictor; }
+
 inline unsigned short CConfig::GetKind_TimeIntScheme_Heat(void) { return Kind_TimeIntScheme_Heat; }
 
 inline unsigned short CConfig::GetKind_TimeStep_Heat(void) { return Kind_TimeStep_Heat; }
@@ -1321,6 +1341,14 @@ inline bool CConfig::GetWrt_Binary_Restart(void) {	return Wrt_Binary_Restart; }
 
 inline bool CConfig::GetRead_Binary_Restart(void) {	return Read_Binary_Restart; }
 
+inline bool CConfig::GetWrt_Elem_Restart_DG(void) {	return Wrt_Elem_Restart_DG; }
+
+inline string CConfig::GetRestart_Elem_DGFileName(void) { return Restart_Elem_DGFileName; }
+
+inline string CConfig::GetSolution_Elem_DGFileName(void) { return Solution_Elem_DGFileName; }
+
+inline bool CConfig::GetRead_Elem_Restart_DG(void) {	return Read_Elem_Restart_DG; }
+
 inline bool CConfig::GetRestart_Flow(void) { return Restart_Flow; }
 
 inline bool CConfig::GetEquivArea(void) { return EquivArea; }
@@ -1646,6 +1674,10 @@ inline bool CConfig::GetFrozen_Limiter_Disc(void){ return Frozen_Limiter_Disc; }
 
 inline bool CConfig::GetInconsistent_Disc(void){ return Inconsistent_Disc; }
 
+inline bool CConfig::GetJacobian_Prec_Disc(void){ return Jacobian_Prec_Disc; }
+
+inline unsigned short CConfig::GetnJacobian_Prec_Disc(void){ return nJacobian_Prec_Disc; }
+
 inline bool CConfig::GetSens_Remove_Sharp(void) { return Sens_Remove_Sharp; }
 
 inline bool CConfig::GetWrite_Conv_FSI(void) { return Write_Conv_FSI; }
@@ -1716,6 +1748,8 @@ inline bool CConfig::GetWrt_Projected_Sensitivity(void) { return Wrt_Projected_S
 
 inline unsigned short CConfig::GetSensitivity_Format(void) { return Sensitivity_FileFormat; }
 
+inline bool CConfig::GetDV_Separate_ObjFunc(void) { return DV_Separate_ObjFunc; }
+
 inline bool CConfig::GetPlot_Section_Forces(void) { return Plot_Section_Forces; }
 
 inline vector<vector<su2double> > CConfig::GetAeroelastic_np1(unsigned short iMarker) { return Aeroelastic_np1[iMarker]; }
@@ -1778,6 +1812,8 @@ inline unsigned short CConfig::GetnFFD_Iter(void) { return nFFD_Iter; }
 
 inline su2double CConfig::GetFFD_Tol(void) { return FFD_Tol; }
 
+inline bool CConfig::GetFFD_ParamCoord_Cache(void) { return FFD_ParamCoord_Cache; }
+
 inline su2double CConfig::GetOpt_LineSearch_Bound(void) {return Opt_LineSearch_Bound; }
 
 inline su2double CConfig::GetOpt_RelaxFactor(void) {return Opt_RelaxFactor; }
@@ -1978,6 +2014,28 @@ inline bool CConfig::GetUse_Lumped_MassMatrix_DGFEM(void) {return Use_Lumped_Mas
 
 inline bool CConfig::GetJacobian_Spatial_Discretization_Only(void) {return Jacobian_Spatial_Discretization_Only;}
 
+inline unsigned short CConfig::GetnNewtonIter_ImplicitDG(void) {return nNewtonIter_ImplicitDG;}
+
+inline unsigned short CConfig::GetJacobianFreq_ImplicitDG(void) {return JacobianFreq_ImplicitDG;}
+
+inline unsigned short CConfig::GetTimeOrder_ImplicitDG(void) {return TimeOrder_ImplicitDG;}
+
+inline unsigned long CConfig::GetnIterMeasureWorkDG(void) {return nIterMeasureWorkDG;}
+
+inline bool CConfig::GetUse_Measured_Work_DG(void) {return Use_Measured_Work_DG;}
+
+inline bool CConfig::GetRepartition_Measured_Work_DG(void) {return Repartition_Measured_Work_DG;}
+
+inline void CConfig::SetnIterMeasureWorkDG(unsigned long val_nIter) {nIterMeasureWorkDG = val_nIter;}
+
+inline void CConfig::SetUse_Measured_Work_DG(bool val_use) {Use_Measured_Work_DG = val_use;}
+
+inline string CConfig::GetWork_Weights_DG_FileName(void) {return Work_Weights_DG_FileName;}
+
+inline bool CConfig::GetCompact_Metric_Affine_DG(void) {return Compact_Metric_Affine_DG;}
+
+inline bool CConfig::GetSinglePrec_Metric_DG(void) {return SinglePrec_Metric_DG;}
+
 inline bool CConfig::GetWeakly_Coupled_Heat(void) { return Weakly_Coupled_Heat; }
 
 inline bool CConfig::GetIntegrated_HeatFlux(void) { return Integrated_HeatFlux; }
@@ -2016,6 +2074,8 @@ inline void CConfig::SetHistFile(ofstream *HistFile) { ConvHistFile = HistFile;
 
 inline bool CConfig::GetTopology_Optimization(void) const { return topology_optimization; }
 
+inline bool CConfig::GetCache_Elem_Stiffness(void) const { return Cache_Elem_Stiffness; }
+
 inline string CConfig::GetTopology_Optim_FileName(void) const { return top_optim_output_file; }
 
 inline su2double CConfig::GetSIMP_Exponent(void) const { return simp_exponent; }
@@ -289,6 +289,12 @@ public:
                                                         integration points of this element. */
   vector<su2double> metricTermsSolDOFs;     /*!< \brief Vector of the metric terms in the
                                                         solution DOFs of this element. */
+  bool metricTermsAffine;                   /*!< \brief Whether or not the metric terms are constant, such that
+                                                        only the values of the first integration point and
+                                                        solution DOF are stored. */
+  vector<float> metricTermsSinglePrec;      /*!< \brief Vector of the metric terms in the integration points
+                                                        stored in single precision. When used, metricTerms
+                                                        is empty. */
   vector<su2double> metricTerms2ndDer;      /*!< \brief Vector of the metric terms needed for the
                                                         computation of the 2nd derivatives in the
                                                         integration points. Only determined when
@@ -330,6 +336,33 @@ public:
   void GetCornerPointsAllFaces(unsigned short &numFaces,
                                unsigned short nPointsPerFace[],
                                unsigned long  faceConn[6][4]);
+
+  /*!
+   * \brief Function, which makes available the metric terms in the integration
+            points, independent of the storage format of the metric terms. The
+            metric terms of integration point i start at i*strideMetric. Hence the
+            storage format is checked once per element and not per integration point.
+   * \param[in]  nMetricPerPoint - Number of metric terms per point.
+   * \param[out] metricBuf       - Buffer of nInt*nMetricPerPoint entries. When the metric terms
+                                   are stored in single precision, they are converted into this
+                                   buffer, which is returned.
+   * \param[out] strideMetric    - Distance between the metric terms of consecutive integration
+                                   points, which is zero for an affine element.
+   * \return Pointer to the metric terms of the first integration point.
+   */
+  const su2double *GetMetricTermsInt(const unsigned short nMetricPerPoint,
+                                     su2double            *metricBuf,
+                                     unsigned short       &strideMetric) const;
+
+  /*!
+   * \brief Function, which makes available the metric terms in the solution DOFs.
+   * \param[in]  nMetricPerPoint - Number of metric terms per point.
+   * \param[out] strideMetric    - Distance between the metric terms of consecutive
+                                   solution DOFs, which is zero for an affine element.
+   * \return Pointer to the metric terms of the first solution DOF.
+   */
+  const su2double *GetMetricTermsSolDOFs(const unsigned short nMetricPerPoint,
+                                         unsigned short       &strideMetric) const;
 };
 
 /*!
@@ -502,6 +535,8 @@ public:
                                                                 for the wall function treatment. */
   vector<vector<su2double> > matWallFunctionDonor;  /*!< \brief Matrices, which store the interpolation coefficients
                                                                 for the donors of the integration points.*/
+  unsigned long indIntWallModel;                    /*!< \brief Index of the first integration point of this face
+                                                                in the data stored in the wall model. */
 
   /*!
    * \brief Constructor of the class. Initialize some variables.
@@ -1018,6 +1053,15 @@ public:
   */
   void LengthScaleVolumeElements(void);
 
+ /*!
+  * \brief Function, which reduces the memory of the metric terms of the volume
+           elements. For affine elements only one set of metric terms is stored
+           and for the other elements the metric terms in the integration points
+           may be stored in single precision, depending on the input options.
+  * \param[in] config - Definition of the particular problem.
+  */
+  void CompressMetricTermsVolumeElements(CConfig *config);
+
  /*!
   * \brief Function, which computes the metric terms of the surface
            elements, both internal faces and physical boundary faces.
@@ -68,10 +68,30 @@ inline CSortBoundaryFaces::CSortBoundaryFaces() { }
 
 inline CSortBoundaryFaces::~CSortBoundaryFaces() { }
 
-inline CVolumeElementFEM::CVolumeElementFEM(void) { }
+inline CVolumeElementFEM::CVolumeElementFEM(void) { metricTermsAffine = false; }
 
 inline CVolumeElementFEM::~CVolumeElementFEM(void) { }
 
+inline const su2double* CVolumeElementFEM::GetMetricTermsInt(const unsigned short nMetricPerPoint,
+                                                             su2double            *metricBuf,
+                                                             unsigned short       &strideMetric) const {
+  strideMetric = metricTermsAffine ? 0 : nMetricPerPoint;
+
+  if( metricTermsSinglePrec.size() ) {
+    for(unsigned long i=0; i<metricTermsSinglePrec.size(); ++i)
+      metricBuf[i] = metricTermsSinglePrec[i];
+    return metricBuf;
+  }
+
+  return metricTerms.data();
+}
+
+inline const su2double* CVolumeElementFEM::GetMetricTermsSolDOFs(const unsigned short nMetricPerPoint,
+                                                                 unsigned short       &strideMetric) const {
+  strideMetric = metricTermsAffine ? 0 : nMetricPerPoint;
+  return metricTermsSolDOFs.data();
+}
+
 inline CPointFEM::CPointFEM(void) { coor[0] = coor[1] = coor[2] = 0.0; }
 
 inline CPointFEM::~CPointFEM(void) { }
@@ -88,7 +108,7 @@ inline CInternalFaceElementFEM::CInternalFaceElementFEM(const CInternalFaceEleme
 
 inline CInternalFaceElementFEM& CInternalFaceElementFEM::operator=(const CInternalFaceElementFEM &other) { Copy(other); return (*this); }
 
-inline CSurfaceElementFEM::CSurfaceElementFEM(void) {indStandardElement = -1;}
+inline CSurfaceElementFEM::CSurfaceElementFEM(void) {indStandardElement = -1; indIntWallModel = 0;}
 
 inline CSurfaceElementFEM::~CSurfaceElementFEM(void) { }
 
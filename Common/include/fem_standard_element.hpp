@@ -845,6 +845,18 @@ private:
                                                           Used for plotting. */
   vector<unsigned short> subConn2ForPlotting; /*!< \brief Local subconnectivity of element type 2 of the high order element.
                                                           Used for plotting. */
+
+  bool sumFactorization;  /*!< \brief Whether or not the tensor product structure of the basis functions is exploited
+                                      (sum factorization). Only possible for quadrilaterals and hexahedra. */
+  unsigned short nDOFs1D; /*!< \brief Number of DOFs in one parametric direction, if sumFactorization is true. */
+  unsigned short nInt1D;  /*!< \brief Number of integration points in one parametric direction, if sumFactorization is true. */
+
+  vector<su2double> lagBasisInt1D;    /*!< \brief 1D Lagrangian basis functions in the 1D integration points, stored as a
+                                                  row major nInt1D x nDOFs1D matrix. */
+  vector<su2double> derLagBasisInt1D; /*!< \brief Derivatives of lagBasisInt1D, stored in the same way. */
+  vector<su2double> der2LagBasisInt1D; /*!< \brief Second derivatives of lagBasisInt1D, stored in the same way. */
+  vector<su2double> derLagBasisSolDOFs1D; /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D DOFs,
+                                                      stored as a row major nDOFs1D x nDOFs1D matrix. */
 public:
   /*!
   * \brief Standard Constructor. Nothing to be done.
@@ -1117,6 +1129,85 @@ public:
   */
   su2double WorkEstimateMetis(CConfig *config);
 
+  /*!
+  * \brief Function, which indicates whether or not sum factorization can be used for this standard element.
+  * \return True for quadrilaterals and hexahedra with tensor product DOFs and integration points.
+  */
+  bool GetSumFactorization(void) const;
+
+  /*!
+  * \brief Function, which returns the size of the work array needed by the sum factorization
+           functions, per unit of the number of right hand sides N.
+  * \return The required size, which is zero if sum factorization is not possible.
+  */
+  unsigned int GetSizeWorkSumFact(void) const;
+
+  /*!
+  * \brief Function, which computes the data in the integration points from the data in the DOFs
+           by applying the 1D basis functions direction by direction. The result is identical to
+           the matrix product with GetMatBasisFunctionsIntegration, but the costs scale with
+           nPoly^(nDim+1) instead of nPoly^(2 nDim).
+  * \param[in]  N           - Number of right hand sides, i.e. the padded number of variables.
+  * \param[in]  derivatives - Whether or not the parametric derivatives must be computed as well.
+  * \param[in]  dataDOFs    - The data in the DOFs, nDOFs x N, row major.
+  * \param[out] dataInt     - The data in the integration points, row major. If derivatives are computed
+                              the value, r-, s- and t-derivatives are stored consecutively, each
+                              nIntegration x N.
+  * \param[in]  work        - Work array of size N*GetSizeWorkSumFact().
+  */
+  void SumFactDOFsToInt(const unsigned short N,
+                        const bool           derivatives,
+                        const su2double      *dataDOFs,
+                        su2double            *dataInt,
+                        su2double            *work) const;
+
+  /*!
+  * \brief Function, which integrates data given in the integration points against the basis functions
+           or their parametric derivatives, using sum factorization. The result is identical to
+           the matrix product with GetBasisFunctionsIntegrationTrans or GetDerMatBasisFunctionsIntTrans.
+  * \param[in]  N           - Number of right hand sides, i.e. the padded number of variables.
+  * \param[in]  derivatives - False: multiply with the basis functions, dataInt is nIntegration x N.
+                              True: multiply with the derivatives of the basis functions, dataInt
+                              is (nIntegration*nDim) x N, where the row index is iInt*nDim + iDim.
+  * \param[in]  dataInt     - The data in the integration points.
+  * \param[out] dataDOFs    - The result in the DOFs, nDOFs x N, row major.
+  * \param[in]  work        - Work array of size N*GetSizeWorkSumFact().
+  */
+  void SumFactIntToDOFs(const unsigned short N,
+                        const bool           derivatives,
+                        const su2double      *dataInt,
+                        su2double            *dataDOFs,
+                        su2double            *work) const;
+
+  /*!
+  * \brief Function, which computes the first or second parametric derivatives in the integration points
+           from the data in the DOFs via sum factorization. The result is identical to the matrix product
+           with the derivative part of GetMatBasisFunctionsIntegration or with GetMat2ndDerBasisFunctionsInt.
+  * \param[in]  N                 - Number of right hand sides, i.e. the padded number of variables.
+  * \param[in]  secondDerivatives - False: the r-, s- and t-derivatives are computed.
+                                    True: the rr-, rs-, ss-, rt-, st- and tt-derivatives are computed.
+  * \param[in]  dataDOFs          - The data in the DOFs, nDOFs x N, row major.
+  * \param[out] dataInt           - The derivatives in the integration points, stored consecutively,
+                                    each nIntegration x N.
+  * \param[in]  work              - Work array of size N*GetSizeWorkSumFact().
+  */
+  void SumFactDOFsToDerInt(const unsigned short N,
+                           const bool           secondDerivatives,
+                           const su2double      *dataDOFs,
+                           su2double            *dataInt,
+                           su2double            *work) const;
+
+  /*!
+  * \brief Function, which computes the parametric derivatives in the solution DOFs via sum factorization.
+           The result is identical to the matrix product with GetMatDerBasisFunctionsSolDOFs.
+  * \param[in]  N        - Number of right hand sides, i.e. the padded number of variables.
+  * \param[in]  dataDOFs - The data in the DOFs, nDOFs x N, row major.
+  * \param[out] derDOFs  - The r-, s- and t-derivatives in the DOFs, stored consecutively, each nDOFs x N.
+  */
+  void SumFactDerSolDOFs(const unsigned short N,
+                         const su2double      *dataDOFs,
+                         su2double            *derDOFs) const;
+
 private:
   /*!
   * \brief Function, which changes the given quadrilateral connectivity, such that the direction coincides
@@ -1228,6 +1319,37 @@ private:
            order hexahedron.
   */
   void SubConnHexahedron(void);
+
+  /*!
+  * \brief Function, which creates the 1D basis functions needed for sum factorization and checks
+           whether the tensor product of them reproduces matBasisIntegration, mat2ndDerBasisInt and
+           matDerBasisSolDOFs. If so, sumFactorization is set to true.
+  */
+  void SetSumFactorization(void);
+
+  /*!
+  * \brief Function, which applies a 1D matrix in one parametric direction of tensor product data.
+  * \param[in]  N          - Number of right hand sides.
+  * \param[in]  dir        - Parametric direction to which the matrix is applied.
+  * \param[in]  nIn        - Number of points of the input data in the three parametric directions.
+  * \param[in]  nOut       - Number of points of the output data in direction dir.
+  * \param[in]  mat        - 1D matrix, either nOut x nIn[dir] or, if transMat, nIn[dir] x nOut.
+  * \param[in]  transMat   - Whether or not the transpose of mat must be applied.
+  * \param[in]  dataIn     - Input data.
+  * \param[in]  strideIn   - Distance between the N values of consecutive input points.
+  * \param[out] dataOut    - Output data, stored with a distance N between consecutive points.
+  * \param[in]  addToOut   - Whether the result is added to dataOut or overwrites it.
+  */
+  void TensorProductDirection(const unsigned short N,
+                              const unsigned short dir,
+                              const unsigned short *nIn,
+                              const unsigned short nOut,
+                              const su2double      *mat,
+                              const bool           transMat,
+                              const su2double      *dataIn,
+                              const unsigned short strideIn,
+                              su2double            *dataOut,
+                              const bool           addToOut) const;
 };
 
 /*!
@@ -43,7 +43,7 @@ inline unsigned short CFEMStandardElementBase::GetNIntegration(void) const {retu
 
 inline unsigned short CFEMStandardElementBase::GetOrderExact(void){return orderExact;}
 
-inline CFEMStandardElement::CFEMStandardElement(){}
+inline CFEMStandardElement::CFEMStandardElement(){sumFactorization = false; nDOFs1D = nInt1D = 0;}
 
 inline CFEMStandardElement::~CFEMStandardElement(){}
 
@@ -91,6 +91,13 @@ inline unsigned short CFEMStandardElement::GetNDOFs(void) const {return nDOFs;}
 
 inline unsigned short CFEMStandardElement::GetNPoly(void) const {return nPoly;}
 
+inline bool CFEMStandardElement::GetSumFactorization(void) const {return sumFactorization;}
+
+inline unsigned int CFEMStandardElement::GetSizeWorkSumFact(void) const {
+  if( !sumFactorization ) return 0;
+  return 5*max(nIntegration, nDOFs);
+}
+
 inline unsigned short CFEMStandardElement::GetVTK_Type1(void) const {return VTK_Type1;}
 
 inline unsigned short CFEMStandardElement::GetNSubElemsType1(void) const {return subConn1ForPlotting.size()/GetNDOFsPerSubElem(GetVTK_Type1());}
@@ -303,6 +303,20 @@ protected:
   su2double **CustomBoundaryTemperature;
   su2double **CustomBoundaryHeatFlux;
 
+  /*--- Data of the element filter, built on the first call of FilterValuesAtElementCG and reused ---*/
+  vector<su2double> Filter_Radius;                                  /*!< \brief Radii for which the filter data was built. */
+  vector<pair<unsigned short,su2double> > Filter_Kernels;           /*!< \brief Kernels for which the filter data was built. */
+  unsigned long Filter_nElemGhost;                                  /*!< \brief Number of elements of other partitions within the filter radius. */
+  vector<int> Filter_Send_Rank,                                     /*!< \brief Ranks to which element values are sent. */
+  Filter_Recv_Rank;                                                 /*!< \brief Ranks from which element values are received. */
+  vector<unsigned long> Filter_Send_Start,                          /*!< \brief Start of the elements sent to each rank in Filter_Send_Elem. */
+  Filter_Send_Elem,                                                 /*!< \brief Local elements sent to other ranks. */
+  Filter_Recv_Start,                                                /*!< \brief Start of the elements received from each rank in Filter_Recv_Slot. */
+  Filter_Recv_Slot;                                                 /*!< \brief Position of the received elements in the filter work array. */
+  vector<vector<unsigned long> > Filter_Neighbour_Start,            /*!< \brief Start of the neighbours of each element, per kernel. */
+  Filter_Neighbour_Idx;                                             /*!< \brief Neighbours of each element (position in the work array), per kernel. */
+  vector<vector<su2double> > Filter_Weight;                         /*!< \brief Weights (distance and volume) of the neighbours, per kernel. */
+
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
 	string *Tag_to_Marker;	/*!< \brief If you know the index of the boundary (depend of the 
@@ -594,6 +608,12 @@ public:
 	 */
 	virtual void ComputeWall_Distance(CConfig *config);
 
+	/*!
+	 * \brief A virtual member.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void UpdateWall_Distance(CConfig *config);
+
 	/*! 
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.		 
@@ -961,6 +981,57 @@ public:
                               vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
                               bool original_surface, CConfig *config);
 
+  /*!
+   * \brief Compute the sections of several planes at once, the surface elements are indexed along the normal
+   *        of the planes and each plane is assembled by a different rank (the results are stored in the master node).
+   * \param[in] nPlane - Number of planes.
+   * \param[in] Plane_P0 - Point of each plane.
+   * \param[in] Plane_Normal - Normal of each plane.
+   * \param[in] FlowVariable - Variable to be interpolated in the sections (or NULL).
+   * \param[out] Xcoord_Airfoil - Coordinates and variable of the section of each plane (nPlane vectors).
+   * \param[in] original_surface - Use the original surface (no deformation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAirfoil_Sections(unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                               su2double MinXCoord, su2double MaxXCoord,
+                               su2double MinYCoord, su2double MaxYCoord,
+                               su2double MinZCoord, su2double MaxZCoord,
+                               su2double *FlowVariable,
+                               vector<su2double> *Xcoord_Airfoil, vector<su2double> *Ycoord_Airfoil,
+                               vector<su2double> *Zcoord_Airfoil, vector<su2double> *Variable_Airfoil,
+                               bool original_surface, CConfig *config);
+
+  /*!
+   * \brief Intersect a plane with a surface element and store the edge of the section (if any).
+   * \param[in] Coord_Variation - Displacement of the points (nPoint*nDim), NULL for the original surface.
+   * \param[out] Edge_Coord - Coordinates of the two points of the edge (6 values per edge).
+   * \param[out] Edge_Variable - Variable at the two points of the edge (2 values per edge).
+   * \param[out] Edge_GlobalID - Global index of the surface edges that contain the points (4 values per edge).
+   */
+  void ComputeAirfoil_SectionElem(unsigned short iMarker, unsigned long iElem,
+                                  su2double *Plane_P0, su2double *Plane_Normal,
+                                  su2double MinXCoord, su2double MaxXCoord,
+                                  su2double MinYCoord, su2double MaxYCoord,
+                                  su2double MinZCoord, su2double MaxZCoord,
+                                  su2double *FlowVariable, su2double *Coord_Variation, CConfig *config,
+                                  vector<su2double> &Edge_Coord, vector<su2double> &Edge_Variable,
+                                  vector<unsigned long> &Edge_GlobalID);
+
+  /*!
+   * \brief Connect the edges of a section (all the ranks) into an ordered curve starting at the trailing edge.
+   * \param[in] Plane_Normal - Normal of the plane.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Edge_Coord - Coordinates of the edges of the section.
+   * \param[in] Edge_Variable - Variable at the edges of the section.
+   * \param[in] Edge_GlobalID - Global index of the surface edges.
+   * \param[out] Xcoord_Airfoil - Coordinates and variable of the ordered section.
+   */
+  void AssembleAirfoil_Section(su2double *Plane_Normal, CConfig *config,
+                               vector<su2double> &Edge_Coord, vector<su2double> &Edge_Variable,
+                               vector<unsigned long> &Edge_GlobalID,
+                               vector<su2double> &Xcoord_Airfoil, vector<su2double> &Ycoord_Airfoil,
+                               vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil);
+
   /*!
 	 * \brief A virtual member.
 	 */
@@ -1313,8 +1384,9 @@ public:
   /*!
    * \brief A virtual member.
    * \param config - Config
+   * \param[in] val_iObj - Index of the objective function whose sensitivity is read (all of them by default).
    */
-  virtual void SetSensitivity(CConfig *config);
+  virtual void SetSensitivity(CConfig *config, short val_iObj = -1);
 
   /*!
    * \brief A virtual member.
@@ -1540,29 +1612,22 @@ public:
    * \param[out] output_values - Filtered values.
    */
   void FilterValuesAtElementCG(const vector<su2double> filter_radius, const vector<pair<unsigned short,su2double> > &kernels,
-                               const su2double *input_values, su2double *output_values) const;
+                               const su2double *input_values, su2double *output_values);
   
   /*!
-   * \brief Build the global (entire mesh!) adjacency matrix for the elements in compressed format.
-   *        Used by FilterValuesAtElementCG to search for geometrically close neighbours.
-   * \param[out] neighbour_start - i'th position stores the start position in "neighbour_idx" for the immediate
-   *             neighbours of global element "i". Size nElemDomain+1
-   * \param[out] neighbour_idx - Global index of the neighbours, mush be NULL on entry and free'd by calling function.
+   * \brief Build the data used by FilterValuesAtElementCG: the exchange pattern for the elements of other partitions
+   *        that are within the filter radius of the local ones, and the neighbours and weights of each element per kernel.
+   * \param[in] filter_radius - Parameter defining the size of the neighbourhood of each kernel.
+   * \param[in] kernels - Kernel types and respective parameter.
    */
-  void GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour_start, long *&neighbour_idx) const;
+  void SetFilterNeighbourhood(const vector<su2double> &filter_radius, const vector<pair<unsigned short,su2double> > &kernels);
   
   /*!
-   * \brief Get the neighbours of the global element in the first position of "neighbours" that are within "radius" of it.
-   * \param[in] iElem_global - Element of interest.
-   * \param[in] radius - Parameter defining the size of the neighbourhood.
-   * \param[in] neighbour_start - See GetGlobalElementAdjacencyMatrix.
-   * \param[in] neighbour_idx - See GetGlobalElementAdjacencyMatrix.
-   * \param[in] cg_elem - Global element centroid coordinates in row major format {x0,y0,x1,y1,...}. Size nDim*nElemDomain.
-   * \param[in,out] neighbours - The neighbours of iElem_global.
+   * \brief Send the values of the local elements that other partitions need to filter theirs, and receive
+   *        the values of the elements of other partitions that are needed locally.
+   * \param[in,out] values - Values of the local elements followed by those of the elements of other partitions.
    */
-  void GetRadialNeighbourhood(const unsigned long iElem_global, const passivedouble radius,
-                              const vector<unsigned long> &neighbour_start, const long *neighbour_idx,
-                              const su2double *cg_elem, vector<long> &neighbours) const;
+  void ExchangeFilterValues(vector<su2double> &values) const;
 
   /*!
    * \brief Compute and store the volume of the elements.
@@ -1646,6 +1711,9 @@ class CPhysicalGeometry : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  vector<su2double> Coord_WallDistRef; /*!< \brief Coordinates of the points for which the wall distance was computed from scratch. */
+  vector<su2double> WallDistRef;       /*!< \brief Wall distance of the points in the reference state of Coord_WallDistRef. */
+
 public:
   
 	/*!
@@ -1881,6 +1949,24 @@ public:
 	 */
 	void ComputeWall_Distance(CConfig *config);
 
+	/*!
+	 * \brief Updates the wall distance after a motion of the grid. Only the points
+	 *        for which the bound on the change of the wall distance exceeds the
+	 *        tolerance are searched again.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void UpdateWall_Distance(CConfig *config);
+
+	/*!
+	 * \brief Computes the wall distance of the given points with a parallel search.
+	 *        The wall elements are not gathered on all ranks. Instead, the ranks whose
+	 *        wall bounding box may contain a closer element are searched with their local ADT.
+	 * \param[in] config   - Definition of the particular problem.
+	 * \param[in] pointIDs - Local IDs of the points for which the wall distance must be computed.
+	 */
+	void ComputeWall_Distance_Points(CConfig                     *config,
+	                                 const vector<unsigned long> &pointIDs);
+
 	/*! 
 	 * \brief Compute surface area (positive z-direction) for force coefficient non-dimensionalization.
 	 * \param[in] config - Definition of the particular problem.
@@ -2451,8 +2537,9 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
   /*!
    * \brief Read the sensitivity from adjoint solution file and store it.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iObj - Index of the objective function whose sensitivity is read (all of them by default).
    */
-  void SetSensitivity(CConfig *config);
+  void SetSensitivity(CConfig *config, short val_iObj = -1);
 
   /*!
    * \brief Read the sensitivity from unordered ASCII adjoint solution file and store it.
@@ -157,6 +157,8 @@ inline void CGeometry::SetBoundaries(CConfig *config) { }
 
 inline void CGeometry::ComputeWall_Distance(CConfig *config) { }
 
+inline void CGeometry::UpdateWall_Distance(CConfig *config) { ComputeWall_Distance(config); }
+
 inline void CGeometry::SetPositive_ZArea(CConfig *config) { }
 
 inline void CGeometry::SetPoint_Connectivity(void) { }
@@ -478,7 +480,7 @@ inline vector<vector<unsigned long> > CPhysicalGeometry::GetPlanarPoints() { ret
 
 inline vector<vector<unsigned long> > CMultiGridGeometry::GetPlanarPoints() { return Plane_points; }
 
-inline void CGeometry::SetSensitivity(CConfig* config) {}
+inline void CGeometry::SetSensitivity(CConfig* config, short val_iObj) {}
 
 inline void CGeometry::ReadUnorderedSensitivity(CConfig* config) {}
 
@@ -314,6 +314,16 @@ public:
 
   CFreeFormBlending** BlendingFunction;
 
+  vector<su2double> Basis[3],           /*!< \brief Blending functions at the current parametric point (i, j, k directions). */
+  Basis_Der1[3], Basis_Der2[3];         /*!< \brief First and second derivatives of the blending functions at the current parametric point. */
+  vector<passivedouble> InvLattice_Param, /*!< \brief Parametric coordinates of the samples of the point inversion lattice. */
+  InvLattice_Coord;                     /*!< \brief Cartesian coordinates of the samples of the point inversion lattice. */
+  vector<unsigned long> InvBucket_Start,  /*!< \brief Offset of each lookup bucket in InvBucket_Sample. */
+  InvBucket_Sample;                     /*!< \brief Lattice samples sorted by lookup bucket. */
+  unsigned long nInvBucket[3];          /*!< \brief Number of lookup buckets in each cartesian direction. */
+  passivedouble InvBucket_Min[3],       /*!< \brief Lower corner of the lookup buckets. */
+  InvBucket_Delta[3];                   /*!< \brief Size of the lookup buckets in each cartesian direction. */
+
 
 public:
 	
@@ -830,6 +840,37 @@ public:
 	 * \param[in] val_Hessian - Value of the hessian.
 	 */
   void GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian);
+
+  /*!
+   * \brief Evaluate the blending functions (and their derivatives) of the three directions at a parametric point.
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[in] val_order - Highest order of the derivatives that are evaluated (0, 1 or 2).
+   */
+  void SetBasis(su2double *uvw, unsigned short val_order);
+
+  /*!
+   * \brief Compute the gradient and the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 in a single
+   *        sweep over the control points (same result as GetFFDGradient and GetFFDHessian).
+   * \param[in] uvw - Current value of the parametrics coordinates.
+   * \param[in] xyz - Cartesians coordinates of the target point to compose the functional.
+   * \param[out] val_Gradient - Value of the gradient.
+   * \param[out] val_Hessian - Value of the hessian.
+   */
+  void GetFFDGradientHessian(su2double *uvw, su2double *xyz, su2double *val_Gradient, su2double **val_Hessian);
+
+  /*!
+   * \brief Sample the current FFD map on a uniform parametric lattice and sort the samples
+   *        in cartesian buckets, used to provide initial guesses for the point inversion.
+   */
+  void SetInversionLattice(void);
+
+  /*!
+   * \brief Initial guess of the point inversion, i.e. the parametric coordinates of the lattice
+   *        sample that is closest to a cartesian point.
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[out] val_guess - Parametric coordinates of the closest lattice sample.
+   */
+  void GetInversionGuess(su2double *xyz, su2double *val_guess);
   
 	/*! 
 	 * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
@@ -971,6 +1012,11 @@ protected:
   CSysVector LinSysSol;
   CSysVector LinSysRes;
 
+  bool stiffness_cache;   /*!< \brief The stiffness of the first deformation is stored and reused. */
+  bool stiffness_stored;  /*!< \brief The stiffness has already been stored. */
+  bool prec_built;        /*!< \brief A preconditioner of the stored stiffness is kept in StiffMatrix. */
+  bool prec_transposed;   /*!< \brief The preconditioner kept in StiffMatrix is the one of the transposed system. */
+
 public:
 
   /*!
@@ -1347,6 +1393,10 @@ protected:
   su2double **D_Mat;            /*!< \brief Constitutive matrix - Auxiliary. */
   su2double **GradNi_Ref_Mat;   /*!< \brief Gradients of Ni - Auxiliary. */
 
+  vector<su2double> Elem_Stiffness;             /*!< \brief Upper triangular blocks (jNode >= iNode) of the element stiffness. */
+  vector<unsigned long> Elem_Stiffness_Offset;  /*!< \brief Position of the first block of each element in Elem_Stiffness. */
+  vector<unsigned short> Elem_Stiffness_nNodes; /*!< \brief Number of nodes of each element with stored stiffness. */
+
 public:
 
   CElement** element_container;  /*!< \brief Container which stores the element information. */
@@ -1711,6 +1761,28 @@ public:
 	 * \param[in] FFDBox - Array with all the free forms FFDBoxes of the computation.
 	 */		
 	void SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox);
+
+  /*!
+   * \brief Read the parametric coordinates stored by a previous point inversion of a FFD box.
+   *        The file is discarded if the FFD box does not match the current one.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] FFDBox - Free form FFDBox that is inverted.
+   * \param[out] val_index - Position of each stored global point in <i>val_data</i>.
+   * \param[out] val_data - Cartesian and parametric coordinates of the stored points.
+   * \return <code>TRUE</code> if the file exists and matches the FFD box; otherwise <code>FALSE</code>.
+   */
+  bool ReadParametricCoordCache(CConfig *config, CFreeFormDefBox *FFDBox, map<unsigned long, unsigned long> &val_index,
+                                vector<su2double> &val_data);
+
+  /*!
+   * \brief Gather the parametric coordinates of a FFD box on the master node and write them in a binary file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] FFDBox - Free form FFDBox that is inverted.
+   * \param[in] val_index - Global index of the local points.
+   * \param[in] val_data - Cartesian and parametric coordinates of the local points.
+   */
+  void WriteParametricCoordCache(CConfig *config, CFreeFormDefBox *FFDBox, vector<unsigned long> &val_index,
+                                 vector<su2double> &val_data);
 	
 	/*! 
 	 * \brief Update the parametric coordinates of a grid point using a point inversion strategy
@@ -306,6 +306,12 @@ public:
  * \brief Sliding mesh approach
   */
 class CSlidingMesh : public CInterpolator {
+private:
+  vector<vector<unsigned long> > StartDonor_Previous;  /*!< \brief For each interface marker and target vertex, reconstructed index of the donor vertex used as supermesh seed in the previous call. */
+  vector<vector<su2double> > StartDist_Previous;       /*!< \brief For each interface marker and target vertex, distance to the seed donor vertex of the previous call. */
+  vector<vector<su2double> > DonorCoord_Previous,      /*!< \brief For each interface marker, reconstructed donor coordinates of the previous call. */
+  TargetCoord_Previous;                                /*!< \brief For each interface marker, reconstructed target coordinates of the previous call. */
+
 public:
 
   /*!
@@ -391,6 +397,22 @@ public:
    * \param[in] T3 - third  point of triangle T
    */
   bool CheckPointInsideTriangle(su2double* Point, su2double* T1, su2double* T2, su2double* T3);
+
+  /*!
+   * \brief Walk over the reconstructed donor boundary, starting from a guess, towards the donor vertex closest to a point.
+   * \param[in] Point            - query point
+   * \param[in] startIndex       - donor vertex from which the walk starts
+   * \param[in] coord            - array containing the coordinates of all the donor boundary vertexes
+   * \param[in] map              - array containing the index of the boundary points connected to each vertex
+   * \param[in] startLinkedNodes - for each vertex the start index of its neighbours in map
+   * \param[in] nLinkedNodes     - for each vertex the number of its neighbouring vertexes
+   * \param[out] mindist         - distance between the point and the returned donor vertex
+   * \param[out] maxEdge         - length of the longest boundary edge attached to the returned donor vertex
+   * \return Index of the donor vertex at which the walk stops, i.e. a local minimum of the distance
+   */
+  unsigned long WalkToClosestDonor(su2double* Point, unsigned long startIndex, su2double* coord, unsigned long* map,
+                                   unsigned long* startLinkedNodes, unsigned long* nLinkedNodes,
+                                   su2double &mindist, su2double &maxEdge);
 };
 
 /*!
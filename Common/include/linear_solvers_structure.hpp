@@ -209,8 +209,9 @@ public:
    * \param[in] LinSysSol - Linear system solution
    * \param[in] geometry -  Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_reuse_prec - Skip the (re)construction of the preconditioner, the one stored in Jacobian from a previous call is used.
    */
-  unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
+  unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config, bool val_reuse_prec = false);
   
 
   /*!
@@ -43,6 +43,10 @@
 #include <map>
 #endif
 
+#ifdef HAVE_OMP
+#include <omp.h>
+#endif
+
 #include "./datatype_structure.hpp"
 #include <stdlib.h>
 #include <unistd.h>
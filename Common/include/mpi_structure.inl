@@ -127,7 +127,13 @@ inline CBaseMPIWrapper::Comm CBaseMPIWrapper::GetComm(){
 }
 
 inline void CBaseMPIWrapper::Init(int *argc, char ***argv) {
+#ifdef HAVE_OMP
+  /* Only the master thread carries out MPI calls. */
+  int provided;
+  MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided);
+#else
   MPI_Init(argc,argv);
+#endif
   MPI_Comm_rank(currentComm, &Rank);    
   MPI_Comm_size(currentComm, &Size);  
 
@@ -135,6 +141,15 @@ inline void CBaseMPIWrapper::Init(int *argc, char ***argv) {
   MPI_Win_create(&MinRankError, sizeof(int), sizeof(int), MPI_INFO_NULL,
                  currentComm, &winMinRankError);
   winMinRankErrorInUse = true;
+
+#ifdef HAVE_OMP
+  /* Multiple threads can only be used if the MPI library allows MPI calls
+     from the master thread while the other threads are active. */
+  if((provided < MPI_THREAD_FUNNELED) && (omp_get_max_threads() > 1))
+    Error(std::string("The MPI library does not provide MPI_THREAD_FUNNELED, which is needed ") +
+          std::string("when running with more than one OpenMP thread. Set OMP_NUM_THREADS=1."),
+          CURRENT_FUNCTION);
+#endif
 }
 
 inline void CBaseMPIWrapper::Buffer_attach(void *buffer, int size){
@@ -121,6 +121,7 @@ const unsigned int MAX_TERMS = 6;		         /*!< \brief Maximum number of terms
 const unsigned int MAX_TERMS_FEA = 10;       /*!< \brief Maximum number of terms in the numerical equations (dimension of solver container array). */
 const unsigned int MAX_ZONES = 3;            /*!< \brief Maximum number of zones. */
 const unsigned int MAX_FE_KINDS = 4;            	/*!< \brief Maximum number of Finite Elements. */
+const unsigned short FEA_BATCH_SIZE = 8;          /*!< \brief Number of structural elements evaluated together by the batched kernels. */
 const unsigned int NO_RK_ITER = 0;		       /*!< \brief No Runge-Kutta iteration. */
 
 const unsigned int OVERHEAD = 4; /*!< \brief Overhead space above nMarker when allocating space for boundary elems (MPI + periodic). */
@@ -549,7 +550,8 @@ enum ENUM_FLUIDMODEL {
 	PR_GAS = 3,
   CONSTANT_DENSITY = 4,
   INC_IDEAL_GAS = 5,
-  INC_IDEAL_GAS_POLY = 6
+  INC_IDEAL_GAS_POLY = 6,
+  LUT_GAS = 7
 };
 
 static const map<string, ENUM_FLUIDMODEL> FluidModel_Map = CCreateMap<string, ENUM_FLUIDMODEL>
@@ -559,7 +561,8 @@ static const map<string, ENUM_FLUIDMODEL> FluidModel_Map = CCreateMap<string, EN
 ("PR_GAS", PR_GAS)
 ("CONSTANT_DENSITY", CONSTANT_DENSITY)
 ("INC_IDEAL_GAS", INC_IDEAL_GAS)
-("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY);
+("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY)
+("LUT_GAS", LUT_GAS);
 
 /*!
  * \brief types of density models
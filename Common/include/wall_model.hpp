@@ -41,6 +41,10 @@
 
 using namespace std;
 
+/*--- Number of exchange points that are treated simultaneously in the
+      batched versions of the wall models. ---*/
+#define N_LANES_WALL_MODEL 8
+
 /*!
  * \class CWallModel
  * \brief Base class for defining the LES wall model.
@@ -101,9 +105,57 @@ public:
                                                 su2double &qWall,
                                                 su2double &ViscosityWall,
                                                 su2double &kOverCvWall);
+
+  /*!
+   * \brief Virtual function, which computes the wall shear stress and heat flux
+            for a batch of exchange points. The default implementation calls
+            the point-wise version for every exchange point.
+   * \param[in]  nPoints                - Number of exchange points in the batch.
+   * \param[in]  indFirstPoint          - Index of the first exchange point of the batch
+                                          in the data stored in the wall model.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[out] tauWall                - Wall shear stresses, to be computed.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  virtual void WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                          const unsigned long  indFirstPoint,
+                                          const su2double      *tExchange,
+                                          const su2double      *velExchange,
+                                          const su2double      *muExchange,
+                                          const su2double      *pExchange,
+                                          const su2double      Wall_HeatFlux,
+                                          const bool           HeatFlux_Prescribed,
+                                          const su2double      Wall_Temperature,
+                                          const bool           Temperature_Prescribed,
+                                                su2double      *tauWall,
+                                                su2double      *qWall,
+                                                su2double      *ViscosityWall,
+                                                su2double      *kOverCvWall);
+
+  /*!
+   * \brief Function, which allocates the memory to store the wall shear stresses
+            of the exchange points, which are used as initial guess in the
+            next evaluation of the batched wall model.
+   * \param[in] nExchangePoints - Number of exchange points treated by this wall model.
+   */
+  void SetNExchangePoints(const unsigned long nExchangePoints);
+
 protected:
 
   su2double h_wm; /*!< \brief The thickness of the wall model. This is also basically the exchange location */
+
+  vector<su2double> tauWallPrevious; /*!< \brief The wall shear stresses of the previous evaluation in the
+                                                  exchange points. A zero value means that no guess is available. */
 };
 
 class CWallModel1DEQ : public CWallModel {
@@ -160,6 +212,44 @@ public:
                                         su2double &ViscosityWall,
                                         su2double &kOverCvWall);
 
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for
+            a batch of exchange points. The points are treated simultaneously
+            in N_LANES_WALL_MODEL lanes, such that the loops over the lanes can
+            be vectorized, and the converged lanes are masked. The wall shear
+            stress of the previous evaluation is used as initial guess.
+   * \param[in]  nPoints                - Number of exchange points in the batch.
+   * \param[in]  indFirstPoint          - Index of the first exchange point of the batch
+                                          in the data stored in the wall model.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[out] tauWall                - Wall shear stresses, to be computed.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  void WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                  const unsigned long  indFirstPoint,
+                                  const su2double      *tExchange,
+                                  const su2double      *velExchange,
+                                  const su2double      *muExchange,
+                                  const su2double      *pExchange,
+                                  const su2double      Wall_HeatFlux,
+                                  const bool           HeatFlux_Prescribed,
+                                  const su2double      Wall_Temperature,
+                                  const bool           Temperature_Prescribed,
+                                        su2double      *tauWall,
+                                        su2double      *qWall,
+                                        su2double      *ViscosityWall,
+                                        su2double      *kOverCvWall);
+
 private:
 
   su2double expansionRatio;   /*!< \brief  Stretching factor used for the wall model grid. */
@@ -167,6 +257,30 @@ private:
 
   vector<su2double> y_cv;    /*!< \brief  The coordinates in normal direction of the wall model grid (control volumes). */
   vector<su2double> y_fa;    /*!< \brief  The coordinates in normal direction of the wall model grid (faces of CV). */
+
+  vector<su2double> TLanes;        /*!< \brief  Temperatures on the faces for the lanes of the batched version. */
+  vector<su2double> muFaLanes;     /*!< \brief  Total viscosities on the faces for the lanes of the batched version. */
+  vector<su2double> tmpLanes;      /*!< \brief  Temporary face data for the lanes of the batched version. */
+  vector<su2double> uLanes;        /*!< \brief  Velocities in the control volumes for the lanes of the batched version. */
+  vector<su2double> lowerLanes;    /*!< \brief  Lower diagonals of the tridiagonal systems of the batched version. */
+  vector<su2double> upperLanes;    /*!< \brief  Upper diagonals of the tridiagonal systems of the batched version. */
+  vector<su2double> diagonalLanes; /*!< \brief  Main diagonals of the tridiagonal systems of the batched version. */
+  vector<su2double> rhsLanes;      /*!< \brief  Right hand sides of the tridiagonal systems of the batched version. */
+
+  /*!
+   * \brief Function, which solves N_LANES_WALL_MODEL tridiagonal systems of size
+            numPoints simultaneously with the Thomas algorithm. The lane index
+            runs fastest in the arrays. The matrices are diagonally dominant,
+            hence no pivoting is needed.
+   * \param[in]     lower    - Lower diagonals.
+   * \param[in,out] diagonal - Main diagonals. Overwritten.
+   * \param[in]     upper    - Upper diagonals.
+   * \param[in,out] rhs      - On input the right hand sides, on output the solutions.
+   */
+  void SolveTridiagonalSystemsBatch(const su2double *lower,
+                                    su2double       *diagonal,
+                                    const su2double *upper,
+                                    su2double       *rhs);
 };
 
 class CWallModelLogLaw : public CWallModel {
@@ -222,7 +336,45 @@ public:
                                   su2double &qWall,
                                   su2double &ViscosityWall,
                                   su2double &kOverCvWall);
-  
+
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for
+            a batch of exchange points. The Newton iterations are carried out
+            simultaneously in N_LANES_WALL_MODEL lanes, such that the loops over
+            the lanes can be vectorized, and the converged lanes are masked. The
+            friction velocity of the previous evaluation is used as initial guess.
+   * \param[in]  nPoints                - Number of exchange points in the batch.
+   * \param[in]  indFirstPoint          - Index of the first exchange point of the batch
+                                          in the data stored in the wall model.
+   * \param[in]  tExchange              - Temperatures at the exchange locations.
+   * \param[in]  velExchange            - Velocities at the exchange locations.
+   * \param[in]  muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]  pExchange              - Pressures at the exchange locations.
+   * \param[in]  Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]  HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]  Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]  Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[out] tauWall                - Wall shear stresses, to be computed.
+   * \param[out] qWall                  - Wall heat fluxes, to be computed (if not prescribed).
+   * \param[out] ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out] kOverCvWall            - Thermal conductivities divided by Cv at the wall,
+                                          to be computed.
+   */
+  void WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                  const unsigned long  indFirstPoint,
+                                  const su2double      *tExchange,
+                                  const su2double      *velExchange,
+                                  const su2double      *muExchange,
+                                  const su2double      *pExchange,
+                                  const su2double      Wall_HeatFlux,
+                                  const bool           HeatFlux_Prescribed,
+                                  const su2double      Wall_Temperature,
+                                  const bool           Temperature_Prescribed,
+                                        su2double      *tauWall,
+                                        su2double      *qWall,
+                                        su2double      *ViscosityWall,
+                                        su2double      *kOverCvWall);
+
 private:
   
   su2double expansionRatio;   /*!< \brief  Stretching factor used for the wall model grid. */
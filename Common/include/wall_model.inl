@@ -59,6 +59,31 @@ inline void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                                          su2double &ViscosityWall,
                                                          su2double &kOverCvWall) {}
 
+inline void CWallModel::WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                                   const unsigned long  indFirstPoint,
+                                                   const su2double      *tExchange,
+                                                   const su2double      *velExchange,
+                                                   const su2double      *muExchange,
+                                                   const su2double      *pExchange,
+                                                   const su2double      Wall_HeatFlux,
+                                                   const bool           HeatFlux_Prescribed,
+                                                   const su2double      Wall_Temperature,
+                                                   const bool           Temperature_Prescribed,
+                                                         su2double      *tauWall,
+                                                         su2double      *qWall,
+                                                         su2double      *ViscosityWall,
+                                                         su2double      *kOverCvWall) {
+  for(unsigned short i=0; i<nPoints; ++i)
+    WallShearStressAndHeatFlux(tExchange[i], velExchange[i], muExchange[i], pExchange[i],
+                               Wall_HeatFlux, HeatFlux_Prescribed,
+                               Wall_Temperature, Temperature_Prescribed,
+                               tauWall[i], qWall[i], ViscosityWall[i], kOverCvWall[i]);
+}
+
+inline void CWallModel::SetNExchangePoints(const unsigned long nExchangePoints) {
+  tauWallPrevious.assign(nExchangePoints, 0.0);
+}
+
 inline CWallModel1DEQ::CWallModel1DEQ(void) : CWallModel(){
   expansionRatio = 0.0;
   numPoints      = 0;
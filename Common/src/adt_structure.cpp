@@ -488,6 +488,81 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
 
 }
 
+void CADTPointsOnlyClass::DetermineNodesInRadius(const su2double       *coor,
+                                                 const su2double       radius,
+                                                 vector<unsigned long> &pointIDs,
+                                                 vector<int>           &rankIDs) {
+
+  pointIDs.clear();
+  rankIDs.clear();
+  if( isEmpty ) return;
+
+  AD_BEGIN_PASSIVE
+
+  /* The comparisons are made with the distance squared to avoid a sqrt. */
+  const su2double radius2 = radius*radius;
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Traverse the tree starting at the root leaf. A leaf is only        ---*/
+  /*--- visited when the minimum possible distance to its bounding box is  ---*/
+  /*--- less than the radius, its terminal nodes are stored when they are  ---*/
+  /*--- inside the sphere.                                                 ---*/
+  /*--------------------------------------------------------------------------*/
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for(;;) {
+
+    frontLeavesNew.clear();
+
+    for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+      const unsigned long ll = frontLeaves[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /*--- A tree with a single point stores it in both children of the root leaf. ---*/
+          if((mm == 1) && leaves[ll].childrenAreTerminal[0] &&
+             (leaves[ll].children[0] == kk)) continue;
+
+          const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+          su2double distTarget = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            const su2double ds = coor[l] - coorTarget[l];
+            distTarget += ds*ds;
+          }
+
+          if(distTarget < radius2) {
+            pointIDs.push_back(localPointIDs[kk]);
+            rankIDs.push_back(ranksOfPoints[kk]);
+          }
+        }
+        else {
+
+          su2double posDist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds*ds;
+          }
+
+          if(posDist < radius2) frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if(frontLeaves.size() == 0) break;
+  }
+
+  AD_END_PASSIVE
+}
+
 CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<su2double>      &val_coor,
                              vector<unsigned long>  &val_connElem,
@@ -47,12 +47,83 @@ extern "C" void dgemv_(char*, const int*, const int*, const passivedouble*,
                        const int*, const passivedouble*, passivedouble*, const int*);
 #endif
 
+#if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+/* Kernel for the product C = A*B, where the number of columns of A (and
+   number of rows of B) is known at compile time. All matrices are stored
+   in row major order. For every row of C the columns are treated in blocks
+   of nBlockSmallGemm, such that the partial sums are kept in registers and
+   the inner loop can be vectorized by the compiler. */
+const int nBlockSmallGemm = 8;
+
+template<int K>
+void gemm_small_K(const int M, const int N, const su2double *A,
+                  const su2double *B, su2double *C) {
+
+  const int jEnd = N - N%nBlockSmallGemm;
+
+  for(int i=0; i<M; ++i) {
+    const su2double *a = A + i*K;
+    su2double       *c = C + i*N;
+
+    /*--- Loop over the full blocks of columns. ---*/
+    for(int j=0; j<jEnd; j+=nBlockSmallGemm) {
+      su2double val[nBlockSmallGemm];
+      for(int jj=0; jj<nBlockSmallGemm; ++jj) val[jj] = 0.0;
+
+      for(int p=0; p<K; ++p) {
+        const su2double  ap = a[p];
+        const su2double *b  = B + p*N + j;
+        for(int jj=0; jj<nBlockSmallGemm; ++jj) val[jj] += ap*b[jj];
+      }
+
+      for(int jj=0; jj<nBlockSmallGemm; ++jj) c[j+jj] = val[jj];
+    }
+
+    /*--- Remaining columns, if present. ---*/
+    if(jEnd < N) {
+      for(int j=jEnd; j<N; ++j) c[j] = 0.0;
+      for(int p=0; p<K; ++p) {
+        const su2double  ap = a[p];
+        const su2double *b  = B + p*N;
+        for(int j=jEnd; j<N; ++j) c[j] += ap*b[j];
+      }
+    }
+  }
+}
+
+/* Recursive template to store the size specialized kernels
+   for K = 1, ..., KMax in a table of function pointers. */
+template<int KMax>
+struct CGemmSmallKernelTable {
+  template<typename T>
+  static void Set(T *table) {
+    table[KMax] = gemm_small_K<KMax>;
+    CGemmSmallKernelTable<KMax-1>::Set(table);
+  }
+};
+
+template<>
+struct CGemmSmallKernelTable<0> {
+  template<typename T>
+  static void Set(T *table) {table[0] = NULL;}
+};
+
+#endif
+
 /* Constructor. Initialize the const member variables, if needed. */
 CBlasStructure::CBlasStructure(void)
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   : mc (256), kc (128), nc (128) 
 #endif
-{}
+{
+#if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+  /* Select the size specialized gemm kernels once, such that the kernel
+     for a certain value of K can be retrieved in gemm by a table lookup. */
+  CGemmSmallKernelTable<maxKSmallGemm>::Set(gemmKernelsSmallK);
+#endif
+}
 
 /* Destructor. Nothing to be done. */
 CBlasStructure::~CBlasStructure(void) {}
@@ -69,11 +140,20 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
-  /* Native implementation of the matrix product. This optimized implementation
-     assumes that the matrices are in column major order. This can be
-     accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
-  gemm_imp(N, M, K, B, A, C);
+  /* Check if a size specialized kernel is available for this value of K.
+     These kernels are tuned for the small matrices of the DG solver and
+     work directly on the row major storage. */
+  if(K <= maxKSmallGemm && K > 0) {
+    gemmKernelsSmallK[K](M, N, A, B, C);
+  }
+  else {
+
+    /* Native implementation of the matrix product. This optimized implementation
+       assumes that the matrices are in column major order. This can be
+       accomplished by swapping N and M and A and B. This implementation is based
+       on https://github.com/flame/how-to-optimize-gemm. */
+    gemm_imp(N, M, K, B, A, C);
+  }
 
 #else
 #ifdef HAVE_LIBXSMM
@@ -498,6 +498,8 @@ void CConfig::SetPointersNull(void) {
   CFL_AdaptParam      = NULL;            
   CFL                 = NULL;
   HTP_Axis = NULL;
+  LUT_Density_Limits = NULL;
+  LUT_Temperature_Limits = NULL;
   PlaneTag            = NULL;
   Kappa_Flow          = NULL;    
   Kappa_AdjFlow       = NULL;
@@ -568,6 +570,8 @@ void CConfig::SetPointersNull(void) {
   default_grid_fix           = NULL;
   default_inc_crit           = NULL;
   default_htp_axis           = NULL;
+  default_lut_density        = NULL;
+  default_lut_temperature    = NULL;
   default_body_force         = NULL;
   default_sineload_coeff     = NULL;
   default_nacelle_location   = NULL;
@@ -677,6 +681,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_grid_fix           = new su2double[6];
   default_inc_crit           = new su2double[3];
   default_htp_axis           = new su2double[2];
+  default_lut_density        = new su2double[2];
+  default_lut_temperature    = new su2double[2];
   default_body_force         = new su2double[3];
   default_sineload_coeff     = new su2double[3];
   default_nacelle_location   = new su2double[5];
@@ -756,6 +762,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, true);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read / write binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief WRT_ELEM_RESTART_DG \n DESCRIPTION: Write the DG-FEM restart files per element in partition order. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_ELEM_RESTART_DG", Wrt_Elem_Restart_DG, false);
+  /*!\brief READ_ELEM_RESTART_DG \n DESCRIPTION: Read the DG-FEM restart files per element in partition order. \n Options: YES, NO \ingroup Config */
+  addBoolOption("READ_ELEM_RESTART_DG", Read_Elem_Restart_DG, false);
+  /*!\brief RESTART_ELEM_DG_FILENAME \n DESCRIPTION: Output file of the DG-FEM restart written per element \n DEFAULT: restart_elem_dg.dat \ingroup Config */
+  addStringOption("RESTART_ELEM_DG_FILENAME", Restart_Elem_DGFileName, string("restart_elem_dg.dat"));
+  /*!\brief SOLUTION_ELEM_DG_FILENAME \n DESCRIPTION: Input file of the DG-FEM restart written per element \n DEFAULT: solution_elem_dg.dat \ingroup Config */
+  addStringOption("SOLUTION_ELEM_DG_FILENAME", Solution_Elem_DGFileName, string("solution_elem_dg.dat"));
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -795,6 +809,22 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the LOOK-UP TABLE fluid model ---*/
+  /* DESCRIPTION: File containing the thermodynamic look-up table */
+  addStringOption("LUT_FILENAME", LUT_Filename, string("fluid_table.dat"));
+  /* DESCRIPTION: Fluid model used to generate the table when LUT_FILENAME does not exist (IDEAL_GAS, VW_GAS, PR_GAS) */
+  addEnumOption("LUT_BASE_MODEL", Kind_LUT_BaseModel, FluidModel_Map, PR_GAS);
+  /* DESCRIPTION: Number of density nodes of the generated table */
+  addUnsignedLongOption("LUT_NDENSITY", LUT_nDensity, 200);
+  /* DESCRIPTION: Number of internal energy nodes of the generated table */
+  addUnsignedLongOption("LUT_NENERGY", LUT_nEnergy, 200);
+  /* DESCRIPTION: Minimum and maximum density of the generated table */
+  default_lut_density[0] = 0.01; default_lut_density[1] = 500.0;
+  addDoubleArrayOption("LUT_DENSITY_LIMITS", 2, LUT_Density_Limits, default_lut_density);
+  /* DESCRIPTION: Minimum and maximum temperature of the generated table */
+  default_lut_temperature[0] = 300.0; default_lut_temperature[1] = 700.0;
+  addDoubleArrayOption("LUT_TEMPERATURE_LIMITS", 2, LUT_Temperature_Limits, default_lut_temperature);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1271,6 +1301,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addEnumOption("TIME_DISCRE_FEM_FLOW", Kind_TimeIntScheme_FEM_Flow, Time_Int_Map, RUNGE_KUTTA_EXPLICIT);
   /* DESCRIPTION: ADER-DG predictor step */
   addEnumOption("ADER_PREDICTOR", Kind_ADER_Predictor, Ader_Predictor_Map, ADER_ALIASED_PREDICTOR);
+  /* DESCRIPTION: Start the ADER-DG predictor step from the extrapolated predictor of the previous time step */
+  addBoolOption("ADER_PREDICTOR_WARM_START", WarmStart_ADER_Predictor, false);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_ADJFLOW", Kind_TimeIntScheme_AdjFlow, Time_Int_Map, EULER_IMPLICIT);
   /* DESCRIPTION: Time discretization */
@@ -1548,6 +1580,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Precondition the discrete adjoint update with the transposed Jacobian of the primal implicit scheme */
+  addBoolOption("JACOBIAN_PREC_DISC", Jacobian_Prec_Disc, false);
+  /* DESCRIPTION: Number of transposed Jacobian solves per discrete adjoint iteration */
+  addUnsignedShortOption("JACOBIAN_PREC_DISC_TERMS", nJacobian_Prec_Disc, 1);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -1759,6 +1795,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleListOption("PLUNGING_AMPL_Z", nPlunging_Ampl_Z, Plunging_Ampl_Z);
   /* DESCRIPTION: Value to move motion origins (1 or 0) */
   addUShortListOption("MOVE_MOTION_ORIGIN", nMoveMotion_Origin, MoveMotion_Origin);
+  /* DESCRIPTION: Update the wall distance after a deformation of the grid */
+  addBoolOption("WALL_DISTANCE_UPDATE", Wall_Distance_Update, false);
+  /* DESCRIPTION: Relative change of the wall distance below which a point is not searched again */
+  addDoubleOption("WALL_DISTANCE_UPDATE_TOL", Wall_Distance_Update_Tol, 1.0E-3);
 
   /*!\par CONFIG_CATEGORY: Grid adaptation \ingroup Config*/
   /*--- Options related to grid adaptation ---*/
@@ -1875,6 +1915,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addStringOption("DV_SENS_FILENAME", DV_Sens_Filename, string("surface_sensitivity.dat"));
   /*!\brief OUTPUT_FORMAT \n DESCRIPTION: I/O format for output plots. \n OPTIONS: see \link Output_Map \endlink \n DEFAULT: TECPLOT \ingroup Config */
   addEnumOption("DV_SENSITIVITY_FORMAT", Sensitivity_FileFormat, Sensitivity_Map, SU2_NATIVE);
+  /* DESCRIPTION: Project the sensitivities of each objective in OBJECTIVE_FUNCTION separately (SU2_DOT), instead of the combined objective */
+  addBoolOption("DV_SEPARATE_OBJECTIVES", DV_Separate_ObjFunc, false);
 	/* DESCRIPTION: Hold the grid fixed in a region */
   addBoolOption("HOLD_GRID_FIXED", Hold_GridFixed, false);
 	default_grid_fix[0] = -1E15; default_grid_fix[1] = -1E15; default_grid_fix[2] = -1E15;
@@ -1897,6 +1939,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("DEFORM_LIMIT", Deform_Limit, 1E6);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_Stiffness_Type, Deform_Stiffness_Map, SOLID_WALL_DISTANCE);
+  /* DESCRIPTION: Compute the stiffness of the FEA mesh deformation once and reuse it (and its preconditioner) in later deformations */
+  addBoolOption("DEFORM_CACHE_STIFFNESS", Deform_Cache_Stiffness, false);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation*/
   addDoubleOption("DEFORM_ELASTICITY_MODULUS", Deform_ElasticityMod, 2E11);
   /* DESCRIPTION: Young's modulus and Poisson's ratio for constant stiffness FEA method of grid deformation*/
@@ -1937,6 +1981,24 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("USE_LUMPED_MASSMATRIX_DGFEM", Use_Lumped_MassMatrix_DGFEM, false);
   /* DESCRIPTION: Only compute the exact Jacobian of the spatial discretization (NO, YES) */
   addBoolOption("JACOBIAN_SPATIAL_DISCRETIZATION_ONLY", Jacobian_Spatial_Discretization_Only, false);
+  /* DESCRIPTION: Number of Newton iterations per time step of the implicit DG time integration (3 by default) */
+  addUnsignedShortOption("NEWTON_ITER_IMPLICIT_DG", nNewtonIter_ImplicitDG, 3);
+  /* DESCRIPTION: Number of Newton iterations after which the Jacobian of the implicit DG scheme is recomputed (1 by default) */
+  addUnsignedShortOption("JACOBIAN_FREQ_IMPLICIT_DG", JacobianFreq_ImplicitDG, 1);
+  /* DESCRIPTION: Order of the BDF scheme for time accurate implicit DG computations, 1 or 2 (2 by default) */
+  addUnsignedShortOption("TIME_ORDER_IMPLICIT_DG", TimeOrder_ImplicitDG, 2);
+  /* DESCRIPTION: Number of task list executions during which the work of the DG elements is measured (0 by default, no measurement) */
+  addUnsignedLongOption("MEASURE_WORK_ITER_DG", nIterMeasureWorkDG, 0);
+  /* DESCRIPTION: Use the measured work weights in the partitioning of the DG grid (NO, YES) */
+  addBoolOption("MEASURED_WORK_WEIGHTS_DG", Use_Measured_Work_DG, false);
+  /* DESCRIPTION: Repartition the DG grid during the computation with the measured work weights (NO, YES) */
+  addBoolOption("REPARTITION_MEASURED_WORK_DG", Repartition_Measured_Work_DG, false);
+  /* DESCRIPTION: File name of the measured work weights of the DG elements (dg_work_weights.dat by default) */
+  addStringOption("WORK_WEIGHTS_FILENAME_DG", Work_Weights_DG_FileName, string("dg_work_weights.dat"));
+  /* DESCRIPTION: Store only one set of metric terms for affine DG elements (NO, YES) */
+  addBoolOption("COMPACT_METRIC_AFFINE_DG", Compact_Metric_Affine_DG, false);
+  /* DESCRIPTION: Store the metric terms of curved DG elements in single precision (NO, YES) */
+  addBoolOption("SINGLE_PRECISION_METRIC_DG", SinglePrec_Metric_DG, false);
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
@@ -2001,6 +2063,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addEnumOption("MATERIAL_MODEL", Kind_Material, Material_Map, LINEAR_ELASTIC);
   /*!\brief REGIME_TYPE \n  DESCRIPTION: Compressibility of the material \n OPTIONS: see \link MatComp_Map \endlink \ingroup Config*/
   addEnumOption("MATERIAL_COMPRESSIBILITY", Kind_Material_Compress, MatComp_Map, COMPRESSIBLE_MAT);
+  /*  DESCRIPTION: Store the element stiffness of linear structural problems and reuse it (and the preconditioner) in later assemblies
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("CACHE_ELEMENT_STIFFNESS", Cache_Elem_Stiffness, false);
 
   /*  DESCRIPTION: Consider a prestretch in the structural domain
   *  Options: NO, YES \ingroup Config */
@@ -2224,6 +2289,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Free surface damping coefficient */
 	addDoubleOption("FFD_TOLERANCE", FFD_Tol, 1E-10);
 
+  /* DESCRIPTION: Store the FFD parametric coordinates in a binary file and reuse them in later runs */
+  addBoolOption("FFD_PARAMCOORD_CACHE", FFD_ParamCoord_Cache, false);
+
   /* DESCRIPTION: Definition of the FFD boxes */
   addFFDDefOption("FFD_DEFINITION", nFFDBox, CoordFFDBox, TagFFDBox);
   
@@ -3724,6 +3792,15 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Kappa_Flow[0] = Kappa_AdjFlow[0];
     Kappa_Flow[1] = Kappa_AdjFlow[1];
   }
+
+  if ((DiscreteAdjoint) && (Jacobian_Prec_Disc)) {
+    if (Unsteady_Simulation != STEADY)
+      SU2_MPI::Error("JACOBIAN_PREC_DISC is only available for steady problems.", CURRENT_FUNCTION);
+    if ((Kind_Regime != COMPRESSIBLE) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT))
+      SU2_MPI::Error("JACOBIAN_PREC_DISC requires a compressible flow solver with EULER_IMPLICIT time integration.", CURRENT_FUNCTION);
+    if ((Kind_Upwind_Flow == TURKEL) || (Low_Mach_Precon))
+      SU2_MPI::Error("JACOBIAN_PREC_DISC is not compatible with low Mach preconditioning.", CURRENT_FUNCTION);
+  }
   
   if (Iter_Fixed_CL == 0) { Iter_Fixed_CL = nExtIter+1; Update_Alpha = 0; }
   if (Iter_Fixed_CM == 0) { Iter_Fixed_CM = nExtIter+1; Update_iH = 0; }
@@ -3769,6 +3846,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     nLevels_TimeAccurateLTS = 1;
   }
 
+  /* Correct the parameters of the implicit DG time integration, if needed. */
+  if (Kind_TimeIntScheme_FEM_Flow == EULER_IMPLICIT) {
+    if (nNewtonIter_ImplicitDG  == 0) nNewtonIter_ImplicitDG  = 1;
+    if (JacobianFreq_ImplicitDG == 0) JacobianFreq_ImplicitDG = 1;
+    if (TimeOrder_ImplicitDG    == 0) TimeOrder_ImplicitDG    = 1;
+    if (TimeOrder_ImplicitDG     > 2) TimeOrder_ImplicitDG    = 2;
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     Unsteady_Simulation = TIME_STEPPING;  // Only time stepping for ADER.
@@ -3986,6 +4071,13 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  /*--- The single precision storage of the DG metric terms removes their derivative information. ---*/
+  if (SinglePrec_Metric_DG)
+    SU2_MPI::Error("SINGLE_PRECISION_METRIC_DG= YES cannot be used with Automatic Differentiation.",
+                   CURRENT_FUNCTION);
+#endif
+
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
     if (Kind_SU2 == SU2_CFD) {
@@ -4139,6 +4231,22 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
 
+  if (Kind_FluidModel == LUT_GAS) {
+    if (Kind_Regime == INCOMPRESSIBLE) {
+      SU2_MPI::Error("Fluid model LUT_GAS is for compressible flows only.", CURRENT_FUNCTION);
+    }
+    if ((Kind_LUT_BaseModel != IDEAL_GAS) && (Kind_LUT_BaseModel != VW_GAS) && (Kind_LUT_BaseModel != PR_GAS)) {
+      SU2_MPI::Error("LUT_BASE_MODEL must be IDEAL_GAS, VW_GAS or PR_GAS.", CURRENT_FUNCTION);
+    }
+    if ((LUT_nDensity < 4) || (LUT_nEnergy < 4)) {
+      SU2_MPI::Error("LUT_NDENSITY and LUT_NENERGY must be at least 4 for bicubic interpolation.", CURRENT_FUNCTION);
+    }
+    if ((LUT_Density_Limits[0] <= 0.0) || (LUT_Density_Limits[1] <= LUT_Density_Limits[0]) ||
+        (LUT_Temperature_Limits[1] <= LUT_Temperature_Limits[0])) {
+      SU2_MPI::Error("Invalid LUT_DENSITY_LIMITS or LUT_TEMPERATURE_LIMITS.", CURRENT_FUNCTION);
+    }
+  }
+
   if ((Kind_Regime == INCOMPRESSIBLE) && (Kind_Solver != EULER) && (Kind_Solver != ADJ_EULER) && (Kind_Solver != DISC_ADJ_EULER)) {
     if (Kind_ViscosityModel == SUTHERLAND) {
       if ((Kind_FluidModel != INC_IDEAL_GAS) && (Kind_FluidModel != INC_IDEAL_GAS_POLY)) {
@@ -5946,6 +6054,15 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
 
+        case EULER_IMPLICIT:
+          if(Unsteady_Simulation == TIME_STEPPING)
+            cout << "Implicit BDF" << TimeOrder_ImplicitDG << " method for the flow equations with "
+                 << nNewtonIter_ImplicitDG << " Newton iterations per time step." << endl;
+          else
+            cout << "Euler implicit method for the flow equations." << endl;
+          cout << "Jacobian recomputed every " << JacobianFreq_ImplicitDG << " Newton iterations." << endl;
+          break;
+
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
             cout << "ADER-DG for the flow equations with global time stepping." << endl;
@@ -5961,6 +6078,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "A non-aliased approach is used in the predictor step. " << endl;
               break;
           }
+          if( WarmStart_ADER_Predictor )
+            cout << "The predictor step starts from the extrapolated predictor of the previous time step." << endl;
           cout << "Number of time DOFs ADER-DG predictor step: " << nTimeDOFsADER_DG << endl;
           cout << "Location of time DOFs ADER-DG on the interval [-1,1]: ";
           for (unsigned short iDOF=0; iDOF<nTimeDOFsADER_DG; iDOF++) {
@@ -7257,6 +7376,8 @@ CConfig::~CConfig(void) {
   if (default_grid_fix      != NULL) delete [] default_grid_fix;
   if (default_inc_crit      != NULL) delete [] default_inc_crit;
   if (default_htp_axis      != NULL) delete [] default_htp_axis;
+  if (default_lut_density   != NULL) delete [] default_lut_density;
+  if (default_lut_temperature != NULL) delete [] default_lut_temperature;
   if (default_body_force    != NULL) delete [] default_body_force;
   if (default_sineload_coeff!= NULL) delete [] default_sineload_coeff;
   if (default_nacelle_location    != NULL) delete [] default_nacelle_location;
@@ -7382,7 +7503,7 @@ string CConfig::GetMultiInstance_HistoryFileName(string val_filename, int val_iI
     return multizone_filename;
 }
 
-string CConfig::GetObjFunc_Extension(string val_filename) {
+string CConfig::GetObjFunc_Extension(string val_filename, short val_iObj) {
 
   string AdjExt, Filename = val_filename;
 
@@ -7393,8 +7514,10 @@ string CConfig::GetObjFunc_Extension(string val_filename) {
     unsigned short lastindex = Filename.find_last_of(".");
     Filename = Filename.substr(0, lastindex);
 
-    if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
+    /*--- A single objective of the list can be requested explicitly ---*/
+
+    if ((nObj==1) || (val_iObj >= 0)) {
+      switch (Kind_ObjFunc[(val_iObj >= 0)? val_iObj : 0]) {
         case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
         case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
         case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
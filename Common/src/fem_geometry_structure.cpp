@@ -324,6 +324,7 @@ void CSurfaceElementFEM::Copy(const CSurfaceElementFEM &other) {
   nIntPerWallFunctionDonor = other.nIntPerWallFunctionDonor;
   intPerWallFunctionDonor  = other.intPerWallFunctionDonor;
   matWallFunctionDonor     = other.matWallFunctionDonor;
+  indIntWallModel          = other.indIntWallModel;
 }
 
 CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
@@ -5398,6 +5399,90 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
 #endif
 }
 
+void CMeshFEM_DG::CompressMetricTermsVolumeElements(CConfig *config) {
+
+  /* Easier storage of the input options and return if nothing needs to be done. */
+  const bool compactAffine = config->GetCompact_Metric_Affine_DG();
+  const bool singlePrec    = config->GetSinglePrec_Metric_DG();
+
+  if(!compactAffine && !singlePrec) return;
+
+  /* Determine the number of metric terms per point and the relative
+     tolerance to decide whether or not the metric terms are constant. */
+  const unsigned short nMetricPerPoint = nDim*nDim + 1;
+  const su2double      tolAffine       = 1.e-10;
+
+  /* Initialize the memory of the metric terms before and after the compression. */
+  unsigned long nBytesOld = 0, nBytesNew = 0;
+
+  /*--- Loop over the owned volume elements. The halo elements do
+        not store metric terms. ---*/
+  for(unsigned long i=0; i<nVolElemOwned; ++i) {
+
+    vector<su2double> &metric        = volElem[i].metricTerms;
+    vector<su2double> &metricSolDOFs = volElem[i].metricTermsSolDOFs;
+
+    nBytesOld += (metric.size() + metricSolDOFs.size())*sizeof(su2double);
+
+    /*--- Check if the element is affine, i.e. if the metric terms in all the
+          integration points and solution DOFs are equal to the metric terms
+          of the first integration point. Only elements, for which the Jacobian
+          is considered constant, are candidates. ---*/
+    bool elemIsAffine = false;
+    if(compactAffine && volElem[i].JacIsConsideredConstant) {
+
+      su2double scale = 0.0;
+      for(unsigned short k=0; k<nMetricPerPoint; ++k)
+        scale = max(scale, fabs(metric[k]));
+      const su2double tol = tolAffine*scale;
+
+      elemIsAffine = true;
+      for(unsigned long j=nMetricPerPoint; j<metric.size(); ++j)
+        if(fabs(metric[j] - metric[j%nMetricPerPoint]) > tol) elemIsAffine = false;
+
+      for(unsigned long j=0; j<metricSolDOFs.size(); ++j)
+        if(fabs(metricSolDOFs[j] - metric[j%nMetricPerPoint]) > tol) elemIsAffine = false;
+    }
+
+    if( elemIsAffine ) {
+
+      /* Only store the metric terms of the first integration point and
+         the first solution DOF. */
+      vector<su2double>(metric.begin(), metric.begin()+nMetricPerPoint).swap(metric);
+      vector<su2double>(metricSolDOFs.begin(),
+                        metricSolDOFs.begin()+nMetricPerPoint).swap(metricSolDOFs);
+      volElem[i].metricTermsAffine = true;
+    }
+    else if( singlePrec ) {
+
+      /* Store the metric terms in the integration points in single precision.
+         The metric terms in the solution DOFs are only used for the subgrid
+         scale model and the ADER predictor and are kept in double precision. */
+      volElem[i].metricTermsSinglePrec.resize(metric.size());
+      for(unsigned long j=0; j<metric.size(); ++j)
+        volElem[i].metricTermsSinglePrec[j] = (float) SU2_TYPE::GetValue(metric[j]);
+
+      vector<su2double>().swap(metric);
+    }
+
+    nBytesNew += (metric.size() + metricSolDOFs.size())*sizeof(su2double)
+               +  volElem[i].metricTermsSinglePrec.size()*sizeof(float);
+  }
+
+  /*--- Write the reduction of the memory of the metric terms. ---*/
+#ifdef HAVE_MPI
+  unsigned long nBytesLoc[] = {nBytesOld, nBytesNew}, nBytesGlob[2];
+  SU2_MPI::Reduce(nBytesLoc, nBytesGlob, 2, MPI_UNSIGNED_LONG, MPI_SUM,
+                  MASTER_NODE, MPI_COMM_WORLD);
+  nBytesOld = nBytesGlob[0];
+  nBytesNew = nBytesGlob[1];
+#endif
+
+  if(rank == MASTER_NODE)
+    cout << "Memory of the metric terms of the volume elements reduced from "
+         << nBytesOld/1048576.0 << " MB to " << nBytesNew/1048576.0 << " MB." << endl;
+}
+
 void CMeshFEM_DG::MetricTermsSurfaceElements(CConfig *config) {
 
   /*--- Compute the metric terms of the internal matching faces. ---*/
@@ -6323,8 +6408,11 @@ void CMeshFEM_DG::WallFunctionPreprocessing(CConfig *config) {
           /* Initialize the wall model. */
           boundaries[iMarker].wallModel->Initialize(intInfo, doubleInfo);
 
-          /* Easier storage of the surface elements and loop over them. */
+          /* Easier storage of the surface elements and loop over them.
+             Also the number of exchange points is determined, which are
+             numbered consecutively over the faces of this boundary. */
           vector<CSurfaceElementFEM> &surfElem = boundaries[iMarker].surfElem;
+          unsigned long nExchangePoints = 0;
           for(unsigned long l=0; l<surfElem.size(); ++l) {
 
             /* Determine the corresponding standard face element and get the
@@ -6333,6 +6421,9 @@ void CMeshFEM_DG::WallFunctionPreprocessing(CConfig *config) {
             const unsigned short ind  = surfElem[l].indStandardElement;
             const unsigned short nInt = standardBoundaryFacesSol[ind].GetNIntegration();
 
+            surfElem[l].indIntWallModel = nExchangePoints;
+            nExchangePoints            += nInt;
+
             /* Allocate the memory for the memory to store the donors and
                the parametric weights. The donor elements are stored in an
                CUnsignedLong2T, such that they can be sorted. */
@@ -6456,6 +6547,10 @@ void CMeshFEM_DG::WallFunctionPreprocessing(CConfig *config) {
               }
             }
           }
+
+          /* Allocate the memory in the wall model to store the solution of
+             the exchange points, which serves as initial guess. */
+          boundaries[iMarker].wallModel->SetNExchangePoints(nExchangePoints);
         }
 
         break;
@@ -2082,6 +2082,12 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
       mat2ndDerBasisIntPoint = mat2ndDerBasisIntPoint + offsetDerInt;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Determine whether sum factorization can be used for this element.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  SetSumFactorization();
 }
 
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double   *parCoor,
@@ -2225,6 +2231,210 @@ bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
   return true;
 }
 
+void CFEMStandardElement::SumFactDOFsToInt(const unsigned short N,
+                                           const bool           derivatives,
+                                           const su2double      *dataDOFs,
+                                           su2double            *dataInt,
+                                           su2double            *work) const {
+
+  /* Easier storage of the number of points in the three parametric
+     directions for the different stages of the tensor product. */
+  const unsigned short n = nDOFs1D, m = nInt1D;
+  const su2double *L = lagBasisInt1D.data();
+  const su2double *D = derLagBasisInt1D.data();
+
+  /*--- Make a distinction between a quadrilateral and a hexahedron. ---*/
+  if(VTK_Type == QUADRILATERAL) {
+
+    const unsigned short nDD[] = {n, n, 1}, nID[] = {m, n, 1};
+
+    /* Interpolation and differentiation in r-direction. */
+    su2double *TL = work;
+    su2double *TD = TL + m*n*N;
+    TensorProductDirection(N, 0, nDD, m, L, false, dataDOFs, N, TL, false);
+
+    /* Value in the integration points. */
+    TensorProductDirection(N, 1, nID, m, L, false, TL, N, dataInt, false);
+    if( !derivatives ) return;
+
+    /* The r- and s-derivatives in the integration points. */
+    TensorProductDirection(N, 0, nDD, m, D, false, dataDOFs, N, TD, false);
+    TensorProductDirection(N, 1, nID, m, L, false, TD, N, dataInt +   nIntegration*N, false);
+    TensorProductDirection(N, 1, nID, m, D, false, TL, N, dataInt + 2*nIntegration*N, false);
+  }
+  else {
+
+    const unsigned short nDDD[] = {n, n, n}, nIDD[] = {m, n, n}, nIID[] = {m, m, n};
+
+    su2double *T1L  = work;
+    su2double *T1D  = T1L  + m*n*n*N;
+    su2double *T2LL = T1D  + m*n*n*N;
+    su2double *T2LD = T2LL + m*m*n*N;
+    su2double *T2DL = T2LD + m*m*n*N;
+
+    /* Interpolation in r- and s-direction, followed by the interpolation
+       in t-direction for the value in the integration points. */
+    TensorProductDirection(N, 0, nDDD, m, L, false, dataDOFs, N, T1L,  false);
+    TensorProductDirection(N, 1, nIDD, m, L, false, T1L,      N, T2LL, false);
+    TensorProductDirection(N, 2, nIID, m, L, false, T2LL,     N, dataInt, false);
+    if( !derivatives ) return;
+
+    /* The r-, s- and t-derivatives in the integration points. The
+       intermediate results of the value computation are reused. */
+    TensorProductDirection(N, 0, nDDD, m, D, false, dataDOFs, N, T1D,  false);
+    TensorProductDirection(N, 1, nIDD, m, L, false, T1D,      N, T2DL, false);
+    TensorProductDirection(N, 1, nIDD, m, D, false, T1L,      N, T2LD, false);
+
+    TensorProductDirection(N, 2, nIID, m, L, false, T2DL, N, dataInt +   nIntegration*N, false);
+    TensorProductDirection(N, 2, nIID, m, L, false, T2LD, N, dataInt + 2*nIntegration*N, false);
+    TensorProductDirection(N, 2, nIID, m, D, false, T2LL, N, dataInt + 3*nIntegration*N, false);
+  }
+}
+
+void CFEMStandardElement::SumFactIntToDOFs(const unsigned short N,
+                                           const bool           derivatives,
+                                           const su2double      *dataInt,
+                                           su2double            *dataDOFs,
+                                           su2double            *work) const {
+
+  /* Easier storage of the 1D data. The transpose of the 1D matrices
+     is applied, hence the roles of n and m are reversed compared to
+     SumFactDOFsToInt. */
+  const unsigned short n = nDOFs1D, m = nInt1D;
+  const su2double *L = lagBasisInt1D.data();
+  const su2double *D = derLagBasisInt1D.data();
+
+  /*--- Make a distinction between a quadrilateral and a hexahedron. ---*/
+  if(VTK_Type == QUADRILATERAL) {
+
+    const unsigned short nII[] = {m, m, 1}, nIE[] = {m, n, 1};
+
+    if( !derivatives ) {
+      TensorProductDirection(N, 1, nII, n, L, true, dataInt, N, work, false);
+      TensorProductDirection(N, 0, nIE, n, L, true, work, N, dataDOFs, false);
+      return;
+    }
+
+    /* The input data is interleaved, i.e. the r- and s-components of a
+       point are stored consecutively. */
+    su2double *Gr = work;
+    su2double *Gs = Gr + m*n*N;
+    TensorProductDirection(N, 1, nII, n, L, true, dataInt,   2*N, Gr, false);
+    TensorProductDirection(N, 1, nII, n, D, true, dataInt+N, 2*N, Gs, false);
+
+    TensorProductDirection(N, 0, nIE, n, D, true, Gr, N, dataDOFs, false);
+    TensorProductDirection(N, 0, nIE, n, L, true, Gs, N, dataDOFs, true);
+  }
+  else {
+
+    const unsigned short nIII[] = {m, m, m}, nIIE[] = {m, m, n}, nIEE[] = {m, n, n};
+
+    if( !derivatives ) {
+      su2double *T2 = work + m*m*n*N;
+      TensorProductDirection(N, 2, nIII, n, L, true, dataInt, N, work, false);
+      TensorProductDirection(N, 1, nIIE, n, L, true, work,    N, T2,   false);
+      TensorProductDirection(N, 0, nIEE, n, L, true, T2,      N, dataDOFs, false);
+      return;
+    }
+
+    su2double *Gr = work;
+    su2double *Gs = Gr + m*m*n*N;
+    su2double *Gt = Gs + m*m*n*N;
+    su2double *Hr = Gt + m*m*n*N;
+    su2double *Hx = Hr + m*n*n*N;
+
+    /* Contraction in t-direction of the interleaved r-, s- and t-components. */
+    TensorProductDirection(N, 2, nIII, n, L, true, dataInt,     3*N, Gr, false);
+    TensorProductDirection(N, 2, nIII, n, L, true, dataInt+N,   3*N, Gs, false);
+    TensorProductDirection(N, 2, nIII, n, D, true, dataInt+2*N, 3*N, Gt, false);
+
+    /* Contraction in s-direction. The s- and t-contributions are combined,
+       because both are multiplied by the basis functions in r-direction. */
+    TensorProductDirection(N, 1, nIIE, n, L, true, Gr, N, Hr, false);
+    TensorProductDirection(N, 1, nIIE, n, D, true, Gs, N, Hx, false);
+    TensorProductDirection(N, 1, nIIE, n, L, true, Gt, N, Hx, true);
+
+    /* Contraction in r-direction. */
+    TensorProductDirection(N, 0, nIEE, n, D, true, Hr, N, dataDOFs, false);
+    TensorProductDirection(N, 0, nIEE, n, L, true, Hx, N, dataDOFs, true);
+  }
+}
+
+void CFEMStandardElement::SumFactDOFsToDerInt(const unsigned short N,
+                                              const bool           secondDerivatives,
+                                              const su2double      *dataDOFs,
+                                              su2double            *dataInt,
+                                              su2double            *work) const {
+
+  /* Easier storage of the 1D data. The 1D matrices are indexed by the order
+     of the derivative they represent. */
+  const unsigned short n = nDOFs1D, m = nInt1D;
+  const su2double *mat1D[] = {lagBasisInt1D.data(), derLagBasisInt1D.data(),
+                              der2LagBasisInt1D.data()};
+
+  /* The order of the derivative in the r-, s- and t-direction for the first
+     derivatives, (r, s, t), and for the second derivatives, (rr, rs, ss, rt,
+     st, tt). For a quadrilateral only the first 2 or 3 entries are used. */
+  const unsigned short orderFirst[][3]  = {{1,0,0}, {0,1,0}, {0,0,1}};
+  const unsigned short orderSecond[][3] = {{2,0,0}, {1,1,0}, {0,2,0},
+                                           {1,0,1}, {0,1,1}, {0,0,2}};
+  const unsigned short (*order)[3] = secondDerivatives ? orderSecond : orderFirst;
+
+  /* Number of 1D matrices that are applied in r-direction. The results of
+     the r-direction are stored in work and reused for all derivatives. */
+  const unsigned short nMatR = secondDerivatives ? 3 : 2;
+
+  /*--- Make a distinction between a quadrilateral and a hexahedron. ---*/
+  if(VTK_Type == QUADRILATERAL) {
+
+    const unsigned short nDD[] = {n, n, 1}, nID[] = {m, n, 1};
+    const unsigned short nDer  = secondDerivatives ? 3 : 2;
+
+    for(unsigned short a=0; a<nMatR; ++a)
+      TensorProductDirection(N, 0, nDD, m, mat1D[a], false, dataDOFs, N,
+                             work + a*m*n*N, false);
+
+    for(unsigned short d=0; d<nDer; ++d)
+      TensorProductDirection(N, 1, nID, m, mat1D[order[d][1]], false,
+                             work + order[d][0]*m*n*N, N,
+                             dataInt + d*nIntegration*N, false);
+  }
+  else {
+
+    const unsigned short nDDD[] = {n, n, n}, nIDD[] = {m, n, n}, nIID[] = {m, m, n};
+    const unsigned short nDer   = secondDerivatives ? 6 : 3;
+
+    su2double *T2 = work + nMatR*m*n*n*N;
+
+    for(unsigned short a=0; a<nMatR; ++a)
+      TensorProductDirection(N, 0, nDDD, m, mat1D[a], false, dataDOFs, N,
+                             work + a*m*n*n*N, false);
+
+    for(unsigned short d=0; d<nDer; ++d) {
+      TensorProductDirection(N, 1, nIDD, m, mat1D[order[d][1]], false,
+                             work + order[d][0]*m*n*n*N, N, T2, false);
+      TensorProductDirection(N, 2, nIID, m, mat1D[order[d][2]], false,
+                             T2, N, dataInt + d*nIntegration*N, false);
+    }
+  }
+}
+
+void CFEMStandardElement::SumFactDerSolDOFs(const unsigned short N,
+                                            const su2double      *dataDOFs,
+                                            su2double            *derDOFs) const {
+
+  /* The derivative in a parametric direction only requires the application
+     of the 1D derivative matrix in that direction, because the DOFs and the
+     points in which the derivatives are computed coincide. */
+  const unsigned short n = nDOFs1D;
+  const unsigned short nDDD[] = {n, n, (unsigned short) ((VTK_Type == QUADRILATERAL) ? 1 : n)};
+  const unsigned short nDimPar = (VTK_Type == QUADRILATERAL) ? 2 : 3;
+
+  for(unsigned short iDim=0; iDim<nDimPar; ++iDim)
+    TensorProductDirection(N, iDim, nDDD, n, derLagBasisSolDOFs1D.data(), false,
+                           dataDOFs, N, derDOFs + iDim*nDOFs*N, false);
+}
+
 /*----------------------------------------------------------------------------------*/
 /*           Private member functions of CFEMStandardElement.                       */
 /*----------------------------------------------------------------------------------*/
@@ -2267,6 +2477,15 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
+
+  sumFactorization = other.sumFactorization;
+  nDOFs1D          = other.nDOFs1D;
+  nInt1D           = other.nInt1D;
+  lagBasisInt1D    = other.lagBasisInt1D;
+  derLagBasisInt1D = other.derLagBasisInt1D;
+
+  der2LagBasisInt1D    = other.der2LagBasisInt1D;
+  derLagBasisSolDOFs1D = other.derLagBasisSolDOFs1D;
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -3502,6 +3721,190 @@ void CFEMStandardElement::ChangeDirectionTriangleConn(vector<unsigned short> &co
   }
 }
 
+void CFEMStandardElement::SetSumFactorization(void) {
+
+  /*--- Initialize sumFactorization to false and check whether the element
+        is a tensor product element. ---*/
+  sumFactorization = false;
+  nDOFs1D = nInt1D = 0;
+
+  unsigned short nDimPar;
+  if(     VTK_Type == QUADRILATERAL) nDimPar = 2;
+  else if(VTK_Type == HEXAHEDRON)    nDimPar = 3;
+  else return;
+
+  /*--- Determine the number of DOFs and integration points in one direction
+        and check if these numbers are consistent with a tensor product. ---*/
+  const unsigned short n = nPoly+1;
+  unsigned short m = 1;
+  while(pow(m+1, nDimPar) <= nIntegration) ++m;
+
+  unsigned int nDOFsTensor = n, nIntTensor = m;
+  for(unsigned short iDim=1; iDim<nDimPar; ++iDim) {
+    nDOFsTensor *= n;
+    nIntTensor  *= m;
+  }
+  if((nDOFsTensor != nDOFs) || (nIntTensor != nIntegration)) return;
+
+  /*--- Compute the 1D Lagrangian basis functions and their first and second
+        derivatives in the 1D integration points, which are the first points
+        in r-direction. Also the derivatives in the 1D DOFs, which are the
+        first DOFs in r-direction, are computed. ---*/
+  lagBasisInt1D.resize(m*n);
+  derLagBasisInt1D.resize(m*n);
+  der2LagBasisInt1D.resize(m*n);
+  derLagBasisSolDOFs1D.resize(n*n);
+
+  for(unsigned short i=0; i<(m+n); ++i) {
+    const su2double x = (i < m) ? rIntegration[i] : rDOFs[i-m];
+    for(unsigned short a=0; a<n; ++a) {
+      su2double lag = 1.0, der = 0.0, der2 = 0.0;
+      for(unsigned short c=0; c<n; ++c) {
+        if(c == a) continue;
+        const su2double denom = rDOFs[a] - rDOFs[c];
+        lag *= (x - rDOFs[c])/denom;
+
+        su2double term = 1.0/denom;
+        for(unsigned short e=0; e<n; ++e) {
+          if((e == a) || (e == c)) continue;
+          term *= (x - rDOFs[e])/(rDOFs[a] - rDOFs[e]);
+
+          su2double term2 = 1.0/(denom*(rDOFs[a] - rDOFs[e]));
+          for(unsigned short f=0; f<n; ++f)
+            if((f != a) && (f != c) && (f != e)) term2 *= (x - rDOFs[f])/(rDOFs[a] - rDOFs[f]);
+          der2 += term2;
+        }
+        der += term;
+      }
+
+      if(i < m) {
+        lagBasisInt1D[i*n+a]     = lag;
+        derLagBasisInt1D[i*n+a]  = der;
+        der2LagBasisInt1D[i*n+a] = der2;
+      }
+      else
+        derLagBasisSolDOFs1D[(i-m)*n+a] = der;
+    }
+  }
+
+  /*--- Check whether the tensor product of the 1D data reproduces the basis
+        functions and their derivatives in the integration points. This is not
+        the case if the DOFs or integration points are not numbered in tensor
+        product fashion, in which case the general matrix products are used. ---*/
+  const unsigned short kMax = (nDimPar == 3) ? n : 1;
+  const unsigned short pMax = (nDimPar == 3) ? m : 1;
+  const unsigned long  offDer = nIntegration*nDOFs;
+
+  for(unsigned short r=0; r<pMax; ++r) {
+    for(unsigned short q=0; q<m; ++q) {
+      for(unsigned short p=0; p<m; ++p) {
+        const unsigned int iInt = p + m*(q + m*r);
+
+        for(unsigned short k=0; k<kMax; ++k) {
+          for(unsigned short j=0; j<n; ++j) {
+            for(unsigned short i=0; i<n; ++i) {
+              const unsigned int iDOF = i + n*(j + n*k);
+
+              const su2double Lr = lagBasisInt1D[p*n+i], Dr = derLagBasisInt1D[p*n+i];
+              const su2double Ls = lagBasisInt1D[q*n+j], Ds = derLagBasisInt1D[q*n+j];
+              const su2double Lt = (nDimPar == 3) ? lagBasisInt1D[r*n+k]    : 1.0;
+              const su2double Dt = (nDimPar == 3) ? derLagBasisInt1D[r*n+k] : 0.0;
+
+              su2double val[] = {Lr*Ls*Lt, Dr*Ls*Lt, Lr*Ds*Lt, Lr*Ls*Dt};
+              for(unsigned short iVal=0; iVal<=nDimPar; ++iVal) {
+                const su2double ref = matBasisIntegration[iVal*offDer + iInt*nDOFs + iDOF];
+                if(fabs(val[iVal] - ref) > 1.e-10*max(su2double(1.0), fabs(ref))) return;
+              }
+
+              /* The second derivatives, stored in the sequence rr, rs, ss, rt, st, tt. */
+              const su2double D2r = der2LagBasisInt1D[p*n+i], D2s = der2LagBasisInt1D[q*n+j];
+              const su2double D2t = (nDimPar == 3) ? der2LagBasisInt1D[r*n+k] : 0.0;
+
+              su2double val2[] = {D2r*Ls*Lt, Dr*Ds*Lt, Lr*D2s*Lt, Dr*Ls*Dt, Lr*Ds*Dt, Lr*Ls*D2t};
+              for(unsigned short iVal=0; iVal<(nDimPar*(nDimPar+1)/2); ++iVal) {
+                const su2double ref = mat2ndDerBasisInt[iVal*offDer + iInt*nDOFs + iDOF];
+                if(fabs(val2[iVal] - ref) > 1.e-8*max(su2double(1.0), fabs(ref))) return;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /*--- Check the derivatives in the solution DOFs in the same way. ---*/
+  const unsigned long offDerDOFs = nDOFs*nDOFs;
+  for(unsigned int iPoint=0; iPoint<nDOFs; ++iPoint) {
+    const unsigned short pointInd[] = {(unsigned short) (iPoint%n), (unsigned short) ((iPoint/n)%n),
+                                       (unsigned short) (iPoint/(n*n))};
+    for(unsigned int iDOF=0; iDOF<nDOFs; ++iDOF) {
+      const unsigned short DOFInd[] = {(unsigned short) (iDOF%n), (unsigned short) ((iDOF/n)%n),
+                                       (unsigned short) (iDOF/(n*n))};
+      for(unsigned short iDim=0; iDim<nDimPar; ++iDim) {
+
+        su2double val = derLagBasisSolDOFs1D[pointInd[iDim]*n + DOFInd[iDim]];
+        for(unsigned short jDim=0; jDim<nDimPar; ++jDim)
+          if((jDim != iDim) && (pointInd[jDim] != DOFInd[jDim])) val = 0.0;
+
+        const su2double ref = matDerBasisSolDOFs[iDim*offDerDOFs + iPoint*nDOFs + iDOF];
+        if(fabs(val - ref) > 1.e-8*max(su2double(1.0), fabs(ref))) return;
+      }
+    }
+  }
+
+  /*--- The tensor product structure is present. ---*/
+  nDOFs1D = n;
+  nInt1D  = m;
+  sumFactorization = true;
+}
+
+void CFEMStandardElement::TensorProductDirection(const unsigned short N,
+                                                 const unsigned short dir,
+                                                 const unsigned short *nIn,
+                                                 const unsigned short nOut,
+                                                 const su2double      *mat,
+                                                 const bool           transMat,
+                                                 const su2double      *dataIn,
+                                                 const unsigned short strideIn,
+                                                 su2double            *dataOut,
+                                                 const bool           addToOut) const {
+
+  /*--- Determine the number of points before and after direction dir. The
+        points before dir are contiguous for a fixed index in direction dir. ---*/
+  unsigned int nInner = 1, nOuter = 1;
+  for(unsigned short d=0; d<dir; ++d)   nInner *= nIn[d];
+  for(unsigned short d=dir+1; d<3; ++d) nOuter *= nIn[d];
+
+  const unsigned short nDir = nIn[dir];
+  const unsigned int   nInnerN = nInner*N;
+
+  /*--- Loop over the outer points and the output points in direction dir. ---*/
+  for(unsigned int o=0; o<nOuter; ++o) {
+    const su2double *inO  = dataIn  + o*nDir*nInner*strideIn;
+    su2double       *outO = dataOut + o*nOut*nInnerN;
+
+    for(unsigned short a=0; a<nOut; ++a) {
+      su2double *outA = outO + a*nInnerN;
+      if( !addToOut )
+        for(unsigned int l=0; l<nInnerN; ++l) outA[l] = 0.0;
+
+      /*--- Loop over the input points in direction dir and update the
+            output points with the corresponding matrix entry. ---*/
+      for(unsigned short b=0; b<nDir; ++b) {
+        const su2double c = transMat ? mat[b*nOut+a] : mat[a*nDir+b];
+        const su2double *inB = inO + b*nInner*strideIn;
+
+        for(unsigned int p=0; p<nInner; ++p) {
+          const su2double *inP  = inB  + p*strideIn;
+          su2double       *outP = outA + p*N;
+          for(unsigned short l=0; l<N; ++l)
+            outP[l] += c*inP[l];
+        }
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------------*/
 /*         Public member functions of CFEMStandardInternalFace.                     */
 /*----------------------------------------------------------------------------------*/
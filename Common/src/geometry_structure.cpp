@@ -43,6 +43,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <iterator>
+#include <limits>
 
 /*--- Epsilon definition ---*/
 
@@ -111,6 +112,10 @@ CGeometry::CGeometry(void) {
   CustomBoundaryHeatFlux = NULL;      //Customized heat flux wall
   CustomBoundaryTemperature = NULL;   //Customized temperature wall
 
+  /*--- Element filter, built when first used ---*/
+
+  Filter_nElemGhost = 0;
+
 }
 
 CGeometry::~CGeometry(void) {
@@ -622,48 +627,65 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
                                        vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil,
                                        bool original_surface, CConfig *config) {
   
-  AD_BEGIN_PASSIVE
+  /*--- A single section is a group of one plane, assembled by the master node ---*/
   
-  unsigned short iMarker, iNode, jNode, iDim, Index = 0;
-  bool intersect;
-  long Next_Edge = 0;
-  unsigned long iPoint, jPoint, iElem, Trailing_Point, Airfoil_Point, iVertex, iEdge, PointIndex, jEdge;
-  su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0, Intersection[3] = {0.0, 0.0, 0.0}, Trailing_Coord,
-  *VarCoord = NULL, Variable_Interp, v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0}, CrossProduct = 1.0;
-  bool Found_Edge;
-  passivedouble Dist_Value;
-  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
-  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil, JGlobalID_Airfoil;
-  vector<unsigned short> Conection_Index0, Conection_Index1;
-  vector<unsigned long> Duplicate;
-  vector<unsigned long>::iterator it;
-  su2double **Coord_Variation = NULL;
-  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
-  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
-  vector<bool> AddExtra;
-  unsigned long EdgeDonor;
-  bool FoundEdge;
+  ComputeAirfoil_Sections(1, &Plane_P0, &Plane_Normal, MinXCoord, MaxXCoord, MinYCoord, MaxYCoord,
+                          MinZCoord, MaxZCoord, FlowVariable, &Xcoord_Airfoil, &Ycoord_Airfoil,
+                          &Zcoord_Airfoil, &Variable_Airfoil, original_surface, config);
   
-#ifdef HAVE_MPI
-  unsigned long nLocalEdge, MaxLocalEdge, *Buffer_Send_nEdge, *Buffer_Receive_nEdge, nBuffer_Coord, nBuffer_Variable, nBuffer_GlobalID;
-  int nProcessor, iProcessor;
-  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
-  su2double *Buffer_Send_Variable, *Buffer_Receive_Variable;
-  unsigned long *Buffer_Send_GlobalID, *Buffer_Receive_GlobalID;
-#endif
+}
+
+void CGeometry::ComputeAirfoil_Sections(unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                                        su2double MinXCoord, su2double MaxXCoord,
+                                        su2double MinYCoord, su2double MaxYCoord,
+                                        su2double MinZCoord, su2double MaxZCoord,
+                                        su2double *FlowVariable,
+                                        vector<su2double> *Xcoord_Airfoil, vector<su2double> *Ycoord_Airfoil,
+                                        vector<su2double> *Zcoord_Airfoil, vector<su2double> *Variable_Airfoil,
+                                        bool original_surface, CConfig *config) {
+  
+  /*--- The sections are only recorded by SU2_GEO, which differentiates the
+   geometrical constraints with respect to the design variables ---*/
+  
+  if (config->GetKind_SU2() != SU2_GEO) {
+    AD_BEGIN_PASSIVE
+  }
+  
+  unsigned short iPlane, iMarker, iNode, iDim;
+  unsigned long iPoint, iElem, iVertex, iList, nList, iBin, nBin, First_Bin, Last_Bin, iCandidate;
+  su2double *VarCoord = NULL, *Variation = NULL;
+  passivedouble Proj, Plane_Value, Tol, Elem_Min, Elem_Max, Min_All = 0.0, Max_All = 0.0, Bin_Size = 1.0;
+  passivedouble Index_Normal[3] = {0.0, 0.0, 0.0};
+  su2double epsilon = 1E-6;
+  bool Index_Built = false, Same_Normal;
   
-  Xcoord_Airfoil.clear();
-  Ycoord_Airfoil.clear();
-  Zcoord_Airfoil.clear();
-  Variable_Airfoil.clear();
-  IGlobalID_Airfoil.clear();
-  JGlobalID_Airfoil.clear();
+  vector<su2double> Coord_Variation;
+  vector<unsigned short> List_Marker;
+  vector<unsigned long> List_Elem, Bin_Start, Bin_List, Candidate;
+  vector<passivedouble> List_Min, List_Max;
+  
+  /*--- Local intersections of each plane, stored by edges of the section: the two
+   points of the edge (6 coordinates), the interpolated variable (2 values) and the
+   global indices of the surface edges that contain the points (4 values) ---*/
+  
+  vector<su2double> *Edge_Coord = new vector<su2double>[nPlane];
+  vector<su2double> *Edge_Variable = new vector<su2double>[nPlane];
+  vector<unsigned long> *Edge_GlobalID = new vector<unsigned long>[nPlane];
+  
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    Xcoord_Airfoil[iPlane].clear();
+    Ycoord_Airfoil[iPlane].clear();
+    Zcoord_Airfoil[iPlane].clear();
+    Variable_Airfoil[iPlane].clear();
+  }
   
   /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
   
   if (nDim == 2) {
-    Plane_P0[0] = 0.0;      Plane_P0[1] = 0.0;      Plane_P0[2] = 0.0;
-    Plane_Normal[0] = 0.0;  Plane_Normal[1] = 1.0;  Plane_Normal[2] = 0.0;
+    for (iPlane = 0; iPlane < nPlane; iPlane++) {
+      Plane_P0[iPlane][0] = 0.0;      Plane_P0[iPlane][1] = 0.0;      Plane_P0[iPlane][2] = 0.0;
+      Plane_Normal[iPlane][0] = 0.0;  Plane_Normal[iPlane][1] = 1.0;  Plane_Normal[iPlane][2] = 0.0;
+    }
   }
   
   /*--- Grid movement is stored using a vertices information,
@@ -671,9 +693,7 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
   
   if (original_surface == false) {
     
-    Coord_Variation = new su2double *[nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      Coord_Variation[iPoint] = new su2double [nDim];
+    Coord_Variation.assign(nPoint*nDim, 0.0);
     
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_GeoEval(iMarker) == YES) {
@@ -681,674 +701,904 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
           VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
           iPoint = vertex[iMarker][iVertex]->GetNode();
           for (iDim = 0; iDim < nDim; iDim++)
-            Coord_Variation[iPoint][iDim] = VarCoord[iDim];
+            Coord_Variation[iPoint*nDim+iDim] = VarCoord[iDim];
         }
       }
     }
     
+    Variation = &Coord_Variation[0];
+    
   }
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  for (iPlane = 0; iPlane < nPlane; iPlane++) {
+    
+    /*--- With several planes in 3D the surface elements are indexed by their extent
+     along the plane normal (uniform bins), and each plane only visits the elements
+     whose extent contains the plane. The index is rebuilt when the normal changes. ---*/
     
-    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+    if ((nDim == 3) && (nPlane > 1)) {
+      
+      Same_Normal = Index_Built;
+      for (iDim = 0; iDim < 3; iDim++)
+        if (Index_Normal[iDim] != SU2_TYPE::GetValue(Plane_Normal[iPlane][iDim])) Same_Normal = false;
       
-      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      if (!Same_Normal) {
         
-        PointIndex=0;
+        for (iDim = 0; iDim < 3; iDim++) Index_Normal[iDim] = SU2_TYPE::GetValue(Plane_Normal[iPlane][iDim]);
         
-        /*--- To decide if an element is going to be used or not should be done element based,
-         The first step is to compute and average coordinate for the element ---*/
+        List_Marker.clear(); List_Elem.clear(); List_Min.clear(); List_Max.clear();
         
-        su2double AveXCoord = 0.0;
-        su2double AveYCoord = 0.0;
-        su2double AveZCoord = 0.0;
+        /*--- The projection uses the same (perturbed) normal as SegmentIntersectsPlane ---*/
         
-        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          AveXCoord += node[iPoint]->GetCoord(0);
-          AveYCoord += node[iPoint]->GetCoord(1);
-          if (nDim == 3) AveZCoord += node[iPoint]->GetCoord(2);
+        for (iMarker = 0; iMarker < nMarker; iMarker++) {
+          if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+            for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+              Elem_Min = numeric_limits<passivedouble>::max();
+              Elem_Max = -numeric_limits<passivedouble>::max();
+              for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+                iPoint = bound[iMarker][iElem]->GetNode(iNode);
+                Proj = 0.0;
+                for (iDim = 0; iDim < nDim; iDim++) {
+                  passivedouble Coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+                  if (Variation != NULL) Coord += SU2_TYPE::GetValue(Variation[iPoint*nDim+iDim]);
+                  Proj += (Index_Normal[iDim]+SU2_TYPE::GetValue(epsilon))*Coord;
+                }
+                Elem_Min = min(Elem_Min, Proj); Elem_Max = max(Elem_Max, Proj);
+              }
+              List_Marker.push_back(iMarker); List_Elem.push_back(iElem);
+              List_Min.push_back(Elem_Min);   List_Max.push_back(Elem_Max);
+            }
+          }
         }
         
-        AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        
-        /*--- To only cut one part of the nacelle based on the cross product
-         of the normal to the plane and a vector that connect the point
-         with the center line ---*/
+        nList = List_Elem.size();
+        if (nList > 0) {
+          Min_All = *min_element(List_Min.begin(), List_Min.end());
+          Max_All = *max_element(List_Max.begin(), List_Max.end());
+        }
+        nBin = max(nList, (unsigned long)1);
+        Bin_Size = (Max_All - Min_All)/passivedouble(nBin);
+        if (Bin_Size <= 0.0) { nBin = 1; Bin_Size = 1.0; }
         
-        CrossProduct = 1.0;
+        /*--- Counting sort of the elements in the bins they overlap ---*/
         
-        if (config->GetGeo_Description() == NACELLE) {
-          
-          su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
-          su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
-          
-          /*--- Translate to the origin ---*/
-          
-          su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
-          su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
-          su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
-          
-          /*--- Apply tilt angle ---*/
-          
-          su2double XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          su2double YCoord_Trans_Tilt = YCoord_Trans;
-          su2double ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
-          
-          /*--- Apply toe angle ---*/
-          
-          su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
-          
-          /*--- Undo plane rotation, we have already rotated the nacelle ---*/
-          
-          /*--- Undo tilt angle ---*/
-          
-          su2double XPlane_Normal_Tilt = Plane_Normal[0]*cos(-Tilt_Angle) + Plane_Normal[2]*sin(-Tilt_Angle);
-          su2double YPlane_Normal_Tilt = Plane_Normal[1];
-          su2double ZPlane_Normal_Tilt = Plane_Normal[2]*cos(-Tilt_Angle) - Plane_Normal[0]*sin(-Tilt_Angle);
-          
-          /*--- Undo toe angle ---*/
-          
-          su2double YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt*sin(-Toe_Angle) + YPlane_Normal_Tilt*cos(-Toe_Angle);
-          su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
-          
-          
-          v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
-          v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
-          v3[0] = v1[1]*ZPlane_Normal_Tilt_Toe-v1[2]*YPlane_Normal_Tilt_Toe;
-          CrossProduct = v3[0] * 1.0;
-          
+        Bin_Start.assign(nBin+1, 0);
+        for (iList = 0; iList < nList; iList++) {
+          First_Bin = min(nBin-1, (unsigned long)((List_Min[iList]-Min_All)/Bin_Size));
+          Last_Bin  = min(nBin-1, (unsigned long)((List_Max[iList]-Min_All)/Bin_Size));
+          for (iBin = First_Bin; iBin <= Last_Bin; iBin++) Bin_Start[iBin+1]++;
+        }
+        for (iBin = 0; iBin < nBin; iBin++) Bin_Start[iBin+1] += Bin_Start[iBin];
+        
+        Bin_List.resize(Bin_Start[nBin]);
+        vector<unsigned long> Bin_Fill(Bin_Start.begin(), Bin_Start.end()-1);
+        for (iList = 0; iList < nList; iList++) {
+          First_Bin = min(nBin-1, (unsigned long)((List_Min[iList]-Min_All)/Bin_Size));
+          Last_Bin  = min(nBin-1, (unsigned long)((List_Max[iList]-Min_All)/Bin_Size));
+          for (iBin = First_Bin; iBin <= Last_Bin; iBin++) Bin_List[Bin_Fill[iBin]++] = iList;
         }
         
-        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          
-          for (jNode = 0; jNode < bound[iMarker][iElem]->GetnNodes(); jNode++) {
-            jPoint = bound[iMarker][iElem]->GetNode(jNode);
+        Index_Built = true;
+        
+      }
+      
+      /*--- Value of the plane in the projected direction, with a tolerance that
+       keeps the search conservative with respect to round-off ---*/
+      
+      Plane_Value = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Plane_Value += (Index_Normal[iDim]+SU2_TYPE::GetValue(epsilon))*SU2_TYPE::GetValue(Plane_P0[iPlane][iDim]+epsilon);
+      Tol = 1E-6*(fabs(Plane_Value) + (Max_All - Min_All) + 1.0);
+      
+      Candidate.clear();
+      if ((List_Elem.size() > 0) && (Plane_Value + Tol >= Min_All) && (Plane_Value - Tol <= Max_All)) {
+        First_Bin = (Plane_Value - Tol <= Min_All) ? 0 : min(nBin-1, (unsigned long)((Plane_Value-Tol-Min_All)/Bin_Size));
+        Last_Bin  = min(nBin-1, (unsigned long)(max(Plane_Value+Tol-Min_All, 0.0)/Bin_Size));
+        for (iBin = First_Bin; iBin <= Last_Bin; iBin++) {
+          for (iCandidate = Bin_Start[iBin]; iCandidate < Bin_Start[iBin+1]; iCandidate++) {
+            iList = Bin_List[iCandidate];
             
-            /*--- CrossProduct concept is delicated because it allows triangles where only one side is divided by a plane.
-             that is going against the concept that all the triangles are divided twice  and causes probelms because
-             Xcoord_Index0.size() > Xcoord_Index1.size()! ---*/
+            /*--- An element is visited only from its first bin inside the range ---*/
             
-            if ((jPoint > iPoint) && (CrossProduct >= 0.0)
-                && ((AveXCoord > MinXCoord) && (AveXCoord < MaxXCoord))
-                && ((AveYCoord > MinYCoord) && (AveYCoord < MaxYCoord))
-                && ((AveZCoord > MinZCoord) && (AveZCoord < MaxZCoord))) {
-              
-              Segment_P0[0] = 0.0;  Segment_P0[1] = 0.0;  Segment_P0[2] = 0.0;  Variable_P0 = 0.0;
-              Segment_P1[0] = 0.0;  Segment_P1[1] = 0.0;  Segment_P1[2] = 0.0;  Variable_P1 = 0.0;
-              
-              
-              for (iDim = 0; iDim < nDim; iDim++) {
-                if (original_surface == true) {
-                  Segment_P0[iDim] = node[iPoint]->GetCoord(iDim);
-                  Segment_P1[iDim] = node[jPoint]->GetCoord(iDim);
-                }
-                else {
-                  Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint][iDim];
-                  Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint][iDim];
-                }
-              }
-              
-              if (FlowVariable != NULL) {
-                Variable_P0 = FlowVariable[iPoint];
-                Variable_P1 = FlowVariable[jPoint];
-              }
-              
-              /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
-              
-              if (nDim == 2) {
-                Xcoord_Index0.push_back(Segment_P0[0]);                     Xcoord_Index1.push_back(Segment_P1[0]);
-                Ycoord_Index0.push_back(Segment_P0[2]);                     Ycoord_Index1.push_back(Segment_P1[2]);
-                Zcoord_Index0.push_back(Segment_P0[1]);                     Zcoord_Index1.push_back(Segment_P1[1]);
-                Variable_Index0.push_back(Variable_P0);                     Variable_Index1.push_back(Variable_P1);
-                IGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex()); IGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-                JGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex()); JGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-                PointIndex++;
-              }
-              
-              /*--- In 3D compute the intersection ---*/
-              
-              else if (nDim == 3) {
-                intersect = SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0, Plane_Normal, Intersection, Variable_Interp);
-                if (intersect == true) {
-                  if (PointIndex == 0) {
-                    Xcoord_Index0.push_back(Intersection[0]);
-                    Ycoord_Index0.push_back(Intersection[1]);
-                    Zcoord_Index0.push_back(Intersection[2]);
-                    Variable_Index0.push_back(Variable_Interp);
-                    IGlobalID_Index0.push_back(node[iPoint]->GetGlobalIndex());
-                    JGlobalID_Index0.push_back(node[jPoint]->GetGlobalIndex());
-                  }
-                  if (PointIndex == 1) {
-                    Xcoord_Index1.push_back(Intersection[0]);
-                    Ycoord_Index1.push_back(Intersection[1]);
-                    Zcoord_Index1.push_back(Intersection[2]);
-                    Variable_Index1.push_back(Variable_Interp);
-                    IGlobalID_Index1.push_back(node[iPoint]->GetGlobalIndex());
-                    JGlobalID_Index1.push_back(node[jPoint]->GetGlobalIndex());
-                  }
-                  PointIndex++;
-                }
-              }
-              
-            }
+            if (max(First_Bin, min(nBin-1, (unsigned long)((List_Min[iList]-Min_All)/Bin_Size))) != iBin) continue;
+            if ((List_Min[iList] <= Plane_Value + Tol) && (List_Max[iList] >= Plane_Value - Tol))
+              Candidate.push_back(iList);
           }
         }
-        
       }
+      
+      /*--- Same order as the scan of the markers, to keep the section unchanged ---*/
+      
+      sort(Candidate.begin(), Candidate.end());
+      
+      for (iCandidate = 0; iCandidate < Candidate.size(); iCandidate++) {
+        iList = Candidate[iCandidate];
+        ComputeAirfoil_SectionElem(List_Marker[iList], List_Elem[iList], Plane_P0[iPlane], Plane_Normal[iPlane],
+                                   MinXCoord, MaxXCoord, MinYCoord, MaxYCoord, MinZCoord, MaxZCoord,
+                                   FlowVariable, Variation, config,
+                                   Edge_Coord[iPlane], Edge_Variable[iPlane], Edge_GlobalID[iPlane]);
+      }
+      
     }
-  }
-  
-  if (original_surface == false) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      delete [] Coord_Variation[iPoint];
-    delete [] Coord_Variation;
+    
+    else {
+      for (iMarker = 0; iMarker < nMarker; iMarker++) {
+        if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+          for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+            ComputeAirfoil_SectionElem(iMarker, iElem, Plane_P0[iPlane], Plane_Normal[iPlane],
+                                       MinXCoord, MaxXCoord, MinYCoord, MaxYCoord, MinZCoord, MaxZCoord,
+                                       FlowVariable, Variation, config,
+                                       Edge_Coord[iPlane], Edge_Variable[iPlane], Edge_GlobalID[iPlane]);
+          }
+        }
+      }
+    }
+    
   }
   
 #ifdef HAVE_MPI
   
-  /*--- Copy the coordinates of all the points in the plane to the master node ---*/
+  /*--- Each plane is assembled by one rank (iPlane % size), the local intersections
+   are sent to that rank, in the order of the ranks ---*/
+  
+  int iProcessor, nProcessor = size;
+  unsigned long iEdge, nEdge, Offset, nSend, nRecv;
   
-  nLocalEdge = 0, MaxLocalEdge = 0;
-  nProcessor = size;
+  vector<unsigned long> Send_nEdge(nProcessor*nPlane, 0), Recv_nEdge(nProcessor*nPlane, 0);
+  vector<unsigned long> Send_Offset(nProcessor+1, 0), Recv_Offset(nProcessor+1, 0);
   
-  Buffer_Send_nEdge = new unsigned long [1];
-  Buffer_Receive_nEdge = new unsigned long [nProcessor];
+  for (iPlane = 0; iPlane < nPlane; iPlane++)
+    Send_nEdge[(iPlane%nProcessor)*nPlane + iPlane] = Edge_Coord[iPlane].size()/6;
   
-  nLocalEdge = Xcoord_Index0.size();
+  SU2_MPI::Alltoall(&Send_nEdge[0], nPlane, MPI_UNSIGNED_LONG, &Recv_nEdge[0], nPlane, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
   
-  Buffer_Send_nEdge[0] = nLocalEdge;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    nSend = 0; nRecv = 0;
+    for (iPlane = 0; iPlane < nPlane; iPlane++) {
+      nSend += Send_nEdge[iProcessor*nPlane + iPlane];
+      nRecv += Recv_nEdge[iProcessor*nPlane + iPlane];
+    }
+    Send_Offset[iProcessor+1] = Send_Offset[iProcessor] + nSend;
+    Recv_Offset[iProcessor+1] = Recv_Offset[iProcessor] + nRecv;
+  }
   
-  SU2_MPI::Allreduce(&nLocalEdge, &MaxLocalEdge, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nEdge, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nEdge, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  vector<su2double> Buffer_Send_Coord(6*Send_Offset[nProcessor]), Buffer_Receive_Coord(6*Recv_Offset[nProcessor]);
+  vector<su2double> Buffer_Send_Variable(2*Send_Offset[nProcessor]), Buffer_Receive_Variable(2*Recv_Offset[nProcessor]);
+  vector<unsigned long> Buffer_Send_GlobalID(4*Send_Offset[nProcessor]), Buffer_Receive_GlobalID(4*Recv_Offset[nProcessor]);
   
-  Buffer_Send_Coord    = new su2double [MaxLocalEdge*6];
-  Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalEdge*6];
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    Offset = Send_Offset[iProcessor];
+    for (iPlane = iProcessor; iPlane < nPlane; iPlane += nProcessor) {
+      nEdge = Edge_Coord[iPlane].size()/6;
+      for (iEdge = 0; iEdge < 6*nEdge; iEdge++) Buffer_Send_Coord[6*Offset + iEdge] = Edge_Coord[iPlane][iEdge];
+      for (iEdge = 0; iEdge < 2*nEdge; iEdge++) Buffer_Send_Variable[2*Offset + iEdge] = Edge_Variable[iPlane][iEdge];
+      for (iEdge = 0; iEdge < 4*nEdge; iEdge++) Buffer_Send_GlobalID[4*Offset + iEdge] = Edge_GlobalID[iPlane][iEdge];
+      Offset += nEdge;
+    }
+  }
   
-  Buffer_Send_Variable    = new su2double [MaxLocalEdge*2];
-  Buffer_Receive_Variable = new su2double [nProcessor*MaxLocalEdge*2];
+  vector<SU2_MPI::Request> Request;
+  Request.reserve(6*nProcessor);
   
-  Buffer_Send_GlobalID    = new unsigned long [MaxLocalEdge*4];
-  Buffer_Receive_GlobalID = new unsigned long [nProcessor*MaxLocalEdge*4];
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    nRecv = Recv_Offset[iProcessor+1] - Recv_Offset[iProcessor];
+    if (nRecv == 0) continue;
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&Buffer_Receive_Coord[6*Recv_Offset[iProcessor]], 6*nRecv, MPI_DOUBLE, iProcessor, 0, MPI_COMM_WORLD, &Request.back());
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&Buffer_Receive_Variable[2*Recv_Offset[iProcessor]], 2*nRecv, MPI_DOUBLE, iProcessor, 1, MPI_COMM_WORLD, &Request.back());
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&Buffer_Receive_GlobalID[4*Recv_Offset[iProcessor]], 4*nRecv, MPI_UNSIGNED_LONG, iProcessor, 2, MPI_COMM_WORLD, &Request.back());
+  }
   
-  nBuffer_Coord    = MaxLocalEdge*6;
-  nBuffer_Variable = MaxLocalEdge*2;
-  nBuffer_GlobalID = MaxLocalEdge*4;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    nSend = Send_Offset[iProcessor+1] - Send_Offset[iProcessor];
+    if (nSend == 0) continue;
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&Buffer_Send_Coord[6*Send_Offset[iProcessor]], 6*nSend, MPI_DOUBLE, iProcessor, 0, MPI_COMM_WORLD, &Request.back());
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&Buffer_Send_Variable[2*Send_Offset[iProcessor]], 2*nSend, MPI_DOUBLE, iProcessor, 1, MPI_COMM_WORLD, &Request.back());
+    Request.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&Buffer_Send_GlobalID[4*Send_Offset[iProcessor]], 4*nSend, MPI_UNSIGNED_LONG, iProcessor, 2, MPI_COMM_WORLD, &Request.back());
+  }
+  
+  if (!Request.empty())
+    SU2_MPI::Waitall(Request.size(), &Request[0], MPI_STATUSES_IGNORE);
+  Request.clear();
+  
+  /*--- Assemble the planes of this rank ---*/
   
-  for (iEdge = 0; iEdge < nLocalEdge; iEdge++) {
-    Buffer_Send_Coord[iEdge*6 + 0] = Xcoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 1] = Ycoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 2] = Zcoord_Index0[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 3] = Xcoord_Index1[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 4] = Ycoord_Index1[iEdge];
-    Buffer_Send_Coord[iEdge*6 + 5] = Zcoord_Index1[iEdge];
+  vector<unsigned long> Recv_Plane_Offset(Recv_Offset.begin(), Recv_Offset.end()-1);
+  
+  for (iPlane = rank; iPlane < nPlane; iPlane += nProcessor) {
     
-    Buffer_Send_Variable[iEdge*2 + 0] = Variable_Index0[iEdge];
-    Buffer_Send_Variable[iEdge*2 + 1] = Variable_Index1[iEdge];
+    Edge_Coord[iPlane].clear(); Edge_Variable[iPlane].clear(); Edge_GlobalID[iPlane].clear();
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      Offset = Recv_Plane_Offset[iProcessor];
+      nEdge  = Recv_nEdge[iProcessor*nPlane + iPlane];
+      Edge_Coord[iPlane].insert(Edge_Coord[iPlane].end(), Buffer_Receive_Coord.begin()+6*Offset, Buffer_Receive_Coord.begin()+6*(Offset+nEdge));
+      Edge_Variable[iPlane].insert(Edge_Variable[iPlane].end(), Buffer_Receive_Variable.begin()+2*Offset, Buffer_Receive_Variable.begin()+2*(Offset+nEdge));
+      Edge_GlobalID[iPlane].insert(Edge_GlobalID[iPlane].end(), Buffer_Receive_GlobalID.begin()+4*Offset, Buffer_Receive_GlobalID.begin()+4*(Offset+nEdge));
+      Recv_Plane_Offset[iProcessor] += nEdge;
+    }
+    
+    AssembleAirfoil_Section(Plane_Normal[iPlane], config, Edge_Coord[iPlane], Edge_Variable[iPlane], Edge_GlobalID[iPlane],
+                            Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane]);
     
-    Buffer_Send_GlobalID[iEdge*4 + 0] = IGlobalID_Index0[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 1] = JGlobalID_Index0[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 2] = IGlobalID_Index1[iEdge];
-    Buffer_Send_GlobalID[iEdge*4 + 3] = JGlobalID_Index1[iEdge];
   }
   
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  /*--- Collect the sections in the master node ---*/
   
-  /*--- Clean the vectors before adding the new vertices only to the master node ---*/
+  vector<unsigned long> Local_nPoint(nPlane, 0), Total_nPoint(nPlane, 0);
+  for (iPlane = rank; iPlane < nPlane; iPlane += nProcessor)
+    Local_nPoint[iPlane] = Xcoord_Airfoil[iPlane].size();
   
-  Xcoord_Index0.clear();     Xcoord_Index1.clear();
-  Ycoord_Index0.clear();     Ycoord_Index1.clear();
-  Zcoord_Index0.clear();     Zcoord_Index1.clear();
-  Variable_Index0.clear();   Variable_Index1.clear();
-  IGlobalID_Index0.clear();  IGlobalID_Index1.clear();
-  JGlobalID_Index0.clear();  JGlobalID_Index1.clear();
+  SU2_MPI::Reduce(&Local_nPoint[0], &Total_nPoint[0], nPlane, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
   
-  /*--- Copy the boundary to the master node vectors ---*/
+  vector<su2double> Buffer_Send_Airfoil, Buffer_Receive_Airfoil;
   
-  if (rank == MASTER_NODE) {
+  if (rank != MASTER_NODE) {
+    for (iPlane = rank; iPlane < nPlane; iPlane += nProcessor) {
+      for (iPoint = 0; iPoint < Xcoord_Airfoil[iPlane].size(); iPoint++) {
+        Buffer_Send_Airfoil.push_back(Xcoord_Airfoil[iPlane][iPoint]);
+        Buffer_Send_Airfoil.push_back(Ycoord_Airfoil[iPlane][iPoint]);
+        Buffer_Send_Airfoil.push_back(Zcoord_Airfoil[iPlane][iPoint]);
+        Buffer_Send_Airfoil.push_back(Variable_Airfoil[iPlane][iPoint]);
+      }
+      Xcoord_Airfoil[iPlane].clear(); Ycoord_Airfoil[iPlane].clear();
+      Zcoord_Airfoil[iPlane].clear(); Variable_Airfoil[iPlane].clear();
+    }
+    if (!Buffer_Send_Airfoil.empty()) {
+      Request.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(&Buffer_Send_Airfoil[0], Buffer_Send_Airfoil.size(), MPI_DOUBLE, MASTER_NODE, 3, MPI_COMM_WORLD, &Request.back());
+    }
+  }
+  else {
+    vector<unsigned long> Airfoil_Offset(nProcessor+1, 0);
     for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      for (iEdge = 0; iEdge < Buffer_Receive_nEdge[iProcessor]; iEdge++) {
-        Xcoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 0] );
-        Ycoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 1] );
-        Zcoord_Index0.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 2] );
-        Xcoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 3] );
-        Ycoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 4] );
-        Zcoord_Index1.push_back( Buffer_Receive_Coord[ iProcessor*MaxLocalEdge*6 + iEdge*6 + 5] );
-        
-        Variable_Index0.push_back( Buffer_Receive_Variable[ iProcessor*MaxLocalEdge*2 + iEdge*2 + 0] );
-        Variable_Index1.push_back( Buffer_Receive_Variable[ iProcessor*MaxLocalEdge*2 + iEdge*2 + 1] );
-        
-        IGlobalID_Index0.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 0] );
-        JGlobalID_Index0.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 1] );
-        IGlobalID_Index1.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 2] );
-        JGlobalID_Index1.push_back( Buffer_Receive_GlobalID[ iProcessor*MaxLocalEdge*4 + iEdge*4 + 3] );
-        
+      nRecv = 0;
+      if (iProcessor != MASTER_NODE)
+        for (iPlane = iProcessor; iPlane < nPlane; iPlane += nProcessor) nRecv += Total_nPoint[iPlane];
+      Airfoil_Offset[iProcessor+1] = Airfoil_Offset[iProcessor] + 4*nRecv;
+    }
+    Buffer_Receive_Airfoil.resize(Airfoil_Offset[nProcessor]);
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      nRecv = Airfoil_Offset[iProcessor+1] - Airfoil_Offset[iProcessor];
+      if (nRecv == 0) continue;
+      Request.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(&Buffer_Receive_Airfoil[Airfoil_Offset[iProcessor]], nRecv, MPI_DOUBLE, iProcessor, 3, MPI_COMM_WORLD, &Request.back());
+    }
+    if (!Request.empty())
+      SU2_MPI::Waitall(Request.size(), &Request[0], MPI_STATUSES_IGNORE);
+    Request.clear();
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if (iProcessor == MASTER_NODE) continue;
+      Offset = Airfoil_Offset[iProcessor];
+      for (iPlane = iProcessor; iPlane < nPlane; iPlane += nProcessor) {
+        for (iPoint = 0; iPoint < Total_nPoint[iPlane]; iPoint++) {
+          Xcoord_Airfoil[iPlane].push_back(Buffer_Receive_Airfoil[Offset++]);
+          Ycoord_Airfoil[iPlane].push_back(Buffer_Receive_Airfoil[Offset++]);
+          Zcoord_Airfoil[iPlane].push_back(Buffer_Receive_Airfoil[Offset++]);
+          Variable_Airfoil[iPlane].push_back(Buffer_Receive_Airfoil[Offset++]);
+        }
       }
     }
   }
   
-  delete[] Buffer_Send_Coord;      delete[] Buffer_Receive_Coord;
-  delete[] Buffer_Send_Variable;   delete[] Buffer_Receive_Variable;
-  delete[] Buffer_Send_GlobalID;   delete[] Buffer_Receive_GlobalID;
-  delete[] Buffer_Send_nEdge;    delete[] Buffer_Receive_nEdge;
+  if (!Request.empty())
+    SU2_MPI::Waitall(Request.size(), &Request[0], MPI_STATUSES_IGNORE);
+  
+#else
+  
+  for (iPlane = 0; iPlane < nPlane; iPlane++)
+    AssembleAirfoil_Section(Plane_Normal[iPlane], config, Edge_Coord[iPlane], Edge_Variable[iPlane], Edge_GlobalID[iPlane],
+                            Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane]);
   
 #endif
   
-  if ((rank == MASTER_NODE) && (Xcoord_Index0.size() != 0)) {
+  delete [] Edge_Coord; delete [] Edge_Variable; delete [] Edge_GlobalID;
+  
+  AD_END_PASSIVE
+  
+}
+
+void CGeometry::ComputeAirfoil_SectionElem(unsigned short iMarker, unsigned long iElem,
+                                           su2double *Plane_P0, su2double *Plane_Normal,
+                                           su2double MinXCoord, su2double MaxXCoord,
+                                           su2double MinYCoord, su2double MaxYCoord,
+                                           su2double MinZCoord, su2double MaxZCoord,
+                                           su2double *FlowVariable, su2double *Coord_Variation, CConfig *config,
+                                           vector<su2double> &Edge_Coord, vector<su2double> &Edge_Variable,
+                                           vector<unsigned long> &Edge_GlobalID) {
+  
+  unsigned short iNode, jNode, iDim, PointIndex = 0;
+  unsigned long iPoint, jPoint;
+  su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0,
+  Intersection[3] = {0.0, 0.0, 0.0}, Variable_Interp, v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0}, CrossProduct = 1.0;
+  su2double Point_Coord[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Point_Variable[2] = {0.0, 0.0};
+  unsigned long Point_GlobalID[4] = {0, 0, 0, 0};
+  
+  /*--- To decide if an element is going to be used or not should be done element based,
+   The first step is to compute and average coordinate for the element ---*/
+  
+  su2double AveXCoord = 0.0;
+  su2double AveYCoord = 0.0;
+  su2double AveZCoord = 0.0;
+  
+  for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+    iPoint = bound[iMarker][iElem]->GetNode(iNode);
+    AveXCoord += node[iPoint]->GetCoord(0);
+    AveYCoord += node[iPoint]->GetCoord(1);
+    if (nDim == 3) AveZCoord += node[iPoint]->GetCoord(2);
+  }
     
-    /*--- Remove singular edges ---*/
+    AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+    AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+    AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
     
-    bool Remove;
+    /*--- To only cut one part of the nacelle based on the cross product
+     of the normal to the plane and a vector that connect the point
+     with the center line ---*/
     
-    do { Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+    CrossProduct = 1.0;
+    
+    if (config->GetGeo_Description() == NACELLE) {
+      
+      su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
+      su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
+      
+      /*--- Translate to the origin ---*/
+      
+      su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
+      su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
+      su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
+      
+      /*--- Apply tilt angle ---*/
+      
+      su2double XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+      su2double YCoord_Trans_Tilt = YCoord_Trans;
+      su2double ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+      
+      /*--- Apply toe angle ---*/
+      
+      su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+      su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+      
+      /*--- Undo plane rotation, we have already rotated the nacelle ---*/
+      
+      /*--- Undo tilt angle ---*/
+      
+      su2double XPlane_Normal_Tilt = Plane_Normal[0]*cos(-Tilt_Angle) + Plane_Normal[2]*sin(-Tilt_Angle);
+      su2double YPlane_Normal_Tilt = Plane_Normal[1];
+      su2double ZPlane_Normal_Tilt = Plane_Normal[2]*cos(-Tilt_Angle) - Plane_Normal[0]*sin(-Tilt_Angle);
+      
+      /*--- Undo toe angle ---*/
+      
+      su2double YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt*sin(-Toe_Angle) + YPlane_Normal_Tilt*cos(-Toe_Angle);
+      su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+      
+      
+      v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
+      v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
+      v3[0] = v1[1]*ZPlane_Normal_Tilt_Toe-v1[2]*YPlane_Normal_Tilt_Toe;
+      CrossProduct = v3[0] * 1.0;
+      
+    }
+  
+  for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+    iPoint = bound[iMarker][iElem]->GetNode(iNode);
+    
+    for (jNode = 0; jNode < bound[iMarker][iElem]->GetnNodes(); jNode++) {
+      jPoint = bound[iMarker][iElem]->GetNode(jNode);
+      
+      /*--- CrossProduct concept is delicated because it allows triangles where only one side is divided by a plane.
+       that is going against the concept that all the triangles are divided twice  and causes probelms because
+       Xcoord_Index0.size() > Xcoord_Index1.size()! ---*/
+      
+      if ((jPoint > iPoint) && (CrossProduct >= 0.0)
+          && ((AveXCoord > MinXCoord) && (AveXCoord < MaxXCoord))
+          && ((AveYCoord > MinYCoord) && (AveYCoord < MaxYCoord))
+          && ((AveZCoord > MinZCoord) && (AveZCoord < MaxZCoord))) {
         
-        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge])) ||
-            ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]))) {
-          
-          Xcoord_Index0.erase (Xcoord_Index0.begin() + iEdge);
-          Ycoord_Index0.erase (Ycoord_Index0.begin() + iEdge);
-          Zcoord_Index0.erase (Zcoord_Index0.begin() + iEdge);
-          Variable_Index0.erase (Variable_Index0.begin() + iEdge);
-          IGlobalID_Index0.erase (IGlobalID_Index0.begin() + iEdge);
-          JGlobalID_Index0.erase (JGlobalID_Index0.begin() + iEdge);
-          
-          Xcoord_Index1.erase (Xcoord_Index1.begin() + iEdge);
-          Ycoord_Index1.erase (Ycoord_Index1.begin() + iEdge);
-          Zcoord_Index1.erase (Zcoord_Index1.begin() + iEdge);
-          Variable_Index1.erase (Variable_Index1.begin() + iEdge);
-          IGlobalID_Index1.erase (IGlobalID_Index1.begin() + iEdge);
-          JGlobalID_Index1.erase (JGlobalID_Index1.begin() + iEdge);
-          
-          Remove = true; break;
+        Segment_P0[0] = 0.0;  Segment_P0[1] = 0.0;  Segment_P0[2] = 0.0;  Variable_P0 = 0.0;
+        Segment_P1[0] = 0.0;  Segment_P1[1] = 0.0;  Segment_P1[2] = 0.0;  Variable_P1 = 0.0;
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          if (Coord_Variation == NULL) {
+            Segment_P0[iDim] = node[iPoint]->GetCoord(iDim);
+            Segment_P1[iDim] = node[jPoint]->GetCoord(iDim);
+          }
+          else {
+            Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint*nDim+iDim];
+            Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint*nDim+iDim];
+          }
         }
-        if (Remove) break;
+        
+        if (FlowVariable != NULL) {
+          Variable_P0 = FlowVariable[iPoint];
+          Variable_P1 = FlowVariable[jPoint];
+        }
+        
+        /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
+        
+        if (nDim == 2) {
+          Edge_Coord.push_back(Segment_P0[0]); Edge_Coord.push_back(Segment_P0[2]); Edge_Coord.push_back(Segment_P0[1]);
+          Edge_Coord.push_back(Segment_P1[0]); Edge_Coord.push_back(Segment_P1[2]); Edge_Coord.push_back(Segment_P1[1]);
+          Edge_Variable.push_back(Variable_P0); Edge_Variable.push_back(Variable_P1);
+          Edge_GlobalID.push_back(node[iPoint]->GetGlobalIndex()); Edge_GlobalID.push_back(node[iPoint]->GetGlobalIndex());
+          Edge_GlobalID.push_back(node[jPoint]->GetGlobalIndex()); Edge_GlobalID.push_back(node[jPoint]->GetGlobalIndex());
+        }
+        
+        /*--- In 3D compute the intersection, the first two intersections
+         of the element define an edge of the section ---*/
+        
+        else if (nDim == 3) {
+          if (SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0, Plane_Normal, Intersection, Variable_Interp)) {
+            if (PointIndex < 2) {
+              for (iDim = 0; iDim < 3; iDim++) Point_Coord[3*PointIndex+iDim] = Intersection[iDim];
+              Point_Variable[PointIndex] = Variable_Interp;
+              Point_GlobalID[2*PointIndex+0] = node[iPoint]->GetGlobalIndex();
+              Point_GlobalID[2*PointIndex+1] = node[jPoint]->GetGlobalIndex();
+            }
+            PointIndex++;
+          }
+        }
+        
       }
-    } while (Remove == true);
+    }
+  }
+  
+  if (PointIndex >= 2) {
+    Edge_Coord.insert(Edge_Coord.end(), Point_Coord, Point_Coord+6);
+    Edge_Variable.insert(Edge_Variable.end(), Point_Variable, Point_Variable+2);
+    Edge_GlobalID.insert(Edge_GlobalID.end(), Point_GlobalID, Point_GlobalID+4);
+  }
+  
+}
+
+void CGeometry::AssembleAirfoil_Section(su2double *Plane_Normal, CConfig *config,
+                                        vector<su2double> &Edge_Coord, vector<su2double> &Edge_Variable,
+                                        vector<unsigned long> &Edge_GlobalID,
+                                        vector<su2double> &Xcoord_Airfoil, vector<su2double> &Ycoord_Airfoil,
+                                        vector<su2double> &Zcoord_Airfoil, vector<su2double> &Variable_Airfoil) {
+  
+  unsigned short Index = 0;
+  long Next_Edge = 0;
+  unsigned long Trailing_Point, Airfoil_Point, iEdge, jEdge, EdgeDonor, nEdge = Edge_Coord.size()/6;
+  su2double Trailing_Coord;
+  bool Found_Edge, FoundEdge;
+  passivedouble Dist_Value;
+  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
+  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil, JGlobalID_Airfoil;
+  vector<unsigned short> Conection_Index0, Conection_Index1;
+  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
+  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
+  vector<bool> AddExtra;
+  
+  if (nEdge == 0) return;
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    Xcoord_Index0.push_back(Edge_Coord[iEdge*6 + 0]);
+    Ycoord_Index0.push_back(Edge_Coord[iEdge*6 + 1]);
+    Zcoord_Index0.push_back(Edge_Coord[iEdge*6 + 2]);
+    Xcoord_Index1.push_back(Edge_Coord[iEdge*6 + 3]);
+    Ycoord_Index1.push_back(Edge_Coord[iEdge*6 + 4]);
+    Zcoord_Index1.push_back(Edge_Coord[iEdge*6 + 5]);
     
-    /*--- Remove repeated edges computing distance, this could happend because the MPI ---*/
+    Variable_Index0.push_back(Edge_Variable[iEdge*2 + 0]);
+    Variable_Index1.push_back(Edge_Variable[iEdge*2 + 1]);
     
-    do { Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
-        for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
-          
-          /*--- Edges with the same orientation ---*/
-          
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))) {
-                
-                Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
-                Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
-                Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
-                Variable_Index0.erase (Variable_Index0.begin() + jEdge);
-                IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
-                JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
-                
-                Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
-                Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
-                Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
-                Variable_Index1.erase (Variable_Index1.begin() + jEdge);
-                IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
-                JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
-                
-                Remove = true; break;
-                
-              }
-          
-          /*--- Edges with oposite orientation ---*/
-          
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))) {
-                
-                Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
-                Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
-                Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
-                Variable_Index0.erase (Variable_Index0.begin() + jEdge);
-                IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
-                JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
-                
-                Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
-                Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
-                Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
-                Variable_Index1.erase (Variable_Index1.begin() + jEdge);
-                IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
-                JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
-                
-                Remove = true; break;
-              }
-          if (Remove) break;
-        }
+    IGlobalID_Index0.push_back(Edge_GlobalID[iEdge*4 + 0]);
+    JGlobalID_Index0.push_back(Edge_GlobalID[iEdge*4 + 1]);
+    IGlobalID_Index1.push_back(Edge_GlobalID[iEdge*4 + 2]);
+    JGlobalID_Index1.push_back(Edge_GlobalID[iEdge*4 + 3]);
+  }
+  
+  
+  /*--- Remove singular edges ---*/
+  
+  bool Remove;
+  
+  do { Remove = false;
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+      
+      if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge])) ||
+          ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]))) {
+        
+        Xcoord_Index0.erase (Xcoord_Index0.begin() + iEdge);
+        Ycoord_Index0.erase (Ycoord_Index0.begin() + iEdge);
+        Zcoord_Index0.erase (Zcoord_Index0.begin() + iEdge);
+        Variable_Index0.erase (Variable_Index0.begin() + iEdge);
+        IGlobalID_Index0.erase (IGlobalID_Index0.begin() + iEdge);
+        JGlobalID_Index0.erase (JGlobalID_Index0.begin() + iEdge);
+        
+        Xcoord_Index1.erase (Xcoord_Index1.begin() + iEdge);
+        Ycoord_Index1.erase (Ycoord_Index1.begin() + iEdge);
+        Zcoord_Index1.erase (Zcoord_Index1.begin() + iEdge);
+        Variable_Index1.erase (Variable_Index1.begin() + iEdge);
+        IGlobalID_Index1.erase (IGlobalID_Index1.begin() + iEdge);
+        JGlobalID_Index1.erase (JGlobalID_Index1.begin() + iEdge);
+        
+        Remove = true; break;
+      }
+      if (Remove) break;
+    }
+  } while (Remove == true);
+  
+  /*--- Remove repeated edges computing distance, this could happend because the MPI ---*/
+  
+  do { Remove = false;
+    for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
+      for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
+        
+        /*--- Edges with the same orientation ---*/
+        
+        if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
+             ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) &&
+            (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
+             ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))) {
+              
+              Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
+              Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
+              Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
+              Variable_Index0.erase (Variable_Index0.begin() + jEdge);
+              IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
+              JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
+              
+              Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
+              Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
+              Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
+              Variable_Index1.erase (Variable_Index1.begin() + jEdge);
+              IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
+              JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
+              
+              Remove = true; break;
+              
+            }
+        
+        /*--- Edges with oposite orientation ---*/
+        
+        if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
+             ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) &&
+            (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
+             ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))) {
+              
+              Xcoord_Index0.erase (Xcoord_Index0.begin() + jEdge);
+              Ycoord_Index0.erase (Ycoord_Index0.begin() + jEdge);
+              Zcoord_Index0.erase (Zcoord_Index0.begin() + jEdge);
+              Variable_Index0.erase (Variable_Index0.begin() + jEdge);
+              IGlobalID_Index0.erase (IGlobalID_Index0.begin() + jEdge);
+              JGlobalID_Index0.erase (JGlobalID_Index0.begin() + jEdge);
+              
+              Xcoord_Index1.erase (Xcoord_Index1.begin() + jEdge);
+              Ycoord_Index1.erase (Ycoord_Index1.begin() + jEdge);
+              Zcoord_Index1.erase (Zcoord_Index1.begin() + jEdge);
+              Variable_Index1.erase (Variable_Index1.begin() + jEdge);
+              IGlobalID_Index1.erase (IGlobalID_Index1.begin() + jEdge);
+              JGlobalID_Index1.erase (JGlobalID_Index1.begin() + jEdge);
+              
+              Remove = true; break;
+            }
         if (Remove) break;
       }
-      
-    } while (Remove == true);
+      if (Remove) break;
+    }
     
-    if (Xcoord_Index0.size() != 1) {
-      
-      /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
-      
-      if (config->GetGeo_Description() == FUSELAGE) {
-        su2double Angle = -0.5*PI_NUMBER;
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          su2double XCoord = Xcoord_Index0[iEdge]*cos(Angle) - Ycoord_Index0[iEdge]*sin(Angle);
-          su2double YCoord = Ycoord_Index0[iEdge]*cos(Angle) + Xcoord_Index0[iEdge]*sin(Angle);
-          su2double ZCoord = Zcoord_Index0[iEdge];
-          Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
-          XCoord = Xcoord_Index1[iEdge]*cos(Angle) - Ycoord_Index1[iEdge]*sin(Angle);
-          YCoord = Ycoord_Index1[iEdge]*cos(Angle) + Xcoord_Index1[iEdge]*sin(Angle);
-          ZCoord = Zcoord_Index1[iEdge];
-          Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
-        }
+  } while (Remove == true);
+  
+  if (Xcoord_Index0.size() != 1) {
+    
+    /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
+    
+    if (config->GetGeo_Description() == FUSELAGE) {
+      su2double Angle = -0.5*PI_NUMBER;
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+        su2double XCoord = Xcoord_Index0[iEdge]*cos(Angle) - Ycoord_Index0[iEdge]*sin(Angle);
+        su2double YCoord = Ycoord_Index0[iEdge]*cos(Angle) + Xcoord_Index0[iEdge]*sin(Angle);
+        su2double ZCoord = Zcoord_Index0[iEdge];
+        Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
+        XCoord = Xcoord_Index1[iEdge]*cos(Angle) - Ycoord_Index1[iEdge]*sin(Angle);
+        YCoord = Ycoord_Index1[iEdge]*cos(Angle) + Xcoord_Index1[iEdge]*sin(Angle);
+        ZCoord = Zcoord_Index1[iEdge];
+        Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
       }
+    }
+    
+    /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
+    
+    
+    if (config->GetGeo_Description() == NACELLE) {
       
-      /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
-      
-      
-      if (config->GetGeo_Description() == NACELLE) {
-        
-        su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
-        su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
-        su2double Theta_deg = atan2(Plane_Normal[1],-Plane_Normal[2])/PI_NUMBER*180 + 180;
-        su2double Roll_Angle = 0.5*PI_NUMBER - Theta_deg*PI_NUMBER/180;
+      su2double Tilt_Angle = config->GetNacelleLocation(3)*PI_NUMBER/180;
+      su2double Toe_Angle = config->GetNacelleLocation(4)*PI_NUMBER/180;
+      su2double Theta_deg = atan2(Plane_Normal[1],-Plane_Normal[2])/PI_NUMBER*180 + 180;
+      su2double Roll_Angle = 0.5*PI_NUMBER - Theta_deg*PI_NUMBER/180;
 
-        su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
-        XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
+      su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
+      XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
+      
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
         
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          
-          /*--- First point of the edge ---*/
+        /*--- First point of the edge ---*/
 
-          /*--- Translate to the origin ---*/
+        /*--- Translate to the origin ---*/
 
-          XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
-          
-          /*--- Apply tilt angle ---*/
+        XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
+        YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
+        ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
+        
+        /*--- Apply tilt angle ---*/
 
-          XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+        XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+        YCoord_Trans_Tilt = YCoord_Trans;
+        ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
 
-          /*--- Apply toe angle ---*/
-          
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+        /*--- Apply toe angle ---*/
+        
+        XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
+        YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+        ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
 
-          /*--- Rotate to X-Z plane (roll) ---*/
+        /*--- Rotate to X-Z plane (roll) ---*/
 
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
-          
-          /*--- Update coordinates ---*/
-          
-          Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
-          
-          /*--- Second point of the edge ---*/
-          
-          /*--- Translate to the origin ---*/
-          
-          XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
-          
-          /*--- Apply tilt angle ---*/
-          
-          XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
-          
-          /*--- Apply toe angle ---*/
-          
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
-          
-          /*--- Rotate to X-Z plane (roll) ---*/
-          
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
-          
-          /*--- Update coordinates ---*/
-          
-          Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
-          
-        }
+        XCoord = XCoord_Trans_Tilt_Toe;
+        YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
+        ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
+        
+        /*--- Update coordinates ---*/
+        
+        Xcoord_Index0[iEdge] = XCoord; Ycoord_Index0[iEdge] = YCoord; Zcoord_Index0[iEdge] = ZCoord;
+        
+        /*--- Second point of the edge ---*/
+        
+        /*--- Translate to the origin ---*/
+        
+        XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
+        YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
+        ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
+        
+        /*--- Apply tilt angle ---*/
+        
+        XCoord_Trans_Tilt = XCoord_Trans*cos(Tilt_Angle) + ZCoord_Trans*sin(Tilt_Angle);
+        YCoord_Trans_Tilt = YCoord_Trans;
+        ZCoord_Trans_Tilt = ZCoord_Trans*cos(Tilt_Angle) - XCoord_Trans*sin(Tilt_Angle);
+        
+        /*--- Apply toe angle ---*/
+        
+        XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*cos(Toe_Angle) - YCoord_Trans_Tilt*sin(Toe_Angle);
+        YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt*sin(Toe_Angle) + YCoord_Trans_Tilt*cos(Toe_Angle);
+        ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+        
+        /*--- Rotate to X-Z plane (roll) ---*/
+        
+        XCoord = XCoord_Trans_Tilt_Toe;
+        YCoord = YCoord_Trans_Tilt_Toe*cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe*sin(Roll_Angle);
+        ZCoord = YCoord_Trans_Tilt_Toe*sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe*cos(Roll_Angle);
+        
+        /*--- Update coordinates ---*/
+        
+        Xcoord_Index1[iEdge] = XCoord; Ycoord_Index1[iEdge] = YCoord; Zcoord_Index1[iEdge] = ZCoord;
+        
       }
-      
-      
-      /*--- Identify the extreme of the curve and close it ---*/
-      
-      Conection_Index0.reserve(Xcoord_Index0.size()+1);
-      Conection_Index1.reserve(Xcoord_Index0.size()+1);
-      
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        Conection_Index0[iEdge] = 0;
-        Conection_Index1[iEdge] = 0;
+    }
+    
+    
+    /*--- Identify the extreme of the curve and close it ---*/
+    
+    Conection_Index0.reserve(Xcoord_Index0.size()+1);
+    Conection_Index1.reserve(Xcoord_Index0.size()+1);
+    
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+      Conection_Index0[iEdge] = 0;
+      Conection_Index1[iEdge] = 0;
+    }
+    
+    for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
+      for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
+        
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge])))
+        { Conection_Index0[iEdge]++; Conection_Index0[jEdge]++; }
+        
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge])))
+        { Conection_Index0[iEdge]++; Conection_Index1[jEdge]++; }
+        
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))
+        { Conection_Index1[iEdge]++; Conection_Index0[jEdge]++; }
+        
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))
+        { Conection_Index1[iEdge]++; Conection_Index1[jEdge]++; }
+        
       }
-      
-      for (iEdge = 0; iEdge < Xcoord_Index0.size()-1; iEdge++) {
-        for (jEdge = iEdge+1; jEdge < Xcoord_Index0.size(); jEdge++) {
-          
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge])))
-          { Conection_Index0[iEdge]++; Conection_Index0[jEdge]++; }
-          
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge])))
-          { Conection_Index0[iEdge]++; Conection_Index1[jEdge]++; }
-          
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))
-          { Conection_Index1[iEdge]++; Conection_Index0[jEdge]++; }
-          
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) && (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))
-          { Conection_Index1[iEdge]++; Conection_Index1[jEdge]++; }
-          
-        }
+    }
+    
+    /*--- Connect extremes of the curves ---*/
+    
+    /*--- First: Identify the extremes of the curve in the extra vector  ---*/
+    
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+      if (Conection_Index0[iEdge] == 0) {
+        XcoordExtra.push_back(Xcoord_Index0[iEdge]);
+        YcoordExtra.push_back(Ycoord_Index0[iEdge]);
+        ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
+        VariableExtra.push_back(Variable_Index0[iEdge]);
+        IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
+        JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
+        AddExtra.push_back(true);
       }
-      
-      /*--- Connect extremes of the curves ---*/
-      
-      /*--- First: Identify the extremes of the curve in the extra vector  ---*/
-      
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Conection_Index0[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index0[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index0[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
-          VariableExtra.push_back(Variable_Index0[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
-          AddExtra.push_back(true);
-        }
-        if (Conection_Index1[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index1[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index1[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
-          VariableExtra.push_back(Variable_Index1[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
-          AddExtra.push_back(true);
-        }
+      if (Conection_Index1[iEdge] == 0) {
+        XcoordExtra.push_back(Xcoord_Index1[iEdge]);
+        YcoordExtra.push_back(Ycoord_Index1[iEdge]);
+        ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
+        VariableExtra.push_back(Variable_Index1[iEdge]);
+        IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
+        JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
+        AddExtra.push_back(true);
       }
+    }
+    
+    /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
+    
+    if (XcoordExtra.size() > 1) {
       
-      /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
-      
-      if (XcoordExtra.size() > 1) {
+      for (iEdge = 0; iEdge < XcoordExtra.size()-1; iEdge++) {
         
-        for (iEdge = 0; iEdge < XcoordExtra.size()-1; iEdge++) {
-          
-          su2double MinDist = 1E6; FoundEdge = false; EdgeDonor = 0;
-          for (jEdge = iEdge+1; jEdge < XcoordExtra.size(); jEdge++) {
-            Dist_Value = sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge])-SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
-            if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
-              EdgeDonor = jEdge; FoundEdge = true;
-            }
+        su2double MinDist = 1E6; FoundEdge = false; EdgeDonor = 0;
+        for (jEdge = iEdge+1; jEdge < XcoordExtra.size(); jEdge++) {
+          Dist_Value = sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge])-SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
+          if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
+            EdgeDonor = jEdge; FoundEdge = true;
           }
+        }
+        
+        if (FoundEdge) {
           
-          if (FoundEdge) {
-            
-            /*--- Add first point of the new edge ---*/
-            
-            Xcoord_Index0.push_back (XcoordExtra[iEdge]);
-            Ycoord_Index0.push_back (YcoordExtra[iEdge]);
-            Zcoord_Index0.push_back (ZcoordExtra[iEdge]);
-            Variable_Index0.push_back (VariableExtra[iEdge]);
-            IGlobalID_Index0.push_back (IGlobalIDExtra[iEdge]);
-            JGlobalID_Index0.push_back (JGlobalIDExtra[iEdge]);
-            AddExtra[iEdge] = false;
-            
-            /*--- Add second (closest)  point of the new edge ---*/
-            
-            Xcoord_Index1.push_back (XcoordExtra[EdgeDonor]);
-            Ycoord_Index1.push_back (YcoordExtra[EdgeDonor]);
-            Zcoord_Index1.push_back (ZcoordExtra[EdgeDonor]);
-            Variable_Index1.push_back (VariableExtra[EdgeDonor]);
-            IGlobalID_Index1.push_back (IGlobalIDExtra[EdgeDonor]);
-            JGlobalID_Index1.push_back (JGlobalIDExtra[EdgeDonor]);
-            AddExtra[EdgeDonor] = false;
-            
-          }
+          /*--- Add first point of the new edge ---*/
+          
+          Xcoord_Index0.push_back (XcoordExtra[iEdge]);
+          Ycoord_Index0.push_back (YcoordExtra[iEdge]);
+          Zcoord_Index0.push_back (ZcoordExtra[iEdge]);
+          Variable_Index0.push_back (VariableExtra[iEdge]);
+          IGlobalID_Index0.push_back (IGlobalIDExtra[iEdge]);
+          JGlobalID_Index0.push_back (JGlobalIDExtra[iEdge]);
+          AddExtra[iEdge] = false;
+          
+          /*--- Add second (closest)  point of the new edge ---*/
+          
+          Xcoord_Index1.push_back (XcoordExtra[EdgeDonor]);
+          Ycoord_Index1.push_back (YcoordExtra[EdgeDonor]);
+          Zcoord_Index1.push_back (ZcoordExtra[EdgeDonor]);
+          Variable_Index1.push_back (VariableExtra[EdgeDonor]);
+          IGlobalID_Index1.push_back (IGlobalIDExtra[EdgeDonor]);
+          JGlobalID_Index1.push_back (JGlobalIDExtra[EdgeDonor]);
+          AddExtra[EdgeDonor] = false;
           
         }
         
       }
       
-      else if (XcoordExtra.size() == 1) {
-        cout <<"There cutting system has failed, there is an incomplete curve (not used)." << endl;
-      }
-      
-      /*--- Find and add the trailing edge to to the list
-       and the contect the first point to the trailing edge ---*/
-      
-      Trailing_Point = 0; Trailing_Coord = Xcoord_Index0[0];
-      for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Xcoord_Index0[iEdge] > Trailing_Coord) {
-          Trailing_Point = iEdge; Trailing_Coord = Xcoord_Index0[iEdge];
-        }
+    }
+    
+    else if (XcoordExtra.size() == 1) {
+      cout <<"There cutting system has failed, there is an incomplete curve (not used)." << endl;
+    }
+    
+    /*--- Find and add the trailing edge to to the list
+     and the contect the first point to the trailing edge ---*/
+    
+    Trailing_Point = 0; Trailing_Coord = Xcoord_Index0[0];
+    for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
+      if (Xcoord_Index0[iEdge] > Trailing_Coord) {
+        Trailing_Point = iEdge; Trailing_Coord = Xcoord_Index0[iEdge];
       }
+    }
+    
+    Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
+    Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
+    Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
+    Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
+    IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
+    JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
+    
+    Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
+    Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
+    Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
+    Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
+    IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
+    JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
+    
+    Xcoord_Index0.erase (Xcoord_Index0.begin() + Trailing_Point);
+    Ycoord_Index0.erase (Ycoord_Index0.begin() + Trailing_Point);
+    Zcoord_Index0.erase (Zcoord_Index0.begin() + Trailing_Point);
+    Variable_Index0.erase (Variable_Index0.begin() + Trailing_Point);
+    IGlobalID_Index0.erase (IGlobalID_Index0.begin() + Trailing_Point);
+    JGlobalID_Index0.erase (JGlobalID_Index0.begin() + Trailing_Point);
+    
+    Xcoord_Index1.erase (Xcoord_Index1.begin() + Trailing_Point);
+    Ycoord_Index1.erase (Ycoord_Index1.begin() + Trailing_Point);
+    Zcoord_Index1.erase (Zcoord_Index1.begin() + Trailing_Point);
+    Variable_Index1.erase (Variable_Index1.begin() + Trailing_Point);
+    IGlobalID_Index1.erase (IGlobalID_Index1.begin() + Trailing_Point);
+    JGlobalID_Index1.erase (JGlobalID_Index1.begin() + Trailing_Point);
+    
+    
+    /*--- Algorithm for adding the rest of the points ---*/
+    
+    do {
       
-      Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
-      
-      Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
-      
-      Xcoord_Index0.erase (Xcoord_Index0.begin() + Trailing_Point);
-      Ycoord_Index0.erase (Ycoord_Index0.begin() + Trailing_Point);
-      Zcoord_Index0.erase (Zcoord_Index0.begin() + Trailing_Point);
-      Variable_Index0.erase (Variable_Index0.begin() + Trailing_Point);
-      IGlobalID_Index0.erase (IGlobalID_Index0.begin() + Trailing_Point);
-      JGlobalID_Index0.erase (JGlobalID_Index0.begin() + Trailing_Point);
+      /*--- Last added point in the list ---*/
       
-      Xcoord_Index1.erase (Xcoord_Index1.begin() + Trailing_Point);
-      Ycoord_Index1.erase (Ycoord_Index1.begin() + Trailing_Point);
-      Zcoord_Index1.erase (Zcoord_Index1.begin() + Trailing_Point);
-      Variable_Index1.erase (Variable_Index1.begin() + Trailing_Point);
-      IGlobalID_Index1.erase (IGlobalID_Index1.begin() + Trailing_Point);
-      JGlobalID_Index1.erase (JGlobalID_Index1.begin() + Trailing_Point);
+      Airfoil_Point = Xcoord_Airfoil.size() - 1;
       
+      /*--- Find the closest point  ---*/
       
-      /*--- Algorithm for adding the rest of the points ---*/
+      Found_Edge = false;
       
-      do {
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
         
-        /*--- Last added point in the list ---*/
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
+          Next_Edge = iEdge; Found_Edge = true; Index = 0; break;
+        }
         
-        Airfoil_Point = Xcoord_Airfoil.size() - 1;
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
+          Next_Edge = iEdge; Found_Edge = true; Index = 1; break;
+        }
         
-        /*--- Find the closest point  ---*/
+      }
+      
+      /*--- Add and remove the next point to the list and the next point in the edge ---*/
+      
+      if (Found_Edge) {
         
-        Found_Edge = false;
+        if (Index == 0) {
+          Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
+          Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
+          Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
+          Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
+          IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
+          JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
+        }
         
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge; Found_Edge = true; Index = 0; break;
-          }
-          
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) && (JGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge; Found_Edge = true; Index = 1; break;
-          }
-          
+        if (Index == 1) {
+          Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
+          Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
+          Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
+          Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
+          IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
+          JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
         }
         
-        /*--- Add and remove the next point to the list and the next point in the edge ---*/
+        Xcoord_Index0.erase(Xcoord_Index0.begin() + Next_Edge);
+        Ycoord_Index0.erase(Ycoord_Index0.begin() + Next_Edge);
+        Zcoord_Index0.erase(Zcoord_Index0.begin() + Next_Edge);
+        Variable_Index0.erase(Variable_Index0.begin() + Next_Edge);
+        IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Next_Edge);
+        JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Next_Edge);
         
-        if (Found_Edge) {
-          
-          if (Index == 0) {
-            Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
-          }
-          
-          if (Index == 1) {
-            Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
-          }
-          
-          Xcoord_Index0.erase(Xcoord_Index0.begin() + Next_Edge);
-          Ycoord_Index0.erase(Ycoord_Index0.begin() + Next_Edge);
-          Zcoord_Index0.erase(Zcoord_Index0.begin() + Next_Edge);
-          Variable_Index0.erase(Variable_Index0.begin() + Next_Edge);
-          IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Next_Edge);
-          JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Next_Edge);
-          
-          Xcoord_Index1.erase(Xcoord_Index1.begin() + Next_Edge);
-          Ycoord_Index1.erase(Ycoord_Index1.begin() + Next_Edge);
-          Zcoord_Index1.erase(Zcoord_Index1.begin() + Next_Edge);
-          Variable_Index1.erase(Variable_Index1.begin() + Next_Edge);
-          IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Next_Edge);
-          JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Next_Edge);
-          
-        }
-        else { break; }
+        Xcoord_Index1.erase(Xcoord_Index1.begin() + Next_Edge);
+        Ycoord_Index1.erase(Ycoord_Index1.begin() + Next_Edge);
+        Zcoord_Index1.erase(Zcoord_Index1.begin() + Next_Edge);
+        Variable_Index1.erase(Variable_Index1.begin() + Next_Edge);
+        IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Next_Edge);
+        JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Next_Edge);
         
-      } while (Xcoord_Index0.size() != 0);
-      
-      /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
-      
-      Xcoord_Index0.clear(); Ycoord_Index0.clear(); Zcoord_Index0.clear(); Variable_Index0.clear();  IGlobalID_Index0.clear();  JGlobalID_Index0.clear();
-      Xcoord_Index1.clear(); Ycoord_Index1.clear(); Zcoord_Index1.clear(); Variable_Index1.clear();  IGlobalID_Index1.clear();  JGlobalID_Index1.clear();
+      }
+      else { break; }
       
-    }
+    } while (Xcoord_Index0.size() != 0);
     
-  }
-  
-  AD_END_PASSIVE
+    /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
+    
+    Xcoord_Index0.clear(); Ycoord_Index0.clear(); Zcoord_Index0.clear(); Variable_Index0.clear();  IGlobalID_Index0.clear();  JGlobalID_Index0.clear();
+    Xcoord_Index1.clear(); Ycoord_Index1.clear(); Zcoord_Index1.clear(); Variable_Index1.clear();  IGlobalID_Index1.clear();  JGlobalID_Index1.clear();
+    
+  }
   
 }
 
@@ -1862,7 +2112,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
 void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
                                         const vector<pair<unsigned short,su2double> > &kernels,
                                         const su2double *input_values,
-                                        su2double *output_values) const
+                                        su2double *output_values)
 {
   /*--- Apply a filter to "input_values". The filter is an averaging process over the neighbourhood
   of each element, which is a circle in 2D and a sphere in 3D of radius "filter_radius".
@@ -1870,7 +2120,7 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
   can be specified in which case they are applied sequentially (each one being applied to the
   output values of the previous filter. ---*/
   
-  unsigned long iElem, iElem_global;
+  unsigned long iElem, iNeigh;
   
   /*--- Initialize output values and check if we need to do any more work than that ---*/
   for (iElem=0; iElem<nElem; ++iElem)
@@ -1878,132 +2128,42 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
 
   if ( kernels.empty() ) return;
 
-  /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
-  processor, this is required because the filter reaches far into adjacent partitions. ---*/
-  
-  /*--- Adjacency matrix ---*/
-  vector<unsigned long> neighbour_start;
-  long *neighbour_idx = NULL;
-  GetGlobalElementAdjacencyMatrix(neighbour_start,neighbour_idx);
-
-  /*--- Element centroids and volumes ---*/
-  su2double *cg_elem  = new su2double [Global_nElemDomain*nDim],
-            *vol_elem = new su2double [Global_nElemDomain];
-
-  /*--- Initialize ---*/
-  for(iElem=0; iElem<Global_nElemDomain; ++iElem) {
-    for(unsigned short iDim=0; iDim<nDim; ++iDim)
-      cg_elem[nDim*iElem+iDim] = 0.0;
-    vol_elem[iElem] = 0.0;
-  }
-  /*--- Populate ---*/
-  for(iElem=0; iElem<nElem; ++iElem) {
-    iElem_global = elem[iElem]->GetGlobalIndex();
-    for(unsigned short iDim=0; iDim<nDim; ++iDim) 
-      cg_elem[nDim*iElem_global+iDim] = elem[iElem]->GetCG(iDim);
-    vol_elem[iElem_global] = elem[iElem]->GetVolume();
-  }
-#ifdef HAVE_MPI
-  /*--- Share with all processors ---*/
-  {
-    su2double *buffer = NULL, *tmp = NULL;
-
-    buffer = new su2double [Global_nElemDomain*nDim];
-    SU2_MPI::Allreduce(cg_elem,buffer,Global_nElemDomain*nDim,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-    tmp = cg_elem; cg_elem = buffer; delete [] tmp;
-
-    buffer = new su2double [Global_nElemDomain];
-    SU2_MPI::Allreduce(vol_elem,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-    tmp = vol_elem; vol_elem = buffer; delete [] tmp;
-  }
-  
-  /*--- Account for the duplication introduced by the halo elements and the
-  reduction using MPI_SUM, which is required to maintain differentiabillity. ---*/
-  unsigned short *halo_detect = new unsigned short [Global_nElemDomain];
-
-  for(iElem=0; iElem<Global_nElemDomain; ++iElem) halo_detect[iElem] = 0;
-  for(iElem=0; iElem<nElem; ++iElem) halo_detect[elem[iElem]->GetGlobalIndex()] = 1;
-  {
-    unsigned short *buffer = new unsigned short [Global_nElemDomain], *tmp = NULL;
-    MPI_Allreduce(halo_detect,buffer,Global_nElemDomain,MPI_UNSIGNED_SHORT,MPI_SUM,MPI_COMM_WORLD);
-    tmp = halo_detect; halo_detect = buffer; delete [] tmp;
-  }
-  for(iElem=0; iElem<Global_nElemDomain; ++iElem) {
-    su2double numRepeat = halo_detect[iElem];
-    for(unsigned short iDim=0; iDim<nDim; ++iDim)
-      cg_elem[nDim*iElem+iDim] /= numRepeat;
-    vol_elem[iElem] /= numRepeat;
-  }
-#endif
-
+  /*--- FIRST: Find the elements of other partitions that are within the filter radius of the
+  local ones, and the neighbourhood and weights of each element. This only depends on the mesh
+  and on the kernels, so it is reused by subsequent calls (e.g. every discrete adjoint iteration). ---*/
+  if ((filter_radius != Filter_Radius) || (kernels != Filter_Kernels))
+    SetFilterNeighbourhood(filter_radius, kernels);
 
-  /*--- SECOND: Each processor performs the average for its elements. For each
-  element we look for neighbours of neighbours of... until the distance to the
-  closest newly found one is greater than the filter radius.  ---*/
-
-  /*--- Inputs of a filter stage, like with CG and volumes, each processor needs to see everything ---*/
-  su2double *work_values = new su2double [Global_nElemDomain];
+  /*--- SECOND: Each processor performs the average for its elements. The inputs of a filter stage
+  are the values of the local elements followed by those of the nearby elements of other partitions. ---*/
+  vector<su2double> work_values(nElem+Filter_nElemGhost, 0.0);
   
   for (unsigned long iKernel=0; iKernel<kernels.size(); ++iKernel)
   {
     unsigned short kernel_type = kernels[iKernel].first;
     su2double kernel_param = kernels[iKernel].second;
-    su2double kernel_radius = filter_radius[iKernel];
+
+    const vector<unsigned long> &neighbour_start = Filter_Neighbour_Start[iKernel],
+                                &neighbour_idx   = Filter_Neighbour_Idx[iKernel];
+    const vector<su2double> &weight = Filter_Weight[iKernel];
 
     /*--- Synchronize work values ---*/
-    /*--- Initialize ---*/
-    for(iElem=0; iElem<Global_nElemDomain; ++iElem) work_values[iElem] = 0.0;
-    /*--- Populate ---*/
-    for(iElem=0; iElem<nElem; ++iElem)
-      work_values[elem[iElem]->GetGlobalIndex()] = output_values[iElem];
-#ifdef HAVE_MPI
-    /*--- Share with all processors ---*/
-    {
-      su2double *buffer = new su2double [Global_nElemDomain], *tmp = NULL;
-      SU2_MPI::Allreduce(work_values,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-      tmp = work_values; work_values = buffer; delete [] tmp;
-    }
-    /*--- Account for duplication ---*/
-    for(iElem=0; iElem<Global_nElemDomain; ++iElem) {
-      su2double numRepeat = halo_detect[iElem];
-      work_values[iElem] /= numRepeat;
-    }
-#endif
+    for (iElem=0; iElem<nElem; ++iElem) work_values[iElem] = output_values[iElem];
+    ExchangeFilterValues(work_values);
 
     /*--- Filter ---*/
     for (iElem=0; iElem<nElem; ++iElem)
     {
-      /*--- Center of the search ---*/
-      iElem_global = elem[iElem]->GetGlobalIndex();
-    
-      /*--- Find the neighbours of iElem ---*/
-      vector<long> neighbours;
-      GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius),
-                             neighbour_start, neighbour_idx, cg_elem, neighbours);
-    
-      /*--- Apply the kernel ---*/
-      su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
+      su2double numerator = 0.0, denominator = 0.0;
     
       switch ( kernel_type ) {
         /*--- distance-based kernels (weighted averages) ---*/
         case CONSTANT_WEIGHT_FILTER: case CONICAL_WEIGHT_FILTER: case GAUSSIAN_WEIGHT_FILTER:
             
-          for (vector<long>::iterator it=neighbours.begin(); it!=neighbours.end(); ++it)
+          for (iNeigh=neighbour_start[iElem]; iNeigh<neighbour_start[iElem+1]; ++iNeigh)
           {
-            su2double distance = 0.0;
-            for (unsigned short iDim=0; iDim<nDim; ++iDim)
-              distance += pow(cg_elem[nDim*iElem_global+iDim]-cg_elem[nDim*(*it)+iDim],2.0);
-            distance = sqrt(distance);
-      
-            switch ( kernel_type ) {
-              case CONSTANT_WEIGHT_FILTER: weight = 1.0; break;
-              case CONICAL_WEIGHT_FILTER:  weight = kernel_radius-distance; break;
-              case GAUSSIAN_WEIGHT_FILTER: weight = exp(-0.5*pow(distance/kernel_param,2.0)); break;
-              default: break;
-            }
-            weight *= vol_elem[*it];
-            numerator   += weight*work_values[*it];
-            denominator += weight;
+            numerator   += weight[iNeigh]*work_values[neighbour_idx[iNeigh]];
+            denominator += weight[iNeigh];
           }
           output_values[iElem] = numerator/denominator;
           break;
@@ -2011,11 +2171,11 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
         /*--- morphology kernels (image processing) ---*/
         case DILATE_MORPH_FILTER: case ERODE_MORPH_FILTER:
             
-          for (vector<long>::iterator it=neighbours.begin(); it!=neighbours.end(); ++it)
+          for (iNeigh=neighbour_start[iElem]; iNeigh<neighbour_start[iElem+1]; ++iNeigh)
           {
             switch ( kernel_type ) {
-              case DILATE_MORPH_FILTER: numerator += exp(kernel_param*work_values[*it]); break;
-              case ERODE_MORPH_FILTER:  numerator += exp(kernel_param*(1.0-work_values[*it])); break;
+              case DILATE_MORPH_FILTER: numerator += exp(kernel_param*work_values[neighbour_idx[iNeigh]]); break;
+              case ERODE_MORPH_FILTER:  numerator += exp(kernel_param*(1.0-work_values[neighbour_idx[iNeigh]])); break;
               default: break;
             }
             denominator += 1.0;
@@ -2029,147 +2189,264 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
       }
     }
   }
-  
-  delete [] neighbour_idx;
-  delete [] cg_elem;
-  delete [] vol_elem;
-  delete [] work_values;
-#ifdef HAVE_MPI
-  delete [] halo_detect;
-#endif
 }
 
-void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour_start,
-                                                long *&neighbour_idx) const
+void CGeometry::SetFilterNeighbourhood(const vector<su2double> &filter_radius,
+                                       const vector<pair<unsigned short,su2double> > &kernels)
 {
-  unsigned long iElem, iElem_global;
-
-  /*--- Determine how much space we need for the adjacency matrix by counting the
-  neighbours of each element, i.e. its number of faces---*/
-  unsigned short *nFaces_elem = new unsigned short [Global_nElemDomain];
+  unsigned long iElem, iNeigh;
+  unsigned short iDim, iKernel;
 
-  for(iElem=0; iElem<Global_nElemDomain; ++iElem) nFaces_elem[iElem] = 0;
+  /*--- Centroids, volumes and global indices of the local elements, the data of the elements
+  of other partitions is appended to these vectors as it is received. ---*/
+  vector<su2double> cg_elem(nElem*nDim), vol_elem(nElem);
+  vector<unsigned long> global_elem(nElem);
 
-  for(iElem=0; iElem<nElem; ++iElem) {
-    iElem_global = elem[iElem]->GetGlobalIndex();
-    nFaces_elem[iElem_global] = elem[iElem]->GetnFaces();
+  for (iElem=0; iElem<nElem; ++iElem) {
+    for (iDim=0; iDim<nDim; ++iDim)
+      cg_elem[nDim*iElem+iDim] = elem[iElem]->GetCG(iDim);
+    vol_elem[iElem] = elem[iElem]->GetVolume();
+    global_elem[iElem] = elem[iElem]->GetGlobalIndex();
   }
+
+  Filter_nElemGhost = 0;
+  Filter_Send_Rank.clear();  Filter_Send_Elem.clear();  Filter_Send_Start.assign(1,0);
+  Filter_Recv_Rank.clear();  Filter_Recv_Slot.clear();  Filter_Recv_Start.assign(1,0);
+
 #ifdef HAVE_MPI
-  /*--- Share with all processors ---*/
-  {
-    unsigned short *buffer = new unsigned short [Global_nElemDomain], *tmp = NULL;
-    MPI_Allreduce(nFaces_elem,buffer,Global_nElemDomain,MPI_UNSIGNED_SHORT,MPI_MAX,MPI_COMM_WORLD);
-    /*--- swap pointers and delete old data to keep the same variable name after reduction ---*/
-    tmp = nFaces_elem; nFaces_elem = buffer; delete [] tmp;
+
+  /*--- The largest radius defines the width of the layer of elements exchanged between partitions. ---*/
+  su2double max_radius = 0.0;
+  for (iKernel=0; iKernel<kernels.size(); ++iKernel)
+    max_radius = max(max_radius, filter_radius[iKernel]);
+
+  /*--- Bounding box of the local centroids {xmin,ymin,(zmin),xmax,ymax,(zmax)}, known by all ranks. ---*/
+  vector<su2double> bbox(2*nDim), bbox_all(2*nDim*size);
+
+  for (iDim=0; iDim<nDim; ++iDim) {
+    bbox[iDim]      =  numeric_limits<passivedouble>::max();
+    bbox[nDim+iDim] = -numeric_limits<passivedouble>::max();
   }
-#endif
+  for (iElem=0; iElem<nElem; ++iElem) {
+    for (iDim=0; iDim<nDim; ++iDim) {
+      bbox[iDim]      = min(bbox[iDim],      cg_elem[nDim*iElem+iDim]);
+      bbox[nDim+iDim] = max(bbox[nDim+iDim], cg_elem[nDim*iElem+iDim]);
+    }
+  }
+  SU2_MPI::Allgather(bbox.data(), 2*nDim, MPI_DOUBLE, bbox_all.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
 
-  /*--- Vector with the addresses of the start of the neighbours of a given element.
-  This is generated by a cumulative sum of the neighbour count. ---*/
-  neighbour_start.resize(Global_nElemDomain+1);
-  
-  neighbour_start[0] = 0;
-  for(iElem=0; iElem<Global_nElemDomain; ++iElem) {
-    neighbour_start[iElem+1] = neighbour_start[iElem]+nFaces_elem[iElem];
-  }
-  delete [] nFaces_elem;
-
-  /*--- Allocate ---*/
-  unsigned long matrix_size = neighbour_start[Global_nElemDomain];
-  if ( neighbour_idx != NULL )
-    SU2_MPI::Error("neighbour_idx is expected to be NULL, stopping to avoid a potential memory leak",CURRENT_FUNCTION);
-  neighbour_idx = new long [matrix_size];
-  /*--- Initialize ---*/
-  for(iElem=0; iElem<matrix_size; ++iElem) neighbour_idx[iElem] = -1;
-  /*--- Populate ---*/
-  for(iElem=0; iElem<nElem; ++iElem)
-  {
-    iElem_global = elem[iElem]->GetGlobalIndex();
-    unsigned long start_pos = neighbour_start[iElem_global];
-    
-    for(unsigned short iFace=0; iFace<elem[iElem]->GetnFaces(); ++iFace)
-    {
-      long neighbour = elem[iElem]->GetNeighbor_Elements(iFace);
-      
-      if ( neighbour>=0 ) {
-        neighbour_idx[start_pos+iFace] = elem[neighbour]->GetGlobalIndex();
-      }
+  /*--- Each rank is sent the local elements that are inside its bounding box enlarged by the
+  radius, this includes every element that may be in the neighbourhood of one of its elements. ---*/
+  vector<int> nElemSend(size,0), nElemRecv(size,0);
+
+  for (int iRank=0; iRank<size; ++iRank) {
+    if (iRank == rank) continue;
+    const su2double *bbox_rank = &bbox_all[2*nDim*iRank];
+
+    bool overlap = true;
+    for (iDim=0; iDim<nDim; ++iDim)
+      overlap = overlap && (bbox[iDim] < bbox_rank[nDim+iDim]+max_radius) &&
+                           (bbox[nDim+iDim] > bbox_rank[iDim]-max_radius);
+    if (!overlap) continue;
+
+    for (iElem=0; iElem<nElem; ++iElem) {
+      bool inside = true;
+      for (iDim=0; iDim<nDim; ++iDim)
+        inside = inside && (cg_elem[nDim*iElem+iDim] > bbox_rank[iDim]-max_radius) &&
+                           (cg_elem[nDim*iElem+iDim] < bbox_rank[nDim+iDim]+max_radius);
+      if (inside) Filter_Send_Elem.push_back(iElem);
+    }
+
+    nElemSend[iRank] = Filter_Send_Elem.size()-Filter_Send_Start.back();
+    if (nElemSend[iRank] > 0) {
+      Filter_Send_Rank.push_back(iRank);
+      Filter_Send_Start.push_back(Filter_Send_Elem.size());
     }
   }
-#ifdef HAVE_MPI
-  /*--- Share with all processors ---*/
-  {
-    long *buffer = new long [matrix_size], *tmp = NULL;
-    MPI_Allreduce(neighbour_idx,buffer,matrix_size,MPI_LONG,MPI_MAX,MPI_COMM_WORLD);
-    tmp = neighbour_idx; neighbour_idx = buffer; delete [] tmp;
+
+  SU2_MPI::Alltoall(nElemSend.data(), 1, MPI_INT, nElemRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank=0; iRank<size; ++iRank) {
+    if (nElemRecv[iRank] > 0) {
+      Filter_Recv_Rank.push_back(iRank);
+      Filter_Recv_Start.push_back(Filter_Recv_Start.back()+nElemRecv[iRank]);
+    }
+  }
+
+  /*--- Exchange the global indices, centroids and volumes of those elements. ---*/
+  unsigned long nSend = Filter_Send_Rank.size(), nRecv = Filter_Recv_Rank.size(),
+                nElemSendTot = Filter_Send_Elem.size(), nElemRecvTot = Filter_Recv_Start.back();
+  unsigned short nVar = nDim+1;
+
+  vector<unsigned long> send_idx(nElemSendTot), recv_idx(nElemRecvTot);
+  vector<su2double> send_buf(nVar*nElemSendTot), recv_buf(nVar*nElemRecvTot);
+
+  for (iElem=0; iElem<nElemSendTot; ++iElem) {
+    unsigned long jElem = Filter_Send_Elem[iElem];
+    send_idx[iElem] = global_elem[jElem];
+    for (iDim=0; iDim<nDim; ++iDim)
+      send_buf[nVar*iElem+iDim] = cg_elem[nDim*jElem+iDim];
+    send_buf[nVar*iElem+nDim] = vol_elem[jElem];
   }
+
+  vector<SU2_MPI::Request> req(2*(nSend+nRecv));
+  vector<SU2_MPI::Status> stat(2*(nSend+nRecv));
+
+  for (unsigned long iRecv=0; iRecv<nRecv; ++iRecv) {
+    unsigned long offset = Filter_Recv_Start[iRecv], count = Filter_Recv_Start[iRecv+1]-offset;
+    SU2_MPI::Irecv(&recv_idx[offset], count, MPI_UNSIGNED_LONG, Filter_Recv_Rank[iRecv],
+                   0, MPI_COMM_WORLD, &req[2*iRecv]);
+    SU2_MPI::Irecv(&recv_buf[nVar*offset], nVar*count, MPI_DOUBLE, Filter_Recv_Rank[iRecv],
+                   1, MPI_COMM_WORLD, &req[2*iRecv+1]);
+  }
+  for (unsigned long iSend=0; iSend<nSend; ++iSend) {
+    unsigned long offset = Filter_Send_Start[iSend], count = Filter_Send_Start[iSend+1]-offset;
+    SU2_MPI::Isend(&send_idx[offset], count, MPI_UNSIGNED_LONG, Filter_Send_Rank[iSend],
+                   0, MPI_COMM_WORLD, &req[2*(nRecv+iSend)]);
+    SU2_MPI::Isend(&send_buf[nVar*offset], nVar*count, MPI_DOUBLE, Filter_Send_Rank[iSend],
+                   1, MPI_COMM_WORLD, &req[2*(nRecv+iSend)+1]);
+  }
+  SU2_MPI::Waitall(2*(nSend+nRecv), req.data(), stat.data());
+
+  /*--- Append the elements that are not local, the same element may be received from several
+  ranks (halo elements are repeated) in which case all copies share the same position. ---*/
+  map<unsigned long,unsigned long> global_to_slot;
+  map<unsigned long,unsigned long>::iterator it;
+
+  for (iElem=0; iElem<nElem; ++iElem) global_to_slot[global_elem[iElem]] = iElem;
+
+  Filter_Recv_Slot.resize(nElemRecvTot);
+
+  for (iElem=0; iElem<nElemRecvTot; ++iElem) {
+    it = global_to_slot.find(recv_idx[iElem]);
+    if (it != global_to_slot.end()) {
+      Filter_Recv_Slot[iElem] = it->second;
+    }
+    else {
+      unsigned long slot = nElem+Filter_nElemGhost;
+      global_to_slot[recv_idx[iElem]] = slot;
+      Filter_Recv_Slot[iElem] = slot;
+      ++Filter_nElemGhost;
+
+      global_elem.push_back(recv_idx[iElem]);
+      for (iDim=0; iDim<nDim; ++iDim)
+        cg_elem.push_back(recv_buf[nVar*iElem+iDim]);
+      vol_elem.push_back(recv_buf[nVar*iElem+nDim]);
+    }
+  }
+
 #endif
-}
 
-void CGeometry::GetRadialNeighbourhood(const unsigned long iElem_global,
-                                       const passivedouble radius,
-                                       const vector<unsigned long> &neighbour_start,
-                                       const long *neighbour_idx,
-                                       const su2double *cg_elem,
-                                       vector<long> &neighbours) const
-{
-  /*--- Center of the search ---*/
-  neighbours.clear(); neighbours.push_back(iElem_global);
+  /*--- Local tree of the centroids of the local and received elements. ---*/
+  unsigned long nElemFilter = nElem+Filter_nElemGhost;
+  vector<unsigned long> slot_idx(nElemFilter);
+  for (iElem=0; iElem<nElemFilter; ++iElem) slot_idx[iElem] = iElem;
 
-  vector<passivedouble> X0(nDim);
-  for (unsigned short iDim=0; iDim<nDim; ++iDim)
-    X0[iDim] = SU2_TYPE::GetValue(cg_elem[nDim*iElem_global+iDim]);
+  CADTPointsOnlyClass tree(nDim, nElemFilter, cg_elem.data(), slot_idx.data(), false);
 
-  /*--- A way to locate neighbours of a given degree (1st degree are direct neighbours).
-  "degree_start"[degree] is the position in "neighbours" where "degree" starts. ---*/
-  vector<unsigned long> degree_start(1,0);
+  /*--- Neighbourhood and weights for each kernel. The neighbours are sorted by global index,
+  this makes the result of the filter independent of the partitioning. ---*/
+  Filter_Neighbour_Start.assign(kernels.size(), vector<unsigned long>(nElem+1,0));
+  Filter_Neighbour_Idx.assign(kernels.size(), vector<unsigned long>());
+  Filter_Weight.assign(kernels.size(), vector<su2double>());
 
-  /*--- Loop stops when "neighbours" stops changing size. ---*/
-  vector<long>::iterator cursor_it = neighbours.begin(), aux_it;
-  while (cursor_it != neighbours.end())
+  vector<unsigned long> neighbours;
+  vector<int> neighbour_ranks;
+  vector<pair<unsigned long,unsigned long> > sorted_neighbours;
+
+  for (iKernel=0; iKernel<kernels.size(); ++iKernel)
   {
-    /*--- Add another degree. ---*/
-    long current_degree = degree_start.size();
-    degree_start.push_back(neighbours.size());
+    unsigned short kernel_type = kernels[iKernel].first;
+    su2double kernel_param = kernels[iKernel].second;
+    su2double kernel_radius = filter_radius[iKernel];
 
-    /*--- For each element of the last degree added, add its direct neighbours avoiding
-    duplicates, note the special value -1 at the start position of "candidates". ---*/
-    vector<long> candidates(1,-1);
+    vector<unsigned long> &neighbour_start = Filter_Neighbour_Start[iKernel],
+                          &neighbour_idx   = Filter_Neighbour_Idx[iKernel];
+    vector<su2double> &weight = Filter_Weight[iKernel];
 
-    for (; cursor_it!=neighbours.end(); ++cursor_it)
-    {
-      /*--- Locators to access this "row" of the adjacency matrix. ---*/
-      unsigned long row_begin = neighbour_start[ *cursor_it],
-                    row_end   = neighbour_start[(*cursor_it)+1];
+    /*--- The search is only repeated if no previous kernel has the same radius. ---*/
+    unsigned short jKernel = 0;
+    while ((jKernel<iKernel) && (filter_radius[jKernel] != kernel_radius)) ++jKernel;
 
-      for (unsigned long i=row_begin; i<row_end; ++i)
-        if (find(candidates.begin(), candidates.end(), neighbour_idx[i]) == candidates.end())
-          candidates.push_back(neighbour_idx[i]);
+    if (jKernel < iKernel) {
+      neighbour_start = Filter_Neighbour_Start[jKernel];
+      neighbour_idx   = Filter_Neighbour_Idx[jKernel];
     }
+    else {
+      for (iElem=0; iElem<nElem; ++iElem)
+      {
+        tree.DetermineNodesInRadius(&cg_elem[nDim*iElem], kernel_radius, neighbours, neighbour_ranks);
 
-    /*--- Avoid duplication of previouly added neighbours.
-    Only the last two degrees need checking. ---*/
-    vector<long> new_neighbours;
-    long degree_to_check = max<long>(0,current_degree-2);
-    vector<long>::iterator search_begin = neighbours.begin()+degree_start[degree_to_check];
+        sorted_neighbours.clear();
+        for (iNeigh=0; iNeigh<neighbours.size(); ++iNeigh)
+          sorted_neighbours.push_back(make_pair(global_elem[neighbours[iNeigh]], neighbours[iNeigh]));
+        sort(sorted_neighbours.begin(), sorted_neighbours.end());
+
+        for (iNeigh=0; iNeigh<sorted_neighbours.size(); ++iNeigh)
+          neighbour_idx.push_back(sorted_neighbours[iNeigh].second);
+        neighbour_start[iElem+1] = neighbour_idx.size();
+      }
+    }
 
-    for (aux_it=candidates.begin()+1; aux_it<candidates.end(); ++aux_it)
-      if (find(search_begin, neighbours.end(), *aux_it) == neighbours.end())
-        new_neighbours.push_back(*aux_it);
+    /*--- Weights of the distance-based kernels, the morphology kernels do not use them. ---*/
+    weight.resize(neighbour_idx.size());
 
-    /*--- Add the new neighbours that are inside the radius. ---*/
-    for (aux_it=new_neighbours.begin(); aux_it!=new_neighbours.end(); ++aux_it)
+    for (iElem=0; iElem<nElem; ++iElem)
     {
-      /*--- passivedouble because we are still not going to calculate anything ---*/
-      passivedouble distance = 0.0;
-      for (unsigned short iDim=0; iDim<nDim; ++iDim)
-        distance += pow(X0[iDim]-SU2_TYPE::GetValue(cg_elem[nDim*(*aux_it)+iDim]),2.0);
-
-      if(sqrt(distance) < radius) neighbours.push_back(*aux_it);
+      for (iNeigh=neighbour_start[iElem]; iNeigh<neighbour_start[iElem+1]; ++iNeigh)
+      {
+        unsigned long jElem = neighbour_idx[iNeigh];
+
+        su2double distance = 0.0;
+        for (iDim=0; iDim<nDim; ++iDim)
+          distance += pow(cg_elem[nDim*iElem+iDim]-cg_elem[nDim*jElem+iDim],2.0);
+        distance = sqrt(distance);
+
+        switch ( kernel_type ) {
+          case CONSTANT_WEIGHT_FILTER: weight[iNeigh] = 1.0; break;
+          case CONICAL_WEIGHT_FILTER:  weight[iNeigh] = kernel_radius-distance; break;
+          case GAUSSIAN_WEIGHT_FILTER: weight[iNeigh] = exp(-0.5*pow(distance/kernel_param,2.0)); break;
+          default: weight[iNeigh] = 1.0; break;
+        }
+        weight[iNeigh] *= vol_elem[jElem];
+      }
     }
-    /*--- need new iterator (to same position where it was) after change of capacity ---*/
-    cursor_it = neighbours.begin()+degree_start[current_degree];
   }
+
+  Filter_Radius  = filter_radius;
+  Filter_Kernels = kernels;
+}
+
+void CGeometry::ExchangeFilterValues(vector<su2double> &values) const
+{
+#ifdef HAVE_MPI
+  unsigned long iElem, nSend = Filter_Send_Rank.size(), nRecv = Filter_Recv_Rank.size();
+
+  vector<su2double> send_buf(Filter_Send_Elem.size()), recv_buf(Filter_Recv_Slot.size());
+
+  for (iElem=0; iElem<Filter_Send_Elem.size(); ++iElem)
+    send_buf[iElem] = values[Filter_Send_Elem[iElem]];
+
+  vector<SU2_MPI::Request> req(nSend+nRecv);
+  vector<SU2_MPI::Status> stat(nSend+nRecv);
+
+  for (unsigned long iRecv=0; iRecv<nRecv; ++iRecv) {
+    unsigned long offset = Filter_Recv_Start[iRecv];
+    SU2_MPI::Irecv(&recv_buf[offset], Filter_Recv_Start[iRecv+1]-offset, MPI_DOUBLE,
+                   Filter_Recv_Rank[iRecv], 0, MPI_COMM_WORLD, &req[iRecv]);
+  }
+  for (unsigned long iSend=0; iSend<nSend; ++iSend) {
+    unsigned long offset = Filter_Send_Start[iSend];
+    SU2_MPI::Isend(&send_buf[offset], Filter_Send_Start[iSend+1]-offset, MPI_DOUBLE,
+                   Filter_Send_Rank[iSend], 0, MPI_COMM_WORLD, &req[nRecv+iSend]);
+  }
+  SU2_MPI::Waitall(nSend+nRecv, req.data(), stat.data());
+
+  /*--- Only the positions of the non-local elements are updated. ---*/
+  for (iElem=0; iElem<Filter_Recv_Slot.size(); ++iElem)
+    if (Filter_Recv_Slot[iElem] >= nElem)
+      values[Filter_Recv_Slot[iElem]] = recv_buf[iElem];
+#endif
 }
 
 void CGeometry::SetElemVolume(CConfig *config)
@@ -2220,6 +2497,8 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {
   npoint_procs  = NULL;
   nPoint_Linear = NULL;
 
+  Sensitivity   = NULL;
+
   /*--- Arrays for defining the turbomachinery structure ---*/
 
   nSpanWiseSections       = NULL;
@@ -2260,6 +2539,8 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   ending_node   = NULL;
   npoint_procs  = NULL;
   nPoint_Linear = NULL;
+
+  Sensitivity   = NULL;
   
   /*--- Arrays for defining the turbomachinery structure ---*/
 
@@ -2437,6 +2718,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
   npoint_procs  = NULL;
   nPoint_Linear = NULL;
 
+  Sensitivity   = NULL;
+
   /*--- Arrays for defining the turbomachinery structure ---*/
 
   nSpanWiseSections       = NULL;
@@ -5403,6 +5686,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   npoint_procs  = NULL;
   nPoint_Linear = NULL;
 
+  Sensitivity   = NULL;
+
   /*--- Arrays for defining the turbomachinery structure ---*/
 
   nSpanWiseSections       = NULL;
@@ -5624,6 +5909,7 @@ CPhysicalGeometry::~CPhysicalGeometry(void) {
   if (Local_to_Global_Point  != NULL) delete [] Local_to_Global_Point;
   if (Global_to_Local_Marker != NULL) delete [] Global_to_Local_Marker;
   if (Local_to_Global_Marker != NULL) delete [] Local_to_Global_Marker;
+  if (Sensitivity            != NULL) delete [] Sensitivity;
   
   /*--- Free up memory from turbomachinery performance computation  ---*/
 
@@ -12924,6 +13210,159 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
 void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
 
+  /*--- Compute the wall distance of all the local points with the
+        parallel search of the wall elements. ---*/
+  vector<unsigned long> pointIDs(nPoint);
+  for(unsigned long i=0; i<nPoint; ++i) pointIDs[i] = i;
+
+  ComputeWall_Distance_Points(config, pointIDs);
+
+  /*--- Store the coordinates and the wall distance of the points when the
+        wall distance must be updated after a deformation of the grid. This
+        state serves as reference for the incremental update. ---*/
+  if( config->GetWall_Distance_Update() ) {
+
+    Coord_WallDistRef.resize(nDim*nPoint);
+    WallDistRef.resize(nPoint);
+
+    for(unsigned long i=0; i<nPoint; ++i) {
+      for(unsigned short k=0; k<nDim; ++k)
+        Coord_WallDistRef[i*nDim+k] = node[i]->GetCoord(k);
+      WallDistRef[i] = node[i]->GetWall_Distance();
+    }
+  }
+}
+
+void CPhysicalGeometry::UpdateWall_Distance(CConfig *config) {
+
+  /*--- The incremental update needs a reference state. For the discrete
+        adjoint the dependency of all points on the wall must be recorded.
+        In both situations the wall distance is computed from scratch. ---*/
+  if((WallDistRef.size() != nPoint) || config->GetDiscrete_Adjoint()) {
+    ComputeWall_Distance(config);
+    return;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Determine the displacements of the points on the viscous   ---*/
+  /*---         walls with respect to the reference state. The center of   ---*/
+  /*---         their bounding box is taken as the reference displacement  ---*/
+  /*---         and the maximum deviation from this value is determined.   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<bool> pointOnWall(nPoint, false);
+  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
+    if( (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL)  ||
+        (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
+      for(unsigned long iElem=0; iElem<nElem_Bound[iMarker]; ++iElem) {
+        for(unsigned short iNode=0; iNode<bound[iMarker][iElem]->GetnNodes(); ++iNode)
+          pointOnWall[bound[iMarker][iElem]->GetNode(iNode)] = true;
+      }
+    }
+  }
+
+  su2double dispMinLoc[] = { 1.e+30,  1.e+30,  1.e+30};
+  su2double dispMaxLoc[] = {-1.e+30, -1.e+30, -1.e+30};
+
+  for(unsigned long i=0; i<nPoint; ++i) {
+    if( pointOnWall[i] ) {
+      for(unsigned short k=0; k<nDim; ++k) {
+        const su2double disp = node[i]->GetCoord(k) - Coord_WallDistRef[i*nDim+k];
+        dispMinLoc[k] = min(dispMinLoc[k], disp);
+        dispMaxLoc[k] = max(dispMaxLoc[k], disp);
+      }
+    }
+  }
+
+  su2double dispMin[3], dispMax[3];
+  for(unsigned short k=0; k<nDim; ++k) {
+    dispMin[k] = dispMinLoc[k];
+    dispMax[k] = dispMaxLoc[k];
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(dispMinLoc, dispMin, nDim, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(dispMaxLoc, dispMax, nDim, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  /*--- Without viscous walls the wall distance is zero and does not change. ---*/
+  if(dispMin[0] > dispMax[0]) return;
+
+  su2double dispRef[3];
+  for(unsigned short k=0; k<nDim; ++k)
+    dispRef[k] = 0.5*(dispMin[k] + dispMax[k]);
+
+  su2double radiusWallLoc = 0.0;
+  for(unsigned long i=0; i<nPoint; ++i) {
+    if( pointOnWall[i] ) {
+      su2double dist2 = 0.0;
+      for(unsigned short k=0; k<nDim; ++k) {
+        const su2double ds = node[i]->GetCoord(k) - Coord_WallDistRef[i*nDim+k] - dispRef[k];
+        dist2 += ds*ds;
+      }
+      radiusWallLoc = max(radiusWallLoc, dist2);
+    }
+  }
+
+  radiusWallLoc = sqrt(radiusWallLoc);
+  su2double radiusWall = radiusWallLoc;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&radiusWallLoc, &radiusWall, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Determine the points that must be searched again. Every    ---*/
+  /*---         point of a linear wall element moves by a convex           ---*/
+  /*---         combination of the displacements of its nodes, hence the   ---*/
+  /*---         wall distance of a point changes at most by the deviation  ---*/
+  /*---         of its displacement from dispRef plus radiusWall. If this  ---*/
+  /*---         bound is below the tolerance, the reference value is kept. ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const su2double tol = config->GetWall_Distance_Update_Tol();
+  vector<unsigned long> pointIDs;
+
+  for(unsigned long i=0; i<nPoint; ++i) {
+    su2double dist2 = 0.0;
+    for(unsigned short k=0; k<nDim; ++k) {
+      const su2double ds = node[i]->GetCoord(k) - Coord_WallDistRef[i*nDim+k] - dispRef[k];
+      dist2 += ds*ds;
+    }
+
+    const su2double bound = sqrt(dist2) + radiusWall;
+    if(bound > tol*WallDistRef[i]) pointIDs.push_back(i);
+    else                           node[i]->SetWall_Distance(WallDistRef[i]);
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Search the wall distance of the selected points. When the  ---*/
+  /*---         majority of the points must be searched, the wall distance ---*/
+  /*---         is computed from scratch, which resets the reference state.---*/
+  /*--------------------------------------------------------------------------*/
+
+  unsigned long nSearchLoc = pointIDs.size(), nSearch = nSearchLoc;
+  unsigned long nPointLoc  = nPoint,          nPointGlob = nPointLoc;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nSearchLoc, &nSearch,    1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nPointLoc,  &nPointGlob, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if(nSearch == 0) return;
+
+  if(rank == MASTER_NODE)
+    cout << " Updating the wall distance of " << nSearch << " out of "
+         << nPointGlob << " points." << endl;
+
+  if(2*nSearch > nPointGlob) ComputeWall_Distance(config);
+  else                       ComputeWall_Distance_Points(config, pointIDs);
+}
+
+void CPhysicalGeometry::ComputeWall_Distance_Points(CConfig                     *config,
+                                                    const vector<unsigned long> &pointIDs) {
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -13001,15 +13440,86 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
     surfaceConn[i] = meshToSurface[surfaceConn[i]];
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 2: Build the ADT, which is an ADT of bounding boxes of the    ---*/
-  /*---         surface elements. A nearest point search does not give     ---*/
-  /*---         accurate results, especially not for the integration       ---*/
-  /*---         points of the elements close to a wall boundary.           ---*/
+  /*--- Step 2: Determine the bounding box of the local wall points and    ---*/
+  /*---         the number of local wall points and make this information  ---*/
+  /*---         available on all ranks. An empty box is characterized by   ---*/
+  /*---         a minimum coordinate that is larger than the maximum.      ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<su2double> BBoxLocal(2*nDim);
+  for(unsigned short k=0; k<nDim; ++k) {
+    BBoxLocal[k]      =  1.e+30;
+    BBoxLocal[k+nDim] = -1.e+30;
+  }
+
+  for(unsigned long i=0; i<nVertex_SolidWall; ++i) {
+    for(unsigned short k=0; k<nDim; ++k) {
+      BBoxLocal[k]      = min(BBoxLocal[k],      surfaceCoor[i*nDim+k]);
+      BBoxLocal[k+nDim] = max(BBoxLocal[k+nDim], surfaceCoor[i*nDim+k]);
+    }
+  }
+
+  vector<su2double>     BBoxRanks(2*nDim*size);
+  vector<unsigned long> nWallPointsRanks(size);
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(BBoxLocal.data(), 2*nDim, MPI_DOUBLE, BBoxRanks.data(),
+                     2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&nVertex_SolidWall, 1, MPI_UNSIGNED_LONG, nWallPointsRanks.data(),
+                     1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  BBoxRanks           = BBoxLocal;
+  nWallPointsRanks[0] = nVertex_SolidWall;
+#endif
+
+  unsigned long nWallPointsGlobal = 0;
+  for(int i=0; i<size; ++i) nWallPointsGlobal += nWallPointsRanks[i];
+
+  /*--- No solid wall boundary nodes in the entire mesh.
+        Set the wall distance to zero for all nodes. ---*/
+  if(nWallPointsGlobal == 0) {
+    for(unsigned long i=0; i<pointIDs.size(); ++i)
+      node[pointIDs[i]]->SetWall_Distance(0.0);
+    return;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Build a global ADT of a subset of the wall points. These   ---*/
+  /*---         points lie on the wall, hence the distance to the nearest  ---*/
+  /*---         point of this subset is an upper bound for the wall        ---*/
+  /*---         distance, which is used to prune the ranks to be searched. ---*/
+  /*---         The size of the subset is limited to keep the memory of    ---*/
+  /*---         this global tree small.                                    ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const unsigned long nSampleGlobalMax = 100000;
+  const unsigned long strideSample     = nWallPointsGlobal/nSampleGlobalMax + 1;
+
+  vector<su2double>     sampleCoor;
+  vector<unsigned long> sampleIDs;
+
+  for(unsigned long i=0; i<nVertex_SolidWall; i+=strideSample) {
+    sampleIDs.push_back(i);
+    for(unsigned short k=0; k<nDim; ++k)
+      sampleCoor.push_back(surfaceCoor[i*nDim+k]);
+  }
+
+  CADTPointsOnlyClass SampleADT(nDim, sampleIDs.size(), sampleCoor.data(),
+                                sampleIDs.data(), true);
+
+  vector<unsigned long>().swap(sampleIDs);
+  vector<su2double>().swap(sampleCoor);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 4: Build the local ADT, which is an ADT of bounding boxes of   ---*/
+  /*---         the local surface elements. A nearest point search does    ---*/
+  /*---         not give accurate results, especially not for the points   ---*/
+  /*---         close to a wall boundary. The wall elements are not        ---*/
+  /*---         gathered on all ranks, such that the memory stays bounded. ---*/
   /*--------------------------------------------------------------------------*/
 
-  /* Build the ADT. */
   CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+                        markerIDs, elemIDs, false);
 
   /* Release the memory of the vectors used to build the ADT. To make sure
      that all the memory is deleted, the swap function is used. */
@@ -13020,36 +13530,136 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   vector<su2double>().swap(surfaceCoor);
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 3: Loop over all interior mesh nodes and compute minimum      ---*/
-  /*---         distance to a solid wall element                           ---*/
+  /*--- Step 5: First stage of the search. Determine the distance to the   ---*/
+  /*---         local wall elements and the upper bound of the wall        ---*/
+  /*---         distance. The other ranks whose bounding box is closer to  ---*/
+  /*---         the point than this upper bound must be searched as well.  ---*/
   /*--------------------------------------------------------------------------*/
 
+  vector<su2double> distPoints(pointIDs.size(), 1.e+30);
+  vector<vector<unsigned long> > pointsToRanks(size);
 
-  if ( WallADT.IsEmpty() ) {
-  
-    /*--- No solid wall boundary nodes in the entire mesh.
-     Set the wall distance to zero for all nodes. ---*/
-    
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
-      node[iPoint]->SetWall_Distance(0.0);
+  for(unsigned long i=0; i<pointIDs.size(); ++i) {
+    const su2double *coor = node[pointIDs[i]]->GetCoord();
+
+    unsigned short markerID;
+    unsigned long  elemID, pointID;
+    int            rankID;
+    su2double      distBound;
+
+    SampleADT.DetermineNearestNode(coor, distBound, pointID, rankID);
+
+    if( !WallADT.IsEmpty() ) {
+      WallADT.DetermineNearestElement(coor, distPoints[i], markerID, elemID, rankID);
+      distBound = min(distBound, distPoints[i]);
+    }
+
+    const su2double distBound2 = distBound*distBound;
+
+    for(int iRank=0; iRank<size; ++iRank) {
+      if((iRank != rank) && nWallPointsRanks[iRank]) {
+
+        const su2double *BBox = BBoxRanks.data() + 2*nDim*iRank;
+        su2double dist2 = 0.0;
+        for(unsigned short k=0; k<nDim; ++k) {
+          su2double ds = 0.0;
+          if(     coor[k] < BBox[k])      ds = BBox[k]      - coor[k];
+          else if(coor[k] > BBox[k+nDim]) ds = coor[k] - BBox[k+nDim];
+          dist2 += ds*ds;
+        }
+
+        if(dist2 <= distBound2) pointsToRanks[iRank].push_back(i);
+      }
+    }
   }
-  else {
 
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
-    
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      unsigned short markerID;
-      unsigned long  elemID;
-      int            rankID;
-      su2double      dist;
-      
-      WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
-                                   elemID, rankID);
-      node[iPoint]->SetWall_Distance(dist);
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 6: Second stage of the search. Send the coordinates of the    ---*/
+  /*---         points to the selected ranks, which search their local ADT ---*/
+  /*---         and return the distances. The minimum is the wall distance.---*/
+  /*--------------------------------------------------------------------------*/
+
+#ifdef HAVE_MPI
+
+  /*--- Determine the number of points to be searched for the other ranks. ---*/
+  vector<int> nPointsSend(size), nPointsRecv(size);
+  for(int iRank=0; iRank<size; ++iRank)
+    nPointsSend[iRank] = (int) pointsToRanks[iRank].size();
+
+  SU2_MPI::Alltoall(nPointsSend.data(), 1, MPI_INT, nPointsRecv.data(), 1,
+                    MPI_INT, MPI_COMM_WORLD);
+
+  /*--- Send the coordinates of the points and receive the coordinates
+        of the points to be searched on this rank. ---*/
+  vector<vector<su2double> > sendBuf(size), recvBuf(size);
+  vector<SU2_MPI::Request> commReqs;
+
+  for(int iRank=0; iRank<size; ++iRank) {
+    if( nPointsSend[iRank] ) {
+      for(unsigned long i=0; i<pointsToRanks[iRank].size(); ++i) {
+        const su2double *coor = node[pointIDs[pointsToRanks[iRank][i]]]->GetCoord();
+        sendBuf[iRank].insert(sendBuf[iRank].end(), coor, coor+nDim);
+      }
+
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(sendBuf[iRank].data(), nDim*nPointsSend[iRank], MPI_DOUBLE,
+                     iRank, iRank, MPI_COMM_WORLD, &commReqs.back());
+    }
+
+    if( nPointsRecv[iRank] ) {
+      recvBuf[iRank].resize(nDim*nPointsRecv[iRank]);
+
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(recvBuf[iRank].data(), nDim*nPointsRecv[iRank], MPI_DOUBLE,
+                     iRank, rank, MPI_COMM_WORLD, &commReqs.back());
     }
   }
-  
+
+  SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+  commReqs.clear();
+
+  /*--- Search the local ADT for the received points and send the distances
+        back. The buffers of the coordinates are reused for the distances. ---*/
+  for(int iRank=0; iRank<size; ++iRank) {
+    if( nPointsRecv[iRank] ) {
+      for(int i=0; i<nPointsRecv[iRank]; ++i) {
+        unsigned short markerID;
+        unsigned long  elemID;
+        int            rankID;
+        su2double      dist;
+
+        WallADT.DetermineNearestElement(recvBuf[iRank].data() + i*nDim, dist,
+                                        markerID, elemID, rankID);
+        recvBuf[iRank][i] = dist;
+      }
+
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(recvBuf[iRank].data(), nPointsRecv[iRank], MPI_DOUBLE,
+                     iRank, iRank, MPI_COMM_WORLD, &commReqs.back());
+    }
+
+    if( nPointsSend[iRank] ) {
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(sendBuf[iRank].data(), nPointsSend[iRank], MPI_DOUBLE,
+                     iRank, rank, MPI_COMM_WORLD, &commReqs.back());
+    }
+  }
+
+  SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+
+  /*--- Take the minimum of the local and the remote distances. ---*/
+  for(int iRank=0; iRank<size; ++iRank) {
+    for(unsigned long i=0; i<pointsToRanks[iRank].size(); ++i) {
+      const unsigned long ii = pointsToRanks[iRank][i];
+      distPoints[ii] = min(distPoints[ii], sendBuf[iRank][i]);
+    }
+  }
+
+#endif
+
+  /*--- Store the wall distance of the points. ---*/
+  for(unsigned long i=0; i<pointIDs.size(); ++i)
+    node[pointIDs[i]]->SetWall_Distance(distPoints[i]);
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -18481,7 +19091,7 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
   
 }
 
-void CPhysicalGeometry::SetSensitivity(CConfig *config) {
+void CPhysicalGeometry::SetSensitivity(CConfig *config, short val_iObj) {
   
   ifstream restart_file;
   string filename = config->GetSolution_AdjFileName();
@@ -18504,7 +19114,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
   string::size_type position;
   int counter = 0;
   
-  Sensitivity = new su2double[nPoint*nDim];
+  if (Sensitivity == NULL) Sensitivity = new su2double[nPoint*nDim];
 
   if (config->GetUnsteady_Simulation()) {
     nExtIter = config->GetnExtIter();
@@ -18545,7 +19155,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
   filename = config->GetSolution_AdjFileName();
 
-  filename = config->GetObjFunc_Extension(filename);
+  filename = config->GetObjFunc_Extension(filename, val_iObj);
 
   if (config->GetUnsteady_Simulation()) {
     filename = config->GetUnsteady_FileName(filename, nExtIter-1);
@@ -19012,7 +19622,7 @@ void CPhysicalGeometry::ReadUnorderedSensitivity(CConfig *config) {
   
   /*--- Allocate space for the sensitivity and initialize. ---*/
   
-  Sensitivity = new su2double[nPoint*nDim];
+  if (Sensitivity == NULL) Sensitivity = new su2double[nPoint*nDim];
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
     for (iDim = 0; iDim < nDim; iDim++) {
       Sensitivity[iPoint*nDim+iDim] = 0.0;
@@ -19803,14 +20413,9 @@ void CPhysicalGeometry::Compute_Wing(CConfig *config, bool original_surface,
   
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-
-   }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                          Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil,
+                          original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
   
@@ -20099,13 +20704,9 @@ void CPhysicalGeometry::Compute_Fuselage(CConfig *config, bool original_surface,
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                          Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil,
+                          original_surface, config);
 
   /*--- Compute the area at each section ---*/
 
@@ -20409,14 +21010,9 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig *config, bool original_surface,
   
   /*--- Create the section slices through the geometry ---*/
   
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane],
-                           -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-    
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                          Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil,
+                          original_surface, config);
   
   /*--- Compute airfoil characteristic only in the master node ---*/
   
@@ -4885,6 +4885,10 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
   /*--- of the corresponding element.                                      ---*/
   /*--------------------------------------------------------------------------*/
 
+  /* Vector to store the elements adjacent to a wall function boundary. These
+     are distinguished when the measured work weights are used. */
+  vector<bool> elemWithWallFunction(nElem, false);
+
   /* Loop over the markers and select the ones for which a wall function
      treatment must be carried out. */
   for(unsigned short iMarker=0; iMarker<nMarker; ++iMarker) {
@@ -4930,6 +4934,7 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
             /* Update the computational work for the corresponding volume element,
                i.e. the 1st vertex weight. */
             vwgt[2*elemID] += standardBoundaryFaces[ii].WorkEstimateMetisWallFunctions(config, shortInfo[0]);
+            elemWithWallFunction[elemID] = true;
           }
         }
 
@@ -4941,6 +4946,93 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
     }
   }
 
+  /*--------------------------------------------------------------------------*/
+  /*--- Replace the estimated work of the elements by the work per update  ---*/
+  /*--- measured in a previous computation, if desired. The measured work  ---*/
+  /*--- is only used if it is available for all element types present.    ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if( config->GetUse_Measured_Work_DG() ) {
+
+    /*--- Open the file with the measured work weights. ---*/
+    const string fileName = config->GetWork_Weights_DG_FileName();
+    ifstream workFile(fileName.c_str());
+    if( !workFile.is_open() )
+      SU2_MPI::Error(string("The file with the measured work weights ") + fileName +
+                     string(" could not be opened."), CURRENT_FUNCTION);
+
+    /*--- Read the work per update for every element type and time level. The
+          key consists of the element type, the polynomial degree, whether or
+          not the Jacobian is constant, the time level and whether or not a
+          wall function is used. Also the average over the time levels of an
+          element type is stored, which is used for missing time levels. ---*/
+    map<vector<unsigned short>, su2double> workPerLevel;
+    map<vector<unsigned short>, vector<su2double> > workPerType;
+
+    string text_line;
+    while( getline(workFile, text_line) ) {
+      if(text_line.empty() || text_line[0] == '%') continue;
+
+      istringstream lineStream(text_line);
+      vector<unsigned short> key(5);
+      unsigned long nElemType;
+      passivedouble workType;
+      lineStream >> key[0] >> key[1] >> key[2] >> key[3] >> key[4] >> nElemType >> workType;
+      if( lineStream.fail() )
+        SU2_MPI::Error(string("Wrong format of the file ") + fileName, CURRENT_FUNCTION);
+
+      workPerLevel[key] = workType;
+
+      key.erase(key.begin()+3);
+      vector<su2double> &val = workPerType[key];
+      if( val.empty() ) val.assign(2, 0.0);
+      val[0] += nElemType;
+      val[1] += nElemType*workType;
+    }
+    workFile.close();
+
+    /*--- Determine the measured work of the local elements. ---*/
+    vector<su2double> workMeasured(nElem);
+    unsigned short typeMissing = 0;
+    for(unsigned long i=0; i<nElem; ++i) {
+      vector<unsigned short> key(5);
+      key[0] = elem[i]->GetVTK_Type();
+      key[1] = elem[i]->GetNPolySol();
+      key[2] = elem[i]->GetJacobianConsideredConstant();
+      key[3] = elem[i]->GetTimeLevel();
+      key[4] = elemWithWallFunction[i];
+
+      map<vector<unsigned short>, su2double>::const_iterator MI = workPerLevel.find(key);
+      if(MI != workPerLevel.end()) workMeasured[i] = MI->second;
+      else {
+        key.erase(key.begin()+3);
+        map<vector<unsigned short>, vector<su2double> >::const_iterator MJ = workPerType.find(key);
+        if(MJ != workPerType.end()) workMeasured[i] = MJ->second[1]/MJ->second[0];
+        else                        typeMissing = 1;
+      }
+    }
+
+#ifdef HAVE_MPI
+    unsigned short typeMissingLocal = typeMissing;
+    SU2_MPI::Allreduce(&typeMissingLocal, &typeMissing, 1, MPI_UNSIGNED_SHORT,
+                       MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+    /*--- Overwrite the estimated work if the measured work is available
+          for all elements. Otherwise the estimates are kept. ---*/
+    if( typeMissing ) {
+      if(rank == MASTER_NODE)
+        cout << "WARNING: Not all element types are present in " << fileName
+             << ". The estimated work weights are used for the partitioning." << endl;
+    }
+    else {
+      for(unsigned long i=0; i<nElem; ++i) vwgt[2*i] = workMeasured[i];
+      if(rank == MASTER_NODE)
+        cout << "The measured work weights of " << fileName
+             << " are used for the partitioning." << endl;
+    }
+  }
+
   /*--------------------------------------------------------------------------*/
   /*--- The final weight is obtained by taking the amount of work in time  ---*/
   /*--- into account. Note that this correction is only relevant when time ---*/
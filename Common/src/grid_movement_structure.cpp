@@ -47,7 +47,10 @@ CGridMovement::~CGridMovement(void) { }
 
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement() {
 
-
+  stiffness_cache  = false;
+  stiffness_stored = false;
+  prec_built       = false;
+  prec_transposed  = false;
 
 }
 
@@ -72,6 +75,14 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
 	  LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 	  StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
+	  /*--- The stiffness matrix (with the boundary conditions imposed) and its preconditioner
+	   may be kept from the first deformation (not while recording the adjoint) ---*/
+
+	  stiffness_cache  = (config->GetDeform_Cache_Stiffness() && !config->GetDiscrete_Adjoint());
+	  stiffness_stored = false;
+	  prec_built       = false;
+	  prec_transposed  = false;
+
 }
 
 CVolumetricMovement::~CVolumetricMovement(void) { }
@@ -135,7 +146,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   unsigned long IterLinSol = 0, Smoothing_Iter, iNonlinear_Iter, MaxIter = 0, RestartIter = 50, Tot_Iter = 0, Nonlinear_Iter = 0;
   su2double MinVolume, MaxVolume, NumError, Residual = 0.0, Residual_Init = 0.0;
-  bool Screen_Output;
+  bool Screen_Output, Transposed, Reuse_Prec;
 
 
   /*--- Retrieve number or iterations, tol, output, etc. from config ---*/
@@ -152,6 +163,10 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   /*--- Set the number of nonlinear iterations to 1 if Derivative computation is enabled ---*/
 
   if (Derivative) Nonlinear_Iter = 1;
+
+  /*--- The mesh sensitivities in SU2_DOT are computed with the transposed system ---*/
+
+  Transposed = (Derivative && (config->GetKind_SU2() == SU2_DOT));
   
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
@@ -163,13 +178,17 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
     
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+     elasticity equations (transfers element stiffnesses to point-to-point).
+     A stored stiffness matrix is used as it is: the boundary conditions below
+     only replace rows by the identity, which does not change it again. ---*/
     
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    if (!(stiffness_cache && stiffness_stored)) {
+      StiffMatrix.SetValZero();
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    }
     
     /*--- Set the boundary and volume displacements (as prescribed by the 
      design variable perturbations controlling the surface shape) 
@@ -195,13 +214,19 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     StiffMatrix.SendReceive_Solution(LinSysSol, geometry, config);
     StiffMatrix.SendReceive_Solution(LinSysRes, geometry, config);
 
+    /*--- The preconditioner of a stored stiffness matrix is kept for the following
+     deformations (multiple right hand sides), as long as the same system is solved ---*/
+
+    if (stiffness_cache) stiffness_stored = true;
+    Reuse_Prec = (stiffness_cache && prec_built && (prec_transposed == Transposed));
+
     /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
 
     /*--- If we want no derivatives or the direct derivatives,
      * we solve the system using the normal matrix vector product and preconditioner.
      * For the mesh sensitivities using the discrete adjoint method we solve the system using the transposed matrix,
      * hence we need the corresponding matrix vector product and the preconditioner.  ---*/
-    if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)) {
+    if (!Transposed) {
 
     	if (config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# LU_SGS preconditioner." << endl;
@@ -210,37 +235,40 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == ILU) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
-    		StiffMatrix.BuildILUPreconditioner();
+    		if (!Reuse_Prec) StiffMatrix.BuildILUPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner(StiffMatrix, geometry, config);
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Jacobi preconditioner." << endl;
-    		StiffMatrix.BuildJacobiPreconditioner();
+    		if (!Reuse_Prec) StiffMatrix.BuildJacobiPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
 
-    } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
+    } else {
 
     	/*--- Build the ILU or Jacobi preconditioner for the transposed system ---*/
 
     	if ((config->GetKind_Deform_Linear_Solver_Prec() == ILU) ||
     			(config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS)) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
-    		StiffMatrix.BuildILUPreconditioner(true);
+    		if (!Reuse_Prec) StiffMatrix.BuildILUPreconditioner(true);
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner(StiffMatrix, geometry, config);
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Jacobi preconditioner." << endl;
-    		StiffMatrix.BuildJacobiPreconditioner(true);
+    		if (!Reuse_Prec) StiffMatrix.BuildJacobiPreconditioner(true);
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
 
     }
 
+    prec_built      = stiffness_stored;
+    prec_transposed = Transposed;
+
     CSysSolve *system  = new CSysSolve();
     
     if (LinSysRes.norm() != 0.0){
@@ -3206,10 +3234,15 @@ void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
 void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
   
   unsigned short iMarker, iDim, iOrder, jOrder, kOrder, lOrder, mOrder, nOrder;
-  unsigned long iVertex, iPoint, TotalVertex = 0;
-  su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
+  unsigned long iVertex, iPoint, TotalVertex = 0, GlobalIndex, nMiss = 0, Global_nMiss = 0;
+  su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], ParamCoordCache[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
   unsigned short nDim = geometry->GetnDim();
   su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
+  bool Cached;
+  map<unsigned long, unsigned long> CacheIndex;
+  map<unsigned long, unsigned long>::iterator it;
+  vector<su2double> CacheData, StoreData;
+  vector<unsigned long> StoreIndex;
 
   unsigned short BoxFFD = true;
   bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
@@ -3245,11 +3278,19 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
     FFDBox->BlendingFunction[1]->SetOrder(2, 2);
     FFDBox->BlendingFunction[2]->SetOrder(2, 2);
   }
-  /*--- Point inversion algorithm with a basic box ---*/
+  /*--- Point inversion algorithm with a basic box, the initial guess of each point
+   is the closest sample of a lattice of the (possibly reduced) box ---*/
+  
+  FFDBox->SetInversionLattice();
   
   ParamCoordGuess[0]  = 0.5; ParamCoordGuess[1] = 0.5; ParamCoordGuess[2] = 0.5;
   CartCoord[0]        = 0.0; CartCoord[1]       = 0.0; CartCoord[2]       = 0.0;
   
+  /*--- Parametric coordinates stored by a previous inversion of the same box ---*/
+  
+  const bool Cache = config->GetFFD_ParamCoord_Cache();
+  if (Cache) ReadParametricCoordCache(config, FFDBox, CacheIndex, CacheData);
+  
   /*--- Count the number of vertices ---*/
   
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
@@ -3295,9 +3336,34 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
         
         if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
           
+          /*--- Reuse the stored parametric coordinate if the point has not moved ---*/
+          
+          GlobalIndex = geometry->node[iPoint]->GetGlobalIndex();
+          Cached = false;
+          
+          it = CacheIndex.find(GlobalIndex);
+          if (it != CacheIndex.end()) {
+            Cached = true;
+            for (iDim = 0; iDim < 3; iDim++) {
+              if (fabs(CacheData[6*it->second+iDim] - CartCoord[iDim]) > config->GetFFD_Tol()) Cached = false;
+              ParamCoordCache[iDim] = CacheData[6*it->second+3+iDim];
+            }
+          }
+          
           /*--- Find the parametric coordinate ---*/
           
-          ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+          if (Cached) ParamCoord = ParamCoordCache;
+          else {
+            FFDBox->GetInversionGuess(CartCoord, ParamCoordGuess);
+            ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+            nMiss++;
+          }
+          
+          if (Cache) {
+            StoreIndex.push_back(GlobalIndex);
+            for (iDim = 0; iDim < 3; iDim++) StoreData.push_back(CartCoord[iDim]);
+            for (iDim = 0; iDim < 3; iDim++) StoreData.push_back(ParamCoord[iDim]);
+          }
           
           /*--- Compute the cartesian coordinates using the parametric coordinates
            to check that everything is correct ---*/
@@ -3340,8 +3406,6 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
             FFDBox->Set_ParametricCoord(ParamCoord);
             FFDBox->Set_CartesianCoord(CartCoord);
             
-            ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
-            
             if (Diff >= config->GetFFD_Tol()) {
               cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
               << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
@@ -3372,6 +3436,17 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
   if (rank == MASTER_NODE)
     cout << "Compute parametric coord      | FFD box: " << FFDBox->GetTag() << ". Max Diff: " << MaxDiff <<"."<< endl;
   
+  /*--- Store the parametric coordinates if any point had to be inverted ---*/
+  
+  if (Cache) {
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&nMiss, &Global_nMiss, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+    Global_nMiss = nMiss;
+#endif
+    if (Global_nMiss > 0) WriteParametricCoordCache(config, FFDBox, StoreIndex, StoreData);
+  }
+  
   
   /*--- After the point inversion, copy the original 
    information back (this only works with boxes,
@@ -3387,14 +3462,169 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
   }
 }
 
+bool CSurfaceMovement::ReadParametricCoordCache(CConfig *config, CFreeFormDefBox *FFDBox, map<unsigned long, unsigned long> &val_index,
+                                                vector<su2double> &val_data) {
+  
+  unsigned short iOrder, jOrder, kOrder, iDim;
+  unsigned long iRecord, nRecord = 0;
+  int Header[5];
+  passivedouble Coord[3];
+  bool Match;
+  
+  string filename = "ffd_paramcoord_" + FFDBox->GetTag() + ".dat";
+  
+  val_index.clear(); val_data.clear();
+  
+  FILE *fhw = fopen(filename.c_str(), "rb");
+  if (fhw == NULL) return false;
+  
+  /*--- The header identifies the box (blending, orders and control points) ---*/
+  
+  Match = (fread(Header, sizeof(int), 5, fhw) == 5);
+  Match = Match && (Header[0] == 535532) && (Header[1] == int(config->GetFFD_Blending())) &&
+          (Header[2] == int(FFDBox->GetlOrder())) && (Header[3] == int(FFDBox->GetmOrder())) &&
+          (Header[4] == int(FFDBox->GetnOrder()));
+  
+  for (iOrder = 0; Match && (iOrder < FFDBox->GetlOrder()); iOrder++)
+    for (jOrder = 0; Match && (jOrder < FFDBox->GetmOrder()); jOrder++)
+      for (kOrder = 0; Match && (kOrder < FFDBox->GetnOrder()); kOrder++) {
+        Match = (fread(Coord, sizeof(passivedouble), 3, fhw) == 3);
+        for (iDim = 0; Match && (iDim < 3); iDim++)
+          Match = (fabs(Coord[iDim] - SU2_TYPE::GetValue(FFDBox->Coord_Control_Points[iOrder][jOrder][kOrder][iDim])) <= config->GetFFD_Tol());
+      }
+  
+  Match = Match && (fread(&nRecord, sizeof(unsigned long), 1, fhw) == 1);
+  
+  /*--- Records: global index, cartesian and parametric coordinates ---*/
+  
+  vector<unsigned long> GlobalIndex(Match ? nRecord : 0);
+  vector<passivedouble> Data(Match ? 6*nRecord : 0);
+  
+  Match = Match && (fread(GlobalIndex.data(), sizeof(unsigned long), nRecord, fhw) == nRecord);
+  Match = Match && (fread(Data.data(), sizeof(passivedouble), 6*nRecord, fhw) == 6*nRecord);
+  
+  fclose(fhw);
+  
+  if (!Match) {
+    if (rank == MASTER_NODE)
+      cout << "The parametric coordinates in " << filename << " do not match the FFD box: " << FFDBox->GetTag() << "." << endl;
+    return false;
+  }
+  
+  val_data.resize(6*nRecord);
+  for (iRecord = 0; iRecord < nRecord; iRecord++) {
+    val_index[GlobalIndex[iRecord]] = iRecord;
+    for (iDim = 0; iDim < 6; iDim++)
+      val_data[6*iRecord+iDim] = Data[6*iRecord+iDim];
+  }
+  
+  if (rank == MASTER_NODE)
+    cout << "Read " << nRecord << " parametric coordinates from " << filename << "." << endl;
+  
+  return true;
+  
+}
+
+void CSurfaceMovement::WriteParametricCoordCache(CConfig *config, CFreeFormDefBox *FFDBox, vector<unsigned long> &val_index,
+                                                 vector<su2double> &val_data) {
+  
+  unsigned short iOrder, jOrder, kOrder, iDim;
+  unsigned long iRecord, nRecord;
+  int Header[5];
+  passivedouble Coord[3];
+  map<unsigned long, unsigned long> Unique;
+  map<unsigned long, unsigned long>::iterator it;
+  
+  vector<unsigned long> GlobalIndex(val_index);
+  vector<su2double> Data(val_data);
+  
+  /*--- Gather all the records on the master node ---*/
+  
+#ifdef HAVE_MPI
+  unsigned long nLocal = val_index.size();
+  int iProcessor;
+  unsigned long *Buffer_Recv_nRecord = NULL;
+  if (rank == MASTER_NODE) Buffer_Recv_nRecord = new unsigned long[size];
+  
+  SU2_MPI::Gather(&nLocal, 1, MPI_UNSIGNED_LONG, Buffer_Recv_nRecord, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  
+  if (rank == MASTER_NODE) {
+    for (iProcessor = 1; iProcessor < size; iProcessor++) {
+      if (Buffer_Recv_nRecord[iProcessor] == 0) continue;
+      nRecord = GlobalIndex.size();
+      GlobalIndex.resize(nRecord + Buffer_Recv_nRecord[iProcessor]);
+      Data.resize(6*(nRecord + Buffer_Recv_nRecord[iProcessor]));
+      SU2_MPI::Recv(&GlobalIndex[nRecord], Buffer_Recv_nRecord[iProcessor], MPI_UNSIGNED_LONG, iProcessor, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      SU2_MPI::Recv(&Data[6*nRecord], 6*Buffer_Recv_nRecord[iProcessor], MPI_DOUBLE, iProcessor, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    delete [] Buffer_Recv_nRecord;
+  }
+  else if (nLocal > 0) {
+    SU2_MPI::Send(&GlobalIndex[0], nLocal, MPI_UNSIGNED_LONG, MASTER_NODE, 0, MPI_COMM_WORLD);
+    SU2_MPI::Send(&Data[0], 6*nLocal, MPI_DOUBLE, MASTER_NODE, 1, MPI_COMM_WORLD);
+  }
+#endif
+  
+  if (rank != MASTER_NODE) return;
+  
+  /*--- Points shared by several markers or ranks are written once ---*/
+  
+  for (iRecord = 0; iRecord < GlobalIndex.size(); iRecord++)
+    Unique[GlobalIndex[iRecord]] = iRecord;
+  
+  string filename = "ffd_paramcoord_" + FFDBox->GetTag() + ".dat";
+  
+  FILE *fhw = fopen(filename.c_str(), "wb");
+  if (fhw == NULL) {
+    cout << "Unable to write the parametric coordinates in " << filename << "." << endl;
+    return;
+  }
+  
+  Header[0] = 535532; Header[1] = int(config->GetFFD_Blending());
+  Header[2] = int(FFDBox->GetlOrder()); Header[3] = int(FFDBox->GetmOrder()); Header[4] = int(FFDBox->GetnOrder());
+  fwrite(Header, sizeof(int), 5, fhw);
+  
+  for (iOrder = 0; iOrder < FFDBox->GetlOrder(); iOrder++)
+    for (jOrder = 0; jOrder < FFDBox->GetmOrder(); jOrder++)
+      for (kOrder = 0; kOrder < FFDBox->GetnOrder(); kOrder++) {
+        for (iDim = 0; iDim < 3; iDim++)
+          Coord[iDim] = SU2_TYPE::GetValue(FFDBox->Coord_Control_Points[iOrder][jOrder][kOrder][iDim]);
+        fwrite(Coord, sizeof(passivedouble), 3, fhw);
+      }
+  
+  nRecord = Unique.size();
+  fwrite(&nRecord, sizeof(unsigned long), 1, fhw);
+  
+  vector<unsigned long> Buffer_Index; Buffer_Index.reserve(nRecord);
+  vector<passivedouble> Buffer_Data; Buffer_Data.reserve(6*nRecord);
+  for (it = Unique.begin(); it != Unique.end(); it++) {
+    Buffer_Index.push_back(it->first);
+    for (iDim = 0; iDim < 6; iDim++)
+      Buffer_Data.push_back(SU2_TYPE::GetValue(Data[6*it->second+iDim]));
+  }
+  
+  fwrite(Buffer_Index.data(), sizeof(unsigned long), nRecord, fhw);
+  fwrite(Buffer_Data.data(), sizeof(passivedouble), 6*nRecord, fhw);
+  
+  fclose(fhw);
+  
+  cout << "Wrote " << nRecord << " parametric coordinates in " << filename << "." << endl;
+  
+}
+
 void CSurfaceMovement::SetParametricCoordCP(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBoxParent, CFreeFormDefBox *FFDBoxChild) {
 	unsigned short iOrder, jOrder, kOrder;
 	su2double *CartCoord, *ParamCoord, ParamCoordGuess[3];
 	
+	/*--- Initial guesses from a lattice of the parent box ---*/
+	
+	FFDBoxParent->SetInversionLattice();
+	
 	for (iOrder = 0; iOrder < FFDBoxChild->GetlOrder(); iOrder++)
 		for (jOrder = 0; jOrder < FFDBoxChild->GetmOrder(); jOrder++)
 			for (kOrder = 0; kOrder < FFDBoxChild->GetnOrder(); kOrder++) {
 				CartCoord = FFDBoxChild->GetCoordControlPoints(iOrder, jOrder, kOrder);
+				FFDBoxParent->GetInversionGuess(CartCoord, ParamCoordGuess);
 				ParamCoord = FFDBoxParent->GetParametricCoord_Iterative(0, CartCoord, ParamCoordGuess, config);
 				FFDBoxChild->SetParCoordControlPoints(ParamCoord, iOrder, jOrder, kOrder);
 			}
@@ -7990,6 +8220,9 @@ CFreeFormDefBox::CFreeFormDefBox(unsigned short Degree[], unsigned short BSpline
 	ParamCoord = new su2double[nDim]; ParamCoord_ = new su2double[nDim];
 	cart_coord = new su2double[nDim]; cart_coord_ = new su2double[nDim];
 	Gradient = new su2double[nDim];
+  Hessian = new su2double* [nDim];
+  for (iDim = 0; iDim < nDim; iDim++)
+    Hessian[iDim] = new su2double[nDim];
 
   lDegree = Degree[0]; lOrder = lDegree+1;
   mDegree = Degree[1]; mOrder = mDegree+1;
@@ -8057,6 +8290,9 @@ CFreeFormDefBox::~CFreeFormDefBox(void) {
 	delete [] ParamCoord;
 	delete [] cart_coord;
 	delete [] Gradient;
+  for (iDim = 0; iDim < nDim; iDim++)
+    delete [] Hessian[iDim];
+  delete [] Hessian;
 	
 	for (iCornerPoints = 0; iCornerPoints < nCornerPoints; iCornerPoints++)
 		delete [] Coord_Corner_Points[iCornerPoints];
@@ -8595,19 +8831,243 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) {
 	for (iDim = 0; iDim < nDim; iDim++)
 		cart_coord[iDim] = 0.0;
 	
+	/*--- Evaluate the blending functions once per direction ---*/
+	
+	SetBasis(ParamCoord, 0);
+	
 	for (iDegree = 0; iDegree <= lDegree; iDegree++)
 		for (jDegree = 0; jDegree <= mDegree; jDegree++)
 			for (kDegree = 0; kDegree <= nDegree; kDegree++)
 				for (iDim = 0; iDim < nDim; iDim++) {
 					cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          * Basis[0][iDegree] * Basis[1][jDegree] * Basis[2][kDegree];
 				}
 	
 	return cart_coord;
 }
 
+void CFreeFormDefBox::SetBasis(su2double *uvw, unsigned short val_order) {
+  
+  unsigned short iDim, iDegree, lmn[3];
+  
+  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Basis[iDim].resize(lmn[iDim]+1);
+    if (val_order > 0) Basis_Der1[iDim].resize(lmn[iDim]+1);
+    if (val_order > 1) Basis_Der2[iDim].resize(lmn[iDim]+1);
+    for (iDegree = 0; iDegree <= lmn[iDim]; iDegree++) {
+      Basis[iDim][iDegree] = BlendingFunction[iDim]->GetBasis(iDegree, uvw[iDim]);
+      if (val_order > 0) Basis_Der1[iDim][iDegree] = BlendingFunction[iDim]->GetDerivative(iDegree, uvw[iDim], 1);
+      if (val_order > 1) Basis_Der2[iDim][iDegree] = BlendingFunction[iDim]->GetDerivative(iDegree, uvw[iDim], 2);
+    }
+  }
+  
+}
+
+void CFreeFormDefBox::GetFFDGradientHessian(su2double *uvw, su2double *xyz, su2double *val_Gradient, su2double **val_Hessian) {
+  
+  unsigned short iDim, jDim, kDim, iDegree, jDegree, kDegree;
+  su2double X[3], dX[3][3], d2X[3][3][3], N, dN[3], d2N[3][3], *Coord, Diff;
+  
+  /*--- Blending functions and their first two derivatives in each direction ---*/
+  
+  SetBasis(uvw, 2);
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    X[iDim] = 0.0;
+    for (jDim = 0; jDim < nDim; jDim++) {
+      dX[iDim][jDim] = 0.0;
+      for (kDim = 0; kDim < nDim; kDim++)
+        d2X[iDim][jDim][kDim] = 0.0;
+    }
+  }
+  
+  /*--- Single sweep over the control points for the map X(u, v, w) and its
+   first and second derivatives (the second derivatives are symmetric) ---*/
+  
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    for (jDegree = 0; jDegree <= mDegree; jDegree++)
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        
+        N = Basis[0][iDegree]*Basis[1][jDegree]*Basis[2][kDegree];
+        
+        dN[0] = Basis_Der1[0][iDegree]*Basis[1][jDegree]*Basis[2][kDegree];
+        dN[1] = Basis[0][iDegree]*Basis_Der1[1][jDegree]*Basis[2][kDegree];
+        dN[2] = Basis[0][iDegree]*Basis[1][jDegree]*Basis_Der1[2][kDegree];
+        
+        d2N[0][0] = Basis_Der2[0][iDegree]*Basis[1][jDegree]*Basis[2][kDegree];
+        d2N[1][1] = Basis[0][iDegree]*Basis_Der2[1][jDegree]*Basis[2][kDegree];
+        d2N[2][2] = Basis[0][iDegree]*Basis[1][jDegree]*Basis_Der2[2][kDegree];
+        d2N[0][1] = Basis_Der1[0][iDegree]*Basis_Der1[1][jDegree]*Basis[2][kDegree];
+        d2N[0][2] = Basis_Der1[0][iDegree]*Basis[1][jDegree]*Basis_Der1[2][kDegree];
+        d2N[1][2] = Basis[0][iDegree]*Basis_Der1[1][jDegree]*Basis_Der1[2][kDegree];
+        
+        Coord = Coord_Control_Points[iDegree][jDegree][kDegree];
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          X[iDim] += Coord[iDim]*N;
+          for (jDim = 0; jDim < nDim; jDim++) {
+            dX[iDim][jDim] += Coord[iDim]*dN[jDim];
+            for (kDim = jDim; kDim < nDim; kDim++)
+              d2X[iDim][jDim][kDim] += Coord[iDim]*d2N[jDim][kDim];
+          }
+        }
+      }
+  
+  /*--- Gradient and Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 ---*/
+  
+  for (jDim = 0; jDim < nDim; jDim++) {
+    val_Gradient[jDim] = 0.0;
+    for (kDim = 0; kDim < nDim; kDim++)
+      val_Hessian[jDim][kDim] = 0.0;
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Diff = 2.0*(X[iDim] - xyz[iDim]);
+    for (jDim = 0; jDim < nDim; jDim++) {
+      val_Gradient[jDim] += Diff*dX[iDim][jDim];
+      for (kDim = jDim; kDim < nDim; kDim++)
+        val_Hessian[jDim][kDim] += 2.0*dX[iDim][jDim]*dX[iDim][kDim] + Diff*d2X[iDim][jDim][kDim];
+    }
+  }
+  
+  for (jDim = 0; jDim < nDim; jDim++)
+    for (kDim = 0; kDim < jDim; kDim++)
+      val_Hessian[jDim][kDim] = val_Hessian[kDim][jDim];
+  
+}
+
+void CFreeFormDefBox::SetInversionLattice(void) {
+  
+  unsigned short iDim, lmn[3];
+  unsigned long iSample, jSample, kSample, nSample[3], iLattice, nLattice, iBucket, ijk[3], nBucket;
+  su2double uvw[3], *xyz;
+  passivedouble MaxLattice[3];
+  
+  /*--- Two samples per control point span in each direction, so that the lattice
+   follows the local stretching of the map (with a cap for very high orders) ---*/
+  
+  lmn[0] = lOrder; lmn[1] = mOrder; lmn[2] = nOrder;
+  
+  nLattice = 1;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    nSample[iDim] = min(max(2*lmn[iDim], 8), 24) + 1;
+    nLattice *= nSample[iDim];
+  }
+  
+  InvLattice_Param.resize(nLattice*nDim);
+  InvLattice_Coord.resize(nLattice*nDim);
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    InvBucket_Min[iDim] = 1E300; MaxLattice[iDim] = -1E300;
+  }
+  
+  iLattice = 0;
+  for (iSample = 0; iSample < nSample[0]; iSample++)
+    for (jSample = 0; jSample < nSample[1]; jSample++)
+      for (kSample = 0; kSample < nSample[2]; kSample++) {
+        uvw[0] = su2double(iSample)/su2double(nSample[0]-1);
+        uvw[1] = su2double(jSample)/su2double(nSample[1]-1);
+        uvw[2] = su2double(kSample)/su2double(nSample[2]-1);
+        xyz = EvalCartesianCoord(uvw);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          InvLattice_Param[iLattice*nDim+iDim] = SU2_TYPE::GetValue(uvw[iDim]);
+          InvLattice_Coord[iLattice*nDim+iDim] = SU2_TYPE::GetValue(xyz[iDim]);
+          InvBucket_Min[iDim] = min(InvBucket_Min[iDim], InvLattice_Coord[iLattice*nDim+iDim]);
+          MaxLattice[iDim] = max(MaxLattice[iDim], InvLattice_Coord[iLattice*nDim+iDim]);
+        }
+        iLattice++;
+      }
+  
+  /*--- Uniform cartesian buckets over the bounding box of the samples, with
+   roughly one sample per bucket ---*/
+  
+  nBucket = 1;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    nInvBucket[iDim] = nSample[iDim]-1;
+    InvBucket_Delta[iDim] = (MaxLattice[iDim] - InvBucket_Min[iDim])/passivedouble(nInvBucket[iDim]);
+    if (InvBucket_Delta[iDim] <= 0.0) { nInvBucket[iDim] = 1; InvBucket_Delta[iDim] = 1.0; }
+    nBucket *= nInvBucket[iDim];
+  }
+  
+  /*--- Sort the samples by bucket (compressed row storage) ---*/
+  
+  InvBucket_Start.assign(nBucket+1, 0);
+  InvBucket_Sample.resize(nLattice);
+  
+  vector<unsigned long> SampleBucket(nLattice);
+  for (iLattice = 0; iLattice < nLattice; iLattice++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      ijk[iDim] = (unsigned long)((InvLattice_Coord[iLattice*nDim+iDim] - InvBucket_Min[iDim])/InvBucket_Delta[iDim]);
+      ijk[iDim] = min(ijk[iDim], nInvBucket[iDim]-1);
+    }
+    SampleBucket[iLattice] = (ijk[0]*nInvBucket[1] + ijk[1])*nInvBucket[2] + ijk[2];
+    InvBucket_Start[SampleBucket[iLattice]+1]++;
+  }
+  
+  for (iBucket = 0; iBucket < nBucket; iBucket++)
+    InvBucket_Start[iBucket+1] += InvBucket_Start[iBucket];
+  
+  vector<unsigned long> BucketFill(InvBucket_Start.begin(), InvBucket_Start.end()-1);
+  for (iLattice = 0; iLattice < nLattice; iLattice++)
+    InvBucket_Sample[BucketFill[SampleBucket[iLattice]]++] = iLattice;
+  
+}
+
+void CFreeFormDefBox::GetInversionGuess(su2double *xyz, su2double *val_guess) {
+  
+  unsigned short iDim;
+  long ijk[3], Ring, iBucket, jBucket, kBucket, nRing;
+  unsigned long iSample, iLattice, Bucket, BestLattice = 0;
+  passivedouble Point[3], Dist, Diff, MinDist = 1E300, MinDelta;
+  bool Found = false;
+  
+  if (InvLattice_Coord.empty()) {
+    for (iDim = 0; iDim < nDim; iDim++) val_guess[iDim] = 0.5;
+    return;
+  }
+  
+  /*--- Bucket of the point (points outside the lattice go to the closest boundary bucket) ---*/
+  
+  MinDelta = 1E300; nRing = 0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Point[iDim] = SU2_TYPE::GetValue(xyz[iDim]);
+    ijk[iDim] = long(floor((Point[iDim] - InvBucket_Min[iDim])/InvBucket_Delta[iDim]));
+    ijk[iDim] = max(0L, min(ijk[iDim], long(nInvBucket[iDim])-1));
+    if (nInvBucket[iDim] > 1) MinDelta = min(MinDelta, InvBucket_Delta[iDim]);
+    nRing = max(nRing, long(nInvBucket[iDim]));
+  }
+  
+  /*--- Visit rings of buckets of increasing size around it; samples beyond ring
+   Ring+1 are at least Ring*MinDelta away, which bounds the search ---*/
+  
+  for (Ring = 0; Ring <= nRing; Ring++) {
+    for (iBucket = max(0L, ijk[0]-Ring); iBucket <= min(long(nInvBucket[0])-1, ijk[0]+Ring); iBucket++)
+      for (jBucket = max(0L, ijk[1]-Ring); jBucket <= min(long(nInvBucket[1])-1, ijk[1]+Ring); jBucket++)
+        for (kBucket = max(0L, ijk[2]-Ring); kBucket <= min(long(nInvBucket[2])-1, ijk[2]+Ring); kBucket++) {
+          
+          if ((labs(iBucket-ijk[0]) != Ring) && (labs(jBucket-ijk[1]) != Ring) && (labs(kBucket-ijk[2]) != Ring)) continue;
+          
+          Bucket = (iBucket*nInvBucket[1] + jBucket)*nInvBucket[2] + kBucket;
+          for (iSample = InvBucket_Start[Bucket]; iSample < InvBucket_Start[Bucket+1]; iSample++) {
+            iLattice = InvBucket_Sample[iSample];
+            Dist = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Diff = InvLattice_Coord[iLattice*nDim+iDim] - Point[iDim];
+              Dist += Diff*Diff;
+            }
+            if (Dist < MinDist) { MinDist = Dist; BestLattice = iLattice; Found = true; }
+          }
+        }
+    if (Found && (sqrt(MinDist) <= passivedouble(Ring)*MinDelta)) break;
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    val_guess[iDim] = InvLattice_Param[BestLattice*nDim+iDim];
+  
+}
+
 
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
   
@@ -8671,7 +9131,7 @@ void CFreeFormDefBox::GetFFDHessian(su2double *uvw, su2double *xyz, su2double **
 
 su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, su2double *ParamCoordGuess, CConfig *config) {
   
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
+  su2double IndepTerm[3], SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
   unsigned short iDim, jDim, RandonCounter;
   unsigned long iter;
   
@@ -8679,12 +9139,9 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   unsigned short it_max = config->GetnFFD_Iter();
   unsigned short Random_Trials = 500;
 
-	/*--- Allocate the Hessian ---*/
+	/*--- Initial guess ---*/
   
-  Hessian = new su2double* [nDim];
-  IndepTerm = new su2double [nDim];
   for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
     ParamCoord[iDim] = ParamCoordGuess[iDim];
     IndepTerm [iDim] = 0.0;
   }
@@ -8695,15 +9152,12 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
 	for (iter = 0; iter < (unsigned long)it_max*Random_Trials; iter++) {
 		  
-		/*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
+		/*--- The independent term of the solution of our system is -Gradient(sol_old), and
+		 the Hessian is the matrix of our system (both from one sweep over the control points) ---*/
 
-		Gradient = GetFFDGradient(ParamCoord, xyz);
+		GetFFDGradientHessian(ParamCoord, xyz, Gradient, Hessian);
     
     for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = - Gradient[iDim];
-
-		/*--- Hessian = The Matrix of our system, getHessian(sol_old,xyz,...) ---*/
-    
-		GetFFDHessian(ParamCoord, xyz, Hessian);
     
     /*--- Adjoint to Hessian ---*/
 
@@ -8786,11 +9240,6 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
   }
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Hessian[iDim];
-  delete [] Hessian;
-  delete [] IndepTerm;
-
   /*--- The code has hit the max number of iterations ---*/
 
   if (iter == (unsigned long)it_max*Random_Trials) {
@@ -9077,6 +9526,12 @@ CElasticityMovement::CElasticityMovement(CGeometry *geometry, CConfig *config) :
     Mu     = E / (2.0*(1.0 + Nu));
     Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
 
+    /*--- The element stiffness may be kept from the first deformation (not while recording the adjoint) ---*/
+
+    stiffness_cache  = (config->GetDeform_Cache_Stiffness() && !config->GetDiscrete_Adjoint());
+    stiffness_stored = false;
+    prec_built       = false;
+
     /*--- Element container structure ---*/
 
     element_container = new CElement* [MAX_FE_KINDS];
@@ -9225,8 +9680,9 @@ void CElasticityMovement::SetVolume_Deformation_Elas(CGeometry *geometry, CConfi
       else           cout << scientific << "Min. volume: "<< MinVolume <<", max. volume: " << MaxVolume <<"." << endl;
     }
 
-    /*--- Compute the stiffness matrix. ---*/
+    /*--- Compute the stiffness matrix (or assemble it from the stored element stiffness). ---*/
     SetStiffnessMatrix(geometry, config);
+    if (stiffness_cache) stiffness_stored = true;
 
     /*--- Impose boundary conditions (all of them are ESSENTIAL BC's - displacements). ---*/
     SetBoundaryDisplacements(geometry, config);
@@ -9575,28 +10031,35 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     CPreconditioner* precond = NULL;
 
+    /*--- A matrix assembled from the stored element stiffness (with the same boundary
+     conditions imposed) is the same in every deformation, and so is its preconditioner ---*/
+
+    bool reuse_prec = (stiffness_cache && prec_built);
+
     switch (config->GetKind_Deform_Linear_Solver_Prec()) {
     case JACOBI:
-      StiffMatrix.BuildJacobiPreconditioner();
+      if (!reuse_prec) StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
       break;
     case ILU:
-      StiffMatrix.BuildILUPreconditioner();
+      if (!reuse_prec) StiffMatrix.BuildILUPreconditioner();
       precond = new CILUPreconditioner(StiffMatrix, geometry, config);
       break;
     case LU_SGS:
       precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
       break;
     case LINELET:
-      StiffMatrix.BuildJacobiPreconditioner();
+      if (!reuse_prec) StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
       break;
     default:
-      StiffMatrix.BuildJacobiPreconditioner();
+      if (!reuse_prec) StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
       break;
     }
 
+    prec_built = stiffness_stored;
+
     switch (config->GetKind_Deform_Linear_Solver()) {
     case BCGSTAB:
       IterLinSol = system->BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
@@ -9744,6 +10207,56 @@ void CElasticityMovement::SetStiffnessMatrix(CGeometry *geometry, CConfig *confi
 
   su2double ElemVolume;
 
+  unsigned long iBlock;
+  bool transposed;
+
+  /*--- With a stored element stiffness the matrix is assembled directly from the element blocks ---*/
+
+  if (stiffness_cache && stiffness_stored) {
+
+    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+      NelNodes = Elem_Stiffness_nNodes[iElem];
+
+      for (iNode = 0; iNode < NelNodes; iNode++)
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+      for (iNode = 0; iNode < NelNodes; iNode++){
+
+        for (jNode = 0; jNode < NelNodes; jNode++){
+
+          /*--- Block ab of the upper triangle, or the transpose of block ba ---*/
+
+          transposed = (jNode < iNode);
+          if (!transposed) iBlock = iNode*NelNodes - (iNode*(iNode-1))/2 + (jNode-iNode);
+          else             iBlock = jNode*NelNodes - (jNode*(jNode-1))/2 + (iNode-jNode);
+          Kab = &Elem_Stiffness[Elem_Stiffness_Offset[iElem] + iBlock*nDim*nDim];
+
+          for (iDim = 0; iDim < nDim; iDim++){
+            for (jDim = 0; jDim < nDim; jDim++){
+              if (!transposed) Jacobian_ij[iDim][jDim] = Kab[iDim*nDim+jDim];
+              else             Jacobian_ij[iDim][jDim] = Kab[jDim*nDim+iDim];
+            }
+          }
+
+          StiffMatrix.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
+
+        }
+
+      }
+
+    }
+
+    return;
+
+  }
+
+  if (stiffness_cache) {
+    Elem_Stiffness.clear();
+    Elem_Stiffness_Offset.assign(geometry->GetnElem()+1, 0);
+    Elem_Stiffness_nNodes.assign(geometry->GetnElem(), 0);
+  }
+
   /*--- Loops over all the elements ---*/
 
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
@@ -9783,6 +10296,19 @@ void CElasticityMovement::SetStiffnessMatrix(CGeometry *geometry, CConfig *confi
 
     NelNodes = element_container[EL_KIND]->GetnNodes();
 
+    /*--- Store the upper triangular blocks of the element stiffness ---*/
+
+    if (stiffness_cache) {
+      Elem_Stiffness_nNodes[iElem] = NelNodes;
+      for (iNode = 0; iNode < NelNodes; iNode++){
+        for (jNode = iNode; jNode < NelNodes; jNode++){
+          Kab = element_container[EL_KIND]->Get_Kab(iNode, jNode);
+          Elem_Stiffness.insert(Elem_Stiffness.end(), Kab, Kab+nDim*nDim);
+        }
+      }
+      Elem_Stiffness_Offset[iElem+1] = Elem_Stiffness.size();
+    }
+
     /*--- Assemble the stiffness matrix ---*/
 
     for (iNode = 0; iNode < NelNodes; iNode++){
@@ -36,6 +36,7 @@
  */
 
 #include "../include/interpolation_structure.hpp"
+#include "../include/adt_structure.hpp"
 
 CInterpolator::CInterpolator(void) {
   
@@ -470,18 +471,26 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
 #endif 
 
   if (rank == MASTER_NODE){
+
+    /*--- Map the global point index to the reconstructed vertex index, in order to
+          avoid a search over the whole boundary for each linked node. If a global
+          point is listed more than once, the first occurrence is used. ---*/
+    map<unsigned long, unsigned long> GlobalPointToVertex;
+    map<unsigned long, unsigned long>::const_iterator MI;
+
+    for (kVertex = nGlobalVertex; kVertex > 0; kVertex--)
+      GlobalPointToVertex[ Buffer_Receive_GlobalPoint[kVertex-1] ] = kVertex-1;
+
     for (iVertex = 0; iVertex < nGlobalVertex; iVertex++){
       count = 0;
       uptr = &Buffer_Receive_LinkedNodes[ Buffer_Receive_StartLinkedNodes[iVertex] ];
       
       for (jVertex = 0; jVertex < Buffer_Receive_nLinkedNodes[iVertex]; jVertex++){
         iTmp = uptr[ jVertex ];
-        for (kVertex = 0; kVertex < nGlobalVertex; kVertex++){
-          if( Buffer_Receive_GlobalPoint[kVertex] == iTmp ){
-            uptr[ jVertex ] = kVertex;
-            count++;
-            break;
-          }
+        MI = GlobalPointToVertex.find(iTmp);
+        if( MI != GlobalPointToVertex.end() ){
+          uptr[ jVertex ] = MI->second;
+          count++;
         }
           
         if( count != (jVertex+1) ){
@@ -594,15 +603,16 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor = size;
+  int iProcessor, pProcessor, rankDonor, nProcessor = size;
   int markDonor, markTarget;
 
-  unsigned short nDim, iMarkerInt, nMarkerInt, iDonor;    
+  unsigned short nDim, iDim, iMarkerInt, nMarkerInt, iDonor;    
 
   unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
+  unsigned long nVertexDonorGlobal, iVertexDonor;
   unsigned long Global_Point_Donor, pGlobalPoint=0;
 
-  su2double *Coord_i, *Coord_j, dist, mindist, maxdist;
+  su2double *Coord_i, mindist, maxdist;
 
   /*--- Initialize variables --- */
   
@@ -653,6 +663,34 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
     /*-- Collect coordinates, global points, and normal vectors ---*/
     Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
 
+    /*--- Store the gathered donor vertices in an ADT. The padding entries of the
+          receive buffers are skipped and the position in the receive buffer is
+          used as point ID, such that the processor and global index of the
+          nearest donor can be retrieved from the buffers afterwards. ---*/
+    nVertexDonorGlobal = 0;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      nVertexDonorGlobal += Buffer_Receive_nVertex_Donor[iProcessor];
+
+    vector<su2double>     Coord_Donor(nVertexDonorGlobal*nDim);
+    vector<unsigned long> Index_Donor(nVertexDonorGlobal);
+
+    iVertexDonor = 0;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
+        Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Coord_Donor[iVertexDonor*nDim+iDim] = Buffer_Receive_Coord[Global_Point_Donor*nDim+iDim];
+        Index_Donor[iVertexDonor] = Global_Point_Donor;
+        iVertexDonor++;
+      }
+    }
+
+    /*--- The donor data is already available on all ranks, hence a local tree suffices. ---*/
+    CADTPointsOnlyClass DonorADT(nDim, nVertexDonorGlobal, Coord_Donor.data(), Index_Donor.data(), false);
+
+    if (DonorADT.IsEmpty() && nVertexTarget > 0)
+      SU2_MPI::Error("No donor vertices found on the interface.", CURRENT_FUNCTION);
+
     /*--- Compute the closest point to a Near-Field boundary point ---*/
     maxdist = 0.0;
 
@@ -668,27 +706,11 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
         /*--- Coordinates of the boundary point ---*/
         Coord_i = target_geometry->node[Point_Target]->GetCoord();
 
-        mindist    = 1E6; 
-        pProcessor = 0;
-
-        /*--- Loop over all the boundaries to find the pair ---*/
-
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
-
-            Coord_j = &Buffer_Receive_Coord[ Global_Point_Donor*nDim];
-
-            dist = PointsDistance(Coord_i, Coord_j);
+        /*--- Search the nearest donor vertex in the ADT ---*/
+        DonorADT.DetermineNearestNode(Coord_i, mindist, Global_Point_Donor, rankDonor);
 
-            if (dist < mindist) {
-              mindist = dist; pProcessor = iProcessor; pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
-            }
-
-            if (dist == 0.0) break;
-          }
-
-        }
+        pProcessor   = (int) (Global_Point_Donor / MaxLocalVertex_Donor);
+        pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
 
         /*--- Store the value of the pair ---*/
         maxdist = max(maxdist, mindist);
@@ -753,7 +775,17 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
 
   unsigned long faceindex;
 
-  su2double dist = 0.0, mindist=1E6, *Coord, *Coord_i;
+  map<unsigned long, unsigned long> GlobalPointToBufferIndex;
+  map<unsigned long, unsigned long>::const_iterator MI;
+
+  vector<su2double> faceCoor;
+  vector<unsigned long> faceConn, faceID, faceFirstNode;
+  vector<unsigned short> faceVTK_Type, faceMarker, faceNNodes;
+  unsigned short faceMarkerID;
+  unsigned long faceNearest;
+  int faceRank;
+
+  su2double dist = 0.0, *Coord_i;
   su2double myCoeff[10]; // Maximum # of donor points
   su2double  *Normal;
   su2double *projected_point = new su2double[nDim];
@@ -763,7 +795,6 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
   int storeProc[10];
 
   int nProcessor = size;
-  Coord = new su2double[nDim];
   Normal = new su2double[nDim];
 
   nMarkerInt = (config[donorZone]->GetMarker_n_ZoneInterface())/2;
@@ -818,6 +849,17 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
     /*-- Collect coordinates, global points, and normal vectors ---*/
     Collect_VertexInfo(true, markDonor,markTarget,nVertexDonor,nDim);
 
+    /*--- Map the global index of the donor vertices to their position in the
+          receive buffers, which avoids a search over all donor vertices for
+          every node of the donor faces. ---*/
+    GlobalPointToBufferIndex.clear();
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
+        GlobalPointToBufferIndex[Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]] =
+            MaxLocalVertex_Donor*iProcessor+jVertex;
+      }
+    }
+
     Buffer_Send_FaceIndex    = new unsigned long[MaxFace_Donor];
     Buffer_Send_FaceNodes    = new unsigned long[MaxFaceNodes_Donor];
     Buffer_Send_FaceProc     = new unsigned long[MaxFaceNodes_Donor];
@@ -871,13 +913,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
               dPoint = donor_geometry->elem[temp_donor]->GetNode(inode);
               // Match node on the face to the correct global index
               jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                  if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                    Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                    Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                  }
-                }
+              MI = GlobalPointToBufferIndex.find(jGlobalPoint);
+              if (MI != GlobalPointToBufferIndex.end()) {
+                Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MI->second;
+                Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=MI->second/MaxLocalVertex_Donor;
               }
               nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
             }
@@ -901,13 +940,10 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
             dPoint = donor_geometry->edge[inode]->GetNode(iDonor);
             // Match node on the face to the correct global index
             jGlobalPoint=donor_geometry->node[dPoint]->GetGlobalIndex();
-            for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-              for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
-                if (jGlobalPoint ==Buffer_Receive_GlobalPoint[MaxLocalVertex_Donor*iProcessor+jVertex]) {
-                  Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MaxLocalVertex_Donor*iProcessor+jVertex;
-                  Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=iProcessor;
-                }
-              }
+            MI = GlobalPointToBufferIndex.find(jGlobalPoint);
+            if (MI != GlobalPointToBufferIndex.end()) {
+              Buffer_Send_FaceNodes[nLocalFaceNodes_Donor]=MI->second;
+              Buffer_Send_FaceProc[nLocalFaceNodes_Donor]=MI->second/MaxLocalVertex_Donor;
             }
             nLocalFaceNodes_Donor++; // Increment total number of face-nodes / processor
           }
@@ -935,9 +971,49 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_FaceProc[iVertex] = Buffer_Send_FaceProc[iVertex];
 #endif
 
+    /*--- Store the gathered donor faces in an ADT of surface elements, such that
+          only the face nearest to a target vertex is considered instead of all
+          donor faces. The faces are available on all ranks, hence a local tree
+          suffices. Its points are the entries of the receive buffers. ---*/
+    faceCoor.assign(nProcessor*MaxLocalVertex_Donor*nDim, 0.0);
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (jVertex = 0; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; jVertex++) {
+        faceindex = MaxLocalVertex_Donor*iProcessor+jVertex;
+        for (iDim = 0; iDim < nDim; iDim++)
+          faceCoor[faceindex*nDim+iDim] = Buffer_Receive_Coord[faceindex*nDim+iDim];
+      }
+    }
+
+    faceConn.clear();  faceVTK_Type.clear();  faceMarker.clear();  faceID.clear();
+    faceFirstNode.clear();  faceNNodes.clear();
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      nFaces = (unsigned int)Buffer_Receive_nFace_Donor[iProcessor];
+      for (iFace = 0; iFace < nFaces; iFace++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
+        nNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] - (unsigned int)faceindex;
+
+        if      (nDim == 2)   faceVTK_Type.push_back(LINE);
+        else if (nNodes == 3) faceVTK_Type.push_back(TRIANGLE);
+        else                  faceVTK_Type.push_back(QUADRILATERAL);
+
+        for (iDonor = 0; iDonor < nNodes; iDonor++)
+          faceConn.push_back(Buffer_Receive_FaceNodes[faceindex+iDonor]);
+
+        faceMarker.push_back(0);
+        faceID.push_back(faceFirstNode.size());
+        faceFirstNode.push_back(faceindex);
+        faceNNodes.push_back(nNodes);
+      }
+    }
+
+    CADTElemClass DonorFaceADT(nDim, faceCoor, faceConn, faceVTK_Type, faceMarker, faceID, false);
+
+    if (DonorFaceADT.IsEmpty() && nVertexTarget > 0)
+      SU2_MPI::Error("No donor faces found on the interface.", CURRENT_FUNCTION);
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
-      mindist=1E6;
       for (unsigned short iCoeff=0; iCoeff<10; iCoeff++) {
     storeCoeff[iCoeff]=0;
       }
@@ -946,89 +1022,66 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
       if (target_geometry->node[Point_Target]->GetDomain()) {
 
     Coord_i = target_geometry->node[Point_Target]->GetCoord();
-    /*---Loop over the faces previously communicated/stored ---*/
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-
-      nFaces = (unsigned int)Buffer_Receive_nFace_Donor[iProcessor];
 
-      for (iFace = 0; iFace< nFaces; iFace++) {
-        /*--- ---*/
+    /*--- Determine the nearest donor face ---*/
+    DonorFaceADT.DetermineNearestElement(Coord_i, dist, faceMarkerID, faceNearest, faceRank);
 
-        nNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1] -
-                (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace];
+    faceindex = faceFirstNode[faceNearest];
+    nNodes    = faceNNodes[faceNearest];
 
-        su2double *X = new su2double[nNodes*nDim];
-        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-        for (iDonor=0; iDonor<nNodes; iDonor++) {
-          jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
-          for (iDim=0; iDim<nDim; iDim++) {
-            X[iDim*nNodes+iDonor]=
-                Buffer_Receive_Coord[jVertex*nDim+iDim];
-          }
-        }
-        jVertex = Buffer_Receive_FaceNodes[faceindex];
-
-        for (iDim=0; iDim<nDim; iDim++) {
-          Normal[iDim] = Buffer_Receive_Normal[jVertex*nDim+iDim];
-        }
+    su2double *X = new su2double[nNodes*nDim];
+    for (iDonor=0; iDonor<nNodes; iDonor++) {
+      jVertex = Buffer_Receive_FaceNodes[iDonor+faceindex]; // index which points to the stored coordinates, global points
+      for (iDim=0; iDim<nDim; iDim++) {
+        X[iDim*nNodes+iDonor]=
+            Buffer_Receive_Coord[jVertex*nDim+iDim];
+      }
+    }
+    jVertex = Buffer_Receive_FaceNodes[faceindex];
 
-        /* Project point used for case where surfaces are not exactly coincident, where
-         * the point is assumed connected by a rigid rod normal to the surface.
-         */
-        tmp = 0;
-        tmp2=0;
-        for (iDim=0; iDim<nDim; iDim++) {
-          tmp+=Normal[iDim]*Normal[iDim];
-          tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
-        }
-        tmp = 1/tmp;
-        tmp2 = tmp2*sqrt(tmp);
-        for (iDim=0; iDim<nDim; iDim++) {
-          // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
-          // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
-          // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
-          // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
-          projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
-        }
+    for (iDim=0; iDim<nDim; iDim++) {
+      Normal[iDim] = Buffer_Receive_Normal[jVertex*nDim+iDim];
+    }
 
-        Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
+    /* Project point used for case where surfaces are not exactly coincident, where
+     * the point is assumed connected by a rigid rod normal to the surface.
+     */
+    tmp = 0;
+    tmp2=0;
+    for (iDim=0; iDim<nDim; iDim++) {
+      tmp+=Normal[iDim]*Normal[iDim];
+      tmp2+=Normal[iDim]*(Coord_i[iDim]-X[iDim*nNodes]);
+    }
+    tmp = 1/tmp;
+    tmp2 = tmp2*sqrt(tmp);
+    for (iDim=0; iDim<nDim; iDim++) {
+      // projection of \vec{q} onto plane defined by \vec{n} and \vec{p}:
+      // \vec{q} - \vec{n} ( (\vec{q}-\vec{p} ) \cdot \vec{n})
+      // tmp2 = ( (\vec{q}-\vec{p} ) \cdot \vec{N})
+      // \vec{n} = \vec{N}/(|N|), tmp = 1/|N|^2
+      projected_point[iDim]=Coord_i[iDim] + Normal[iDim]*tmp2*tmp;
+    }
+
+    Isoparameters(nDim, nNodes, X, projected_point,myCoeff);
+
+    /*--- Store info ---*/
+    donor_elem = temp_donor;
+    target_geometry->vertex[markTarget][iVertex]->SetDonorElem(donor_elem); // in 2D is nearest neighbor
+    target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
+    for (iDonor=0; iDonor<nNodes; iDonor++) {
+      storeCoeff[iDonor] = myCoeff[iDonor];
+      jVertex = Buffer_Receive_FaceNodes[faceindex+iDonor];
+      storeGlobal[iDonor] =Buffer_Receive_GlobalPoint[jVertex];
+      storeProc[iDonor] = (int)Buffer_Receive_FaceProc[faceindex+iDonor];
+    }
 
-        /*--- Find distance to the interpolated point ---*/
-        dist = 0.0;
-        for (iDim=0; iDim<nDim; iDim++) {
-          Coord[iDim] = Coord_i[iDim];
-          for(iDonor=0; iDonor< nNodes; iDonor++) {
-            Coord[iDim]-=myCoeff[iDonor]*X[iDim*nNodes+iDonor];
-          }
-          dist+=pow(Coord[iDim],2.0);
-        }
+    delete [] X;
 
-        /*--- If the dist is shorter than last closest (and nonzero nodes are on the boundary), update ---*/
-        if (dist<mindist ) {
-          /*--- update last dist ---*/
-          mindist = dist;
-          /*--- Store info ---*/
-          donor_elem = temp_donor;
-          target_geometry->vertex[markTarget][iVertex]->SetDonorElem(donor_elem); // in 2D is nearest neighbor
-          target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
-          for (iDonor=0; iDonor<nNodes; iDonor++) {
-            storeCoeff[iDonor] = myCoeff[iDonor];
-            jVertex = Buffer_Receive_FaceNodes[faceindex+iDonor];
-            storeGlobal[iDonor] =Buffer_Receive_GlobalPoint[jVertex];
-            storeProc[iDonor] = (int)Buffer_Receive_FaceProc[faceindex+iDonor];
-          }
-        }
-      
-        delete [] X;
-      }
-    }
     /*--- Set the appropriate amount of memory and fill ---*/
-    nNodes =target_geometry->vertex[markTarget][iVertex]->GetnDonorPoints();
     target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
     for (iDonor=0; iDonor<nNodes; iDonor++) {
       target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,storeGlobal[iDonor]);
-      //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;
       target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,storeCoeff[iDonor]);
       target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, storeProc[iDonor]);
     }
@@ -1059,7 +1112,6 @@ void CIsoparametric::Set_TransferCoeff(CConfig **config) {
     delete[] Buffer_Receive_FaceNodes;
     delete[] Buffer_Receive_FaceProc;
   }
-  delete [] Coord;
   delete [] Normal;
   
   delete [] projected_point;
@@ -1294,6 +1346,9 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
   su2double *Buffer_Send_Coeff, *Buffer_Receive_Coeff;
   su2double coeff;
 
+  map<unsigned long, vector<pair<unsigned long, int> > > TargetPointToEntries;
+  map<unsigned long, vector<pair<unsigned long, int> > >::const_iterator MMI;
+
   /*--- Number of markers on the interface ---*/
   nMarkerInt = (config[targetZone]->GetMarker_n_ZoneInterface())/2;
 
@@ -1425,46 +1480,44 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_Coeff[iVertex] = Buffer_Send_Coeff[iVertex];
     }
 #endif
+    /*--- Sort the received donor entries by the global index of the point they
+          are a donor for, such that each target vertex only visits its own
+          entries. The entries are stored in the order of the processor, face
+          and node loops, i.e. the order in which the donors are set. ---*/
+    TargetPointToEntries.clear();
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
+        iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
+        for (iTarget=0; iTarget<iNodes; iTarget++) {
+          TargetPointToEntries[Buffer_Receive_GlobalPoint[faceindex+iTarget]].push_back(
+              make_pair(faceindex+iTarget, iProcessor));
+        }
+      }
+    }
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
 
       iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
       if (target_geometry->node[iPoint]->GetDomain()) {
         Global_Point = target_geometry->node[iPoint]->GetGlobalIndex();
+
+        MMI = TargetPointToEntries.find(Global_Point);
         nNodes = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget])
-                nNodes++;
-              //coeff =Buffer_Receive_Coeff[faceindex+iDonor];
-            }
-          }
-        }
+        if (MMI != TargetPointToEntries.end()) nNodes = MMI->second.size();
 
         target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
         target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
-        iDonor = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget]) {
-                coeff =Buffer_Receive_Coeff[faceindex+iTarget];
-                pGlobalPoint = Buffer_Receive_FaceNodes[faceindex+iTarget];
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
-                target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
-                //cout <<rank << " Global Point " << Global_Point<<" iDonor " << iDonor <<" coeff " << coeff <<" gp " << pGlobalPoint << endl;
-                iDonor++;
-              }
-            }
-          }
+        for (iDonor = 0; iDonor < nNodes; iDonor++) {
+          faceindex  = MMI->second[iDonor].first;
+          iProcessor = MMI->second[iDonor].second;
+          coeff =Buffer_Receive_Coeff[faceindex];
+          pGlobalPoint = Buffer_Receive_FaceNodes[faceindex];
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
         }
       }
     }
@@ -1511,7 +1564,9 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /* --- General variables --- */
 
-  bool check;
+  bool check, unchanged, found;
+  
+  int rankDonor;
   
   unsigned short iDim, nDim;
   
@@ -1528,7 +1583,7 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, mindist, maxEdge, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -1563,6 +1618,14 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
   
   su2double *donor_iMidEdge_point, *donor_jMidEdge_point;
   su2double **donor_element, *DonorPoint_Coord;
+
+  /* --- Search structures --- */
+
+  map<unsigned long, unsigned long> TargetGlobalPointToVertex;
+  map<unsigned long, unsigned long>::const_iterator MI;
+
+  vector<unsigned long> Donor_Index;
+  CADTPointsOnlyClass *DonorADT;
     
   /*  1 - Variable pre-processing - */
 
@@ -1580,13 +1643,20 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
   
   Normal    = new su2double[nDim];
   Direction = new su2double[nDim];
-    
-    
-  /* 2 - Find boundary tag between touching grids */
 
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt    = (int)( config[ donorZone ]->GetMarker_n_ZoneInterface() ) / 2;
 
+  if (StartDonor_Previous.size() != nMarkerInt) {
+    StartDonor_Previous.resize(nMarkerInt);
+    StartDist_Previous.resize(nMarkerInt);
+    DonorCoord_Previous.resize(nMarkerInt);
+    TargetCoord_Previous.resize(nMarkerInt);
+  }
+    
+    
+  /* 2 - Find boundary tag between touching grids */
+
   /*--- For the number of markers on the interface... ---*/
   for ( iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++ ){
 
@@ -1633,6 +1703,44 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- If neither the donor nor the target boundary moved since the previous call,
+          the donor information stored on the target vertices is still valid and the
+          supermesh reconstruction is skipped for this interface. For the discrete adjoint
+          the coefficients are always recomputed, such that they are part of the recording. ---*/
+    vector<unsigned long> &StartDonor = StartDonor_Previous[iMarkerInt-1];
+    vector<su2double> &StartDist      = StartDist_Previous[iMarkerInt-1];
+    vector<su2double> &DonorCoord_Old  = DonorCoord_Previous[iMarkerInt-1];
+    vector<su2double> &TargetCoord_Old = TargetCoord_Previous[iMarkerInt-1];
+
+    unchanged = ( !config[donorZone]->GetDiscrete_Adjoint()           &&
+                  StartDonor.size()      == nVertexTarget                &&
+                  DonorCoord_Old.size()  == nGlobalVertex_Donor  * nDim  &&
+                  TargetCoord_Old.size() == nGlobalVertex_Target * nDim );
+
+    if (unchanged)
+      unchanged = ( equal(DonorCoord_Old.begin(),  DonorCoord_Old.end(),  DonorPoint_Coord)  &&
+                    equal(TargetCoord_Old.begin(), TargetCoord_Old.end(), TargetPoint_Coord) );
+
+    if (unchanged) nVertexTarget = 0;
+
+    /*--- The seeds of the previous call are only meaningful if the donor boundary
+          was reconstructed with the same number of vertices. ---*/
+    else if (StartDonor.size() != nVertexTarget || DonorCoord_Old.size() != nGlobalVertex_Donor * nDim) {
+      StartDonor.assign(nVertexTarget, nGlobalVertex_Donor);
+      StartDist.assign(nVertexTarget, 0.0);
+    }
+
+    DonorCoord_Old.assign( DonorPoint_Coord,  DonorPoint_Coord  + nGlobalVertex_Donor  * nDim);
+    TargetCoord_Old.assign(TargetPoint_Coord, TargetPoint_Coord + nGlobalVertex_Target * nDim);
+
+    /*--- Map the global index of the target vertices to their reconstructed index ---*/
+    TargetGlobalPointToVertex.clear();
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      TargetGlobalPointToVertex.insert(make_pair(Target_GlobalPoint[jVertexTarget], jVertexTarget));
+
+    /*--- The ADT of the donor vertices is only built if a global search is needed ---*/
+    DonorADT = NULL;
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -1664,37 +1772,42 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
           Coord_i = target_geometry->node[target_iPoint]->GetCoord();
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
+          /*--- Find the closest donor_node. The seed of the previous call is used as initial
+                guess and the donor boundary is walked towards the closest node. For a rotor
+                that turned by a small angle since the previous time step this only takes a
+                few steps. A global search in the ADT is done if there is no previous seed, if
+                the walk stops at a node whose neighbourhood does not contain the target, or if
+                the walk ends farther away than the previous donor plus half the local edge
+                length, which indicates that it got stuck in a local minimum of the distance. ---*/
+
+          found = false;
+          if (StartDonor[iVertex] < nGlobalVertex_Donor) {
+            donor_StartIndex = WalkToClosestDonor(Coord_i, StartDonor[iVertex], DonorPoint_Coord, Donor_LinkedNodes,
+                                                  Donor_StartLinkedNodes, Donor_nLinkedNodes, mindist, maxEdge);
+            found = ( (mindist <= maxEdge) && (mindist <= StartDist[iVertex] + 0.5*maxEdge) );
+          }
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
+          if (!found) {
+            if (DonorADT == NULL) {
+              Donor_Index.resize(nGlobalVertex_Donor);
+              for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++)
+                Donor_Index[donor_iPoint] = donor_iPoint;
+              DonorADT = new CADTPointsOnlyClass(nDim, nGlobalVertex_Donor, DonorPoint_Coord, Donor_Index.data(), false);
             }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
+            DonorADT->DetermineNearestNode(Coord_i, mindist, donor_StartIndex, rankDonor);
           }
 
+          StartDonor[iVertex] = donor_StartIndex;
+          StartDist[iVertex]  = mindist;
+
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
           
           /*--- Contruct information regarding the target cell ---*/
           
           dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          MI = TargetGlobalPointToVertex.find(dPoint);
+          jVertexTarget = (MI != TargetGlobalPointToVertex.end()) ? MI->second : nGlobalVertex_Target;
             
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -1924,10 +2037,8 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
             Coord_i[iDim] = target_geometry->node[target_iPoint]->GetCoord(iDim);
           
           dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-            if( dPoint == Target_GlobalPoint[target_iPoint] )
-              break;
-          }        
+          MI = TargetGlobalPointToVertex.find(dPoint);
+          target_iPoint = (MI != TargetGlobalPointToVertex.end()) ? MI->second : nGlobalVertex_Target;
         
           /*--- Build local surface dual mesh for target element ---*/
         
@@ -1941,27 +2052,33 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
             
           nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes, TargetPoint_Coord, target_iPoint, target_element);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
+          /*--- Find the closest donor_node. The seed of the previous call is used as initial
+                guess and the donor boundary is walked towards the closest node. For a rotor
+                that turned by a small angle since the previous time step this only takes a
+                few steps. A global search in the ADT is done if there is no previous seed, if
+                the walk stops at a node whose neighbourhood does not contain the target, or if
+                the walk ends farther away than the previous donor plus half the local edge
+                length, which indicates that it got stuck in a local minimum of the distance. ---*/
+
+          found = false;
+          if (StartDonor[iVertex] < nGlobalVertex_Donor) {
+            donor_StartIndex = WalkToClosestDonor(Coord_i, StartDonor[iVertex], DonorPoint_Coord, Donor_LinkedNodes,
+                                                  Donor_StartLinkedNodes, Donor_nLinkedNodes, mindist, maxEdge);
+            found = ( (mindist <= maxEdge) && (mindist <= StartDist[iVertex] + 0.5*maxEdge) );
+          }
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
+          if (!found) {
+            if (DonorADT == NULL) {
+              Donor_Index.resize(nGlobalVertex_Donor);
+              for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++)
+                Donor_Index[donor_iPoint] = donor_iPoint;
+              DonorADT = new CADTPointsOnlyClass(nDim, nGlobalVertex_Donor, DonorPoint_Coord, Donor_Index.data(), false);
             }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
+            DonorADT->DetermineNearestNode(Coord_i, mindist, donor_StartIndex, rankDonor);
           }
+
+          StartDonor[iVertex] = donor_StartIndex;
+          StartDist[iVertex]  = mindist;
                 
           donor_iPoint = donor_StartIndex;
 
@@ -2165,6 +2282,8 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     }
 
 
+    if (DonorADT != NULL) delete DonorADT;
+
     delete [] TargetPoint_Coord;
     delete [] Target_GlobalPoint;
     delete [] Target_Proc;
@@ -2189,6 +2308,44 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
   if (storeProc  != NULL) delete [] storeProc;  
 }
 
+unsigned long CSlidingMesh::WalkToClosestDonor(su2double* Point, unsigned long startIndex, su2double* coord, unsigned long* map,
+                                               unsigned long* startLinkedNodes, unsigned long* nLinkedNodes,
+                                               su2double &mindist, su2double &maxEdge){
+
+  /*--- Starting from startIndex, move to the closest linked node as long as
+        this reduces the distance to the point ---*/
+
+  unsigned short nDim = donor_geometry->GetnDim();
+  unsigned long iPoint = startIndex, jPoint, nextPoint, iLinked;
+  su2double dist;
+
+  mindist = PointsDistance(Point, &coord[ iPoint * nDim ]);
+
+  for(;;){
+    nextPoint = iPoint;
+    for (iLinked = 0; iLinked < nLinkedNodes[iPoint]; iLinked++){
+      jPoint = map[ startLinkedNodes[iPoint] + iLinked ];
+      dist   = PointsDistance(Point, &coord[ jPoint * nDim ]);
+      if (dist < mindist){
+        mindist   = dist;
+        nextPoint = jPoint;
+      }
+    }
+    if (nextPoint == iPoint) break;
+    iPoint = nextPoint;
+  }
+
+  /*--- Size of the neighbourhood of the node that was found ---*/
+
+  maxEdge = 0.0;
+  for (iLinked = 0; iLinked < nLinkedNodes[iPoint]; iLinked++){
+    jPoint  = map[ startLinkedNodes[iPoint] + iLinked ];
+    maxEdge = max(maxEdge, PointsDistance(&coord[ iPoint * nDim ], &coord[ jPoint * nDim ]));
+  }
+
+  return iPoint;
+}
+
 int CSlidingMesh::Build_3D_surface_element(unsigned long *map, unsigned long *startIndex, unsigned long* nNeighbor, su2double *coord, unsigned long centralNode, su2double** element){
     
   /*--- Given a node "centralNode", this routines reconstruct the vertex centered surface element around the node and store it into "element" ---*/
@@ -587,7 +587,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
   return (unsigned long) i;
 }
 
-unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config, bool val_reuse_prec) {
   
   su2double SolverTol = config->GetLinear_Solver_Error(), Residual, Norm0;
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
@@ -622,22 +622,22 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
     
     switch (config->GetKind_Linear_Solver_Prec()) {
       case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(Jacobian, geometry, config);
         break;
       case ILU:
-        Jacobian.BuildILUPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildILUPreconditioner();
         precond = new CILUPreconditioner(Jacobian, geometry, config);
         break;
       case LU_SGS:
         precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
         break;
       case LINELET:
-        Jacobian.BuildJacobiPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildJacobiPreconditioner();
         precond = new CLineletPreconditioner(Jacobian, geometry, config);
         break;
       default:
-        Jacobian.BuildJacobiPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(Jacobian, geometry, config);
         break;
     }
@@ -682,13 +682,13 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         break;
       case SMOOTHER_JACOBI:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildJacobiPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildJacobiPreconditioner();
         IterLinSol = Jacobian.Jacobi_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
       case SMOOTHER_ILU:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildILUPreconditioner();
+        if (!val_reuse_prec) Jacobian.BuildILUPreconditioner();
         IterLinSol = Jacobian.ILU_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
@@ -73,6 +73,19 @@ void CWallModel1DEQ::Initialize(const unsigned short *intInfo,
   for(unsigned short i=0; i<numPoints; ++i) {
     y_cv[i] = y_cv[i]/y_max * h_wm;
   }
+
+  /* Allocate the work arrays of the batched version of the wall model.
+     The lane index runs fastest in these arrays. */
+  const unsigned short NL = N_LANES_WALL_MODEL;
+
+  TLanes.assign(nfa*NL, 0.0);
+  muFaLanes.assign(nfa*NL, 0.0);
+  tmpLanes.assign(nfa*NL, 0.0);
+  uLanes.assign(numPoints*NL, 0.0);
+  lowerLanes.assign((numPoints-1)*NL, 0.0);
+  upperLanes.assign((numPoints-1)*NL, 0.0);
+  diagonalLanes.assign(numPoints*NL, 0.0);
+  rhsLanes.assign(numPoints*NL, 0.0);
 }
 
 void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
@@ -308,6 +321,282 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
   }
 }
 
+void CWallModel1DEQ::WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                                const unsigned long  indFirstPoint,
+                                                const su2double      *tExchange,
+                                                const su2double      *velExchange,
+                                                const su2double      *muExchange,
+                                                const su2double      *pExchange,
+                                                const su2double      Wall_HeatFlux,
+                                                const bool           HeatFlux_Prescribed,
+                                                const su2double      TWall,
+                                                const bool           Temperature_Prescribed,
+                                                      su2double      *tauWall,
+                                                      su2double      *qWall,
+                                                      su2double      *ViscosityWall,
+                                                      su2double      *kOverCvWall) {
+
+  /* Set some constants, assuming air at standard conditions. These are
+     the same values as used in the point-wise version. */
+  const su2double C_1     = 1.716e-5;
+  const su2double S       = 110.4;
+  const su2double T_ref   = 273.15;
+  const su2double R       = 287.058;
+  const su2double kappa   = 0.41;
+  const su2double A       = 17;
+  const su2double gamma   = 1.4;
+  const su2double Pr_lam  = 0.7;
+  const su2double Pr_turb = 0.9;
+  const su2double c_p     = (gamma*R)/(gamma-1);
+  const su2double c_v     = R/(gamma-1);
+  const su2double tol     = 1e-3;
+
+  const unsigned short max_iter = 25;
+  const unsigned short nfa      = numPoints + 1;
+  const unsigned short NL       = N_LANES_WALL_MODEL;
+
+  /* Easier storage of the inverse of the distance between the wall and
+     the first control volume center. */
+  const su2double dyWallInv = 1.0/(y_cv[0]-y_fa[0]);
+
+  /*--- Set the references to the work arrays, which are allocated in Initialize.
+        They can be shared, because the boundary conditions of the DG solver,
+        which call the wall model, are carried out one at a time. ---*/
+  vector<su2double> &T     = TLanes,     &mu_fa = muFaLanes,  &tmp      = tmpLanes,      &u   = uLanes;
+  vector<su2double> &lower = lowerLanes, &upper = upperLanes, &diagonal = diagonalLanes, &rhs = rhsLanes;
+
+  su2double tExch[NL], velExch[NL], pExch[NL];
+  su2double tauW[NL], tauW_prev[NL], tauW_lam[NL];
+  su2double h_wall[NL], h_bc[NL], aux_rhs[NL];
+  bool      active[NL];
+
+  /*--- Loop over the batches of exchange points. ---*/
+  for(unsigned short iBeg=0; iBeg<nPoints; iBeg+=NL) {
+    const unsigned short nLanes = min(NL, (unsigned short) (nPoints-iBeg));
+
+    /* Copy the data of the exchange points into the lanes. Unused lanes
+       are padded with the data of the last point, such that all lanes
+       contain valid data. */
+    for(unsigned short k=0; k<NL; ++k) {
+      const unsigned short i = iBeg + min(k, (unsigned short) (nLanes-1));
+
+      tExch[k]   = tExchange[i];
+      velExch[k] = velExchange[i];
+      pExch[k]   = pExchange[i];
+
+      /* Initial guess of the wall shear stress. Take the value of the
+         previous evaluation, if available. */
+      const su2double tauGuess = tauWallPrevious.size() ? tauWallPrevious[indFirstPoint+i]
+                                                        : su2double(0.0);
+      tauW[k]     = (tauGuess > 0.0) ? tauGuess : su2double(0.5);
+      tauW_lam[k] = muExchange[i]*velExch[k]/h_wm;
+      h_wall[k]   = c_p*TWall;
+      h_bc[k]     = c_p*tExch[k];
+      active[k]   = k < nLanes;
+    }
+
+    for(unsigned short i=0; i<nfa; ++i)
+      for(unsigned short k=0; k<NL; ++k) T[i*NL+k] = tExch[k];
+
+    /*--- Iterative loop. Lanes that are converged keep on computing to
+          allow vectorization, but their results are not updated anymore. ---*/
+    for(unsigned short iter=0; iter<max_iter; ++iter) {
+
+      bool anyActive = false;
+      for(unsigned short k=0; k<NL; ++k) anyActive = anyActive || active[k];
+      if( !anyActive ) break;
+
+      for(unsigned short k=0; k<NL; ++k) tauW_prev[k] = tauW[k];
+
+      /* Total viscosity on the faces of the wall model grid. */
+      for(unsigned short i=0; i<nfa; ++i) {
+        for(unsigned short k=0; k<NL; ++k) {
+          const su2double Ti = T[i*NL+k];
+          mu_fa[i*NL+k] = C_1 * pow(Ti/T_ref, 1.5) * ((T_ref + S)/ (Ti + S));
+        }
+      }
+
+      for(unsigned short i=1; i<nfa; ++i) {
+        for(unsigned short k=0; k<NL; ++k) {
+          const su2double rho    = pExch[k] / (R*T[i*NL+k]);
+          const su2double nu     = mu_fa[i*NL+k] / rho;
+          const su2double utau   = sqrt(tauW[k] / rho);
+          const su2double y_plus = y_fa[i] * utau / nu;
+          const su2double D1     = 1.0 - exp((-y_plus)/A);
+          mu_fa[i*NL+k]         += rho * kappa * y_fa[i] * utau * D1*D1;
+        }
+      }
+
+      /* Momentum matrix. The solution vector is u at y_cv. */
+      lower.assign(lower.size(), 0.0);
+      upper.assign(upper.size(), 0.0);
+      diagonal.assign(diagonal.size(), 0.0);
+      rhs.assign(rhs.size(), 0.0);
+
+      for(unsigned short k=0; k<NL; ++k) {
+        diagonal[(numPoints-1)*NL+k] = 1.0;
+        rhs[(numPoints-1)*NL+k]      = velExch[k];
+      }
+
+      for(unsigned short i=1; i<(numPoints-1); ++i) {
+        const su2double dyUInv = 1.0/(y_cv[i+1] - y_cv[i]);
+        const su2double dyLInv = 1.0/(y_cv[i]   - y_cv[i-1]);
+        for(unsigned short k=0; k<NL; ++k) {
+          upper[i*NL+k]     = mu_fa[(i+1)*NL+k]*dyUInv;
+          lower[(i-1)*NL+k] = mu_fa[i*NL+k]*dyLInv;
+          diagonal[i*NL+k]  = -1.0*(upper[i*NL+k] + lower[(i-1)*NL+k]);
+        }
+      }
+
+      for(unsigned short k=0; k<NL; ++k) {
+        upper[k]    = mu_fa[NL+k]/(y_cv[1] - y_cv[0]);
+        diagonal[k] = -1.0*(upper[k] + mu_fa[k]*dyWallInv);
+      }
+
+      /* Solve the systems to get the velocity fields. */
+      SolveTridiagonalSystemsBatch(lower.data(), diagonal.data(), upper.data(), rhs.data());
+      u = rhs;
+
+      /* Update the total viscosity and the wall shear stress. */
+      for(unsigned short i=0; i<nfa; ++i) {
+        for(unsigned short k=0; k<NL; ++k) {
+          const su2double Ti     = T[i*NL+k];
+          const su2double mu_lam = C_1 * pow(Ti/T_ref, 1.5) * ((T_ref + S)/ (Ti + S));
+          mu_fa[i*NL+k] = mu_lam;
+          tmp[i*NL+k]   = mu_lam/Pr_lam;
+        }
+      }
+
+      for(unsigned short k=0; k<NL; ++k) tauW[k] = mu_fa[k]*u[k]*dyWallInv;
+
+      for(unsigned short i=1; i<nfa; ++i) {
+        for(unsigned short k=0; k<NL; ++k) {
+          const su2double rho    = pExch[k] / (R*T[i*NL+k]);
+          const su2double nu     = mu_fa[i*NL+k] / rho;
+          const su2double utau   = sqrt(tauW[k] / rho);
+          const su2double y_plus = y_fa[i] * utau / nu;
+          const su2double D1     = 1.0 - exp((-y_plus)/A);
+          const su2double mut    = rho * kappa * y_fa[i] * utau * D1*D1;
+          mu_fa[i*NL+k] += mut;
+          tmp[i*NL+k]    = c_p*(tmp[i*NL+k] + mut/Pr_turb);
+        }
+      }
+      for(unsigned short k=0; k<NL; ++k) tmp[k] *= c_p;
+
+      /* Energy matrix. The solution vector is the enthalpy at y_cv. */
+      lower.assign(lower.size(), 0.0);
+      upper.assign(upper.size(), 0.0);
+      diagonal.assign(diagonal.size(), 0.0);
+      rhs.assign(rhs.size(), 0.0);
+
+      for(unsigned short i=1; i<(numPoints-1); ++i) {
+        const su2double dyUInv = 1.0/(y_cv[i+1] - y_cv[i]);
+        const su2double dyLInv = 1.0/(y_cv[i]   - y_cv[i-1]);
+        for(unsigned short k=0; k<NL; ++k) {
+          upper[i*NL+k]     = tmp[(i+1)*NL+k]*dyUInv;
+          lower[(i-1)*NL+k] = tmp[i*NL+k]*dyLInv;
+          diagonal[i*NL+k]  = -1.0*(upper[i*NL+k] + lower[(i-1)*NL+k]);
+        }
+      }
+
+      for(unsigned short k=0; k<NL; ++k) {
+        diagonal[(numPoints-1)*NL+k] = 1.0;
+
+        upper[k]    = tmp[NL+k]/(y_cv[1] - y_cv[0]);
+        diagonal[k] = -1.0*(upper[k] + tmp[k]*dyWallInv);
+        aux_rhs[k]  = tmp[k]*dyWallInv;
+      }
+
+      /* Right hand side of the energy equation, which is the difference of
+         the fluxes (mu + mu_t) * u * du/dy. Zero flux at the wall. */
+      for(unsigned short k=0; k<NL; ++k) tmp[k] = 0.0;
+      for(unsigned short i=1; i<numPoints; ++i) {
+        const su2double dyInv = 1.0/(y_cv[i] - y_cv[i-1]);
+        for(unsigned short k=0; k<NL; ++k) {
+          const su2double ui = u[i*NL+k], uim1 = u[(i-1)*NL+k];
+          tmp[i*NL+k] = 0.5*mu_fa[i*NL+k]*(ui + uim1)*(ui - uim1)*dyInv;
+        }
+      }
+
+      for(unsigned short i=0; i<(numPoints-1); ++i)
+        for(unsigned short k=0; k<NL; ++k)
+          rhs[i*NL+k] = tmp[i*NL+k] - tmp[(i+1)*NL+k];
+
+      /* For a prescribed heat flux dT/dy = 0, hence Twall = T[1]. */
+      if( HeatFlux_Prescribed ) {
+        for(unsigned short k=0; k<NL; ++k) h_wall[k] = c_p*T[NL+k];
+      }
+
+      for(unsigned short k=0; k<NL; ++k) {
+        rhs[k]                 -= aux_rhs[k]*h_wall[k];
+        rhs[(numPoints-1)*NL+k] = h_bc[k];
+      }
+
+      /* Solve the systems to get the enthalpy fields and determine the
+         temperature on the faces. */
+      SolveTridiagonalSystemsBatch(lower.data(), diagonal.data(), upper.data(), rhs.data());
+
+      for(unsigned short k=0; k<NL; ++k) {
+        T[k]              = h_wall[k]/c_p;
+        T[numPoints*NL+k] = h_bc[k]/c_p;
+      }
+      for(unsigned short i=0; i<(numPoints-1); ++i)
+        for(unsigned short k=0; k<NL; ++k)
+          T[(i+1)*NL+k] = 0.5*(rhs[i*NL+k] + rhs[(i+1)*NL+k])/c_p;
+
+      /* Final update of the wall shear stress. Store the results of the lanes
+         that are still active and check for convergence. */
+      for(unsigned short k=0; k<NL; ++k) {
+        const su2double T0     = T[k];
+        const su2double mu_lam = C_1 * pow(T0/T_ref, 1.5) * ((T_ref + S)/ (T0 + S));
+        tauW[k] = mu_lam*u[k]*dyWallInv;
+
+        if( active[k] ) {
+          const unsigned short i = iBeg + k;
+          tauWall[i]       = tauW[k];
+          qWall[i]         = mu_lam * (c_p / Pr_lam) * -(T[NL+k] - T0) * dyWallInv;
+          ViscosityWall[i] = mu_lam;
+          kOverCvWall[i]   = c_p / c_v * (mu_lam/Pr_lam);
+
+          if(fabs((tauW[k] - tauW_prev[k])/tauW_lam[k]) < tol) active[k] = false;
+        }
+      }
+    }
+
+    /* Store the wall shear stresses as initial guess for the next evaluation. */
+    if( tauWallPrevious.size() ) {
+      for(unsigned short k=0; k<nLanes; ++k)
+        tauWallPrevious[indFirstPoint+iBeg+k] = tauWall[iBeg+k];
+    }
+  }
+}
+
+void CWallModel1DEQ::SolveTridiagonalSystemsBatch(const su2double *lower,
+                                                  su2double       *diagonal,
+                                                  const su2double *upper,
+                                                  su2double       *rhs) {
+
+  const unsigned short NL = N_LANES_WALL_MODEL;
+
+  /* Forward elimination. */
+  for(int i=1; i<numPoints; ++i) {
+    for(unsigned short k=0; k<NL; ++k) {
+      const su2double w = lower[(i-1)*NL+k]/diagonal[(i-1)*NL+k];
+      diagonal[i*NL+k] -= w*upper[(i-1)*NL+k];
+      rhs[i*NL+k]      -= w*rhs[(i-1)*NL+k];
+    }
+  }
+
+  /* Back substitution. */
+  for(unsigned short k=0; k<NL; ++k)
+    rhs[(numPoints-1)*NL+k] /= diagonal[(numPoints-1)*NL+k];
+
+  for(int i=numPoints-2; i>=0; --i) {
+    for(unsigned short k=0; k<NL; ++k)
+      rhs[i*NL+k] = (rhs[i*NL+k] - upper[i*NL+k]*rhs[(i+1)*NL+k])/diagonal[i*NL+k];
+  }
+}
+
 void CWallModelLogLaw::Initialize(const unsigned short *intInfo,
                                 const su2double      *doubleInfo){
   
@@ -338,7 +627,7 @@ void CWallModelLogLaw::Initialize(const unsigned short *intInfo,
     coorGridPoints[i] *= scaleFact;
 }
 
-void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double rhoExchange,
+void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 const su2double velExchange,
                                                 const su2double muExchange,
                                                 const su2double pExchange,
@@ -352,64 +641,135 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                                 su2double &kOverCvWall) {
   
 
-  // Note: I replaced pExchange by muExchange
-  su2double fval, fprime, newton_step, u_tau = 0.0;
-  su2double k = 0.38;
-  su2double C = 4.1;
-  su2double u_tau0 = 0.001;
-  su2double nuExchange = muExchange / rhoExchange;
-  
-  //su2double R = 287.058;
-  su2double gamma = 1.4;
-  su2double Pr_lam = 0.7;
-  //su2double Pr_turb = 0.9;
-  //su2double c_p = (gamma*R)/(gamma-1);
-  //su2double c_v = R/(gamma-1);
-  const su2double factHeatFlux_Lam  = HeatFlux_Prescribed ? su2double(0.0): gamma/Pr_lam;
-  unsigned short maxIter = 50, counter = -1;
-  
-  SU2_MPI::Error("Implementation not finished yet.\nPlease comment this line if you want to test", CURRENT_FUNCTION);
-  
-  for (unsigned short i=0; i < maxIter; i++){
-    counter += 1;
-    //y_plus = h_wm * u_tau0 / nuExchange;
-    //fval = (velExchange /u_tau0) - ((1.0/k) * log(y_plus) + C);
-    //fprime = -velExchange/pow(u_tau0,2) - 1.0/(k*u_tau0);
+  /* Constants of Reichardt's law of the wall. */
+  const su2double k      = 0.38;
+  const su2double C      = 4.1;
+  const su2double B      = C - log(k)/k;
+  const su2double gamma  = 1.4;
+  const su2double Pr_lam = 0.7;
+  const su2double R      = 287.058;
+  const su2double factHeatFlux_Lam = HeatFlux_Prescribed ? su2double(0.0): gamma/Pr_lam;
 
-    fval = velExchange/u_tau0 - (C - 1.0*log(k)/k)*(1.0 - exp(-0.0909090909090909*u_tau*h_wm/nuExchange) - 0.0909090909090909*u_tau0*h_wm*exp(-0.333333333333333*u_tau0*h_wm/nuExchange)/nuExchange) - 1.0*log(k*u_tau*h_wm/nuExchange + 1.0)/k;
-    
-    //-u_pw/u_tau**2 - (C - 1.0*log(k)/k)*(-0.0909090909090909*y*exp(-0.333333333333333*u_tau*y/nu)/nu + 0.0909090909090909*y*exp(-0.0909090909090909*u_tau*y/nu)/nu + 0.0303030303030303*u_tau*y**2*exp(-0.333333333333333*u_tau*y/nu)/nu**2) - 1.0*y/(nu*(k*u_tau*y/nu + 1.0))
-    
-    fprime = -velExchange/pow(u_tau0,2.0) - (C - 1.0*log(k)/k)*(-0.0909090909090909*h_wm*exp(-0.333333333333333*u_tau0*h_wm/nuExchange)/nuExchange + 0.0909090909090909*h_wm*exp(-0.0909090909090909*u_tau0*h_wm/nuExchange)/nuExchange + 0.0303030303030303*u_tau0*pow(h_wm,2.0)*exp(-0.333333333333333*u_tau0*h_wm/nuExchange)/pow(nuExchange, 2.0)) - 1.0*h_wm/(nuExchange*(k*u_tau0*h_wm/nuExchange + 1.0));
-    
-    newton_step = fval/fprime;
-    
-    u_tau = u_tau0 - newton_step;
-    
-    if (abs(u_tau - u_tau0) < 1e-6){
-      break;
-    }
-    if (counter == 49) {
-      cout << counter << " " <<  u_tau0 << " " << u_tau << endl;
-      cout << fprime << " " << fval << " " << newton_step << endl;
-      cout << rhoExchange << " " << velExchange << " " << muExchange << endl;
-    }
-    u_tau0 = u_tau;
+  /* The density at the exchange location, assuming air as in the
+     1D equilibrium wall model. */
+  const su2double rhoExchange = pExchange/(R*tExchange);
+  const su2double hOverNu     = h_wm*rhoExchange/muExchange;
+  const unsigned short maxIter = 50;
+
+  /* Newton iterations for the friction velocity. */
+  su2double u_tau = 0.001;
+  for(unsigned short iter=0; iter<maxIter; ++iter) {
+    const su2double yPlus = u_tau*hOverNu;
+    const su2double exp3  = exp(-yPlus/3.0);
+    const su2double exp11 = exp(-yPlus/11.0);
+
+    const su2double fval   = velExchange/u_tau - B*(1.0 - exp11 - yPlus*exp3/11.0)
+                           - log(k*yPlus + 1.0)/k;
+    const su2double fprime = -velExchange/(u_tau*u_tau)
+                           - B*hOverNu*(exp11/11.0 - exp3/11.0 + yPlus*exp3/33.0)
+                           - hOverNu/(k*yPlus + 1.0);
+
+    const su2double u_tauNew = u_tau - fval/fprime;
+    const bool      conv     = fabs(u_tauNew - u_tau) < 1e-6;
+    u_tau = u_tauNew;
+    if( conv ) break;
   }
-  //cout << counter << " " <<  u_tau0 << " " << u_tau << endl;
-  //cout << thickness * u_tau0 / nuExchange << " " << velExchange /u_tau << endl;
+
   tauWall = rhoExchange * pow(u_tau,2.0);
   qWall = 0.0;
   ViscosityWall = muExchange;
   kOverCvWall = ViscosityWall * factHeatFlux_Lam;
-  //kOverCvWall = c_p / c_v * (muExchange/Pr_lam);
-  
-  if(Temperature_Prescribed == true)
-  {
-    
-    
-  }
-  else if(HeatFlux_Prescribed == true){
+}
+
+void CWallModelLogLaw::WallShearStressAndHeatFlux(const unsigned short nPoints,
+                                                  const unsigned long  indFirstPoint,
+                                                  const su2double      *tExchange,
+                                                  const su2double      *velExchange,
+                                                  const su2double      *muExchange,
+                                                  const su2double      *pExchange,
+                                                  const su2double      Wall_HeatFlux,
+                                                  const bool           HeatFlux_Prescribed,
+                                                  const su2double      Wall_Temperature,
+                                                  const bool           Temperature_Prescribed,
+                                                        su2double      *tauWall,
+                                                        su2double      *qWall,
+                                                        su2double      *ViscosityWall,
+                                                        su2double      *kOverCvWall) {
+
+  /* Constants of the law of the wall, see the point-wise version. */
+  const su2double k      = 0.38;
+  const su2double C      = 4.1;
+  const su2double B      = C - log(k)/k;
+  const su2double gamma  = 1.4;
+  const su2double Pr_lam = 0.7;
+  const su2double R      = 287.058;
+  const su2double factHeatFlux_Lam = HeatFlux_Prescribed ? su2double(0.0): gamma/Pr_lam;
+
+  const unsigned short maxIter = 50;
+  const unsigned short NL      = N_LANES_WALL_MODEL;
+
+  su2double rhoExch[NL], velExch[NL], hOverNu[NL], u_tau[NL];
+  bool      active[NL];
+
+  /*--- Loop over the batches of exchange points. ---*/
+  for(unsigned short iBeg=0; iBeg<nPoints; iBeg+=NL) {
+    const unsigned short nLanes = min(NL, (unsigned short) (nPoints-iBeg));
+
+    /* Copy the data of the exchange points into the lanes and set the
+       initial guess of the friction velocity. The density follows from the
+       pressure and temperature, assuming air. Unused lanes are padded with
+       the data of the last point. */
+    for(unsigned short l=0; l<NL; ++l) {
+      const unsigned short i = iBeg + min(l, (unsigned short) (nLanes-1));
+
+      rhoExch[l] = pExchange[i]/(R*tExchange[i]);
+      velExch[l] = velExchange[i];
+      hOverNu[l] = h_wm*rhoExch[l]/muExchange[i];
+
+      const su2double tauGuess = tauWallPrevious.size() ? tauWallPrevious[indFirstPoint+i]
+                                                        : su2double(0.0);
+      u_tau[l]  = (tauGuess > 0.0) ? sqrt(tauGuess/rhoExch[l]) : su2double(0.001);
+      active[l] = l < nLanes;
+    }
+
+    /*--- Newton iterations for Reichardt's law of the wall. Lanes that are
+          converged are masked, i.e. their friction velocity is not updated. ---*/
+    for(unsigned short iter=0; iter<maxIter; ++iter) {
+
+      bool anyActive = false;
+      for(unsigned short l=0; l<NL; ++l) anyActive = anyActive || active[l];
+      if( !anyActive ) break;
+
+      for(unsigned short l=0; l<NL; ++l) {
+        const su2double yPlus = u_tau[l]*hOverNu[l];
+        const su2double exp3  = exp(-yPlus/3.0);
+        const su2double exp11 = exp(-yPlus/11.0);
+
+        const su2double fval   = velExch[l]/u_tau[l] - B*(1.0 - exp11 - yPlus*exp3/11.0)
+                               - log(k*yPlus + 1.0)/k;
+        const su2double fprime = -velExch[l]/(u_tau[l]*u_tau[l])
+                               - B*hOverNu[l]*(exp11/11.0 - exp3/11.0 + yPlus*exp3/33.0)
+                               - hOverNu[l]/(k*yPlus + 1.0);
+
+        const su2double u_tauNew = u_tau[l] - fval/fprime;
+        const bool      conv     = fabs(u_tauNew - u_tau[l]) < 1e-6;
+
+        if( active[l] ) {
+          u_tau[l]  = u_tauNew;
+          active[l] = !conv;
+        }
+      }
+    }
+
+    /* Store the results, also as initial guess for the next evaluation. */
+    for(unsigned short l=0; l<nLanes; ++l) {
+      const unsigned short i = iBeg + l;
+      tauWall[i]       = rhoExch[l]*u_tau[l]*u_tau[l];
+      qWall[i]         = 0.0;
+      ViscosityWall[i] = muExchange[i];
+      kOverCvWall[i]   = ViscosityWall[i]*factHeatFlux_Lam;
+
+      if( tauWallPrevious.size() ) tauWallPrevious[indFirstPoint+i] = tauWall[i];
+    }
   }
-  
 }
@@ -44,6 +44,7 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
 
 #define LEN_COMPONENTS 32
 
@@ -243,6 +244,26 @@ public:
 
 		virtual void SetTDState_rhoe (su2double rho, su2double e );
 
+		/*!
+		 * \brief Evaluate the thermodynamic state of a batch of points from density and internal energy.
+		 *        On exit the fluid model holds the state of the last point, as after point-wise calls.
+		 * \param[in] nPoints - Number of points of the batch.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] e - Static energy of the points.
+		 * \param[out] P - Pressure of the points.
+		 * \param[out] T - Temperature of the points.
+		 * \param[out] c2 - Speed of sound squared of the points.
+		 * \param[out] val_dPdrho_e - Derivative of pressure w.r.t. density at constant energy.
+		 * \param[out] val_dPde_rho - Derivative of pressure w.r.t. energy at constant density.
+		 * \param[out] val_dTdrho_e - Derivative of temperature w.r.t. density at constant energy.
+		 * \param[out] val_dTde_rho - Derivative of temperature w.r.t. energy at constant density.
+		 * \param[out] val_Cp - Specific heat at constant pressure of the points.
+		 */
+		virtual void SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                           su2double *P, su2double *T, su2double *c2,
+                                           su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                           su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp);
+
 		/*!
 		 * \brief virtual member that would be different for each gas model implemented
 		 * \param[in] InputSpec - Input pair for FLP calls ("PT").
@@ -317,6 +338,35 @@ public:
 
 		virtual void SetTDState_T(su2double val_Temperature);
 
+		/*!
+		 * \brief Evaluate the state of a batch of points from temperature (incompressible models).
+		 *        On exit the fluid model holds the state of the last point, as after point-wise calls.
+		 * \param[in] nPoints - Number of points of the batch.
+		 * \param[in] T - Temperature of the points.
+		 * \param[out] rho - Density of the points.
+		 * \param[out] val_Cp - Specific heat at constant pressure of the points.
+		 * \param[out] val_Cv - Specific heat at constant volume of the points.
+		 */
+		virtual void SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv);
+
+		/*!
+		 * \brief Evaluate viscosity, thermal conductivity and their derivatives for a batch of points.
+		 *        The eddy viscosity stored in the fluid model is used for all points.
+		 * \param[in] nPoints - Number of points of the batch.
+		 * \param[in] T - Temperature of the points.
+		 * \param[in] rho - Density of the points.
+		 * \param[in] cp - Specific heat at constant pressure of the points.
+		 * \param[out] mu - Laminar viscosity of the points.
+		 * \param[out] val_dmudrho_T - Derivative of the viscosity w.r.t. density.
+		 * \param[out] val_dmudT_rho - Derivative of the viscosity w.r.t. temperature.
+		 * \param[out] kt - Thermal conductivity of the points.
+		 * \param[out] val_dktdrho_T - Derivative of the conductivity w.r.t. density.
+		 * \param[out] val_dktdT_rho - Derivative of the conductivity w.r.t. temperature.
+		 */
+		void SetTransport_Batch(unsigned long nPoints, const su2double *T, const su2double *rho, const su2double *cp,
+		                        su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho,
+		                        su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho);
+
 		/*!
 		 * \brief Set fluid eddy viscosity provided by a turbulence model needed for computing effective thermal conductivity.
 		 */
@@ -370,6 +420,14 @@ public:
 
 		void SetTDState_rhoe (su2double rho, su2double e );
 
+		/*!
+		 * \brief Set the Dimensionless State of a batch of points using Density and Internal Energy.
+		 */
+		void SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                   su2double *P, su2double *T, su2double *c2,
+                                   su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                   su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp);
+
 		/*!
 		 * \brief Set the Dimensionless State using Pressure  and Temperature
 		 * \param[in] P - first thermodynamic variable.
@@ -466,6 +524,14 @@ public:
      */
     void SetTDState_rhoe (su2double rho, su2double e );
 
+    /*!
+     * \brief Set the Dimensionless State of a batch of points using Density and Internal Energy.
+     */
+    void SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                               su2double *P, su2double *T, su2double *c2,
+                               su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                               su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp);
+
     /*!
      * \brief Set the Dimensionless State using Pressure and Temperature
      * \param[in] P - first thermodynamic variable.
@@ -581,6 +647,14 @@ public:
      */
     void SetTDState_rhoe (su2double rho, su2double e );
 
+    /*!
+     * \brief Set the Dimensionless State of a batch of points using Density and Internal Energy.
+     */
+    void SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                               su2double *P, su2double *T, su2double *c2,
+                               su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                               su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp);
+
     /*!
      * \brief Set the Dimensionless State using Pressure and Temperature
      * \param[in] P - first thermodynamic variable.
@@ -638,6 +712,173 @@ public:
 
 };
 
+/*!
+ * \class CLookUpTable
+ * \brief Child class for defining a fluid model based on a tabulated thermodynamic state.
+ * The table stores pressure, temperature and entropy on a grid in density (logarithmic spacing)
+ * and internal energy (uniform spacing), such that the cell containing a (rho, e) pair is found
+ * directly. All properties and their derivatives are obtained from bicubic (Catmull-Rom)
+ * interpolation of these three fields. The other input pairs are inverted with Newton iterations
+ * on the interpolated state. If the table file does not exist, it is generated from
+ * the fluid model given by LUT_BASE_MODEL and written to the file.
+ */
+class CLookUpTable : public CFluidModel {
+
+protected:
+  unsigned long nDensity,          /*!< \brief Number of density nodes of the table. */
+  nEnergy;                         /*!< \brief Number of internal energy nodes of the table. */
+  su2double LogDensity_Min,        /*!< \brief Logarithm of the minimum density of the table. */
+  Delta_LogDensity,                /*!< \brief Spacing of the logarithm of the density. */
+  Energy_Min,                      /*!< \brief Minimum internal energy of the table. */
+  Delta_Energy,                    /*!< \brief Spacing of the internal energy. */
+  dsdrho_e,                        /*!< \brief Derivative of the entropy w.r.t. density at constant energy. */
+  dsde_rho;                        /*!< \brief Derivative of the entropy w.r.t. energy at constant density. */
+  vector<su2double> Table_Pressure,    /*!< \brief Tabulated pressure, stored as [iDensity*nEnergy+iEnergy]. */
+  Table_Temperature,                   /*!< \brief Tabulated temperature, stored as [iDensity*nEnergy+iEnergy]. */
+  Table_Entropy;                       /*!< \brief Tabulated entropy, stored as [iDensity*nEnergy+iEnergy]. */
+
+private:
+
+  /*!
+   * \brief Generate the table from the fluid model LUT_BASE_MODEL (dimensional values).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GenerateTable(CConfig *config);
+
+  /*!
+   * \brief Read the table from file (dimensional values). The header of the table is checked
+   *        against the configuration and an error is raised if they do not match.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>true</code> if the table could be read.
+   */
+  bool ReadTable(CConfig *config);
+
+  /*!
+   * \brief Write the table to file (dimensional values), together with the configuration
+   *        it has been generated with.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WriteTable(CConfig *config);
+
+  /*!
+   * \brief Get the name of a fluid model that can be used to generate the table.
+   * \param[in] val_kind - Kind of the fluid model.
+   * \return Name of the fluid model in the configuration file.
+   */
+  string GetBaseModelName(unsigned short val_kind);
+
+  /*!
+   * \brief Compare a parameter of the table header with the one of the configuration.
+   * \param[in] val_table - Value in the header of the table.
+   * \param[in] val_config - Value in the configuration.
+   * \return <code>true</code> if the values are equal up to the precision of the file.
+   */
+  bool EqualParameter(su2double val_table, su2double val_config);
+
+  /*!
+   * \brief Raise an error if a parameter of the table header does not match the configuration.
+   * \param[in] filename - Name of the table file.
+   * \param[in] val_name - Name of the parameter.
+   * \param[in] val_match - Whether or not the parameter matches.
+   */
+  void CheckTableParameter(string filename, string val_name, bool val_match);
+
+  /*!
+   * \brief Interpolate pressure, temperature and entropy and their derivatives
+   *        and set the complete thermodynamic state.
+   * \param[in] rho - Density.
+   * \param[in] e - Internal energy.
+   */
+  void Interpolate(su2double rho, su2double e);
+
+  /*!
+   * \brief Newton iteration on the interpolated state for a given input pair.
+   * \param[in] val_pair - Input pair (0: P-T, 1: h-s, 2: P-s).
+   * \param[in] val_1 - First thermodynamic variable.
+   * \param[in] val_2 - Second thermodynamic variable.
+   */
+  void Newton_2D(unsigned short val_pair, su2double val_1, su2double val_2);
+
+  /*!
+   * \brief Newton iteration on the internal energy for a given density.
+   * \param[in] rho - Density.
+   * \param[in] val_pressure - <code>true</code> to match val_value with the pressure, otherwise the temperature.
+   * \param[in] val_value - Value of the pressure or temperature.
+   */
+  void Newton_1D(su2double rho, bool val_pressure, su2double val_value);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] dimensional - Whether the dimensional or the non-dimensional table must be used.
+   */
+  CLookUpTable(CConfig *config, bool dimensional);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CLookUpTable(void);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s );
+
+  /*!
+   * \brief compute some derivatives of enthalpy and entropy needed for subsonic inflow BC
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho (su2double P, su2double rho );
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
@@ -670,6 +911,11 @@ public:
    */
   void SetTDState_T(su2double val_Temperature);
   
+  /*!
+   * \brief Set the Dimensionless State of a batch of points using Temperature.
+   */
+  void SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv);
+  
 };
 
 /*!
@@ -707,6 +953,11 @@ public:
   
   void SetTDState_T(su2double val_Temperature);
   
+  /*!
+   * \brief Set the Dimensionless State of a batch of points using Temperature.
+   */
+  void SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv);
+  
 };
 
 /*!
@@ -751,6 +1002,11 @@ public:
    */
   void SetTDState_T(su2double val_temperature);
   
+  /*!
+   * \brief Set the Dimensionless State of a batch of points using Temperature.
+   */
+  void SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv);
+  
 };
 
 #include "fluid_model.inl"
@@ -54,6 +54,54 @@
 
 using namespace std;
 
+/*!
+ * \class CFEABatch
+ * \brief Storage of a batch of structural elements of the same kind in structure-of-arrays layout.
+ * \details The last index of every array is the lane (element) of the batch, so that the loops
+ *          of the batched element kernels run over contiguous data of FEA_BATCH_SIZE elements.
+ *          Up to 8 nodes and 8 Gaussian points per element are supported.
+ * \ingroup FEM_Discr
+ * \version 6.2.0 "Falcon"
+ */
+class CFEABatch {
+public:
+
+  unsigned short nLanes;                          /*!< \brief Number of elements stored in the batch. */
+  unsigned short nNodes;                          /*!< \brief Number of nodes of the elements of the batch. */
+  unsigned short nGauss;                          /*!< \brief Number of Gaussian points of the elements of the batch. */
+
+  unsigned long iElem[FEA_BATCH_SIZE];            /*!< \brief Index of the element stored in each lane. */
+  su2double Penalty[FEA_BATCH_SIZE];              /*!< \brief Stiffness penalty of the element stored in each lane. */
+
+  su2double Weight[8];                            /*!< \brief Weight of the Gaussian points (common to the batch). */
+  su2double Jac_x[8][FEA_BATCH_SIZE];             /*!< \brief Jacobian of the Gaussian points in the current configuration. */
+  su2double GradNi_X[8][8][3][FEA_BATCH_SIZE];    /*!< \brief Gradients of the shape functions in the reference configuration. */
+  su2double GradNi_x[8][8][3][FEA_BATCH_SIZE];    /*!< \brief Gradients of the shape functions in the current configuration. */
+  su2double Coord[8][3][FEA_BATCH_SIZE];          /*!< \brief Current coordinates of the nodes. */
+
+  su2double E[FEA_BATCH_SIZE],                    /*!< \brief Young's modulus of each element. */
+  Nu[FEA_BATCH_SIZE],                             /*!< \brief Poisson's ratio of each element. */
+  Mu[FEA_BATCH_SIZE],                             /*!< \brief Lame's coefficient of each element. */
+  Lambda[FEA_BATCH_SIZE],                         /*!< \brief Lame's coefficient of each element. */
+  Kappa[FEA_BATCH_SIZE];                          /*!< \brief Compressibility constant of each element. */
+
+  su2double F[3][3][FEA_BATCH_SIZE];              /*!< \brief Deformation gradient at the current Gaussian point. */
+  su2double b[3][3][FEA_BATCH_SIZE];              /*!< \brief Left Cauchy-Green tensor at the current Gaussian point. */
+  su2double J_F[FEA_BATCH_SIZE];                  /*!< \brief Determinant of F at the current Gaussian point. */
+  su2double Stress[3][3][FEA_BATCH_SIZE];         /*!< \brief Cauchy stress tensor at the current Gaussian point. */
+  su2double D[6][6][FEA_BATCH_SIZE];              /*!< \brief Constitutive matrix at the current Gaussian point. */
+
+  su2double Kab[8][8][3][3][FEA_BATCH_SIZE];      /*!< \brief Constitutive term of the tangent matrix. */
+  su2double Ks_ab[8][8][FEA_BATCH_SIZE];          /*!< \brief Stress term of the tangent matrix. */
+  su2double Kt_a[8][3][FEA_BATCH_SIZE];           /*!< \brief Nodal stress term of the residual. */
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CFEABatch(void) : nLanes(0), nNodes(0), nGauss(0) { }
+
+};
+
 /*!
  * \class CNumerics
  * \brief Class for defining the numerical methods.
@@ -1306,6 +1354,28 @@ public:
    */
   virtual void Compute_Tangent_Matrix(CElement *element_container, CConfig *config);
 
+  /*!
+   * \brief A virtual member to store an element in a lane of a batch for the batched structural kernels.
+   * \param[in] element_container - Element structure for the particular element integrated.
+   * \param[in] batch - Batch of elements of the same kind.
+   * \param[in] iLane - Lane of the batch where the element is stored.
+   */
+  virtual void Set_Element_Batch(CElement *element_container, CFEABatch *batch, unsigned short iLane, CConfig *config);
+
+  /*!
+   * \brief A virtual member to compute the tangent matrix and the nodal stress term of a batch of elements.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   */
+  virtual void Compute_Tangent_Matrix_Batch(CElement *element_container, CFEABatch *batch, CConfig *config);
+
+  /*!
+   * \brief A virtual member to compute the nodal stress term of a batch of elements.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   */
+  virtual void Compute_NodalStress_Term_Batch(CElement *element_container, CFEABatch *batch, CConfig *config);
+
   /*!
    * \brief A virtual member to compute the pressure term in incompressible or nearly-incompressible structural problems
    * \param[in] element_container - Definition of the particular element integrated.
@@ -4291,6 +4361,47 @@ public:
 
   virtual void Compute_Stress_Tensor(CElement *element_container, CConfig *config);
 
+  /*!
+   * \brief Store an element in a lane of a batch (material properties, gradients and current coordinates).
+   * \param[in] element_container - Element structure for the particular element integrated.
+   * \param[in] batch - Batch of elements of the same kind.
+   * \param[in] iLane - Lane of the batch where the element is stored.
+   */
+  void Set_Element_Batch(CElement *element_container, CFEABatch *batch, unsigned short iLane, CConfig *config);
+
+  /*!
+   * \brief Compute the tangent matrix and the nodal stress term of all the elements of a batch.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   */
+  void Compute_Tangent_Matrix_Batch(CElement *element_container, CFEABatch *batch, CConfig *config);
+
+  /*!
+   * \brief Compute the nodal stress term of all the elements of a batch.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   */
+  void Compute_NodalStress_Term_Batch(CElement *element_container, CFEABatch *batch, CConfig *config);
+
+  /*!
+   * \brief Compute the stress tensor (and the constitutive matrix) at the current Gaussian point of all the elements of a batch.
+   * \details The default evaluates the material model lane by lane, models with a closed form overload it with a batched version.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   * \param[in] val_tangent - Compute also the constitutive matrix.
+   */
+  virtual void Compute_Stress_Tensor_Batch(CElement *element_container, CFEABatch *batch, bool val_tangent, CConfig *config);
+
+protected:
+
+  /*!
+   * \brief Element kernel of the batched evaluation, with the dimension and number of nodes fixed at compile time.
+   * \param[in] element_container - Element structure of the kind of the elements of the batch.
+   * \param[in] batch - Batch of elements of the same kind.
+   * \param[in] val_tangent - Compute also the tangent matrix (only the nodal stress term otherwise).
+   */
+  template<unsigned short nDim_, unsigned short nNode_>
+  void Compute_Batch_Kernel(CElement *element_container, CFEABatch *batch, bool val_tangent, CConfig *config);
 
 };
 
@@ -4325,6 +4436,8 @@ public:
 
   void Compute_Stress_Tensor(CElement *element_container, CConfig *config);
 
+  void Compute_Stress_Tensor_Batch(CElement *element_container, CFEABatch *batch, bool val_tangent, CConfig *config);
+
 };
 
 /*!
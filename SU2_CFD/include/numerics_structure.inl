@@ -65,6 +65,12 @@ inline void CFEAElasticity::Compute_MeanDilatation_Term(CElement *element_contai
 
 inline void CNumerics::Compute_NodalStress_Term(CElement *element_container, CConfig *config) { }
 
+inline void CNumerics::Set_Element_Batch(CElement *element_container, CFEABatch *batch, unsigned short iLane, CConfig *config) { }
+
+inline void CNumerics::Compute_Tangent_Matrix_Batch(CElement *element_container, CFEABatch *batch, CConfig *config) { }
+
+inline void CNumerics::Compute_NodalStress_Term_Batch(CElement *element_container, CFEABatch *batch, CConfig *config) { }
+
 inline void CFEAElasticity::Compute_NodalStress_Term(CElement *element_container, CConfig *config) { }
 
 inline void CNumerics::Compute_Averaged_NodalStress(CElement *element_container, CConfig *config) { }
@@ -503,6 +503,16 @@ public:
    */
   void WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst);
 
+  /*!
+   * \brief Write a DG-FEM restart file (binary) in parallel, which stores the solution per element in partition order.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Flow solution.
+   * \param[in] val_iZone - iZone index.
+   * \param[in] val_iInst - iInst index.
+   */
+  void WriteRestart_Parallel_Binary_DG(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst);
+
   /*!
    * \brief Write the x, y, & z coordinates to a CGNS output file.
    * \param[in] config - Definition of the particular problem.
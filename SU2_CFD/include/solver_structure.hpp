@@ -42,6 +42,11 @@
 
 #include "../../Common/include/mpi_structure.hpp"
 
+#ifdef HAVE_OMP
+#include <omp.h>
+#include <deque>
+#endif
+
 #include <cmath>
 #include <string>
 #include <fstream>
@@ -11766,6 +11771,18 @@ private:
   su2double RelaxCoeff;             /*!< \brief Relaxation coefficient . */
   su2double FSI_Residual;           /*!< \brief FSI residual. */
 
+  bool stiffness_cache;             /*!< \brief Element stiffness of linear problems is stored and reused. */
+  bool stiffness_stored;            /*!< \brief The element stiffness blocks have already been stored. */
+  bool stiffness_assembled;         /*!< \brief The Jacobian was assembled from the stored element stiffness. */
+  bool stiffness_changed;           /*!< \brief The assembled stiffness differs from the one used to build the preconditioner. */
+  bool prec_built;                  /*!< \brief A preconditioner of the assembled stiffness is stored in the Jacobian. */
+  vector<su2double> Elem_Stiffness;             /*!< \brief Upper triangular blocks (jNode >= iNode) of the element stiffness. */
+  vector<unsigned long> Elem_Stiffness_Offset;  /*!< \brief Position of the first block of each element in Elem_Stiffness. */
+  vector<unsigned short> Elem_Stiffness_nNodes; /*!< \brief Number of nodes of each element with stored stiffness. */
+  vector<su2double> Elem_Penalty;               /*!< \brief Stiffness penalty applied to each element in the last assembly. */
+
+  CFEABatch *Elem_Batch;            /*!< \brief Batch of elements for the batched nonlinear element kernels (NULL if not used). */
+
 public:
   
   CSysVector TimeRes_Aux;      /*!< \brief Auxiliary vector for adding mass and damping contributions to the residual. */
@@ -11889,6 +11906,33 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config);
+
+  /*!
+   * \brief Assemble the stiffness matrix and the stress residual of a linear problem from the stored element stiffness.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Compute_StiffMatrix_Cached(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Compute the stiffness matrix and/or the nodal stress residual of a nonlinear problem, evaluating
+   *        consecutive elements of the same kind and material in batches.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] val_tangent - Compute the stiffness matrix as well as the nodal stress residual.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Compute_NodalStressRes_Batch(CGeometry *geometry, CNumerics **numerics, bool val_tangent, CConfig *config);
+
+  /*!
+   * \brief Evaluate the elements stored in the batch and add their contributions to the system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Numerics of the material of the elements in the batch.
+   * \param[in] element - Element structure of the kind of the elements in the batch.
+   * \param[in] val_tangent - Compute the stiffness matrix as well as the nodal stress residual.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Assemble_Element_Batch(CGeometry *geometry, CNumerics *numerics, CElement *element, bool val_tangent, CConfig *config);
   
   /*!
    * \brief Compute the stiffness matrix of the problem and the nodal stress terms at the same time (more efficient if full Newton Raphson).
@@ -12669,6 +12713,22 @@ private:
   
   su2double *Solution_Geometry; /*!< \brief Auxiliary vector for the geometry solution (dimension nDim instead of nVar). */
   
+  bool Jacobian_Prec;           /*!< \brief Precondition the fixed-point update with the transposed primal Jacobian. */
+  CMatrixVectorProduct *Prec_MatVec; /*!< \brief Product with the transposed primal Jacobian, built in the first preconditioned update. */
+  CPreconditioner *Prec_Precond;     /*!< \brief Transposed preconditioner of the primal Jacobian. */
+  CSysSolve *Prec_Solver;            /*!< \brief Linear solver of the preconditioned update. */
+  
+  /*!
+   * \brief Correct the fixed-point update of the adjoint solution with the transposed Jacobian of
+   *        the primal implicit scheme. The primal iteration U = U - omega*P^-1 R(U), with P = dR/dU + V/dt,
+   *        leads to the adjoint iteration matrix A ~ (1-omega) I + omega (V/dt) P^-T, hence the update
+   *        is corrected with a truncated Neumann series of (I - A)^-1. P and its transposed preconditioner
+   *        are the ones assembled while recording, and are reused in all adjoint iterations.
+   * \param[in] geometry - The geometrical definition of the problem.
+   * \param[in] config - The particular config.
+   */
+  void Precondition_AdjointUpdate(CGeometry *geometry, CConfig *config);
+  
 public:
   
   /*!
@@ -12698,6 +12758,13 @@ public:
    */
   ~CDiscAdjSolver(void);
   
+  /*!
+   * \brief Impose the send-receive boundary condition on the adjoint solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_MPI_Solution(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Performs the preprocessing of the adjoint AD-based solver.
    *        Registers all necessary variables on the tape. Called while tape is active.
@@ -13292,6 +13359,10 @@ protected:
 
   CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
 
+  unsigned short nThreadsTaskList;         /*!< \brief Number of threads used to process the list of tasks. */
+  vector<CFluidModel *> FluidModelThreads; /*!< \brief Fluid model for every thread, because the fluid model stores
+                                                       the thermodynamic state. The first entry is FluidModel. */
+
   su2double
   Mach_Inf,	       /*!< \brief Mach number at infinity. */
   Density_Inf,	       /*!< \brief Density at infinity. */
@@ -13424,6 +13495,9 @@ protected:
 
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
 
+  unsigned short nElemSimulPredictorADER; /*!< \brief Maximum number of elements that are treated simultaneously
+                                                      in the ADER predictor step. */
+
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
 
@@ -13434,6 +13508,10 @@ protected:
   vector<su2double> VecSolDOFsPredictorADER; /*!< \brief Vector, which stores the ADER predictor solution in the owned
                                                          DOFs. These are both space and time DOFs. */
 
+  vector<su2double> VecDeltaTimePredictorADER; /*!< \brief Vector, which stores the time steps of the owned volume elements
+                                                           for which the ADER predictor solution was computed. A
+                                                           zero value indicates that no predictor is available. */
+
   vector<vector<su2double> > VecWorkSolDOFs; /*!< \brief Working double vector to store the conserved variables for
                                                          the DOFs for the different time levels. */
 
@@ -13463,6 +13541,9 @@ protected:
   vector<unsigned long> startLocResInternalFacesWithHaloElem; /*!< \brief The starting location in the residual of the
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
+  vector<unsigned long> startLocResInternalFaces; /*!< \brief The starting location in the residual of the faces for
+                                                              every internal matching face. Needed to split the
+                                                              surface residual tasks in chunks. */
 
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
@@ -13483,6 +13564,47 @@ protected:
                                                                   the color does not contribute to the Jacobian
                                                                   of the DOF. */
 
+  vector<unsigned long> nNonZeroEntriesJacobian;  /*!< \brief Number of nonzero blocks of the Jacobian for the locally
+                                                               owned DOFs in cumulative storage format. */
+  vector<unsigned long> colLocalEntriesJacobian;  /*!< \brief Local column index of the nonzero blocks of the Jacobian.
+                                                               Indices beyond nDOFsLocOwned refer to ghost DOFs. */
+  vector<unsigned long> diagEntriesJacobian;      /*!< \brief Index of the diagonal block of the Jacobian for
+                                                               every locally owned DOF. */
+  vector<passivedouble> JacobianDG;               /*!< \brief The Jacobian of the spatial residual in block compressed
+                                                               row storage. Every block is stored in row major order. */
+
+  unsigned long nGhostDOFsImplicit;               /*!< \brief Number of DOFs owned by other ranks, which are needed
+                                                               in the Jacobian vector product. */
+  vector<int> ranksRecvImplicit;                  /*!< \brief Ranks from which ghost DOFs are received. */
+  vector<unsigned long> startGhostDOFsRecvImplicit; /*!< \brief Starting position of the ghost DOFs for every rank
+                                                                 in ranksRecvImplicit, cumulative storage format. */
+  vector<int> ranksSendImplicit;                  /*!< \brief Ranks to which owned DOFs are sent. */
+  vector<vector<unsigned long> > DOFsSendImplicit; /*!< \brief Local owned DOFs to be sent for every rank
+                                                                in ranksSendImplicit. */
+  vector<vector<su2double> > sendBufImplicit;     /*!< \brief Send buffers for the Jacobian vector products. */
+  vector<su2double> VecWorkImplicit;              /*!< \brief Work vector for the Jacobian vector products, which
+                                                               stores the owned and ghost DOFs. */
+
+  vector<su2double> VecSolDOFsTimeNm1;      /*!< \brief Solution of the owned DOFs at time level n-1 for BDF2. */
+  vector<su2double> VecTimeCoefImplicit;    /*!< \brief Coefficient of the time derivative term on the diagonal
+                                                         of the implicit system for every owned element. */
+  vector<su2double> PrecondImplicit;        /*!< \brief Storage of the preconditioner of the implicit system, either
+                                                         the inverted element blocks or the block ILU(0) factors. */
+  vector<su2double> invDiagBlocksILU;       /*!< \brief The inverse of the diagonal blocks of the block ILU(0) factors. */
+  vector<unsigned long> offsetPrecondElem;  /*!< \brief Offset of the inverted element blocks in PrecondImplicit. */
+  bool precondImplicitUpToDate;             /*!< \brief Whether or not the preconditioner corresponds to JacobianDG. */
+
+  unsigned long  nIterJacobianImplicit;     /*!< \brief Counter of Newton iterations, used for the Jacobian update frequency. */
+  unsigned short nTimeLevelsStoredImplicit; /*!< \brief Number of previous time levels available for the BDF scheme. */
+  su2double deltaTimeNImplicit;             /*!< \brief Physical time step of the current time level. */
+  su2double deltaTimeNm1Implicit;           /*!< \brief Physical time step of the previous time level. */
+
+  bool measureWorkDG;                   /*!< \brief Whether or not the work of the elements is currently measured. */
+  unsigned long nTaskListCallsMeasured; /*!< \brief Number of executions of the task list during the measurement. */
+  vector<vector<passivedouble> > measuredWorkElem; /*!< \brief Measured wall clock time of the owned elements
+                                                                for every thread of the task list. */
+  bool repartitionRequestedDG;          /*!< \brief Whether or not the grid must be repartitioned with the measured work. */
+
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
 private:
@@ -13505,6 +13627,8 @@ private:
                                                                 in the communication pattern for all time levels. */
   vector<vector<vector<su2double> > > commSendBuf;  /*!< \brief Send buffers used to send the solution data
                                                                 in the communication pattern for all time levels. */
+
+  vector<SU2_MPI::Request> commRequestsImplicit;   /*!< \brief Communication requests of the Jacobian vector products. */
 #endif
 
   vector<vector<unsigned long> > elementsRecvSelfComm;  /*!< \brief Double vector, which contains the halo elements
@@ -13572,6 +13696,43 @@ public:
    */
   unsigned long GetnDOFsGlobal(void);
 
+  /*!
+   * \brief Function to make available whether or not the grid must be repartitioned
+            with the work of the elements measured by this solver.
+   * \return True if the measurement is finished and a repartitioning is requested.
+   */
+  bool GetRepartitionRequested_DG(void);
+
+  /*!
+   * \brief Function, which copies the global ID, the number of DOFs, the solution
+            and the history of the time integration scheme of the owned elements into
+            buffers, such that they can be migrated to a new partitioning of the grid.
+            The history consists of the predictor of the previous time step for a warm
+            start of ADER and the solution at the beginning of the time step for BDF2.
+   * \param[in]  config   - Definition of the particular problem.
+   * \param[out] elemData - Global ID and number of DOFs of the owned elements.
+   * \param[out] solData  - Solution and history of the owned elements.
+   * \param[out] timeData - Number of stored time levels and time steps of BDF2.
+   */
+  void GetSolutionElements_DG(CConfig               *config,
+                              vector<unsigned long> &elemData,
+                              vector<passivedouble> &solData,
+                              vector<passivedouble> &timeData);
+
+  /*!
+   * \brief Function, which sets the solution and the history of the time integration
+            scheme of the owned elements from the buffers created by GetSolutionElements_DG
+            on the previous partitioning of the grid. The buffers are released on return.
+   * \param[in]     config   - Definition of the particular problem.
+   * \param[in,out] elemData - Global ID and number of DOFs of the elements in the buffer.
+   * \param[in,out] solData  - Solution and history of the elements in the buffer.
+   * \param[in,out] timeData - Number of stored time levels and time steps of BDF2.
+   */
+  void SetSolutionElements_DG(CConfig               *config,
+                              vector<unsigned long> &elemData,
+                              vector<passivedouble> &solData,
+                              vector<passivedouble> &timeData);
+
   /*!
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
@@ -13653,6 +13814,8 @@ public:
 
   /*!
    * \brief Set the new solution to the current solution for classical RK.
+            For the implicit scheme this is the solution at the start of the
+            time step, while the previous one is kept for BDF2.
    * \param[in] geometry - Geometrical definition of the problem.
    */
   void Set_NewSolution(CGeometry *geometry);
@@ -13739,6 +13902,20 @@ public:
                              const unsigned long elemEnd,
                              su2double           *workArray);
 
+  /*!
+   * \brief Function, which initializes the predictor solution of an element by
+            extrapolating the predictor solution of the previous time step in time.
+            The extrapolated polynomial is shifted, such that its value at the
+            beginning of the time step equals the current solution.
+   * \param[in]  config  - Definition of the particular problem.
+   * \param[in]  elem    - Index of the owned element for which the predictor must be initialized.
+   * \param[out] solPred - Initial predictor solution of the space and time DOFs of the element.
+   * \return Whether or not the extrapolated solution has a positive density and total energy.
+   */
+  bool ADER_DG_WarmStartPredictor(CConfig             *config,
+                                  const unsigned long elem,
+                                  su2double           *solPred);
+
   /*!
    * \brief Function, which interpolates the predictor solution of ADER-DG
             to the time value that corresponds to iTime.
@@ -14131,6 +14308,35 @@ public:
   void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short iRKStep);
 
+  /*!
+   * \brief Update the solution with one Newton iteration of the implicit scheme,
+            i.e. backward Euler for steady problems and BDF1/BDF2 for time
+            accurate problems. The linear system is solved with a Krylov method.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config);
+
+  /*!
+   * \brief Function, which computes the product of the matrix of the implicit
+            system, i.e. the Jacobian plus the time derivative term, and a vector.
+   * \param[in]  u - Vector to be multiplied by the matrix.
+   * \param[out] v - Result of the matrix vector product.
+   */
+  void JacobianVectorProduct_DG(const CSysVector &u,
+                                CSysVector       &v);
+
+  /*!
+   * \brief Function, which applies the preconditioner of the implicit system.
+   * \param[in]  config - Definition of the particular problem.
+   * \param[in]  u      - Vector to be preconditioned.
+   * \param[out] v      - Result of the preconditioning.
+   */
+  void Preconditioner_DG(CConfig          *config,
+                         const CSysVector &u,
+                         CSysVector       &v);
+
   /*!
    * \brief Update the solution for the ADER-DG scheme for the given range
             of elements.
@@ -14466,6 +14672,131 @@ public:
 
 protected:
 
+  /*!
+   * \brief Function, which returns the fluid model of the calling thread.
+   * \return Pointer to the fluid model that may be used by the calling thread.
+   */
+  CFluidModel *GetThreadFluidModel(void);
+
+  /*!
+   * \brief Function, which determines the range of elements or faces of a task,
+            if the task can be split into chunks that are carried out independently.
+   * \param[in]  task     - Task for which the range must be determined.
+   * \param[out] rangeBeg - Start of the range of elements or faces.
+   * \param[out] rangeEnd - End of the range of elements or faces.
+   * \return Whether or not the task can be split into chunks.
+   */
+  bool RangeTask_DG(const CTaskDefinition &task,
+                    unsigned long         &rangeBeg,
+                    unsigned long         &rangeEnd);
+
+  /*!
+   * \brief Function, which carries out (a chunk of) a task of the task list.
+   * \param[in] config              - Definition of the particular problem.
+   * \param[in] numerics            - Description of the numerical method.
+   * \param[in] task                - Task to be carried out.
+   * \param[in] rangeBeg            - Start of the range of elements or faces, if relevant.
+   * \param[in] rangeEnd            - End of the range of elements or faces, if relevant.
+   * \param[in] commMustBeCompleted - Whether or not a communication must be completed.
+   * \param[in] workArray           - Work array.
+   * \return Whether or not the task has been carried out. Only the completion of
+              the communication may fail.
+   */
+  bool CarryOutTask_DG(CConfig               *config,
+                       CNumerics             **numerics,
+                       const CTaskDefinition &task,
+                       const unsigned long   rangeBeg,
+                       const unsigned long   rangeEnd,
+                       const bool            commMustBeCompleted,
+                       su2double             *workArray);
+
+  /*!
+   * \brief Function, which attributes the measured wall clock time of (a chunk of)
+            a task to the owned elements involved. The boundary conditions are
+            measured per marker in Boundary_Conditions.
+   * \param[in] task     - Task that has been carried out.
+   * \param[in] rangeBeg - Start of the range of elements or faces, if relevant.
+   * \param[in] rangeEnd - End of the range of elements or faces, if relevant.
+   * \param[in] timeTask - Wall clock time spent in the task.
+   */
+  void AccumulateMeasuredWork_DG(const CTaskDefinition &task,
+                                 const unsigned long   rangeBeg,
+                                 const unsigned long   rangeEnd,
+                                 const passivedouble   timeTask);
+
+  /*!
+   * \brief Function, which distributes the measured wall clock time over a
+            range of owned elements, proportional to their number of DOFs.
+   * \param[in] elemBeg  - Start of the range of owned elements.
+   * \param[in] elemEnd  - End of the range of owned elements.
+   * \param[in] timeElem - Wall clock time to be distributed.
+   */
+  void DistributeMeasuredWorkElem_DG(const unsigned long elemBeg,
+                                     const unsigned long elemEnd,
+                                     const passivedouble timeElem);
+
+  /*!
+   * \brief Function, which updates the counter of the measured executions of the
+            task list and writes the measured work when the measurement is finished.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateMeasuredWork_DG(CConfig *config);
+
+  /*!
+   * \brief Function, which determines the measured work per update of an element
+            for every element type and time level, gathers this information on the
+            master rank and writes it to the file of the work weights. These weights
+            can be used in the partitioning of a subsequent computation.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WriteMeasuredWork_DG(CConfig *config);
+
+  /*!
+   * \brief Function, which reads a restart file that stores the solution per element
+            in partition order. If the partitioning is the same as the one used for
+            writing, every rank reads its chunk contiguously. Otherwise the chunks are
+            read by a subset of the ranks and the elements are sent to their owners,
+            which are found via a directory of the linearly distributed element IDs.
+   * \param[in] config       - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_Binary_DG(CConfig *config, string val_filename);
+
+  /*!
+   * \brief Function, which sends the data of the given elements to the ranks that
+            own these elements and stores the received data. The owners are found via
+            a directory, in which the global element IDs are distributed linearly over
+            the ranks.
+   * \param[in]     nElemGlobal  - Global number of elements.
+   * \param[in]     nDataPerDOF  - Number of data items per DOF of an element.
+   * \param[in]     nDataPerElem - Number of additional data items per element.
+   * \param[in,out] elemData     - Global ID and number of DOFs of the elements to be sent.
+                                   The buffer is released on return.
+   * \param[in,out] solData      - Data of these elements, stored contiguously per element.
+                                   The buffer is released on return.
+   * \param[out]    dataOwned    - Received data of the owned elements in element order.
+   * \return The number of owned elements for which the data has been received.
+   */
+  unsigned long RedistributeSolutionElements_DG(const unsigned long   nElemGlobal,
+                                                const unsigned short  nDataPerDOF,
+                                                const unsigned short  nDataPerElem,
+                                                vector<unsigned long> &elemData,
+                                                vector<passivedouble> &solData,
+                                                vector<passivedouble> &dataOwned);
+
+#ifdef HAVE_OMP
+  /*!
+   * \brief Function, which processes the list of tasks with multiple threads. Tasks
+            are started as soon as their dependencies are completed and large element
+            and face ranges are split in chunks, which are distributed over per thread
+            queues with work stealing. The communication is carried out by the master thread.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] numerics - Description of the numerical method.
+   */
+  void ProcessTaskListThreads_DG(CConfig   *config,
+                                 CNumerics **numerics);
+#endif
+
   /*!
    * \brief Routine that initiates the non-blocking communication between ranks
             for the givem time level.
@@ -14665,23 +14996,24 @@ private:
 
   /*!
    * \brief Virtual function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using an
+            predictor step for the given volume elements and solution using an
             aliased discretization in 2D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   virtual void ADER_DG_AliasedPredictorResidual_2D(CConfig              *config,
-                                                   CVolumeElementFEM    *elem,
+                                                   CVolumeElementFEM   **elemEntity,
                                                    const su2double      *sol,
                                                    const unsigned short nSimul,
                                                    const unsigned short NPad,
@@ -14690,23 +15022,24 @@ private:
 
   /*!
    * \brief Virtual function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using an
+            predictor step for the given volume elements and solution using an
             aliased discretization in 3D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   virtual void ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
-                                                   CVolumeElementFEM    *elem,
+                                                   CVolumeElementFEM   **elemEntity,
                                                    const su2double      *sol,
                                                    const unsigned short nSimul,
                                                    const unsigned short NPad,
@@ -14715,23 +15048,24 @@ private:
 
   /*!
    * \brief Virtual function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using a
+            predictor step for the given volume elements and solution using a
             non-aliased discretization in 2D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   virtual void ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
-                                                      CVolumeElementFEM    *elem,
+                                                      CVolumeElementFEM   **elemEntity,
                                                       const su2double      *sol,
                                                       const unsigned short nSimul,
                                                       const unsigned short NPad,
@@ -14740,23 +15074,24 @@ private:
 
 /*!
    * \brief Virtual function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using a
+            predictor step for the given volume elements and solution using a
             non-aliased discretization in 3D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   virtual void ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
-                                                      CVolumeElementFEM    *elem,
+                                                      CVolumeElementFEM   **elemEntity,
                                                       const su2double      *sol,
                                                       const unsigned short nSimul,
                                                       const unsigned short NPad,
@@ -14781,6 +15116,26 @@ private:
   void MetaDataJacobianComputation(const CMeshFEM    *FEMGeometry,
                                    const vector<int> &colorLocalDOFs);
 
+  /*!
+   * \brief Function, which determines the meta data needed for the implicit
+            time integration, i.e. the storage of the Jacobian and the
+            communication pattern of the Jacobian vector products.
+   */
+  void MetaDataImplicitTimeIntegration(void);
+
+  /*!
+   * \brief Function, which builds the preconditioner of the implicit system.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildPreconditionerImplicit(CConfig *config);
+
+  /*!
+   * \brief Function, which computes the global residual norms from the local
+            contributions and checks for divergence.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidualNorms(CConfig *config);
+
   /*!
    * \brief Function, which sets up the list of tasks to be carried out in the
             computationally expensive part of the solver.
@@ -14907,6 +15262,70 @@ protected:
   }
 };
 
+/*!
+ * \class CFEM_DG_JacobianVectorProduct
+ * \brief Specialization of the matrix-vector product for the implicit DG solver.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ */
+class CFEM_DG_JacobianVectorProduct : public CMatrixVectorProduct {
+private:
+  CFEM_DG_EulerSolver *solver; /*!< \brief Pointer to the DG solver, which stores the Jacobian. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] solver_ref - Pointer to the DG solver.
+   */
+  CFEM_DG_JacobianVectorProduct(CFEM_DG_EulerSolver *solver_ref);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CFEM_DG_JacobianVectorProduct(void) {}
+
+  /*!
+   * \brief Operator, which defines the product of the implicit DG matrix and a CSysVector.
+   * \param[in]  u - CSysVector that is being multiplied by the matrix.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CFEM_DG_ImplicitPreconditioner
+ * \brief Specialization of the preconditioner for the implicit DG solver.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ */
+class CFEM_DG_ImplicitPreconditioner : public CPreconditioner {
+private:
+  CFEM_DG_EulerSolver *solver; /*!< \brief Pointer to the DG solver, which stores the preconditioner. */
+  CConfig *config;             /*!< \brief Definition of the particular problem. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] solver_ref - Pointer to the DG solver.
+   * \param[in] config_ref - Definition of the particular problem.
+   */
+  CFEM_DG_ImplicitPreconditioner(CFEM_DG_EulerSolver *solver_ref, CConfig *config_ref);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CFEM_DG_ImplicitPreconditioner(void) {}
+
+  /*!
+   * \brief Operator, which applies the preconditioner of the implicit DG system.
+   * \param[in]  u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CFEM_DG_NSSolver
  * \brief Main class for defining the Navier-Stokes Discontinuous Galerkin finite element flow solver.
@@ -15347,23 +15766,24 @@ private:
 
   /*!
    * \brief Function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using an
+            predictor step for the given volume elements and solution using an
             aliased discretization in 2D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   void ADER_DG_AliasedPredictorResidual_2D(CConfig              *config,
-                                           CVolumeElementFEM    *elem,
+                                           CVolumeElementFEM   **elemEntity,
                                            const su2double      *sol,
                                            const unsigned short nSimul,
                                            const unsigned short NPad,
@@ -15372,23 +15792,24 @@ private:
 
 /*!
    * \brief Function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using an
+            predictor step for the given volume elements and solution using an
             aliased discretization in 3D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   void ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
-                                           CVolumeElementFEM    *elem,
+                                           CVolumeElementFEM   **elemEntity,
                                            const su2double      *sol,
                                            const unsigned short nSimul,
                                            const unsigned short NPad,
@@ -15396,23 +15817,24 @@ private:
                                            su2double            *work);
   /*!
    * \brief Function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using a
+            predictor step for the given volume elements and solution using a
             non-aliased discretization in 2D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   void ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
-                                              CVolumeElementFEM    *elem,
+                                              CVolumeElementFEM   **elemEntity,
                                               const su2double      *sol,
                                               const unsigned short nSimul,
                                               const unsigned short NPad,
@@ -15421,23 +15843,24 @@ private:
 
   /*!
    * \brief Function, which computes the spatial residual of the ADER-DG
-            predictor step for the given volume element and solution using a
+            predictor step for the given volume elements and solution using a
             non-aliased discretization in 3D.
-   * \param[in]  config  - Definition of the particular problem.
-   * \param[in]  elem    - Volume element for which the spatial residual of the
-                           predictor step must be computed.
-   * \param[in]  sol     - Solution for which the residual must be computed.
-   * \param[in]  nSimul  - Number of entities (typically time integration points)
-                           that are treated simultaneously.
-   * \param[in]  NPad    - Padded N value in the matrix multiplications to
-                           obtain better performance. The solution sol is stored
-                           with this padded value to avoid a memcpy.
-   * \param[out] res     - Residual of the spatial DOFs to be computed by this
-                           function.
-   * \param[out] work    - Work array.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  elemEntity - Volume elements of the entities for which the spatial
+                              residual of the predictor step must be computed.
+                              These elements must have the same standard element.
+   * \param[in]  sol        - Solution for which the residual must be computed.
+   * \param[in]  nSimul     - Number of entities (combinations of an element and a
+                              time integration point) that are treated simultaneously.
+   * \param[in]  NPad       - Padded N value in the matrix multiplications to
+                              obtain better performance. The solution sol is stored
+                              with this padded value to avoid a memcpy.
+   * \param[out] res        - Residual of the spatial DOFs to be computed by this
+                              function.
+   * \param[out] work       - Work array.
    */
   void ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
-                                              CVolumeElementFEM    *elem,
+                                              CVolumeElementFEM   **elemEntity,
                                               const su2double      *sol,
                                               const unsigned short nSimul,
                                               const unsigned short NPad,
@@ -1763,10 +1763,19 @@ inline void CNSSolver::SetConjugateHeatVariable(unsigned short val_marker, unsig
 
 inline CFluidModel* CFEM_DG_EulerSolver::GetFluidModel(void) { return FluidModel;}
 
+inline CFluidModel* CFEM_DG_EulerSolver::GetThreadFluidModel(void) {
+#ifdef HAVE_OMP
+  if(nThreadsTaskList > 1) return FluidModelThreads[omp_get_thread_num()];
+#endif
+  return FluidModel;
+}
+
 inline su2double* CFEM_DG_EulerSolver::GetVecSolDOFs(void) {return VecSolDOFs.data();}
 
 inline unsigned long CFEM_DG_EulerSolver::GetnDOFsGlobal(void) {return nDOFsGlobal;}
 
+inline bool CFEM_DG_EulerSolver::GetRepartitionRequested_DG(void) {return repartitionRequestedDG;}
+
 inline su2double CFEM_DG_EulerSolver::GetDensity_Inf(void) { return Density_Inf; }
 
 inline su2double CFEM_DG_EulerSolver::GetModVelocity_Inf(void) {
@@ -1902,6 +1911,16 @@ inline void CFEM_DG_EulerSolver::BC_Isothermal_Wall(CConfig                  *co
                                                     unsigned short           val_marker,
                                                     su2double                *workArray) {}
 
+inline CFEM_DG_JacobianVectorProduct::CFEM_DG_JacobianVectorProduct(CFEM_DG_EulerSolver *solver_ref) {
+  solver = solver_ref;
+}
+
+inline CFEM_DG_ImplicitPreconditioner::CFEM_DG_ImplicitPreconditioner(CFEM_DG_EulerSolver *solver_ref,
+                                                                      CConfig             *config_ref) {
+  solver = solver_ref;
+  config = config_ref;
+}
+
 inline su2double CFEM_DG_NSSolver::GetViscosity_Inf(void) { return Viscosity_Inf; }
 
 inline su2double CFEM_DG_NSSolver::GetTke_Inf(void) { return Tke_Inf; }
@@ -132,4 +132,29 @@ private:
   void Copy(const CTaskDefinition &other);
 };
 
+/*!
+ * \class CTaskChunk
+ * \brief Class for defining a part of a task, which is carried out by one thread
+          when the list of tasks is processed by multiple threads.
+ * \version 6.2.0 "Falcon"
+ */
+class CTaskChunk {
+
+public:
+
+  unsigned long indTask;  /*!< \brief Index of the task in the list of tasks. */
+  unsigned long rangeBeg; /*!< \brief Start of the range of elements or faces of this chunk. */
+  unsigned long rangeEnd; /*!< \brief End of the range of elements or faces of this chunk. */
+
+  /*!
+   * \brief Constructor of the class, which initializes the member variables.
+   * \param[in] val_indTask  - Index of the task in the list of tasks.
+   * \param[in] val_rangeBeg - Start of the range of this chunk.
+   * \param[in] val_rangeEnd - End of the range of this chunk.
+   */
+  CTaskChunk(unsigned long val_indTask  = 0,
+             unsigned long val_rangeBeg = 0,
+             unsigned long val_rangeEnd = 0);
+};
+
 #include "task_definition.inl"
@@ -89,3 +89,11 @@ inline void CTaskDefinition::Copy(const CTaskDefinition &other) {
   for(int i=0; i<5; ++i)
     indMustBeCompleted[i] = other.indMustBeCompleted[i];
 }
+
+inline CTaskChunk::CTaskChunk(unsigned long val_indTask,
+                              unsigned long val_rangeBeg,
+                              unsigned long val_rangeEnd) {
+  indTask  = val_indTask;
+  rangeBeg = val_rangeBeg;
+  rangeEnd = val_rangeEnd;
+}
@@ -105,6 +105,18 @@ public:
      */
     virtual   void SetDerViscosity(su2double T, su2double rho);
 
+    /*!
+     * \brief Set the viscosity and its derivatives for a batch of points.
+     * \param[in] nPoints - Number of points of the batch.
+     * \param[in] T - Temperature of the points.
+     * \param[in] rho - Density of the points.
+     * \param[out] mu - Viscosity of the points.
+     * \param[out] val_dmudrho_T - Derivative of the viscosity w.r.t. density.
+     * \param[out] val_dmudT_rho - Derivative of the viscosity w.r.t. temperature.
+     */
+    virtual void SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                            su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho);
+
 };
 
 /*!
@@ -133,6 +145,11 @@ public:
    */
   virtual ~CConstantViscosity(void);
   
+  /*!
+   * \brief Set the (constant) viscosity of a batch of points.
+   */
+  void SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                          su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho);
   
 };
 
@@ -176,6 +193,12 @@ public:
    */
   void SetDerViscosity(su2double T, su2double rho);
   
+  /*!
+   * \brief Set the viscosity and its derivatives for a batch of points.
+   */
+  void SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                          su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho);
+  
 };
 
 /*!
@@ -261,6 +284,25 @@ public:
      */
     virtual void SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp);
 
+    /*!
+     * \brief Set the thermal conductivity and its derivatives for a batch of points.
+     * \param[in] nPoints - Number of points of the batch.
+     * \param[in] T - Temperature of the points.
+     * \param[in] rho - Density of the points.
+     * \param[in] mu_lam - Laminar viscosity of the points.
+     * \param[in] mu_turb - Eddy viscosity, the same for all points.
+     * \param[in] cp - Specific heat at constant pressure of the points.
+     * \param[in] dmudrho_T - Derivative of the viscosity w.r.t. density.
+     * \param[in] dmudT_rho - Derivative of the viscosity w.r.t. temperature.
+     * \param[out] kt - Thermal conductivity of the points.
+     * \param[out] val_dktdrho_T - Derivative of the conductivity w.r.t. density.
+     * \param[out] val_dktdT_rho - Derivative of the conductivity w.r.t. temperature.
+     */
+    virtual void SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                               const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                               const su2double *dmudrho_T, const su2double *dmudT_rho,
+                               su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho);
+
 };
 
 /*!
@@ -288,6 +330,14 @@ public:
      */
     virtual ~CConstantConductivity(void);
 
+    /*!
+     * \brief Set the (constant) thermal conductivity of a batch of points.
+     */
+    void SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                               const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                               const su2double *dmudrho_T, const su2double *dmudT_rho,
+                               su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho);
+
 };
 
 /*!
@@ -365,6 +415,14 @@ public:
      */
     void SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp);
 
+    /*!
+     * \brief Set the thermal conductivity and its derivatives for a batch of points.
+     */
+    void SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                               const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                               const su2double *dmudrho_T, const su2double *dmudT_rho,
+                               su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho);
+
 };
 
 /*!
@@ -1116,6 +1116,28 @@ public:
    */
   virtual void SetSecondaryVar(CFluidModel *FluidModel);
   
+  /*!
+   * \brief A virtual member.
+   */
+  virtual bool SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2, su2double val_temperature);
+  
+  /*!
+   * \brief A virtual member.
+   */
+  virtual bool SetPrimVar_TDState(su2double eddy_visc, su2double val_pressure, su2double val_soundspeed2, su2double val_temperature,
+                                  su2double val_laminar_viscosity, su2double val_thermal_conductivity, su2double val_cp);
+  
+  /*!
+   * \brief A virtual member.
+   */
+  virtual bool SetPrimVar_TDState_Inc(su2double val_density, su2double val_cp, su2double val_cv);
+  
+  /*!
+   * \brief A virtual member.
+   */
+  virtual void SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                                       su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho);
+  
   /*!
    * \brief A virtual member.
    */
@@ -3331,6 +3353,22 @@ public:
    */
   void SetSecondaryVar(CFluidModel *FluidModel);
   
+  /*!
+   * \brief Set the primitive variables from a thermodynamic state evaluated beforehand (batched evaluation).
+   *        The velocity must be up to date. Nothing is reverted if the state is non-physical.
+   * \param[in] val_pressure - Pressure.
+   * \param[in] val_soundspeed2 - Speed of sound squared.
+   * \param[in] val_temperature - Temperature.
+   * \return <code>FALSE</code> if the state is non-physical, <code>TRUE</code> otherwise.
+   */
+  bool SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2, su2double val_temperature);
+  
+  /*!
+   * \brief Set the secondary variables from derivatives evaluated beforehand (batched evaluation).
+   */
+  void SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                               su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho);
+  
   /*!
    * \brief Get the primitive variables.
    * \param[in] val_var - Index of the variable.
@@ -3762,6 +3800,16 @@ public:
    */
   bool SetPrimVar(CFluidModel *FluidModel);
 
+  /*!
+   * \brief Set the primitive variables from a density and specific heats evaluated beforehand (batched evaluation).
+   *        Nothing is reverted if the state is non-physical.
+   * \param[in] val_density - Density at the temperature of the solution.
+   * \param[in] val_cp - Specific heat at constant pressure.
+   * \param[in] val_cv - Specific heat at constant volume.
+   * \return <code>FALSE</code> if the state is non-physical, <code>TRUE</code> otherwise.
+   */
+  bool SetPrimVar_TDState_Inc(su2double val_density, su2double val_cp, su2double val_cv);
+
   /*!
    * \brief Set the specific heat Cp.
    */
@@ -3964,6 +4012,28 @@ public:
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
   void SetSecondaryVar(CFluidModel *FluidModel);
+  
+  /*!
+   * \brief Set the primitive variables from a thermodynamic and transport state evaluated beforehand (batched evaluation).
+   *        The velocity must be up to date. Nothing is reverted if the state is non-physical.
+   * \param[in] eddy_visc - Eddy viscosity.
+   * \param[in] val_pressure - Pressure.
+   * \param[in] val_soundspeed2 - Speed of sound squared.
+   * \param[in] val_temperature - Temperature.
+   * \param[in] val_laminar_viscosity - Laminar viscosity.
+   * \param[in] val_thermal_conductivity - Thermal conductivity.
+   * \param[in] val_cp - Specific heat at constant pressure.
+   * \return <code>FALSE</code> if the state is non-physical, <code>TRUE</code> otherwise.
+   */
+  bool SetPrimVar_TDState(su2double eddy_visc, su2double val_pressure, su2double val_soundspeed2, su2double val_temperature,
+                          su2double val_laminar_viscosity, su2double val_thermal_conductivity, su2double val_cp);
+  using CEulerVariable::SetPrimVar_TDState;
+  
+  /*!
+   * \brief Set the secondary variables from derivatives evaluated beforehand (batched evaluation).
+   */
+  void SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                               su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho);
 
   /*! 
    * \brief Set the value of the wall shear stress computed by a wall function.
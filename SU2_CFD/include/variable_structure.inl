@@ -329,6 +329,16 @@ inline bool CVariable::SetPrimVar(CFluidModel *FluidModel) { return true; }
 
 inline void CVariable::SetSecondaryVar(CFluidModel *FluidModel) { }
 
+inline bool CVariable::SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2, su2double val_temperature) { return true; }
+
+inline bool CVariable::SetPrimVar_TDState(su2double eddy_visc, su2double val_pressure, su2double val_soundspeed2, su2double val_temperature,
+                                          su2double val_laminar_viscosity, su2double val_thermal_conductivity, su2double val_cp) { return true; }
+
+inline bool CVariable::SetPrimVar_TDState_Inc(su2double val_density, su2double val_cp, su2double val_cv) { return true; }
+
+inline void CVariable::SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                                               su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho) { }
+
 inline bool CVariable::SetPrimVar(su2double eddy_visc, su2double turb_ke, CConfig *config) { return true; }
 
 inline bool CVariable::SetPrimVar(su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) { return true; }
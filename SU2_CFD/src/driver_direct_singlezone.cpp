@@ -102,6 +102,10 @@ void CSinglezoneDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    /*--- Repartition the DG grid with the measured work, if requested. ---*/
+
+    if (fem_solver) Repartition_DGFEM();
+
     TimeIter++;
 
   }
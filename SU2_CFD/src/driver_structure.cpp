@@ -1150,6 +1150,9 @@ void CDriver::Geometrical_Preprocessing_DGFEM() {
       if (rank == MASTER_NODE) cout << "Preprocessing for the wall functions. " << endl;
       DGMesh->WallFunctionPreprocessing(config_container[iZone]);
 
+      /*--- Reduce the memory of the metric terms of the volume elements, if desired. ---*/
+      DGMesh->CompressMetricTermsVolumeElements(config_container[iZone]);
+
       /*--- Store the global to local mapping. ---*/
       if (rank == MASTER_NODE) cout << "Storing a mapping from global to local DOF index." << endl;
       geometry_container[iZone][iInst][MESH_0]->SetGlobal_to_Local_Point();
@@ -1165,6 +1168,126 @@ void CDriver::Geometrical_Preprocessing_DGFEM() {
   }
 }
 
+void CDriver::Repartition_DGFEM() {
+
+  /*--- Check whether one of the DG solvers requests a repartitioning. The
+        measurement of the work ends in the same time step on all ranks. ---*/
+
+  bool repartition = false;
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      CFEM_DG_EulerSolver *DGSolver = dynamic_cast<CFEM_DG_EulerSolver *>(solver_container[iZone][iInst][MESH_0][FLOW_SOL]);
+      if (DGSolver && DGSolver->GetRepartitionRequested_DG()) repartition = true;
+    }
+  }
+
+  if (!repartition) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"---------------------- Repartitioning of the DG grid --------------------" << endl;
+
+  /*--- Store the solution and the history of the time integration scheme of
+        the owned elements together with their global element IDs and release
+        the solvers and the partitioned grids. ---*/
+
+  vector<vector<vector<unsigned long> > > elemData(nZone);
+  vector<vector<vector<passivedouble> > > solData(nZone), timeData(nZone);
+  vector<vector<bool> > NSSolver(nZone);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    elemData[iZone].resize(nInst[iZone]);
+    solData[iZone].resize(nInst[iZone]);
+    timeData[iZone].resize(nInst[iZone]);
+    NSSolver[iZone].resize(nInst[iZone]);
+
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      CFEM_DG_EulerSolver *DGSolver = dynamic_cast<CFEM_DG_EulerSolver *>(solver_container[iZone][iInst][MESH_0][FLOW_SOL]);
+
+      DGSolver->GetSolutionElements_DG(config_container[iZone], elemData[iZone][iInst],
+                                       solData[iZone][iInst], timeData[iZone][iInst]);
+      NSSolver[iZone][iInst] = (dynamic_cast<CFEM_DG_NSSolver *>(DGSolver) != NULL);
+
+      delete solver_container[iZone][iInst][MESH_0][FLOW_SOL];
+      solver_container[iZone][iInst][MESH_0][FLOW_SOL] = NULL;
+
+      delete geometry_container[iZone][iInst][MESH_0];
+      geometry_container[iZone][iInst][MESH_0] = NULL;
+    }
+  }
+
+  /*--- Make sure that the file with the measured work weights, which is
+        written by the master rank, is complete before it is read. ---*/
+
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  /*--- Partition the grid again with ParMETIS, now with the measured work
+        weights, and divide the grid between the ranks. This is the same
+        sequence as in Input_Preprocessing. The work is not measured again. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    config_container[iZone]->SetUse_Measured_Work_DG(true);
+    config_container[iZone]->SetnIterMeasureWorkDG(0);
+
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+
+      config_container[iZone]->SetiInst(iInst);
+
+      CSolver *solver_aux = new CFEM_DG_EulerSolver(config_container[iZone], nDim, MESH_0);
+      CGeometry *geometry_aux = new CPhysicalGeometry(config_container[iZone], iZone, nZone);
+
+      geometry_aux->SetColorFEMGrid_Parallel(config_container[iZone]);
+
+      geometry_container[iZone][iInst][MESH_0] = new CMeshFEM_DG(geometry_aux, config_container[iZone]);
+
+      delete geometry_aux;
+      delete solver_aux;
+
+      geometry_container[iZone][iInst][MESH_0]->SetSendReceive(config_container[iZone]);
+      geometry_container[iZone][iInst][MESH_0]->SetBoundaries(config_container[iZone]);
+    }
+  }
+
+  /*--- Redo the geometrical preprocessing of the DG grid, which recomputes the
+        metric terms of the elements on their new owners. ---*/
+
+  Geometrical_Preprocessing_DGFEM();
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+
+      /*--- Wall distances and the positive surface area, as in the constructor. ---*/
+
+      if ((config_container[iZone]->GetKind_Solver() == FEM_RANS) ||
+          (config_container[iZone]->GetKind_Solver() == FEM_LES) ) {
+
+        if (rank == MASTER_NODE)
+          cout << "Computing wall distances." << endl;
+
+        geometry_container[iZone][iInst][MESH_0]->ComputeWall_Distance(config_container[iZone]);
+      }
+
+      geometry_container[iZone][iInst][MESH_0]->SetPositive_ZArea(config_container[iZone]);
+
+      /*--- Create the DG solver for the new partitioning and migrate the
+            solution and the history of the elements to their new owners. ---*/
+
+      if (rank == MASTER_NODE) cout << "Migrating the solution to the new partitioning." << endl;
+
+      CFEM_DG_EulerSolver *DGSolver;
+      if ( NSSolver[iZone][iInst] )
+        DGSolver = new CFEM_DG_NSSolver(geometry_container[iZone][iInst][MESH_0], config_container[iZone], MESH_0);
+      else
+        DGSolver = new CFEM_DG_EulerSolver(geometry_container[iZone][iInst][MESH_0], config_container[iZone], MESH_0);
+
+      DGSolver->SetSolutionElements_DG(config_container[iZone], elemData[iZone][iInst],
+                                       solData[iZone][iInst], timeData[iZone][iInst]);
+      solver_container[iZone][iInst][MESH_0][FLOW_SOL] = DGSolver;
+    }
+  }
+}
+
 void CDriver::Solver_Preprocessing(CSolver ****solver_container, CGeometry ***geometry,
                                    CConfig *config, unsigned short val_iInst) {
   
@@ -3820,6 +3943,10 @@ void CDriver::StartSolver(){
 
     if (StopCalc) break;
 
+    /*--- Repartition the DG grid with the measured work, if requested. ---*/
+
+    if (fem_solver) Repartition_DGFEM();
+
     ExtIter++;
 
   }
@@ -116,3 +116,48 @@ void CFluidModel::SetThermalConductivityModel (CConfig *config) {
   
 }
 
+
+void CFluidModel::SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                        su2double *P, su2double *T, su2double *c2,
+                                        su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                        su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp) {
+
+  /*--- Generic fallback, point by point through the scalar interface. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    SetTDState_rhoe(rho[iPoint], e[iPoint]);
+    P[iPoint]            = Pressure;
+    T[iPoint]            = Temperature;
+    c2[iPoint]           = SoundSpeed2;
+    val_dPdrho_e[iPoint] = dPdrho_e;
+    val_dPde_rho[iPoint] = dPde_rho;
+    val_dTdrho_e[iPoint] = dTdrho_e;
+    val_dTde_rho[iPoint] = dTde_rho;
+    val_Cp[iPoint]       = Cp;
+  }
+
+}
+
+void CFluidModel::SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv) {
+
+  /*--- Generic fallback, point by point through the scalar interface. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    SetTDState_T(T[iPoint]);
+    rho[iPoint]    = Density;
+    val_Cp[iPoint] = Cp;
+    val_Cv[iPoint] = Cv;
+  }
+
+}
+
+void CFluidModel::SetTransport_Batch(unsigned long nPoints, const su2double *T, const su2double *rho, const su2double *cp,
+                                     su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho,
+                                     su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho) {
+
+  LaminarViscosity->SetViscosity_Batch(nPoints, T, rho, mu, val_dmudrho_T, val_dmudT_rho);
+
+  ThermalConductivity->SetConductivity_Batch(nPoints, T, rho, mu, Mu_Turb, cp, val_dmudrho_T, val_dmudT_rho,
+                                             kt, val_dktdrho_T, val_dktdT_rho);
+
+}
@@ -64,6 +64,18 @@ void CConstantDensity::SetTDState_T (su2double val_Temperature) {
   
 }
 
+void CConstantDensity::SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    rho[iPoint]    = Density;
+    val_Cp[iPoint] = Cp;
+    val_Cv[iPoint] = Cv;
+  }
+
+  if (nPoints > 0) Temperature = T[nPoints-1];
+
+}
+
 CIncIdealGas::CIncIdealGas() : CFluidModel() {
   Pressure        = 0.0;
   Gamma           = 0.0;
@@ -99,6 +111,20 @@ void CIncIdealGas::SetTDState_T(su2double val_temperature) {
 
 }
 
+void CIncIdealGas::SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    rho[iPoint]    = Pressure/(T[iPoint]*Gas_Constant);
+    val_Cp[iPoint] = Cp;
+    val_Cv[iPoint] = Cv;
+  }
+
+  /*--- Leave the model in the state of the last point. ---*/
+
+  if (nPoints > 0) SetTDState_T(T[nPoints-1]);
+
+}
+
 CIncIdealGasPolynomial::CIncIdealGasPolynomial() : CFluidModel() {
   Gas_Constant     = 0.0;
   Pressure         = 0.0;
@@ -162,3 +188,30 @@ void CIncIdealGasPolynomial::SetTDState_T(su2double val_temperature) {
   Cv = Cp/Gamma;
   
 }
+
+void CIncIdealGasPolynomial::SetTDState_T_Batch(unsigned long nPoints, const su2double *T, su2double *rho, su2double *val_Cp, su2double *val_Cv) {
+
+  unsigned long iPoint;
+  unsigned short iVar;
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++)
+    rho[iPoint] = Pressure/(T[iPoint]*Gas_Constant);
+
+  /*--- Evaluate Cp from the coefficients, one coefficient at a time
+        over the whole batch so that the inner loop vectorizes. ---*/
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++)
+    val_Cp[iPoint] = b[0];
+
+  for (iVar = 1; iVar < nPolyCoeffs; iVar++)
+    for (iPoint = 0; iPoint < nPoints; iPoint++)
+      val_Cp[iPoint] += b[iVar]*pow(T[iPoint],iVar);
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++)
+    val_Cv[iPoint] = val_Cp[iPoint]/Gamma;
+
+  /*--- Leave the model in the state of the last point. ---*/
+
+  if (nPoints > 0) SetTDState_T(T[nPoints-1]);
+
+}
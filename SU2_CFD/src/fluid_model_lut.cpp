@@ -0,0 +1,576 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the tabulated (look-up table) fluid model.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./../include/fluid_model.hpp"
+
+CLookUpTable::CLookUpTable(CConfig *config, bool dimensional) : CFluidModel() {
+
+  int rank = SU2_MPI::GetRank();
+  int Read_Success, Read_Success_All;
+
+  su2double Density_Ref = 1.0, Energy_Ref = 1.0, Pressure_Ref = 1.0,
+  Temperature_Ref = 1.0, Entropy_Ref = 1.0;
+  unsigned long iPoint;
+
+  nDensity = 0;
+  nEnergy  = 0;
+  dsdrho_e = 0.0;
+  dsde_rho = 0.0;
+
+  /*--- Read the table. If it is not available on all ranks, it is generated
+        from the base fluid model and written by the master node. ---*/
+
+  Read_Success = ReadTable(config);
+  Read_Success_All = Read_Success;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Read_Success, &Read_Success_All, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+  if (!Read_Success_All) {
+    GenerateTable(config);
+    if (rank == MASTER_NODE) {
+      cout << "Generated thermodynamic look-up table (" << nDensity << " x " << nEnergy << ") in " << config->GetLUT_Filename() << "." << endl;
+      WriteTable(config);
+    }
+#ifdef HAVE_MPI
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+#endif
+  }
+
+  /*--- The table is stored in dimensional (SI) values, scale it if needed. ---*/
+
+  if (!dimensional) {
+    Density_Ref     = config->GetDensity_Ref();
+    Pressure_Ref    = config->GetPressure_Ref();
+    Temperature_Ref = config->GetTemperature_Ref();
+    Energy_Ref      = Pressure_Ref/Density_Ref;
+    Entropy_Ref     = Energy_Ref/Temperature_Ref;
+
+    LogDensity_Min -= log(Density_Ref);
+    Energy_Min     /= Energy_Ref;
+    Delta_Energy   /= Energy_Ref;
+
+    for (iPoint = 0; iPoint < nDensity*nEnergy; iPoint++) {
+      Table_Pressure[iPoint]    /= Pressure_Ref;
+      Table_Temperature[iPoint] /= Temperature_Ref;
+      Table_Entropy[iPoint]     /= Entropy_Ref;
+    }
+  }
+
+}
+
+CLookUpTable::~CLookUpTable(void) { }
+
+void CLookUpTable::GenerateTable(CConfig *config) {
+
+  CFluidModel *BaseModel = NULL;
+  unsigned long iDensity, iEnergy;
+  unsigned short iLimit;
+  su2double rho, e, Energy_Max;
+
+  switch (config->GetKind_LUT_BaseModel()) {
+
+    case IDEAL_GAS:
+      BaseModel = new CIdealGas(config->GetGamma(), config->GetGas_Constant());
+      break;
+
+    case VW_GAS:
+      BaseModel = new CVanDerWaalsGas(config->GetGamma(), config->GetGas_Constant(),
+                                      config->GetPressure_Critical(), config->GetTemperature_Critical());
+      break;
+
+    case PR_GAS:
+      BaseModel = new CPengRobinson(config->GetGamma(), config->GetGas_Constant(), config->GetPressure_Critical(),
+                                    config->GetTemperature_Critical(), config->GetAcentric_Factor());
+      break;
+
+    default:
+      SU2_MPI::Error("Fluid model not available to generate the look-up table.", CURRENT_FUNCTION);
+      break;
+  }
+
+  nDensity = config->GetLUT_nDensity();
+  nEnergy  = config->GetLUT_nEnergy();
+
+  LogDensity_Min   = log(config->GetLUT_Density_Limits(0));
+  Delta_LogDensity = (log(config->GetLUT_Density_Limits(1)) - LogDensity_Min)/su2double(nDensity-1);
+
+  /*--- The energy range covers the temperature limits at all densities of the table. ---*/
+
+  Energy_Min = 0.0; Energy_Max = 0.0;
+  for (iDensity = 0; iDensity < nDensity; iDensity++) {
+    rho = exp(LogDensity_Min + su2double(iDensity)*Delta_LogDensity);
+    for (iLimit = 0; iLimit < 2; iLimit++) {
+      BaseModel->SetTDState_rhoT(rho, config->GetLUT_Temperature_Limits(iLimit));
+      e = BaseModel->GetStaticEnergy();
+      if ((iDensity == 0 && iLimit == 0) || (e < Energy_Min)) Energy_Min = e;
+      if ((iDensity == 0 && iLimit == 0) || (e > Energy_Max)) Energy_Max = e;
+    }
+  }
+  Delta_Energy = (Energy_Max - Energy_Min)/su2double(nEnergy-1);
+
+  /*--- Sample the base model on the nodes of the table. ---*/
+
+  Table_Pressure.resize(nDensity*nEnergy);
+  Table_Temperature.resize(nDensity*nEnergy);
+  Table_Entropy.resize(nDensity*nEnergy);
+
+  for (iDensity = 0; iDensity < nDensity; iDensity++) {
+    rho = exp(LogDensity_Min + su2double(iDensity)*Delta_LogDensity);
+    for (iEnergy = 0; iEnergy < nEnergy; iEnergy++) {
+      e = Energy_Min + su2double(iEnergy)*Delta_Energy;
+      BaseModel->SetTDState_rhoe(rho, e);
+      Table_Pressure[iDensity*nEnergy+iEnergy]    = BaseModel->GetPressure();
+      Table_Temperature[iDensity*nEnergy+iEnergy] = BaseModel->GetTemperature();
+      Table_Entropy[iDensity*nEnergy+iEnergy]     = BaseModel->GetEntropy();
+    }
+  }
+
+  delete BaseModel;
+
+}
+
+bool CLookUpTable::ReadTable(CConfig *config) {
+
+  ifstream table_file;
+  string filename = config->GetLUT_Filename();
+  string text_line, keyword, base_model;
+  unsigned long iPoint = 0;
+  unsigned short iParam;
+  double value, P, T, s;
+
+  table_file.open(filename.data(), ios::in);
+  if (table_file.fail()) return false;
+
+  nDensity = 0; nEnergy = 0;
+
+  /*--- Parameters of the configuration the table must have been generated
+        with. A table without these parameters in its header is rejected. ---*/
+
+  const unsigned short nParam = 10;
+  const string param_name[] = {"NDENSITY=", "NENERGY=", "GAMMA=", "GAS_CONSTANT=",
+                               "PRESSURE_CRITICAL=", "TEMPERATURE_CRITICAL=", "ACENTRIC_FACTOR=",
+                               "DENSITY_LIMITS=", "TEMPERATURE_LIMITS=", "BASE_MODEL="};
+  bool param_found[nParam];
+  for (iParam = 0; iParam < nParam; iParam++) param_found[iParam] = false;
+
+  double Gamma = 0.0, Gas_Constant = 0.0, Pressure_Critical = 0.0,
+  Temperature_Critical = 0.0, Acentric_Factor = 0.0;
+  double Density_Limits[2] = {0.0, 0.0}, Temperature_Limits[2] = {0.0, 0.0};
+
+  while (getline(table_file, text_line)) {
+
+    if (text_line.empty() || text_line[0] == '%') continue;
+
+    istringstream line_stream(text_line);
+
+    /*--- Header: keyword followed by its value(s). ---*/
+
+    if (text_line.find('=') != string::npos) {
+      line_stream >> keyword;
+      for (iParam = 0; iParam < nParam; iParam++)
+        if (keyword == param_name[iParam]) param_found[iParam] = true;
+
+      if      (keyword == "BASE_MODEL=")         line_stream >> base_model;
+      else if (keyword == "DENSITY_LIMITS=")     line_stream >> Density_Limits[0] >> Density_Limits[1];
+      else if (keyword == "TEMPERATURE_LIMITS=") line_stream >> Temperature_Limits[0] >> Temperature_Limits[1];
+      else {
+        line_stream >> value;
+        if      (keyword == "NDENSITY=")            nDensity             = (unsigned long) value;
+        else if (keyword == "NENERGY=")             nEnergy              = (unsigned long) value;
+        else if (keyword == "LOG_DENSITY_MIN=")     LogDensity_Min       = value;
+        else if (keyword == "DELTA_LOG_DENSITY=")   Delta_LogDensity     = value;
+        else if (keyword == "ENERGY_MIN=")          Energy_Min           = value;
+        else if (keyword == "DELTA_ENERGY=")        Delta_Energy         = value;
+        else if (keyword == "GAMMA=")               Gamma                = value;
+        else if (keyword == "GAS_CONSTANT=")        Gas_Constant         = value;
+        else if (keyword == "PRESSURE_CRITICAL=")   Pressure_Critical    = value;
+        else if (keyword == "TEMPERATURE_CRITICAL=") Temperature_Critical = value;
+        else if (keyword == "ACENTRIC_FACTOR=")     Acentric_Factor      = value;
+      }
+      continue;
+    }
+
+    /*--- Data: pressure, temperature and entropy of each node. ---*/
+
+    if (Table_Pressure.size() != nDensity*nEnergy) {
+      Table_Pressure.resize(nDensity*nEnergy);
+      Table_Temperature.resize(nDensity*nEnergy);
+      Table_Entropy.resize(nDensity*nEnergy);
+    }
+    if (iPoint >= nDensity*nEnergy) break;
+
+    line_stream >> P >> T >> s;
+    Table_Pressure[iPoint]    = P;
+    Table_Temperature[iPoint] = T;
+    Table_Entropy[iPoint]     = s;
+    iPoint++;
+  }
+
+  table_file.close();
+
+  /*--- Check the header of the table against the configuration. A table
+        generated for another fluid or range is not used silently. ---*/
+
+  for (iParam = 0; iParam < nParam; iParam++) {
+    if (!param_found[iParam])
+      SU2_MPI::Error(string("The look-up table ") + filename + string(" does not contain ") +
+                     param_name[iParam] + string(" in its header.\n") +
+                     string("Remove the file to regenerate the table from LUT_BASE_MODEL."), CURRENT_FUNCTION);
+  }
+
+  const unsigned short Kind_BaseModel = config->GetKind_LUT_BaseModel();
+
+  CheckTableParameter(filename, "BASE_MODEL", base_model == GetBaseModelName(Kind_BaseModel));
+  CheckTableParameter(filename, "NDENSITY", nDensity == config->GetLUT_nDensity());
+  CheckTableParameter(filename, "NENERGY",  nEnergy  == config->GetLUT_nEnergy());
+  CheckTableParameter(filename, "GAMMA", EqualParameter(Gamma, config->GetGamma()));
+  CheckTableParameter(filename, "GAS_CONSTANT", EqualParameter(Gas_Constant, config->GetGas_Constant()));
+  CheckTableParameter(filename, "DENSITY_LIMITS",
+                      EqualParameter(Density_Limits[0], config->GetLUT_Density_Limits(0)) &&
+                      EqualParameter(Density_Limits[1], config->GetLUT_Density_Limits(1)));
+  CheckTableParameter(filename, "TEMPERATURE_LIMITS",
+                      EqualParameter(Temperature_Limits[0], config->GetLUT_Temperature_Limits(0)) &&
+                      EqualParameter(Temperature_Limits[1], config->GetLUT_Temperature_Limits(1)));
+
+  if ((Kind_BaseModel == VW_GAS) || (Kind_BaseModel == PR_GAS)) {
+    CheckTableParameter(filename, "PRESSURE_CRITICAL",
+                        EqualParameter(Pressure_Critical, config->GetPressure_Critical()));
+    CheckTableParameter(filename, "TEMPERATURE_CRITICAL",
+                        EqualParameter(Temperature_Critical, config->GetTemperature_Critical()));
+  }
+  if (Kind_BaseModel == PR_GAS)
+    CheckTableParameter(filename, "ACENTRIC_FACTOR",
+                        EqualParameter(Acentric_Factor, config->GetAcentric_Factor()));
+
+  return ((nDensity >= 4) && (nEnergy >= 4) && (iPoint == nDensity*nEnergy));
+
+}
+
+void CLookUpTable::WriteTable(CConfig *config) {
+
+  ofstream table_file;
+  unsigned long iPoint;
+
+  table_file.open(config->GetLUT_Filename().data(), ios::out);
+  table_file.precision(15);
+  table_file.setf(ios::scientific);
+
+  table_file << "% SU2 thermodynamic look-up table. Density is spaced logarithmically, internal energy uniformly." << endl;
+  table_file << "% Configuration the table has been generated with, which is checked when the table is read." << endl;
+  table_file << "BASE_MODEL= " << GetBaseModelName(config->GetKind_LUT_BaseModel()) << endl;
+  table_file << "GAMMA= " << config->GetGamma() << endl;
+  table_file << "GAS_CONSTANT= " << config->GetGas_Constant() << endl;
+  table_file << "PRESSURE_CRITICAL= " << config->GetPressure_Critical() << endl;
+  table_file << "TEMPERATURE_CRITICAL= " << config->GetTemperature_Critical() << endl;
+  table_file << "ACENTRIC_FACTOR= " << config->GetAcentric_Factor() << endl;
+  table_file << "DENSITY_LIMITS= " << config->GetLUT_Density_Limits(0) << " " << config->GetLUT_Density_Limits(1) << endl;
+  table_file << "TEMPERATURE_LIMITS= " << config->GetLUT_Temperature_Limits(0) << " " << config->GetLUT_Temperature_Limits(1) << endl;
+  table_file << "% Layout of the table." << endl;
+  table_file << "NDENSITY= " << nDensity << endl;
+  table_file << "NENERGY= " << nEnergy << endl;
+  table_file << "LOG_DENSITY_MIN= " << LogDensity_Min << endl;
+  table_file << "DELTA_LOG_DENSITY= " << Delta_LogDensity << endl;
+  table_file << "ENERGY_MIN= " << Energy_Min << endl;
+  table_file << "DELTA_ENERGY= " << Delta_Energy << endl;
+  table_file << "% Pressure, Temperature, Entropy for each density (outer) and energy (inner) node" << endl;
+
+  for (iPoint = 0; iPoint < nDensity*nEnergy; iPoint++)
+    table_file << Table_Pressure[iPoint] << "\t" << Table_Temperature[iPoint] << "\t" << Table_Entropy[iPoint] << "\n";
+
+  table_file.close();
+
+}
+
+string CLookUpTable::GetBaseModelName(unsigned short val_kind) {
+
+  map<string, ENUM_FLUIDMODEL>::const_iterator it;
+  for (it = FluidModel_Map.begin(); it != FluidModel_Map.end(); ++it)
+    if (it->second == val_kind) return it->first;
+
+  return string("UNKNOWN");
+
+}
+
+bool CLookUpTable::EqualParameter(su2double val_table, su2double val_config) {
+
+  return fabs(val_table - val_config) <= 1e-10*max(fabs(val_table), fabs(val_config));
+
+}
+
+void CLookUpTable::CheckTableParameter(string filename, string val_name, bool val_match) {
+
+  if (!val_match)
+    SU2_MPI::Error(string("The look-up table ") + filename + string(" has been generated with another ") +
+                   val_name + string(" than specified in the configuration.\n") +
+                   string("Remove the file to regenerate the table from LUT_BASE_MODEL."), CURRENT_FUNCTION);
+
+}
+
+void CLookUpTable::Interpolate(su2double rho, su2double e) {
+
+  unsigned short iStencil, jStencil;
+  long iDensity, iEnergy;
+  unsigned long iPoint;
+  su2double x, y, tx, ty, W;
+  su2double wx[4], wy[4], dwx[4], dwy[4];
+  su2double P_x = 0.0, P_y = 0.0, T_x = 0.0, T_y = 0.0, s_x = 0.0, s_y = 0.0;
+  su2double dedrho_P, dTdrho_P;
+
+  /*--- Locate the cell in the uniform (log rho, e) grid. The 4x4 stencil is
+        shifted inwards near the edges of the table. ---*/
+
+  x = (log(rho) - LogDensity_Min)/Delta_LogDensity;
+  y = (e - Energy_Min)/Delta_Energy;
+
+  iDensity = (long) floor(SU2_TYPE::GetValue(x));
+  iEnergy  = (long) floor(SU2_TYPE::GetValue(y));
+  iDensity = max(1L, min(iDensity, (long) nDensity-3));
+  iEnergy  = max(1L, min(iEnergy,  (long) nEnergy-3));
+
+  tx = x - su2double(iDensity);
+  ty = y - su2double(iEnergy);
+
+  /*--- Catmull-Rom weights and their derivatives. ---*/
+
+  wx[0] = 0.5*(-tx*tx*tx + 2.0*tx*tx - tx);    dwx[0] = 0.5*(-3.0*tx*tx + 4.0*tx - 1.0);
+  wx[1] = 0.5*( 3.0*tx*tx*tx - 5.0*tx*tx + 2.0); dwx[1] = 0.5*( 9.0*tx*tx - 10.0*tx);
+  wx[2] = 0.5*(-3.0*tx*tx*tx + 4.0*tx*tx + tx); dwx[2] = 0.5*(-9.0*tx*tx + 8.0*tx + 1.0);
+  wx[3] = 0.5*( tx*tx*tx - tx*tx);              dwx[3] = 0.5*( 3.0*tx*tx - 2.0*tx);
+
+  wy[0] = 0.5*(-ty*ty*ty + 2.0*ty*ty - ty);    dwy[0] = 0.5*(-3.0*ty*ty + 4.0*ty - 1.0);
+  wy[1] = 0.5*( 3.0*ty*ty*ty - 5.0*ty*ty + 2.0); dwy[1] = 0.5*( 9.0*ty*ty - 10.0*ty);
+  wy[2] = 0.5*(-3.0*ty*ty*ty + 4.0*ty*ty + ty); dwy[2] = 0.5*(-9.0*ty*ty + 8.0*ty + 1.0);
+  wy[3] = 0.5*( ty*ty*ty - ty*ty);              dwy[3] = 0.5*( 3.0*ty*ty - 2.0*ty);
+
+  Pressure = 0.0; Temperature = 0.0; Entropy = 0.0;
+
+  for (iStencil = 0; iStencil < 4; iStencil++) {
+    for (jStencil = 0; jStencil < 4; jStencil++) {
+      iPoint = (iDensity-1+iStencil)*nEnergy + (iEnergy-1+jStencil);
+
+      W = wx[iStencil]*wy[jStencil];
+      Pressure    += W*Table_Pressure[iPoint];
+      Temperature += W*Table_Temperature[iPoint];
+      Entropy     += W*Table_Entropy[iPoint];
+
+      W = dwx[iStencil]*wy[jStencil];
+      P_x += W*Table_Pressure[iPoint];
+      T_x += W*Table_Temperature[iPoint];
+      s_x += W*Table_Entropy[iPoint];
+
+      W = wx[iStencil]*dwy[jStencil];
+      P_y += W*Table_Pressure[iPoint];
+      T_y += W*Table_Temperature[iPoint];
+      s_y += W*Table_Entropy[iPoint];
+    }
+  }
+
+  Density      = rho;
+  StaticEnergy = e;
+
+  /*--- Derivatives w.r.t. the table coordinates to derivatives w.r.t. rho and e. ---*/
+
+  dPdrho_e = P_x/(Delta_LogDensity*rho);
+  dTdrho_e = T_x/(Delta_LogDensity*rho);
+  dsdrho_e = s_x/(Delta_LogDensity*rho);
+  dPde_rho = P_y/Delta_Energy;
+  dTde_rho = T_y/Delta_Energy;
+  dsde_rho = s_y/Delta_Energy;
+
+  SoundSpeed2 = dPdrho_e + Pressure/(rho*rho)*dPde_rho;
+
+  /*--- Specific heats from the derivatives along isochores and isobars. ---*/
+
+  Cv = 1.0/dTde_rho;
+
+  dedrho_P = -dPdrho_e/dPde_rho;
+  dTdrho_P = dTdrho_e + dTde_rho*dedrho_P;
+  Cp = (dedrho_P - Pressure/(rho*rho))/dTdrho_P;
+
+}
+
+void CLookUpTable::Newton_2D(unsigned short val_pair, su2double val_1, su2double val_2) {
+
+  const unsigned short ITMAX = 50;
+  const su2double toll = 1e-10;
+  unsigned short iIter;
+  su2double rho, LogDensity, e, f1 = 0.0, f2 = 0.0, J11 = 0.0, J12 = 0.0, J21 = 0.0, J22 = 0.0, det, dLogDensity, de;
+  su2double LogDensity_Max = LogDensity_Min + su2double(nDensity-1)*Delta_LogDensity,
+  Energy_Max = Energy_Min + su2double(nEnergy-1)*Delta_Energy;
+
+  /*--- The current state is the initial guess if it lies inside the table. ---*/
+
+  LogDensity = 0.5*(LogDensity_Min + LogDensity_Max);
+  e = 0.5*(Energy_Min + Energy_Max);
+  if (Density > 0.0 && log(Density) > LogDensity_Min && log(Density) < LogDensity_Max &&
+      StaticEnergy > Energy_Min && StaticEnergy < Energy_Max) {
+    LogDensity = log(Density);
+    e = StaticEnergy;
+  }
+
+  for (iIter = 0; iIter < ITMAX; iIter++) {
+
+    rho = exp(LogDensity);
+    Interpolate(rho, e);
+
+    /*--- Residuals and Jacobian w.r.t. (log rho, e). ---*/
+
+    switch (val_pair) {
+      case 0:  /*--- P-T ---*/
+        f1 = Pressure - val_1;            J11 = dPdrho_e*rho;                J12 = dPde_rho;
+        f2 = Temperature - val_2;         J21 = dTdrho_e*rho;                J22 = dTde_rho;
+        break;
+      case 1:  /*--- h-s ---*/
+        f1 = e + Pressure/rho - val_1;    J11 = dPdrho_e - Pressure/rho;    J12 = 1.0 + dPde_rho/rho;
+        f2 = Entropy - val_2;             J21 = dsdrho_e*rho;                J22 = dsde_rho;
+        break;
+      case 2:  /*--- P-s ---*/
+        f1 = Pressure - val_1;            J11 = dPdrho_e*rho;                J12 = dPde_rho;
+        f2 = Entropy - val_2;             J21 = dsdrho_e*rho;                J22 = dsde_rho;
+        break;
+    }
+
+    det = J11*J22 - J12*J21;
+    dLogDensity = -( J22*f1 - J12*f2)/det;
+    de          = -(-J21*f1 + J11*f2)/det;
+
+    /*--- Limit the update to the extent of the table. ---*/
+
+    LogDensity = min(max(LogDensity + dLogDensity, LogDensity_Min), LogDensity_Max);
+    e          = min(max(e + de, Energy_Min), Energy_Max);
+
+    if (fabs(dLogDensity) < toll && fabs(de) < toll*(Energy_Max - Energy_Min)) break;
+  }
+
+  Interpolate(exp(LogDensity), e);
+
+}
+
+void CLookUpTable::Newton_1D(su2double rho, bool val_pressure, su2double val_value) {
+
+  const unsigned short ITMAX = 50;
+  const su2double toll = 1e-10;
+  unsigned short iIter;
+  su2double e, de;
+  su2double Energy_Max = Energy_Min + su2double(nEnergy-1)*Delta_Energy;
+
+  e = 0.5*(Energy_Min + Energy_Max);
+  if (StaticEnergy > Energy_Min && StaticEnergy < Energy_Max) e = StaticEnergy;
+
+  for (iIter = 0; iIter < ITMAX; iIter++) {
+
+    Interpolate(rho, e);
+
+    if (val_pressure) de = -(Pressure - val_value)/dPde_rho;
+    else              de = -(Temperature - val_value)/dTde_rho;
+
+    e = min(max(e + de, Energy_Min), Energy_Max);
+
+    if (fabs(de) < toll*(Energy_Max - Energy_Min)) break;
+  }
+
+  Interpolate(rho, e);
+
+}
+
+void CLookUpTable::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(rho); AD::SetPreaccIn(e);
+
+  Interpolate(rho, e);
+
+  AD::SetPreaccOut(Temperature); AD::SetPreaccOut(SoundSpeed2);
+  AD::SetPreaccOut(dPde_rho); AD::SetPreaccOut(dPdrho_e);
+  AD::SetPreaccOut(dTde_rho); AD::SetPreaccOut(dTdrho_e);
+  AD::SetPreaccOut(Pressure); AD::SetPreaccOut(Entropy);
+  AD::SetPreaccOut(Cp); AD::SetPreaccOut(Cv);
+  AD::EndPreacc();
+
+}
+
+void CLookUpTable::SetTDState_PT (su2double P, su2double T ) {
+
+  Newton_2D(0, P, T);
+
+}
+
+void CLookUpTable::SetTDState_Prho (su2double P, su2double rho ) {
+
+  Newton_1D(rho, true, P);
+
+}
+
+void CLookUpTable::SetEnergy_Prho (su2double P, su2double rho ) {
+
+  Newton_1D(rho, true, P);
+
+}
+
+void CLookUpTable::SetTDState_hs (su2double h, su2double s ) {
+
+  Newton_2D(1, h, s);
+
+}
+
+void CLookUpTable::SetTDState_rhoT (su2double rho, su2double T ) {
+
+  Newton_1D(rho, false, T);
+
+}
+
+void CLookUpTable::SetTDState_Ps (su2double P, su2double s ) {
+
+  Newton_2D(2, P, s);
+
+}
+
+void CLookUpTable::ComputeDerivativeNRBC_Prho (su2double P, su2double rho ) {
+
+  su2double dedrho_P;
+
+  SetTDState_Prho(P, rho);
+
+  dedrho_P = -dPdrho_e/dPde_rho;
+
+  dhdrho_P = dedrho_P - Pressure/(rho*rho);
+  dhdP_rho = 1.0/dPde_rho + 1.0/rho;
+  dsdrho_P = dsdrho_e + dsde_rho*dedrho_P;
+  dsdP_rho = dsde_rho/dPde_rho;
+
+}
@@ -84,6 +84,32 @@ void CIdealGas::SetTDState_rhoe (su2double rho, su2double e ) {
     Entropy = (1.0/Gamma_Minus_One*log(Temperature) + log(1.0/Density))*Gas_Constant;
 }
 
+void CIdealGas::SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                      su2double *P, su2double *T, su2double *c2,
+                                      su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                      su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp) {
+
+  unsigned long iPoint;
+
+  /*--- Same expressions as SetTDState_rhoe, written to the output arrays only. ---*/
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++) {
+    P[iPoint]            = Gamma_Minus_One*rho[iPoint]*e[iPoint];
+    T[iPoint]            = Gamma_Minus_One*e[iPoint]/Gas_Constant;
+    c2[iPoint]           = Gamma*P[iPoint]/rho[iPoint];
+    val_dPdrho_e[iPoint] = Gamma_Minus_One*e[iPoint];
+    val_dPde_rho[iPoint] = Gamma_Minus_One*rho[iPoint];
+    val_dTdrho_e[iPoint] = 0.0;
+    val_dTde_rho[iPoint] = Gamma_Minus_One/Gas_Constant;
+    val_Cp[iPoint]       = Cp;
+  }
+
+  /*--- Leave the model in the state of the last point. ---*/
+
+  if (nPoints > 0) SetTDState_rhoe(rho[nPoints-1], e[nPoints-1]);
+
+}
+
 void CIdealGas::SetTDState_PT (su2double P, su2double T ) {
   su2double e = T*Gas_Constant/Gamma_Minus_One;
   su2double rho = P/(T*Gas_Constant);
@@ -163,6 +163,68 @@ void CPengRobinson::SetTDState_rhoe (su2double rho, su2double e ) {
 
 }
 
+void CPengRobinson::SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                          su2double *P, su2double *T, su2double *c2,
+                                          su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                          su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp) {
+
+  unsigned long iPoint;
+  su2double DpDd_T, DpDT_d, DeDd_T, Cv;
+  su2double A, B, C, fv, a2T, rho2, Temp;
+  const su2double sqrt2 = sqrt(2.0);
+
+  /*--- Same expressions as SetTDState_rhoe, written to the output arrays only.
+        Each point is still preaccumulated on its own for the discrete adjoint. ---*/
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++) {
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(rho[iPoint]); AD::SetPreaccIn(e[iPoint]);
+
+    rho2 = rho[iPoint]*rho[iPoint];
+
+    fv = (log(1.0+( rho[iPoint] * b * sqrt2/(1 + rho[iPoint]*b))) - log(1.0-( rho[iPoint] * b * sqrt2/(1 + rho[iPoint]*b))))/2.0;
+
+    A = Gas_Constant / Gamma_Minus_One;
+    B = a*k*(k+1)*fv/(b*sqrt2*sqrt(TstarCrit));
+    C = a*(k+1)*(k+1)*fv/(b*sqrt2) + e[iPoint];
+
+    Temp = ( -B + sqrt(B*B + 4*A*C) ) / (2*A);
+    Temp *= Temp;
+
+    a2T = alpha2(Temp);
+
+    A = (1/rho2 + 2*b/rho[iPoint] - b*b);
+    B = 1/rho[iPoint]-b;
+
+    T[iPoint] = Temp;
+    P[iPoint] = Temp*Gas_Constant / B - a*a2T / A;
+
+    DpDd_T = ( Temp*Gas_Constant /(B*B    ) - 2*a*a2T*(1/rho[iPoint] + b) /( A*A ) ) /(rho2);
+    DpDT_d = Gas_Constant /B + a*k / A * sqrt( a2T/(Temp*TstarCrit) );
+    Cv     = Gas_Constant/Gamma_Minus_One + ( a*k*(k+1)*fv ) / ( 2*b*sqrt(2*Temp*TstarCrit) );
+    DeDd_T = - a*(1+k) * sqrt( a2T ) / A / (rho2);
+
+    val_dPde_rho[iPoint] = DpDT_d/Cv;
+    val_dPdrho_e[iPoint] = DpDd_T - val_dPde_rho[iPoint]*DeDd_T;
+    val_dTdrho_e[iPoint] = dTdrho_e;
+    val_dTde_rho[iPoint] = 1/Cv;
+    c2[iPoint]           = val_dPdrho_e[iPoint] + P[iPoint]/(rho2)*val_dPde_rho[iPoint];
+
+    AD::SetPreaccOut(T[iPoint]); AD::SetPreaccOut(c2[iPoint]);
+    AD::SetPreaccOut(val_dPde_rho[iPoint]); AD::SetPreaccOut(val_dPdrho_e[iPoint]);
+    AD::SetPreaccOut(val_dTde_rho[iPoint]); AD::SetPreaccOut(P[iPoint]);
+    AD::EndPreacc();
+
+    val_Cp[iPoint] = Cp;
+  }
+
+  /*--- Leave the model in the state of the last point (also used as initial guess by SetTDState_PT). ---*/
+
+  if (nPoints > 0) SetTDState_rhoe(rho[nPoints-1], e[nPoints-1]);
+
+}
+
 void CPengRobinson::SetTDState_PT (su2double P, su2double T ) {
   su2double toll= 1e-6;
   su2double A, B, Z, DZ=1.0, F, F1, atanh;
@@ -74,6 +74,39 @@ void CVanDerWaalsGas::SetTDState_rhoe (su2double rho, su2double e ) {
     Zed = Pressure/(Gas_Constant*Temperature*Density);
 }
 
+void CVanDerWaalsGas::SetTDState_rhoe_Batch(unsigned long nPoints, const su2double *rho, const su2double *e,
+                                            su2double *P, su2double *T, su2double *c2,
+                                            su2double *val_dPdrho_e, su2double *val_dPde_rho,
+                                            su2double *val_dTdrho_e, su2double *val_dTde_rho, su2double *val_Cp) {
+
+  unsigned long iPoint;
+  su2double d, E;
+
+  /*--- Same expressions as SetTDState_rhoe, written to the output arrays only. ---*/
+
+  for (iPoint = 0; iPoint < nPoints; iPoint++) {
+    d = rho[iPoint];
+    E = e[iPoint];
+
+    P[iPoint] = Gamma_Minus_One*d/(1.0-d*b)*(E + d*a) - a*d*d;
+    T[iPoint] = (P[iPoint]+d*d*a)*((1-d*b)/(d*Gas_Constant));
+
+    val_dPde_rho[iPoint] = d*Gamma_Minus_One/(1.0 - d*b);
+    val_dPdrho_e[iPoint] = Gamma_Minus_One/(1.0 - d*b)*((E + 2*d*a) + d*b*(E + d*a)/(1.0 - d*b)) - 2*d*a;
+    val_dTdrho_e[iPoint] = Gamma_Minus_One/Gas_Constant*a;
+    val_dTde_rho[iPoint] = Gamma_Minus_One/Gas_Constant;
+
+    c2[iPoint] = val_dPdrho_e[iPoint] + P[iPoint]/(d*d)*val_dPde_rho[iPoint];
+
+    val_Cp[iPoint] = Cp;
+  }
+
+  /*--- Leave the model in the state of the last point (also used as initial guess by SetTDState_PT). ---*/
+
+  if (nPoints > 0) SetTDState_rhoe(rho[nPoints-1], e[nPoints-1]);
+
+}
+
 
 void CVanDerWaalsGas::SetTDState_PT (su2double P, su2double T ) {
   su2double toll= 1e-5;
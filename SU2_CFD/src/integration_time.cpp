@@ -1010,7 +1010,15 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
     case RUNGE_KUTTA_EXPLICIT: iLimit = config[iZone]->GetnRKStep(); break;
     case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
     case ADER_DG: iLimit = 1; useADER = true; break;
-    case EULER_EXPLICIT: case EULER_IMPLICIT: iLimit = 1; break; }
+    case EULER_EXPLICIT: iLimit = 1; break;
+    case EULER_IMPLICIT:
+      /* For time accurate simulations several Newton iterations are carried
+         out per time step, for steady simulations one per pseudo time step. */
+      if(config[iZone]->GetUnsteady_Simulation() == TIME_STEPPING)
+        iLimit = config[iZone]->GetnNewtonIter_ImplicitDG();
+      else
+        iLimit = 1;
+      break; }
 
   /*--- In case an unsteady simulation is carried out, it is possible that a
         synchronization time step is specified. If so, set the boolean
@@ -1098,16 +1106,30 @@ void CFEM_DG_Integration::Space_Integration(CGeometry *geometry,
   /*--- Runge-Kutta type of time integration schemes. In the first step, i.e.
         if iStep == 0, set the old solution (working solution for the DG part),
         and if needed, the new solution. ---*/
+  const bool implicitScheme = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
   if (iStep == 0) {
     solver_container[MainSolver]->Set_OldSolution(geometry);
 
-    if (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT) {
+    if (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT || implicitScheme) {
       solver_container[MainSolver]->Set_NewSolution(geometry);
     }
   }
 
+  /*--- For the implicit scheme every Newton iteration starts from the current
+        solution, which must be stored as the working solution. ---*/
+  else if ( implicitScheme ) {
+    solver_container[MainSolver]->Set_OldSolution(geometry);
+  }
+
   /*--- Compute the spatial residual by processing the task list. ---*/
   solver_container[MainSolver]->ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+  /*--- The implicit scheme also needs the Jacobian of the spatial residual.
+        Whether or not it is recomputed in this iteration is decided in
+        ComputeSpatialJacobian, based on JACOBIAN_FREQ_IMPLICIT_DG. ---*/
+  if ( implicitScheme )
+    solver_container[MainSolver]->ComputeSpatialJacobian(geometry, solver_container, numerics,
+                                                         config, iMesh, RunTime_EqSystem);
 }
 
 void CFEM_DG_Integration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iStep,
@@ -1123,6 +1145,9 @@ void CFEM_DG_Integration::Time_Integration(CGeometry *geometry, CSolver **solver
     case (CLASSICAL_RK4_EXPLICIT):
       solver_container[MainSolver]->ClassicalRK4_Iteration(geometry, solver_container, config, iStep);
       break;
+    case (EULER_IMPLICIT):
+      solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
+      break;
     default:
       SU2_MPI::Error("Time integration scheme not implemented.", CURRENT_FUNCTION);
   }
@@ -373,6 +373,19 @@ void CIteration::SetGrid_Movement(CGeometry ****geometry_container,
       break;
   }
 
+  /*--- Update the wall distance after a deformation of the grid, if desired.
+   A rigid motion of the entire grid does not change the wall distance. ---*/
+
+  unsigned short Kind_Solver = config_container[val_iZone]->GetKind_Solver();
+  bool rans = ((Kind_Solver == RANS) || (Kind_Solver == ADJ_RANS) || (Kind_Solver == DISC_ADJ_RANS));
+  bool deforming = ((Kind_Grid_Movement == DEFORMING)       || (Kind_Grid_Movement == EXTERNAL) ||
+                    (Kind_Grid_Movement == EXTERNAL_ROTATION) || (Kind_Grid_Movement == AEROELASTIC) ||
+                    (Kind_Grid_Movement == AEROELASTIC_RIGID_MOTION) ||
+                    (Kind_Grid_Movement == FLUID_STRUCTURE) || (Kind_Grid_Movement == FLUID_STRUCTURE_STATIC));
+
+  if (rans && deforming && config_container[val_iZone]->GetWall_Distance_Update())
+    geometry_container[val_iZone][val_iInst][MESH_0]->UpdateWall_Distance(config_container[val_iZone]);
+
 }
 
 void CIteration::Preprocess(COutput *output,
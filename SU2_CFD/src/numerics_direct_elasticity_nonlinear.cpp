@@ -753,6 +753,361 @@ void CFEANonlinearElasticity::Compute_NodalStress_Term(CElement *element, CConfi
 
 }
 
+void CFEANonlinearElasticity::Set_Element_Batch(CElement *element, CFEABatch *batch, unsigned short iLane, CConfig *config) {
+
+  unsigned short iGauss, iNode, iDim;
+
+  /*--- Material properties of the element ---*/
+
+  SetElement_Properties(element, config);
+
+  batch->E[iLane]      = E;
+  batch->Nu[iLane]     = Nu;
+  batch->Mu[iLane]     = Mu;
+  batch->Lambda[iLane] = Lambda;
+  batch->Kappa[iLane]  = Kappa;
+
+  /*--- Gradients of the shape functions and current coordinates ---*/
+
+  element->ComputeGrad_NonLinear();
+
+  batch->nNodes = element->GetnNodes();
+  batch->nGauss = element->GetnGaussPoints();
+
+  for (iGauss = 0; iGauss < batch->nGauss; iGauss++) {
+    batch->Weight[iGauss] = element->GetWeight(iGauss);
+    batch->Jac_x[iGauss][iLane] = element->GetJ_x(iGauss);
+    for (iNode = 0; iNode < batch->nNodes; iNode++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        batch->GradNi_X[iGauss][iNode][iDim][iLane] = element->GetGradNi_X(iNode,iGauss,iDim);
+        batch->GradNi_x[iGauss][iNode][iDim][iLane] = element->GetGradNi_x(iNode,iGauss,iDim);
+      }
+    }
+  }
+
+  for (iNode = 0; iNode < batch->nNodes; iNode++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      batch->Coord[iNode][iDim][iLane] = element->GetCurr_Coord(iNode, iDim);
+
+}
+
+template<unsigned short nDim_, unsigned short nNode_>
+void CFEANonlinearElasticity::Compute_Batch_Kernel(CElement *element, CFEABatch *batch, bool val_tangent, CConfig *config) {
+
+  const unsigned short bDim = (nDim_ == 2) ? 3 : 6;
+  const unsigned short nLane = FEA_BATCH_SIZE;
+
+  unsigned short iVar, jVar, kVar, iLane;
+  unsigned short iGauss, iNode, jNode;
+
+  su2double Weight;
+  su2double Ba[6][3][FEA_BATCH_SIZE], Bb[6][3][FEA_BATCH_SIZE];
+  su2double AuxMatrixKc[3][6][FEA_BATCH_SIZE], AuxMatrixKs[3][FEA_BATCH_SIZE];
+  su2double KAux[3][3][FEA_BATCH_SIZE], KsAux[FEA_BATCH_SIZE], KtAux[3][FEA_BATCH_SIZE];
+
+  /*--- The unused lanes replicate the first element, so that all lanes hold valid data ---*/
+
+  for (iLane = batch->nLanes; iLane < nLane; iLane++) {
+    batch->E[iLane] = batch->E[0];   batch->Nu[iLane] = batch->Nu[0];
+    batch->Mu[iLane] = batch->Mu[0]; batch->Lambda[iLane] = batch->Lambda[0];
+    batch->Kappa[iLane] = batch->Kappa[0];
+    for (iGauss = 0; iGauss < batch->nGauss; iGauss++) {
+      batch->Jac_x[iGauss][iLane] = batch->Jac_x[iGauss][0];
+      for (iNode = 0; iNode < nNode_; iNode++) {
+        for (iVar = 0; iVar < nDim_; iVar++) {
+          batch->GradNi_X[iGauss][iNode][iVar][iLane] = batch->GradNi_X[iGauss][iNode][iVar][0];
+          batch->GradNi_x[iGauss][iNode][iVar][iLane] = batch->GradNi_x[iGauss][iNode][iVar][0];
+        }
+      }
+    }
+    for (iNode = 0; iNode < nNode_; iNode++)
+      for (iVar = 0; iVar < nDim_; iVar++)
+        batch->Coord[iNode][iVar][iLane] = batch->Coord[iNode][iVar][0];
+  }
+
+  /*--- Restart the element terms of the batch ---*/
+
+  for (iNode = 0; iNode < nNode_; iNode++) {
+    for (iVar = 0; iVar < nDim_; iVar++)
+      for (iLane = 0; iLane < nLane; iLane++) batch->Kt_a[iNode][iVar][iLane] = 0.0;
+    if (val_tangent) {
+      for (jNode = 0; jNode < nNode_; jNode++) {
+        for (iLane = 0; iLane < nLane; iLane++) batch->Ks_ab[iNode][jNode][iLane] = 0.0;
+        for (iVar = 0; iVar < nDim_; iVar++)
+          for (jVar = 0; jVar < nDim_; jVar++)
+            for (iLane = 0; iLane < nLane; iLane++) batch->Kab[iNode][jNode][iVar][jVar][iLane] = 0.0;
+      }
+    }
+  }
+
+  for (iVar = 0; iVar < bDim; iVar++) {
+    for (jVar = 0; jVar < nDim_; jVar++) {
+      for (iLane = 0; iLane < nLane; iLane++) {
+        Ba[iVar][jVar][iLane] = 0.0;
+        Bb[iVar][jVar][iLane] = 0.0;
+      }
+    }
+  }
+
+  for (iGauss = 0; iGauss < batch->nGauss; iGauss++) {
+
+    Weight = batch->Weight[iGauss];
+    su2double *Jac_x = batch->Jac_x[iGauss];
+
+    /*--- Deformation gradient ---*/
+
+    for (iVar = 0; iVar < 3; iVar++)
+      for (jVar = 0; jVar < 3; jVar++)
+        for (iLane = 0; iLane < nLane; iLane++) {
+          batch->F[iVar][jVar][iLane] = 0.0;
+          batch->b[iVar][jVar][iLane] = 0.0;
+        }
+
+    for (iNode = 0; iNode < nNode_; iNode++)
+      for (iVar = 0; iVar < nDim_; iVar++)
+        for (jVar = 0; jVar < nDim_; jVar++)
+          for (iLane = 0; iLane < nLane; iLane++)
+            batch->F[iVar][jVar][iLane] += batch->Coord[iNode][iVar][iLane]*batch->GradNi_X[iGauss][iNode][jVar][iLane];
+
+    if (nDim_ == 2) {
+      for (iLane = 0; iLane < nLane; iLane++) batch->F[2][2][iLane] = 1.0;
+
+      /*--- The plane stress term is found with a Newton method, lane by lane ---*/
+      if (plane_stress) {
+        for (iLane = 0; iLane < batch->nLanes; iLane++) {
+          Mu = batch->Mu[iLane]; Lambda = batch->Lambda[iLane];
+          for (iVar = 0; iVar < 3; iVar++)
+            for (jVar = 0; jVar < 3; jVar++)
+              F_Mat[iVar][jVar] = batch->F[iVar][jVar][iLane];
+          Compute_Plane_Stress_Term(element, config);
+          batch->F[2][2][iLane] = f33;
+        }
+      }
+    }
+
+    /*--- Determinant of F and left Cauchy-Green tensor ---*/
+
+    for (iLane = 0; iLane < nLane; iLane++) {
+      batch->J_F[iLane] =
+        batch->F[0][0][iLane]*batch->F[1][1][iLane]*batch->F[2][2][iLane]+
+        batch->F[0][1][iLane]*batch->F[1][2][iLane]*batch->F[2][0][iLane]+
+        batch->F[0][2][iLane]*batch->F[1][0][iLane]*batch->F[2][1][iLane]-
+        batch->F[0][2][iLane]*batch->F[1][1][iLane]*batch->F[2][0][iLane]-
+        batch->F[1][2][iLane]*batch->F[2][1][iLane]*batch->F[0][0][iLane]-
+        batch->F[2][2][iLane]*batch->F[0][1][iLane]*batch->F[1][0][iLane];
+    }
+
+    for (iVar = 0; iVar < 3; iVar++)
+      for (jVar = 0; jVar < 3; jVar++)
+        for (kVar = 0; kVar < 3; kVar++)
+          for (iLane = 0; iLane < nLane; iLane++)
+            batch->b[iVar][jVar][iLane] += batch->F[iVar][kVar][iLane]*batch->F[jVar][kVar][iLane];
+
+    /*--- Stress tensor and constitutive matrix of the material ---*/
+
+    Compute_Stress_Tensor_Batch(element, batch, val_tangent, config);
+
+    for (iNode = 0; iNode < nNode_; iNode++) {
+
+      su2double (*GradNi_a)[FEA_BATCH_SIZE] = batch->GradNi_x[iGauss][iNode];
+
+      /*--- Nodal stress term ---*/
+
+      for (iVar = 0; iVar < nDim_; iVar++) {
+        for (iLane = 0; iLane < nLane; iLane++) KtAux[iVar][iLane] = 0.0;
+        for (jVar = 0; jVar < nDim_; jVar++)
+          for (iLane = 0; iLane < nLane; iLane++)
+            KtAux[iVar][iLane] += Weight * batch->Stress[iVar][jVar][iLane] * GradNi_a[jVar][iLane] * Jac_x[iLane];
+        for (iLane = 0; iLane < nLane; iLane++)
+          batch->Kt_a[iNode][iVar][iLane] += KtAux[iVar][iLane];
+      }
+
+      if (!val_tangent) continue;
+
+      /*--- Constitutive and stress terms of the tangent matrix ---*/
+
+      for (iLane = 0; iLane < nLane; iLane++) {
+        if (nDim_ == 2) {
+          Ba[0][0][iLane] = GradNi_a[0][iLane];
+          Ba[1][1][iLane] = GradNi_a[1][iLane];
+          Ba[2][0][iLane] = GradNi_a[1][iLane];
+          Ba[2][1][iLane] = GradNi_a[0][iLane];
+        }
+        else {
+          Ba[0][0][iLane] = GradNi_a[0][iLane];
+          Ba[1][1][iLane] = GradNi_a[1][iLane];
+          Ba[2][2][iLane] = GradNi_a[2][iLane];
+          Ba[3][0][iLane] = GradNi_a[1][iLane];
+          Ba[3][1][iLane] = GradNi_a[0][iLane];
+          Ba[4][0][iLane] = GradNi_a[2][iLane];
+          Ba[4][2][iLane] = GradNi_a[0][iLane];
+          Ba[5][1][iLane] = GradNi_a[2][iLane];
+          Ba[5][2][iLane] = GradNi_a[1][iLane];
+        }
+      }
+
+      for (iVar = 0; iVar < nDim_; iVar++) {
+        for (jVar = 0; jVar < bDim; jVar++) {
+          for (iLane = 0; iLane < nLane; iLane++) AuxMatrixKc[iVar][jVar][iLane] = 0.0;
+          for (kVar = 0; kVar < bDim; kVar++)
+            for (iLane = 0; iLane < nLane; iLane++)
+              AuxMatrixKc[iVar][jVar][iLane] += Ba[kVar][iVar][iLane]*batch->D[kVar][jVar][iLane];
+        }
+      }
+
+      for (iVar = 0; iVar < nDim_; iVar++) {
+        for (iLane = 0; iLane < nLane; iLane++) AuxMatrixKs[iVar][iLane] = 0.0;
+        for (jVar = 0; jVar < nDim_; jVar++)
+          for (iLane = 0; iLane < nLane; iLane++)
+            AuxMatrixKs[iVar][iLane] += GradNi_a[jVar][iLane]*batch->Stress[jVar][iVar][iLane];
+      }
+
+      /*--- Assuming symmetry ---*/
+      for (jNode = iNode; jNode < nNode_; jNode++) {
+
+        su2double (*GradNi_b)[FEA_BATCH_SIZE] = batch->GradNi_x[iGauss][jNode];
+
+        for (iLane = 0; iLane < nLane; iLane++) {
+          if (nDim_ == 2) {
+            Bb[0][0][iLane] = GradNi_b[0][iLane];
+            Bb[1][1][iLane] = GradNi_b[1][iLane];
+            Bb[2][0][iLane] = GradNi_b[1][iLane];
+            Bb[2][1][iLane] = GradNi_b[0][iLane];
+          }
+          else {
+            Bb[0][0][iLane] = GradNi_b[0][iLane];
+            Bb[1][1][iLane] = GradNi_b[1][iLane];
+            Bb[2][2][iLane] = GradNi_b[2][iLane];
+            Bb[3][0][iLane] = GradNi_b[1][iLane];
+            Bb[3][1][iLane] = GradNi_b[0][iLane];
+            Bb[4][0][iLane] = GradNi_b[2][iLane];
+            Bb[4][2][iLane] = GradNi_b[0][iLane];
+            Bb[5][1][iLane] = GradNi_b[2][iLane];
+            Bb[5][2][iLane] = GradNi_b[1][iLane];
+          }
+        }
+
+        for (iVar = 0; iVar < nDim_; iVar++) {
+          for (jVar = 0; jVar < nDim_; jVar++) {
+            for (iLane = 0; iLane < nLane; iLane++) KAux[iVar][jVar][iLane] = 0.0;
+            for (kVar = 0; kVar < bDim; kVar++)
+              for (iLane = 0; iLane < nLane; iLane++)
+                KAux[iVar][jVar][iLane] += Weight * AuxMatrixKc[iVar][kVar][iLane] * Bb[kVar][jVar][iLane] * Jac_x[iLane];
+          }
+        }
+
+        for (iLane = 0; iLane < nLane; iLane++) KsAux[iLane] = 0.0;
+        for (iVar = 0; iVar < nDim_; iVar++)
+          for (iLane = 0; iLane < nLane; iLane++)
+            KsAux[iLane] += Weight * AuxMatrixKs[iVar][iLane] * GradNi_b[iVar][iLane] * Jac_x[iLane];
+
+        for (iVar = 0; iVar < nDim_; iVar++)
+          for (jVar = 0; jVar < nDim_; jVar++)
+            for (iLane = 0; iLane < nLane; iLane++)
+              batch->Kab[iNode][jNode][iVar][jVar][iLane] += KAux[iVar][jVar][iLane];
+        for (iLane = 0; iLane < nLane; iLane++)
+          batch->Ks_ab[iNode][jNode][iLane] += KsAux[iLane];
+
+        /*--- Symmetric terms ---*/
+        if (iNode != jNode) {
+          for (iVar = 0; iVar < nDim_; iVar++)
+            for (jVar = 0; jVar < nDim_; jVar++)
+              for (iLane = 0; iLane < nLane; iLane++)
+                batch->Kab[jNode][iNode][iVar][jVar][iLane] += KAux[jVar][iVar][iLane];
+          for (iLane = 0; iLane < nLane; iLane++)
+            batch->Ks_ab[jNode][iNode][iLane] += KsAux[iLane];
+        }
+
+      }
+
+    }
+
+  }
+
+}
+
+void CFEANonlinearElasticity::Compute_Tangent_Matrix_Batch(CElement *element, CFEABatch *batch, CConfig *config) {
+
+  switch (nDim*10 + batch->nNodes) {
+    case 23: Compute_Batch_Kernel<2,3>(element, batch, true, config); break;
+    case 24: Compute_Batch_Kernel<2,4>(element, batch, true, config); break;
+    case 34: Compute_Batch_Kernel<3,4>(element, batch, true, config); break;
+    case 35: Compute_Batch_Kernel<3,5>(element, batch, true, config); break;
+    case 36: Compute_Batch_Kernel<3,6>(element, batch, true, config); break;
+    case 38: Compute_Batch_Kernel<3,8>(element, batch, true, config); break;
+    default:
+      SU2_MPI::Error("Element type not supported by the batched structural kernels.", CURRENT_FUNCTION);
+      break;
+  }
+
+}
+
+void CFEANonlinearElasticity::Compute_NodalStress_Term_Batch(CElement *element, CFEABatch *batch, CConfig *config) {
+
+  switch (nDim*10 + batch->nNodes) {
+    case 23: Compute_Batch_Kernel<2,3>(element, batch, false, config); break;
+    case 24: Compute_Batch_Kernel<2,4>(element, batch, false, config); break;
+    case 34: Compute_Batch_Kernel<3,4>(element, batch, false, config); break;
+    case 35: Compute_Batch_Kernel<3,5>(element, batch, false, config); break;
+    case 36: Compute_Batch_Kernel<3,6>(element, batch, false, config); break;
+    case 38: Compute_Batch_Kernel<3,8>(element, batch, false, config); break;
+    default:
+      SU2_MPI::Error("Element type not supported by the batched structural kernels.", CURRENT_FUNCTION);
+      break;
+  }
+
+}
+
+void CFEANonlinearElasticity::Compute_Stress_Tensor_Batch(CElement *element, CFEABatch *batch, bool val_tangent, CConfig *config) {
+
+  unsigned short iVar, jVar, iLane;
+  unsigned short bDim = (nDim == 2) ? 3 : 6;
+
+  /*--- Generic evaluation: load the state of each lane in the member variables used by the material model ---*/
+
+  for (iLane = 0; iLane < batch->nLanes; iLane++) {
+
+    E = batch->E[iLane];   Nu = batch->Nu[iLane];
+    Mu = batch->Mu[iLane]; Lambda = batch->Lambda[iLane]; Kappa = batch->Kappa[iLane];
+    J_F = batch->J_F[iLane];
+
+    for (iVar = 0; iVar < 3; iVar++) {
+      for (jVar = 0; jVar < 3; jVar++) {
+        F_Mat[iVar][jVar] = batch->F[iVar][jVar][iLane];
+        b_Mat[iVar][jVar] = batch->b[iVar][jVar][iLane];
+      }
+    }
+
+    Compute_Stress_Tensor(element, config);
+
+    for (iVar = 0; iVar < 3; iVar++)
+      for (jVar = 0; jVar < 3; jVar++)
+        batch->Stress[iVar][jVar][iLane] = Stress_Tensor[iVar][jVar];
+
+    if (val_tangent) {
+      Compute_Constitutive_Matrix(element, config);
+      for (iVar = 0; iVar < bDim; iVar++)
+        for (jVar = 0; jVar < bDim; jVar++)
+          batch->D[iVar][jVar][iLane] = D_Mat[iVar][jVar];
+    }
+
+  }
+
+  /*--- The unused lanes replicate the first one ---*/
+
+  for (iLane = batch->nLanes; iLane < FEA_BATCH_SIZE; iLane++) {
+    for (iVar = 0; iVar < 3; iVar++)
+      for (jVar = 0; jVar < 3; jVar++)
+        batch->Stress[iVar][jVar][iLane] = batch->Stress[iVar][jVar][0];
+    if (val_tangent) {
+      for (iVar = 0; iVar < bDim; iVar++)
+        for (jVar = 0; jVar < bDim; jVar++)
+          batch->D[iVar][jVar][iLane] = batch->D[iVar][jVar][0];
+    }
+  }
+
+}
+
 void CFEANonlinearElasticity::Add_MaxwellStress(CElement *element, CConfig *config){
 
 //  Adds the Maxwell stress to the output of the stress Sxx, Syy, Szz, SVM...
@@ -1125,6 +1480,51 @@ void CFEM_NeoHookean_Comp::Compute_Stress_Tensor(CElement *element, CConfig *con
 
 }
 
+void CFEM_NeoHookean_Comp::Compute_Stress_Tensor_Batch(CElement *element, CFEABatch *batch, bool val_tangent, CConfig *config) {
+
+  unsigned short iVar, jVar, iLane;
+  unsigned short bDim = (nDim == 2) ? 3 : 6;
+  su2double Mu_J[FEA_BATCH_SIZE], Lambda_J[FEA_BATCH_SIZE], Log_J[FEA_BATCH_SIZE];
+  su2double Mu_p[FEA_BATCH_SIZE], Lambda_p[FEA_BATCH_SIZE];
+  su2double dij = 0.0;
+
+  /*--- Same expressions as Compute_Stress_Tensor and Compute_Constitutive_Matrix, evaluated over the lanes ---*/
+
+  for (iLane = 0; iLane < FEA_BATCH_SIZE; iLane++) {
+    Mu_J[iLane] = 0.0; Lambda_J[iLane] = 0.0;
+    Mu_p[iLane] = 0.0; Lambda_p[iLane] = 0.0;
+    Log_J[iLane] = log(batch->J_F[iLane]);
+    if (batch->J_F[iLane] != 0.0) {
+      Mu_J[iLane] = batch->Mu[iLane]/batch->J_F[iLane];
+      Lambda_J[iLane] = batch->Lambda[iLane]/batch->J_F[iLane];
+      Mu_p[iLane] = (batch->Mu[iLane] - batch->Lambda[iLane]*Log_J[iLane])/batch->J_F[iLane];
+      Lambda_p[iLane] = batch->Lambda[iLane]/batch->J_F[iLane];
+    }
+  }
+
+  for (iVar = 0; iVar < 3; iVar++) {
+    for (jVar = 0; jVar < 3; jVar++) {
+      dij = (iVar == jVar) ? 1.0 : 0.0;
+      for (iLane = 0; iLane < FEA_BATCH_SIZE; iLane++)
+        batch->Stress[iVar][jVar][iLane] = Mu_J[iLane] * (batch->b[iVar][jVar][iLane] - dij) + Lambda_J[iLane] * Log_J[iLane] * dij;
+    }
+  }
+
+  if (!val_tangent) return;
+
+  for (iVar = 0; iVar < bDim; iVar++) {
+    for (jVar = 0; jVar < bDim; jVar++) {
+      for (iLane = 0; iLane < FEA_BATCH_SIZE; iLane++) {
+        if ((iVar < nDim) && (jVar < nDim))
+          batch->D[iVar][jVar][iLane] = (iVar == jVar) ? Lambda_p[iLane] + 2.0 * Mu_p[iLane] : Lambda_p[iLane];
+        else
+          batch->D[iVar][jVar][iLane] = (iVar == jVar) ? Mu_p[iLane] : 0.0;
+      }
+    }
+  }
+
+}
+
 CFEM_NeoHookean_Incomp::CFEM_NeoHookean_Incomp(unsigned short val_nDim, unsigned short val_nVar,
                                    CConfig *config) : CFEANonlinearElasticity(val_nDim, val_nVar, config) {
 
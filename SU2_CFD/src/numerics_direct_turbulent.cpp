@@ -330,13 +330,15 @@ CSourcePieceWise_TurbSA::~CSourcePieceWise_TurbSA(void) { }
 
 void CSourcePieceWise_TurbSA::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+  /*--- The vorticity always has three components (also in 2D). ---*/
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+6);
+  AD::SetPreaccIn(Vorticity_i, 3);
+  AD::SetPreaccIn(StrainMag_i);
+  AD::SetPreaccIn(TurbVar_i[0]);
+  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
 
 //  BC Transition Model variables
   su2double vmag, rey, re_theta, re_theta_t, re_v;
@@ -472,8 +474,8 @@ void CSourcePieceWise_TurbSA::ComputeResidual(su2double *val_residual, su2double
     
   }
 
-//  AD::SetPreaccOut(val_residual[0]);
-//  AD::EndPreacc();
+  AD::SetPreaccOut(val_residual[0]);
+  AD::EndPreacc();
   
 }
 
@@ -1119,13 +1121,15 @@ CSourcePieceWise_TurbSA_Neg::~CSourcePieceWise_TurbSA_Neg(void) {
 
 void CSourcePieceWise_TurbSA_Neg::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+  /*--- The vorticity always has three components (also in 2D). ---*/
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+6);
+  AD::SetPreaccIn(Vorticity_i, 3);
+  AD::SetPreaccIn(StrainMag_i);
+  AD::SetPreaccIn(TurbVar_i[0]);
+  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
 
   if (incompressible) {
     Density_i = V_i[nDim+2];
@@ -1252,8 +1256,8 @@ void CSourcePieceWise_TurbSA_Neg::ComputeResidual(su2double *val_residual, su2do
     
   }
 
-//  AD::SetPreaccOut(val_residual, nVar);
-//  AD::EndPreacc();
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwSca_TurbSST::CUpwSca_TurbSST(unsigned short val_nDim,
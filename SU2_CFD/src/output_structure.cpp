@@ -6950,6 +6950,14 @@ void COutput::SpecialOutput_ForcesBreakdown(CSolver *****solver, CGeometry ****g
           Breakdown_file << "Critical Pressure (non-dim):   " << config[val_iZone]->GetPressure_Critical() /config[val_iZone]->GetPressure_Ref() << "\n";
           Breakdown_file << "Critical Temperature (non-dim) :  " << config[val_iZone]->GetTemperature_Critical() /config[val_iZone]->GetTemperature_Ref() << "\n";
           break;
+
+        case LUT_GAS:
+          Breakdown_file << "Fluid Model: Look-up table "<< "\n";
+          Breakdown_file << "Look-up table file: " << config[val_iZone]->GetLUT_Filename() << "\n";
+          Breakdown_file << "Specific gas constant: " << config[val_iZone]->GetGas_Constant() << " N.m/kg.K." << "\n";
+          Breakdown_file << "Specific gas constant (non-dim): " << config[val_iZone]->GetGas_ConstantND()<< "\n";
+          Breakdown_file << "Specific Heat Ratio: "<< config[val_iZone]->GetGamma() << "\n";
+          break;
       }
       
       if (viscous) {
@@ -12332,6 +12340,16 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
     compressible = (config[iZone]->GetKind_Regime() == COMPRESSIBLE);
 
+    /*--- The DG-FEM solver can write a checkpoint file directly from the
+     elements in partition order, without the loading and sorting of the
+     data below. It is written under its own name, in addition to the
+     regular output files. ---*/
+
+    if (fem_solver && config[iZone]->GetWrt_Elem_Restart_DG()) {
+      if (rank == MASTER_NODE) cout << "Writing binary DG-FEM element restart file." << endl;
+      WriteRestart_Parallel_Binary_DG(config[iZone], geometry[iZone][iInst][MESH_0], solver_container[iZone][iInst][MESH_0], iZone, iInst);
+    }
+
     /*--- First, prepare the offsets needed throughout below. ---*/
 
     PrepareOffsets(config[iZone], geometry[iZone][iInst][MESH_0]);
@@ -17986,6 +18004,228 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
 
 }
 
+void COutput::WriteRestart_Parallel_Binary_DG(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst) {
+
+  /*--- Local variables ---*/
+
+  unsigned short nZone = geometry->GetnZone(), nInst = config->GetnTimeInstances();
+  unsigned long iExtIter = config->GetExtIter();
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  bool wrt_perf  = config->GetWrt_Performance();
+  string filename;
+  char fname[100];
+  su2double file_size = 0.0, StartTime, StopTime, UsedTime, Bandwidth;
+
+  /*--- Retrieve filename from config and append the zone, instance and
+   iteration number in the same way as for the regular restart files. ---*/
+
+  filename = config->GetRestart_Elem_DGFileName();
+
+  if (nZone > 1)
+    filename= config->GetMultizone_FileName(filename, val_iZone);
+
+  if (nInst > 1)
+    filename= config->GetMultiInstance_FileName(filename, val_iInst);
+
+  if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iInst));
+  } else if (config->GetWrt_Unsteady()) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  }
+
+  strcpy(fname, filename.c_str());
+
+  /*--- Retrieve the locally owned volume elements from the DG geometry and
+   the solution DOFs from the DG solver. ---*/
+
+  CMeshFEM_DG *DGGeometry = dynamic_cast<CMeshFEM_DG *>(geometry);
+
+  const unsigned long nVolElemOwned = DGGeometry->GetNVolElemOwned();
+  const CVolumeElementFEM *volElem  = DGGeometry->GetVolElem();
+
+  const unsigned short nVar = solver[FLOW_SOL]->GetnVar();
+  const su2double *solDOFs  = solver[FLOW_SOL]->GetVecSolDOFs();
+
+  /*--- Prepare the ints of the header. The first is a magic number to
+   identify the element based DG restart files, followed by the number of
+   variables, the number of ranks that wrote the file and the external
+   iteration. ---*/
+
+  int Restart_ExtIter;
+  if (dual_time)
+    Restart_ExtIter= (int)config->GetExtIter() + 1;
+  else
+    Restart_ExtIter = (int)config->GetExtIter() + (int)config->GetExtIter_OffSet() + 1;
+
+  const int var_buf_size = 4;
+  int var_buf[4] = {535533, nVar, size, Restart_ExtIter};
+
+  /*--- Store the global ID and the number of DOFs of the owned elements in
+   partition order. The solution of the elements is stored in the same
+   order, such that a restart on the same partition reads contiguously. ---*/
+
+  vector<unsigned long> elemBuf(2*nVolElemOwned);
+  unsigned long nDOFsLoc = 0;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    elemBuf[2*l]   = volElem[l].elemIDGlobal;
+    elemBuf[2*l+1] = volElem[l].nDOFsSol;
+    nDOFsLoc      += volElem[l].nDOFsSol;
+  }
+
+  vector<passivedouble> solBuf(nVar*nDOFsLoc);
+  unsigned long ii = 0;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const su2double *solElem = solDOFs + nVar*volElem[l].offsetDOFsSolLocal;
+    for(unsigned long i=0; i<(unsigned long)(nVar*volElem[l].nDOFsSol); ++i, ++ii)
+      solBuf[ii] = SU2_TYPE::GetValue(solElem[i]);
+  }
+
+  /*--- Gather the number of elements and DOFs of all ranks. These are
+   written to the header and determine the file offsets of the ranks. ---*/
+
+  unsigned long myInfo[2] = {nVolElemOwned, nDOFsLoc};
+  vector<unsigned long> rankInfo(2*size);
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(myInfo, 2, MPI_UNSIGNED_LONG, rankInfo.data(), 2,
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  rankInfo[0] = myInfo[0]; rankInfo[1] = myInfo[1];
+#endif
+
+  unsigned long nElemGlobal = 0, nElemCum = 0, nDOFsCum = 0;
+  for(int iRank=0; iRank<size; ++iRank) {
+    if(iRank < rank) {
+      nElemCum += rankInfo[2*iRank];
+      nDOFsCum += rankInfo[2*iRank+1];
+    }
+    nElemGlobal += rankInfo[2*iRank];
+  }
+
+  /*--- Set a timer for the binary file writing. ---*/
+
+#ifndef HAVE_MPI
+  StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StartTime = MPI_Wtime();
+#endif
+
+#ifndef HAVE_MPI
+
+  FILE* fhw;
+  fhw = fopen(fname, "wb");
+
+  /*--- Error check for opening the file. ---*/
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- Write the header, the element section and the solution section. ---*/
+
+  fwrite(var_buf, sizeof(int), var_buf_size, fhw);
+  fwrite(rankInfo.data(), sizeof(unsigned long), rankInfo.size(), fhw);
+  fwrite(elemBuf.data(), sizeof(unsigned long), elemBuf.size(), fhw);
+  fwrite(solBuf.data(), sizeof(passivedouble), solBuf.size(), fhw);
+
+  file_size = (su2double)(var_buf_size*sizeof(int) + rankInfo.size()*sizeof(unsigned long) +
+                          elemBuf.size()*sizeof(unsigned long) + solBuf.size()*sizeof(passivedouble));
+
+  /*--- Close the file. ---*/
+
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel binary output using MPI I/O. ---*/
+
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Offset disp;
+  int ierr;
+
+  /*--- All ranks open the file using MPI. An existing file is deleted, such
+   that always a fresh restart file is written. ---*/
+
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname,
+                       MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                       MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS)  {
+    MPI_File_close(&fhw);
+    if (rank == 0)
+      MPI_File_delete(fname, MPI_INFO_NULL);
+    ierr = MPI_File_open(MPI_COMM_WORLD, fname,
+                         MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                         MPI_INFO_NULL, &fhw);
+  }
+
+  /*--- Error check opening the file. ---*/
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- The master rank writes the header, which consists of the ints and
+   the number of elements and DOFs of all ranks. ---*/
+
+  if (rank == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, var_buf, var_buf_size, MPI_INT, MPI_STATUS_IGNORE);
+    disp = var_buf_size*sizeof(int);
+    MPI_File_write_at(fhw, disp, rankInfo.data(), rankInfo.size(),
+                      MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    file_size += (su2double)(var_buf_size*sizeof(int) + rankInfo.size()*sizeof(unsigned long));
+  }
+
+  /*--- Every rank writes its elements and its solution as contiguous
+   chunks at the offsets following from the cumulative counts. ---*/
+
+  const MPI_Offset headerSize = var_buf_size*sizeof(int) + rankInfo.size()*sizeof(unsigned long);
+
+  disp = headerSize + 2*nElemCum*sizeof(unsigned long);
+  MPI_File_write_at_all(fhw, disp, elemBuf.data(), elemBuf.size(),
+                        MPI_UNSIGNED_LONG, &status);
+
+  disp = headerSize + 2*nElemGlobal*sizeof(unsigned long)
+       + nVar*nDOFsCum*sizeof(passivedouble);
+  MPI_File_write_at_all(fhw, disp, solBuf.data(), solBuf.size(), MPI_DOUBLE, &status);
+
+  file_size += (su2double)(elemBuf.size()*sizeof(unsigned long) + solBuf.size()*sizeof(passivedouble));
+
+  /*--- All ranks close the file after writing. ---*/
+
+  MPI_File_close(&fhw);
+
+#endif
+
+  /*--- Compute and store the write time. ---*/
+
+#ifndef HAVE_MPI
+  StopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StopTime = MPI_Wtime();
+#endif
+  UsedTime = StopTime-StartTime;
+
+  /*--- Communicate the total file size for the restart ---*/
+
+#ifdef HAVE_MPI
+  su2double my_file_size = file_size;
+  SU2_MPI::Allreduce(&my_file_size, &file_size, 1,
+                     MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  /*--- Compute and store the bandwidth ---*/
+
+  Bandwidth = file_size/(1.0e6)/UsedTime;
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+Bandwidth);
+
+  if ((rank == MASTER_NODE) && (wrt_perf)) {
+    cout << "Wrote " << file_size/1.0e6 << " MB to disk in ";
+    cout << UsedTime << " s. (" << Bandwidth << " MB/s)." << endl;
+  }
+}
+
 void COutput::WriteCSV_Slice(CConfig *config, CGeometry *geometry,
                              CSolver *FlowSolver, unsigned long iExtIter,
                              unsigned short val_iZone, unsigned short val_direction) {
@@ -258,7 +258,7 @@ unsigned long CDriver::GetNumberHaloVertices(unsigned short iMarker){
 
 }
 
-unsigned long CDriver::GetVertexGlobalIndex(unsigned short iMarker, unsigned short iVertex) {
+unsigned long CDriver::GetVertexGlobalIndex(unsigned short iMarker, unsigned long iVertex) {
 
   unsigned long iPoint, GlobalIndex;
 
@@ -269,7 +269,7 @@ unsigned long CDriver::GetVertexGlobalIndex(unsigned short iMarker, unsigned sho
 
 }
 
-bool CDriver::IsAHaloNode(unsigned short iMarker, unsigned short iVertex) {
+bool CDriver::IsAHaloNode(unsigned short iMarker, unsigned long iVertex) {
 
   unsigned long iPoint;
 
@@ -294,7 +294,7 @@ su2double CDriver::GetUnsteady_TimeStep(){
   return config_container[ZONE_0]->GetDelta_UnstTime();
 }
 
-su2double CDriver::GetVertexCoordX(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexCoordX(unsigned short iMarker, unsigned long iVertex) {
 
   su2double* Coord;
   unsigned long iPoint;
@@ -305,7 +305,7 @@ su2double CDriver::GetVertexCoordX(unsigned short iMarker, unsigned short iVerte
 
 }
 
-su2double CDriver::GetVertexCoordY(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexCoordY(unsigned short iMarker, unsigned long iVertex) {
 
   su2double* Coord;
   unsigned long iPoint;
@@ -315,7 +315,7 @@ su2double CDriver::GetVertexCoordY(unsigned short iMarker, unsigned short iVerte
   return Coord[1];
 }
 
-su2double CDriver::GetVertexCoordZ(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexCoordZ(unsigned short iMarker, unsigned long iVertex) {
 
   su2double* Coord;
   unsigned long iPoint;
@@ -331,7 +331,7 @@ su2double CDriver::GetVertexCoordZ(unsigned short iMarker, unsigned short iVerte
 
 }
 
-bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned short iVertex) {
+bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned long iVertex) {
 
   unsigned long iPoint;
   unsigned short iDim, jDim;
@@ -421,37 +421,37 @@ bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned short iVertex
 
 }
 
-su2double CDriver::GetVertexForceX(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceX(unsigned short iMarker, unsigned long iVertex) {
 
   return PyWrapNodalForce[0];
 
 }
 
-su2double CDriver::GetVertexForceY(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceY(unsigned short iMarker, unsigned long iVertex) {
 
   return PyWrapNodalForce[1];
 
 }
 
-su2double CDriver::GetVertexForceZ(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceZ(unsigned short iMarker, unsigned long iVertex) {
 
   return PyWrapNodalForce[2];
 
 }
 
-su2double CDriver::GetVertexForceDensityX(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceDensityX(unsigned short iMarker, unsigned long iVertex) {
   return PyWrapNodalForceDensity[0];
 }
 
-su2double CDriver::GetVertexForceDensityY(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceDensityY(unsigned short iMarker, unsigned long iVertex) {
   return PyWrapNodalForceDensity[1];
 }
 
-su2double CDriver::GetVertexForceDensityZ(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::GetVertexForceDensityZ(unsigned short iMarker, unsigned long iVertex) {
   return PyWrapNodalForceDensity[2];
 }
 
-void CDriver::SetVertexCoordX(unsigned short iMarker, unsigned short iVertex, su2double newPosX) {
+void CDriver::SetVertexCoordX(unsigned short iMarker, unsigned long iVertex, su2double newPosX) {
 
   unsigned long iPoint;
   su2double *Coord;
@@ -463,7 +463,7 @@ void CDriver::SetVertexCoordX(unsigned short iMarker, unsigned short iVertex, su
 
 }
 
-void CDriver::SetVertexCoordY(unsigned short iMarker, unsigned short iVertex, su2double newPosY) {
+void CDriver::SetVertexCoordY(unsigned short iMarker, unsigned long iVertex, su2double newPosY) {
 
   unsigned long iPoint;
   su2double *Coord;
@@ -474,7 +474,7 @@ void CDriver::SetVertexCoordY(unsigned short iMarker, unsigned short iVertex, su
   PyWrapVarCoord[1] = newPosY - Coord[1];
 }
 
-void CDriver::SetVertexCoordZ(unsigned short iMarker, unsigned short iVertex, su2double newPosZ) {
+void CDriver::SetVertexCoordZ(unsigned short iMarker, unsigned long iVertex, su2double newPosZ) {
 
   unsigned long iPoint;
   su2double *Coord;
@@ -490,7 +490,7 @@ void CDriver::SetVertexCoordZ(unsigned short iMarker, unsigned short iVertex, su
   }
 }
 
-su2double CDriver::SetVertexVarCoord(unsigned short iMarker, unsigned short iVertex) {
+su2double CDriver::SetVertexVarCoord(unsigned short iMarker, unsigned long iVertex) {
 
   su2double nodalVarCoordNorm;
 
@@ -501,7 +501,7 @@ su2double CDriver::SetVertexVarCoord(unsigned short iMarker, unsigned short iVer
 
 }
 
-su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   su2double vertexWallTemp(0.0);
@@ -518,12 +518,12 @@ su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned short i
 
 }
 
-void CDriver::SetVertexTemperature(unsigned short iMarker, unsigned short iVertex, su2double val_WallTemp){
+void CDriver::SetVertexTemperature(unsigned short iMarker, unsigned long iVertex, su2double val_WallTemp){
 
   geometry_container[ZONE_0][INST_0][MESH_0]->SetCustomBoundaryTemperature(iMarker, iVertex, val_WallTemp);
 }
 
-bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned short iVertex){
+bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   unsigned short iDim;
@@ -559,22 +559,22 @@ bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned short iVe
   return halo;
 }
 
-su2double CDriver::GetVertexHeatFluxX(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexHeatFluxX(unsigned short iMarker, unsigned long iVertex){
 
   return PyWrapNodalHeatFlux[0];
 }
 
-su2double CDriver::GetVertexHeatFluxY(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexHeatFluxY(unsigned short iMarker, unsigned long iVertex){
 
   return PyWrapNodalHeatFlux[1];
 }
 
-su2double CDriver::GetVertexHeatFluxZ(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexHeatFluxZ(unsigned short iMarker, unsigned long iVertex){
 
   return PyWrapNodalHeatFlux[2];
 }
 
-su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   unsigned short iDim;
@@ -619,12 +619,12 @@ su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned shor
   return vertexWallHeatFlux;
 }
 
-void CDriver::SetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex, su2double val_WallHeatFlux){
+void CDriver::SetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex, su2double val_WallHeatFlux){
 
   geometry_container[ZONE_0][INST_0][MESH_0]->SetCustomBoundaryHeatFlux(iMarker, iVertex, val_WallHeatFlux);
 }
 
-su2double CDriver::GetThermalConductivity(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetThermalConductivity(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   su2double Prandtl_Lam  = config_container[ZONE_0]->GetPrandtl_Lam();
@@ -642,7 +642,7 @@ su2double CDriver::GetThermalConductivity(unsigned short iMarker, unsigned short
 
 }
 
-vector<su2double> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsigned short iVertex){
+vector<su2double> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsigned long iVertex){
 
   unsigned short iDim;
   su2double *Normal;
@@ -664,6 +664,171 @@ vector<su2double> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsigned
 
 }
 
+unsigned short CDriver::GetnDim(){
+
+  return nDim;
+}
+
+void CDriver::GetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, iPoint, nVertex;
+  unsigned short iDim;
+  su2double *Coord;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex*nDim)
+    SU2_MPI::Error("The size of the array does not match nVertex*nDim of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    Coord  = geometry->node[iPoint]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = Coord[iDim];
+  }
+
+}
+
+void CDriver::SetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, iPoint, nVertex;
+  unsigned short iDim;
+  su2double *Coord, VarCoord[3] = {0.0, 0.0, 0.0};
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex*nDim)
+    SU2_MPI::Error("The size of the array does not match nVertex*nDim of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    Coord  = geometry->node[iPoint]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++)
+      VarCoord[iDim] = values[iVertex*nDim+iDim] - Coord[iDim];
+    geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+
+}
+
+void CDriver::GetMarkerDisplacements(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+  unsigned short iDim;
+  su2double *VarCoord;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex*nDim)
+    SU2_MPI::Error("The size of the array does not match nVertex*nDim of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+    for (iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = VarCoord[iDim];
+  }
+
+}
+
+void CDriver::SetMarkerDisplacements(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+  unsigned short iDim;
+  su2double VarCoord[3] = {0.0, 0.0, 0.0};
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex*nDim)
+    SU2_MPI::Error("The size of the array does not match nVertex*nDim of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      VarCoord[iDim] = values[iVertex*nDim+iDim];
+    geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+
+}
+
+void CDriver::GetMarkerForces(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+  unsigned short iDim;
+  bool halo;
+
+  nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex*nDim)
+    SU2_MPI::Error("The size of the array does not match nVertex*nDim of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    halo = ComputeVertexForces(iMarker, iVertex);
+    for (iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = halo? 0.0 : PyWrapNodalForce[iDim];
+  }
+
+}
+
+void CDriver::GetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+
+  nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex)
+    SU2_MPI::Error("The size of the array does not match nVertex of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexTemperature(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex)
+    SU2_MPI::Error("The size of the array does not match nVertex of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    geometry->SetCustomBoundaryTemperature(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::GetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+
+  nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex)
+    SU2_MPI::Error("The size of the array does not match nVertex of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexNormalHeatFlux(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues){
+
+  unsigned long iVertex, nVertex;
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  nVertex = geometry->nVertex[iMarker];
+
+  if ((unsigned long)(nValues) != nVertex)
+    SU2_MPI::Error("The size of the array does not match nVertex of the marker.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex, values[iVertex]);
+
+}
+
 vector<string> CDriver::GetAllBoundaryMarkersTag(){
 
   vector<string> boundariesTagList;
@@ -946,25 +1111,25 @@ void CFluidDriver::SetInitialMesh() {
   //}
 }
 
-void CFluidDriver::SetVertexTtotal(unsigned short iMarker, unsigned short iVertex, su2double val_Ttotal){
+void CFluidDriver::SetVertexTtotal(unsigned short iMarker, unsigned long iVertex, su2double val_Ttotal){
 
   solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->SetInlet_Ttotal(iMarker, iVertex, val_Ttotal);
 
 }
 
-void CFluidDriver::SetVertexPtotal(unsigned short iMarker, unsigned short iVertex, su2double val_Ptotal){
+void CFluidDriver::SetVertexPtotal(unsigned short iMarker, unsigned long iVertex, su2double val_Ptotal){
 
   solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->SetInlet_Ptotal(iMarker, iVertex, val_Ptotal);
 
 }
 
-void CFluidDriver::SetVertexFlowDir(unsigned short iMarker, unsigned short iVertex, unsigned short iDim, su2double val_FlowDir){
+void CFluidDriver::SetVertexFlowDir(unsigned short iMarker, unsigned long iVertex, unsigned short iDim, su2double val_FlowDir){
 
   solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->SetInlet_FlowDir(iMarker, iVertex, iDim, val_FlowDir);
 
 }
 
-void CFluidDriver::SetVertexTurbVar(unsigned short iMarker, unsigned short iVertex, unsigned short iDim, su2double val_turb_var){
+void CFluidDriver::SetVertexTurbVar(unsigned short iMarker, unsigned long iVertex, unsigned short iDim, su2double val_turb_var){
 
   if (solver_container[ZONE_0][INST_0] == NULL ||
       solver_container[ZONE_0][INST_0][MESH_0] ==  NULL) {
@@ -39,10 +39,20 @@
 
 CDiscAdjSolver::CDiscAdjSolver(void) : CSolver () {
 
+  Jacobian_Prec = false;
+  Prec_MatVec   = NULL;
+  Prec_Precond  = NULL;
+  Prec_Solver   = NULL;
+
 }
 
 CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config)  : CSolver() {
 
+  Jacobian_Prec = false;
+  Prec_MatVec   = NULL;
+  Prec_Precond  = NULL;
+  Prec_Solver   = NULL;
+
 }
 
 CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *direct_solver, unsigned short Kind_Solver, unsigned short iMesh)  : CSolver() {
@@ -60,6 +70,10 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
 
   CSensitivity = NULL;
 
+  Prec_MatVec  = NULL;
+  Prec_Precond = NULL;
+  Prec_Solver  = NULL;
+
   /*-- Store some information about direct solver ---*/
   this->KindDirect_Solver = Kind_Solver;
   this->direct_solver = direct_solver;
@@ -135,6 +149,16 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CDiscAdjVariable(Solution, nDim, nVar, config);
 
+  /*--- Vectors for the correction of the update with the primal Jacobian (only the flow solver on the finest grid). ---*/
+
+  Jacobian_Prec = (config->GetJacobian_Prec_Disc() && (Kind_Solver == RUNTIME_FLOW_SYS) && (iMesh == MESH_0));
+
+  if (Jacobian_Prec) {
+    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    LinSysAux.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
 }
 
 CDiscAdjSolver::~CDiscAdjSolver(void) { 
@@ -148,6 +172,10 @@ CDiscAdjSolver::~CDiscAdjSolver(void) {
     delete [] CSensitivity;
   }
 
+  if (Prec_MatVec  != NULL) delete Prec_MatVec;
+  if (Prec_Precond != NULL) delete Prec_Precond;
+  if (Prec_Solver  != NULL) delete Prec_Solver;
+
 }
 
 void CDiscAdjSolver::SetRecording(CGeometry* geometry, CConfig *config){
@@ -527,6 +555,225 @@ void CDiscAdjSolver::ExtractAdjoint_Solution(CGeometry *geometry, CConfig *confi
   }
 
   SetResidual_RMS(geometry, config);
+
+  /*--- Accelerate the fixed-point iteration using the primal Jacobian. The residuals
+   above are still the ones of the plain tape evaluation. ---*/
+
+  if (Jacobian_Prec) Precondition_AdjointUpdate(geometry, config);
+
+}
+
+void CDiscAdjSolver::Precondition_AdjointUpdate(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iVar, iTerm;
+  unsigned long iPoint, total_index;
+  su2double Delta, Residual;
+
+  su2double omega         = config->GetRelaxation_Factor_Flow();
+  unsigned short nTerms   = config->GetnJacobian_Prec_Disc();
+  unsigned long MaxIter   = config->GetLinear_Solver_Iter();
+  su2double SolverTol     = config->GetLinear_Solver_Error();
+
+  /*--- The transposed preconditioner of the primal Jacobian was built when the
+   linear solver of the primal iteration was recorded (see CSysSolve::SetExternalSolve). ---*/
+
+  CSysMatrix &Jacobian_Direct = direct_solver->Jacobian;
+
+  /*--- The matrix-vector product, the preconditioner and the linear solver only
+   refer to the primal Jacobian, hence they are built once, in the first call. ---*/
+
+  if (Prec_MatVec == NULL) {
+
+    Prec_MatVec = new CSysMatrixVectorProductTransposed(Jacobian_Direct, geometry, config);
+
+    switch(config->GetKind_DiscAdj_Linear_Prec()) {
+      case ILU:
+        Prec_Precond = new CILUPreconditioner(Jacobian_Direct, geometry, config);
+        break;
+      case JACOBI:
+        Prec_Precond = new CJacobiPreconditioner(Jacobian_Direct, geometry, config);
+        break;
+      default:
+        SU2_MPI::Error("The specified preconditioner is not yet implemented for the discrete adjoint method.", CURRENT_FUNCTION);
+        break;
+    }
+
+    Prec_Solver = new CSysSolve;
+  }
+
+  /*--- The first term of the series is the fixed-point residual r = Psi_tape - Psi_old,
+   it is stored in LinSysRes while LinSysAux accumulates the update. ---*/
+
+  LinSysRes.SetValZero();
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      LinSysRes[total_index] = node[iPoint]->GetSolution(iVar) - node[iPoint]->GetSolution_Old(iVar);
+    }
+  }
+  LinSysAux = LinSysRes;
+
+  /*--- Following terms, A^k r, with A = (1-omega) I + omega (V/dt) P^-T. ---*/
+
+  for (iTerm = 0; iTerm < nTerms; iTerm++) {
+
+    LinSysSol.SetValZero();
+
+    switch(config->GetKind_DiscAdj_Linear_Solver()) {
+      case FGMRES:
+        Prec_Solver->FGMRES_LinSolver(LinSysRes, LinSysSol, *Prec_MatVec, *Prec_Precond, SolverTol, MaxIter, &Residual, false);
+        break;
+      case BCGSTAB:
+        Prec_Solver->BCGSTAB_LinSolver(LinSysRes, LinSysSol, *Prec_MatVec, *Prec_Precond, SolverTol, MaxIter, &Residual, false);
+        break;
+      case CONJUGATE_GRADIENT:
+        Prec_Solver->CG_LinSolver(LinSysRes, LinSysSol, *Prec_MatVec, *Prec_Precond, SolverTol, MaxIter, &Residual, false);
+        break;
+    }
+
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (direct_solver->node[iPoint]->GetDelta_Time() != 0.0)
+        Delta = geometry->node[iPoint]->GetVolume() / direct_solver->node[iPoint]->GetDelta_Time();
+      else
+        Delta = 0.0;
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        LinSysRes[total_index] = (1.0-omega)*LinSysRes[total_index] + omega*Delta*LinSysSol[total_index];
+        LinSysAux[total_index] += LinSysRes[total_index];
+      }
+    }
+
+  }
+
+  /*--- Update the adjoint solution of the owned points. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Solution[iVar] = node[iPoint]->GetSolution_Old(iVar) + LinSysAux[iPoint*nVar+iVar];
+    }
+    node[iPoint]->SetSolution(Solution);
+  }
+
+  /*--- The halo points still hold the plain tape values, communicate the update. ---*/
+
+  Set_MPI_Solution(geometry, config);
+
+}
+
+void CDiscAdjSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
+  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  SU2_MPI::Status status;
+#endif
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      
+#ifdef HAVE_MPI
+      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+#endif
+      
+      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
+      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
+      
+      /*--- Allocate Receive and send buffers  ---*/
+      Buffer_Receive_U = new su2double [nBufferR_Vector];
+      Buffer_Send_U = new su2double[nBufferS_Vector];
+      
+      /*--- Copy the solution that should be sended ---*/
+      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        for (iVar = 0; iVar < nVar; iVar++)
+          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
+      }
+      
+#ifdef HAVE_MPI
+      
+      /*--- Send/Receive information using Sendrecv ---*/
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      
+#else
+      
+      /*--- Receive information without MPI ---*/
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        for (iVar = 0; iVar < nVar; iVar++)
+          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
+      }
+      
+#endif
+      
+      /*--- Deallocate send buffer ---*/
+      delete [] Buffer_Send_U;
+      
+      /*--- Do the coordinate transformation ---*/
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        
+        /*--- Find point and its type of transformation ---*/
+        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
+        
+        /*--- Retrieve the supplied periodic information. ---*/
+        angles = config->GetPeriodicRotation(iPeriodic_Index);
+        
+        /*--- Store angles separately for clarity. ---*/
+        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+        
+        /*--- Compute the rotation matrix. Note that the implicit
+         ordering is rotation about the x-axis, y-axis,
+         then z-axis. Note that this is the transpose of the matrix
+         used during the preprocessing stage. ---*/
+        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+        
+        /*--- Copy conserved variables before performing transformation. ---*/
+        for (iVar = 0; iVar < nVar; iVar++)
+          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
+        
+        /*--- Rotate the adjoint momentum components (flow adjoint only). ---*/
+        if ((KindDirect_Solver == RUNTIME_FLOW_SYS) && (nDim == 2)) {
+          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
+          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
+          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
+          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
+        }
+        else if (KindDirect_Solver == RUNTIME_FLOW_SYS) {
+          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
+          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
+          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
+          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
+          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
+          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
+          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
+          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
+          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
+        }
+        
+        /*--- Copy transformed conserved variables back into buffer. ---*/
+        for (iVar = 0; iVar < nVar; iVar++)
+          node[iPoint]->SetSolution(iVar, Solution[iVar]);
+        
+      }
+      
+      /*--- Deallocate receive buffer ---*/
+      delete [] Buffer_Receive_U;
+      
+    }
+    
+  }
+  
 }
 
 void CDiscAdjSolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *config) {
@@ -58,6 +58,15 @@ CFEASolver::CFEASolver(void) : CSolver() {
   node = NULL;
   
   element_properties = NULL;
+
+  stiffness_cache = false;
+  stiffness_stored = false;
+  stiffness_assembled = false;
+  stiffness_changed = false;
+  prec_built = false;
+  
+  Elem_Batch = NULL;
+  
   elProperties = NULL;
   
   GradN_X = NULL;
@@ -112,6 +121,19 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   
   element_based = false;          // A priori we don't have an element-based input file (most of the applications will be like this)
   
+  /*--- The element stiffness of linear problems can be stored and reused (not while recording the adjoint) ---*/
+  stiffness_cache = (config->GetCache_Elem_Stiffness() && !nonlinear_analysis && !config->GetDiscrete_Adjoint());
+  stiffness_stored = false;
+  stiffness_assembled = false;
+  stiffness_changed = false;
+  prec_built = false;
+  
+  /*--- Nonlinear elements are evaluated in batches, except for the mixed formulations and the
+   dielectric effects, and while recording the adjoint (the element preaccumulation needs one element at a time) ---*/
+  Elem_Batch = NULL;
+  if (nonlinear_analysis && !incompressible && !de_effects && !config->GetDiscrete_Adjoint())
+    Elem_Batch = new CFEABatch();
+  
   nElement      = geometry->GetnElem();
   nDim          = geometry->GetnDim();
   nMarker       = geometry->GetnMarker();
@@ -516,6 +538,8 @@ CFEASolver::~CFEASolver(void) {
   delete [] stressTensor;
   
   if (iElem_iDe != NULL) delete [] iElem_iDe;
+  
+  if (Elem_Batch != NULL) delete Elem_Batch;
 }
 
 void CFEASolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
@@ -1594,6 +1618,21 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_conta
   su2double simp_exponent = config->GetSIMP_Exponent();
   su2double simp_minstiff = config->GetSIMP_MinStiffness();
   
+  /*--- The element stiffness of a linear problem does not change, once it has
+   been stored the matrix is assembled directly from the element blocks. ---*/
+  
+  if (stiffness_cache && stiffness_stored) {
+    Compute_StiffMatrix_Cached(geometry, config);
+    return;
+  }
+  
+  if (stiffness_cache) {
+    Elem_Stiffness.clear();
+    Elem_Stiffness_Offset.assign(geometry->GetnElem()+1, 0);
+    Elem_Stiffness_nNodes.assign(geometry->GetnElem(), 0);
+    Elem_Penalty.assign(geometry->GetnElem(), 1.0);
+  }
+  
   /*--- Loops over all the elements ---*/
   
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
@@ -1638,6 +1677,20 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_conta
     
     NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
     
+    /*--- Store the upper triangular blocks of the (unpenalized) element stiffness ---*/
+    
+    if (stiffness_cache) {
+      Elem_Stiffness_nNodes[iElem] = NelNodes;
+      Elem_Penalty[iElem] = simp_penalty;
+      for (iNode = 0; iNode < NelNodes; iNode++) {
+        for (jNode = iNode; jNode < NelNodes; jNode++) {
+          Kab = element_container[FEA_TERM][EL_KIND]->Get_Kab(iNode, jNode);
+          Elem_Stiffness.insert(Elem_Stiffness.end(), Kab, Kab+nVar*nVar);
+        }
+      }
+      Elem_Stiffness_Offset[iElem+1] = Elem_Stiffness.size();
+    }
+    
     for (iNode = 0; iNode < NelNodes; iNode++) {
       
       Ta = element_container[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
@@ -1662,6 +1715,90 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_conta
     
   }
   
+  if (stiffness_cache) {
+    stiffness_stored = true;
+    stiffness_assembled = true;
+    stiffness_changed = true;
+  }
+  
+}
+
+void CFEASolver::Compute_StiffMatrix_Cached(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iElem, iVar, jVar, iBlock;
+  unsigned short iNode, jNode, iDim, NelNodes;
+  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
+  su2double val_Coord, val_Sol, res_aux;
+  su2double Disp[8][3];
+  su2double *Kab = NULL;
+  bool transposed;
+  
+  bool topology_mode = config->GetTopology_Optimization();
+  su2double simp_exponent = config->GetSIMP_Exponent();
+  su2double simp_minstiff = config->GetSIMP_MinStiffness();
+  
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    
+    NelNodes = Elem_Stiffness_nNodes[iElem];
+    
+    /*--- Displacements of the nodes, computed as in the element (current minus reference coordinates) ---*/
+    
+    for (iNode = 0; iNode < NelNodes; iNode++) {
+      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
+        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
+        Disp[iNode][iDim] = val_Sol - val_Coord;
+      }
+    }
+    
+    /*--- Only the penalty of the elements changes (e.g. density updates in topology optimization) ---*/
+    
+    su2double simp_penalty = 1.0;
+    if (topology_mode) {
+      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
+    }
+    if (simp_penalty != Elem_Penalty[iElem]) {
+      Elem_Penalty[iElem] = simp_penalty;
+      stiffness_changed = true;
+    }
+    
+    for (iNode = 0; iNode < NelNodes; iNode++) {
+      
+      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = 0.0;
+      
+      for (jNode = 0; jNode < NelNodes; jNode++) {
+        
+        /*--- Block ab of the upper triangle, or the transpose of block ba ---*/
+        
+        transposed = (jNode < iNode);
+        if (!transposed) iBlock = iNode*NelNodes - (iNode*(iNode-1))/2 + (jNode-iNode);
+        else             iBlock = jNode*NelNodes - (jNode*(jNode-1))/2 + (iNode-jNode);
+        Kab = &Elem_Stiffness[Elem_Stiffness_Offset[iElem] + iBlock*nVar*nVar];
+        
+        for (iVar = 0; iVar < nVar; iVar++) {
+          res_aux = 0.0;
+          for (jVar = 0; jVar < nVar; jVar++) {
+            if (!transposed) Jacobian_ij[iVar][jVar] = Kab[iVar*nVar+jVar];
+            else             Jacobian_ij[iVar][jVar] = Kab[jVar*nVar+iVar];
+            res_aux += Jacobian_ij[iVar][jVar]*Disp[jNode][jVar];
+            Jacobian_ij[iVar][jVar] *= simp_penalty;
+          }
+          Res_Stress_i[iVar] += res_aux;
+        }
+        
+        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
+      }
+      
+      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] *= simp_penalty;
+      
+      LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
+      
+    }
+    
+  }
+  
+  stiffness_assembled = true;
   
 }
 
@@ -1692,6 +1829,11 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CSolver
   su2double simp_exponent = config->GetSIMP_Exponent();
   su2double simp_minstiff = config->GetSIMP_MinStiffness();
   
+  if (Elem_Batch != NULL) {
+    Compute_NodalStressRes_Batch(geometry, numerics, true, config);
+    return;
+  }
+  
   /*--- Loops over all the elements ---*/
   
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
@@ -1813,6 +1955,142 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CSolver
   
 }
 
+void CFEASolver::Compute_NodalStressRes_Batch(CGeometry *geometry, CNumerics **numerics, bool val_tangent, CConfig *config) {
+  
+  unsigned long iElem;
+  unsigned short iNode, iDim, nNodes = 0;
+  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
+  su2double val_Coord, val_Sol, val_Ref = 0.0;
+  int EL_KIND = 0, Batch_KIND = -1;
+  
+  CNumerics *el_numerics = NULL, *batch_numerics = NULL;
+  CElement *element = NULL;
+  
+  bool prestretch_fem = config->GetPrestretch();
+  
+  bool topology_mode = config->GetTopology_Optimization();
+  su2double simp_exponent = config->GetSIMP_Exponent();
+  su2double simp_minstiff = config->GetSIMP_MinStiffness();
+  
+  Elem_Batch->nLanes = 0;
+  
+  /*--- Loops over all the elements, the batch is evaluated when it is full or when the kind
+   of element (or its material) changes, so the contributions are added in the element order ---*/
+  
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    
+    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
+    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
+    
+    if (element_based) el_numerics = numerics[element_properties[iElem]->GetMat_Mod()];
+    else el_numerics = numerics[FEA_TERM];
+    
+    if ((Elem_Batch->nLanes > 0) && ((EL_KIND != Batch_KIND) || (el_numerics != batch_numerics)))
+      Assemble_Element_Batch(geometry, batch_numerics, element, val_tangent, config);
+    
+    element = element_container[FEA_TERM][EL_KIND];
+    
+    /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
+    
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
+        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
+        element->SetCurr_Coord(val_Sol, iNode, iDim);
+        if (prestretch_fem) {
+          val_Ref = node[indexNode[iNode]]->GetPrestretch(iDim);
+          element->SetRef_Coord(val_Ref, iNode, iDim);
+        }
+        else {
+          element->SetRef_Coord(val_Coord, iNode, iDim);
+        }
+      }
+    }
+    
+    /*--- In topology mode determine the penalty to apply to the stiffness ---*/
+    su2double simp_penalty = 1.0;
+    if (topology_mode) {
+      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
+    }
+    
+    /*--- Set the properties of the element and store it in the batch ---*/
+    element->Set_ElProperties(element_properties[iElem]);
+    
+    el_numerics->Set_Element_Batch(element, Elem_Batch, Elem_Batch->nLanes, config);
+    Elem_Batch->iElem[Elem_Batch->nLanes] = iElem;
+    Elem_Batch->Penalty[Elem_Batch->nLanes] = simp_penalty;
+    Elem_Batch->nLanes++;
+    
+    Batch_KIND = EL_KIND;
+    batch_numerics = el_numerics;
+    
+    if (Elem_Batch->nLanes == FEA_BATCH_SIZE)
+      Assemble_Element_Batch(geometry, batch_numerics, element, val_tangent, config);
+    
+  }
+  
+  if (Elem_Batch->nLanes > 0)
+    Assemble_Element_Batch(geometry, batch_numerics, element, val_tangent, config);
+  
+}
+
+void CFEASolver::Assemble_Element_Batch(CGeometry *geometry, CNumerics *numerics, CElement *element, bool val_tangent, CConfig *config) {
+  
+  unsigned long iElem, iVar, jVar;
+  unsigned short iLane, iNode, jNode, NelNodes;
+  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
+  su2double simp_penalty;
+  
+  /*--- Compute the components of the Jacobian and the stress term for all the elements of the batch ---*/
+  
+  if (val_tangent) numerics->Compute_Tangent_Matrix_Batch(element, Elem_Batch, config);
+  else numerics->Compute_NodalStress_Term_Batch(element, Elem_Batch, config);
+  
+  NelNodes = Elem_Batch->nNodes;
+  
+  for (iLane = 0; iLane < Elem_Batch->nLanes; iLane++) {
+    
+    iElem = Elem_Batch->iElem[iLane];
+    simp_penalty = Elem_Batch->Penalty[iLane];
+    
+    for (iNode = 0; iNode < NelNodes; iNode++)
+      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+    
+    for (iNode = 0; iNode < NelNodes; iNode++) {
+      
+      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Elem_Batch->Kt_a[iNode][iVar][iLane];
+      
+      LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
+      
+      if (!val_tangent) continue;
+      
+      for (jNode = 0; jNode < NelNodes; jNode++) {
+        
+        for (iVar = 0; iVar < nVar; iVar++) {
+          Jacobian_s_ij[iVar][iVar] = simp_penalty*Elem_Batch->Ks_ab[iNode][jNode][iLane];
+          for (jVar = 0; jVar < nVar; jVar++) {
+            Jacobian_c_ij[iVar][jVar] = simp_penalty*Elem_Batch->Kab[iNode][jNode][iVar][jVar][iLane];
+          }
+        }
+        
+        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_c_ij);
+        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s_ij);
+        
+      }
+      
+    }
+    
+  }
+  
+  Elem_Batch->nLanes = 0;
+  
+}
+
 void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
   
   unsigned long iElem, iVar;
@@ -1976,6 +2254,11 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CSolver **solver_co
   su2double simp_exponent = config->GetSIMP_Exponent();
   su2double simp_minstiff = config->GetSIMP_MinStiffness();
   
+  if (Elem_Batch != NULL) {
+    Compute_NodalStressRes_Batch(geometry, numerics, false, config);
+    return;
+  }
+  
   /*--- Loops over all the elements ---*/
   
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
@@ -4233,8 +4516,17 @@ void CFEASolver::Solve_System(CGeometry *geometry, CSolver **solver_container, C
     
   }
   
+  /*--- If the matrix was assembled from unchanged element stiffness, the
+   preconditioner built in a previous call is still valid. ---*/
+  
+  bool reuse_prec = (stiffness_assembled && !stiffness_changed && prec_built);
+  
   CSysSolve femSystem;
-  IterLinSol = femSystem.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  IterLinSol = femSystem.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config, reuse_prec);
+  
+  prec_built = stiffness_assembled;
+  stiffness_assembled = false;
+  stiffness_changed = false;
   
   /*--- The the number of iterations of the linear solver ---*/
   
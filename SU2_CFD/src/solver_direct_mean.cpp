@@ -3607,6 +3607,21 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
       }
       break;
 
+    case LUT_GAS:
+
+      FluidModel = new CLookUpTable(config, true);
+      if (free_stream_temp) {
+        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = FluidModel->GetDensity();
+        config->SetDensity_FreeStream(Density_FreeStream);
+      }
+      else {
+        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = FluidModel->GetTemperature();
+        config->SetTemperature_FreeStream(Temperature_FreeStream);
+      }
+      break;
+
   }
 
   Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
@@ -3800,6 +3815,11 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
       FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
       break;
       
+    case LUT_GAS:
+      FluidModel = new CLookUpTable(config, false);
+      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+      break;
+      
   }
   
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
@@ -3948,6 +3968,9 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
     case PR_GAS:
       ModelTable << "PR_GAS";
       break;
+    case LUT_GAS:
+      ModelTable << "LUT_GAS";
+      break;
     }
  
     if (config->GetKind_FluidModel() == VW_GAS || config->GetKind_FluidModel() == PR_GAS){
@@ -4340,26 +4363,61 @@ void CEulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_containe
 
 unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
   
-  unsigned long iPoint, ErrorCounter = 0;
+  const unsigned long nPointBatch = 128;
+  unsigned long iPoint, iBatch, nBatch, jPoint, ErrorCounter = 0;
   bool RightSol = true;
   
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    
-    /*--- Initialize the non-physical points vector ---*/
-    
-    node[iPoint]->SetNon_Physical(false);
-    
-    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+  su2double Density[nPointBatch], StaticEnergy[nPointBatch], Pressure[nPointBatch], Temperature[nPointBatch],
+  SoundSpeed2[nPointBatch], dPdrho_e[nPointBatch], dPde_rho[nPointBatch], dTdrho_e[nPointBatch],
+  dTde_rho[nPointBatch], Cp[nPointBatch];
+  
+  /*--- The thermodynamic state is evaluated by the fluid model for batches
+   of points, instead of one virtual call per point. ---*/
+  
+  for (jPoint = 0; jPoint < nPoint; jPoint += nPointBatch) {
     
-    RightSol = node[iPoint]->SetPrimVar(FluidModel);
-    node[iPoint]->SetSecondaryVar(FluidModel);
-
-    if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+    nBatch = min(nPointBatch, nPoint-jPoint);
     
-    /*--- Initialize the convective, source and viscous residual vector ---*/
+    for (iBatch = 0; iBatch < nBatch; iBatch++) {
+      iPoint = jPoint+iBatch;
+      node[iPoint]->SetVelocity();   // Computes velocity and velocity^2
+      Density[iBatch]      = node[iPoint]->GetDensity();
+      StaticEnergy[iBatch] = node[iPoint]->GetEnergy()-0.5*node[iPoint]->GetVelocity2();
+    }
     
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+    FluidModel->SetTDState_rhoe_Batch(nBatch, Density, StaticEnergy, Pressure, Temperature, SoundSpeed2,
+                                      dPdrho_e, dPde_rho, dTdrho_e, dTde_rho, Cp);
     
+    for (iBatch = 0; iBatch < nBatch; iBatch++) {
+      iPoint = jPoint+iBatch;
+      
+      /*--- Initialize the non-physical points vector ---*/
+      
+      node[iPoint]->SetNon_Physical(false);
+      
+      /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+      
+      RightSol = node[iPoint]->SetPrimVar_TDState(Pressure[iBatch], SoundSpeed2[iBatch], Temperature[iBatch]);
+      
+      if (RightSol) {
+        node[iPoint]->SetSecondaryVar_TDState(dPdrho_e[iBatch], dPde_rho[iBatch], dTdrho_e[iBatch], dTde_rho[iBatch],
+                                              0.0, 0.0, 0.0, 0.0);
+      }
+      else {
+        
+        /*--- Non-physical state, the point-wise update reverts to the old solution. ---*/
+        
+        RightSol = node[iPoint]->SetPrimVar(FluidModel);
+        node[iPoint]->SetSecondaryVar(FluidModel);
+      }
+      
+      if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+      
+      /*--- Initialize the convective, source and viscous residual vector ---*/
+      
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+      
+    }
   }
   
   return ErrorCounter;
@@ -6800,7 +6858,10 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
       AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
       AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-      AD::SetPreaccIn(eps2);
+      if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+        AD::SetPreaccIn(GlobalMinPrimitive, nPrimVarGrad);
+        AD::SetPreaccIn(GlobalMaxPrimitive, nPrimVarGrad);
+      }
 
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         
@@ -9094,7 +9155,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   su2double SoundSpeed_Bound, Entropy_Bound, Vel2_Bound, Vn_Bound;
   su2double SoundSpeed_Infty, Entropy_Infty, Vel2_Infty, Vn_Infty, Qn_Infty;
   su2double RiemannPlus, RiemannMinus;
-  su2double *V_infty, *V_domain;
+  su2double *V_infty, *V_domain, Tke_Infty = 0.0;
   
   su2double Gas_Constant     = config->GetGas_ConstantND();
   
@@ -9132,6 +9193,25 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       /*--- Retrieve solution at the farfield boundary node ---*/
       V_domain = node[iPoint]->GetPrimitive();
 
+      /*--- The reconstruction of the boundary state below only depends on
+         the normal, the domain state and the freestream state, hence it is
+         preaccumulated. The tke is copied before the start of the section
+         so that it enters as an input. ---*/
+
+      if (tkeNeeded) Tke_Infty = GetTke_Inf();
+
+      AD::StartPreacc();
+      AD::SetPreaccIn(Normal, nDim);
+      AD::SetPreaccIn(V_domain, nDim+3);
+      AD::SetPreaccIn(Density_Inf); AD::SetPreaccIn(Pressure_Inf);
+      AD::SetPreaccIn(Velocity_Inf, nDim);
+      if (grid_movement) {
+        AD::SetPreaccIn(geometry->node[iPoint]->GetGridVel(), nDim);
+      }
+      if (tkeNeeded) {
+        AD::SetPreaccIn(Tke_Infty);
+      }
+
       /*--- Construct solution state at infinity for compressible flow by
          using Riemann invariants, and then impose a weak boundary condition
          by computing the flux using this new state for U. See CFD texts by
@@ -9161,7 +9241,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
         Vel2_Bound     += Vel_Bound[iDim]*Vel_Bound[iDim];
         Vn_Bound       += Vel_Bound[iDim]*UnitNormal[iDim];
       }
-      Pressure_Bound   = node[iPoint]->GetPressure();
+      Pressure_Bound   = V_domain[nDim+1];
       SoundSpeed_Bound = sqrt(Gamma*Pressure_Bound/Density_Bound);
       Entropy_Bound    = pow(Density_Bound, Gamma)/Pressure_Bound;
 
@@ -9255,7 +9335,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       }
       Pressure = Density*SoundSpeed*SoundSpeed/Gamma;
       Energy   = Pressure/(Gamma_Minus_One*Density) + 0.5*Velocity2;
-      if (tkeNeeded) Energy += GetTke_Inf();
+      if (tkeNeeded) Energy += Tke_Infty;
 
       /*--- Store new primitive state for computing the flux. ---*/
 
@@ -9266,6 +9346,8 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       V_infty[nDim+2] = Density;
       V_infty[nDim+3] = Energy + Pressure/Density;
 
+      AD::SetPreaccOut(V_infty, nDim+4);
+      AD::EndPreacc();
 
       
       /*--- Set various quantities in the numerics class ---*/
@@ -15817,45 +15899,90 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
 unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
   
-  unsigned long iPoint, ErrorCounter = 0;
+  const unsigned long nPointBatch = 128;
+  unsigned long iPoint, iBatch, nBatch, jPoint, ErrorCounter = 0;
   su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
   unsigned short turb_model = config->GetKind_Turb_Model();
   bool RightSol = true;
   
   bool tkeNeeded            = (turb_model == SST);
-
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  
+  su2double Density[nPointBatch], StaticEnergy[nPointBatch], Pressure[nPointBatch], Temperature[nPointBatch],
+  SoundSpeed2[nPointBatch], dPdrho_e[nPointBatch], dPde_rho[nPointBatch], dTdrho_e[nPointBatch],
+  dTde_rho[nPointBatch], Cp[nPointBatch], LaminarViscosity[nPointBatch], dmudrho_T[nPointBatch],
+  dmudT_rho[nPointBatch], ThermalConductivity[nPointBatch], dktdrho_T[nPointBatch], dktdT_rho[nPointBatch];
+  
+  /*--- The thermodynamic and transport properties are evaluated by the fluid
+   model for batches of points, instead of one virtual call per point. ---*/
+  
+  for (jPoint = 0; jPoint < nPoint; jPoint += nPointBatch) {
     
-    /*--- Retrieve the value of the kinetic energy (if need it) ---*/
+    nBatch = min(nPointBatch, nPoint-jPoint);
     
-    if (turb_model != NONE) {
-      eddy_visc = solver_container[TURB_SOL]->node[iPoint]->GetmuT();
+    for (iBatch = 0; iBatch < nBatch; iBatch++) {
+      iPoint = jPoint+iBatch;
+      
+      /*--- Retrieve the value of the kinetic energy (if need it) ---*/
+      
       if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->node[iPoint]->GetSolution(0);
       
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES){
-        DES_LengthScale = solver_container[TURB_SOL]->node[iPoint]->GetDES_LengthScale();
-      }
+      node[iPoint]->SetVelocity(); // Computes velocity and velocity^2
+      Density[iBatch]      = node[iPoint]->GetDensity();
+      StaticEnergy[iBatch] = node[iPoint]->GetEnergy()-0.5*node[iPoint]->GetVelocity2() - turb_ke;
     }
     
-    /*--- Initialize the non-physical points vector ---*/
-    
-    node[iPoint]->SetNon_Physical(false);
+    FluidModel->SetTDState_rhoe_Batch(nBatch, Density, StaticEnergy, Pressure, Temperature, SoundSpeed2,
+                                      dPdrho_e, dPde_rho, dTdrho_e, dTde_rho, Cp);
     
-    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+    FluidModel->SetTransport_Batch(nBatch, Temperature, Density, Cp, LaminarViscosity, dmudrho_T, dmudT_rho,
+                                   ThermalConductivity, dktdrho_T, dktdT_rho);
     
-    RightSol = node[iPoint]->SetPrimVar(eddy_visc, turb_ke, FluidModel);
-    node[iPoint]->SetSecondaryVar(FluidModel);
-
-    if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+    for (iBatch = 0; iBatch < nBatch; iBatch++) {
+      iPoint = jPoint+iBatch;
+      
+      /*--- Retrieve the value of the eddy viscosity and kinetic energy (if need it) ---*/
+      
+      if (turb_model != NONE) {
+        eddy_visc = solver_container[TURB_SOL]->node[iPoint]->GetmuT();
+        if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->node[iPoint]->GetSolution(0);
         
-    /*--- Set the DES length scale ---*/
-    
-    node[iPoint]->SetDES_LengthScale(DES_LengthScale);
-    
-    /*--- Initialize the convective, source and viscous residual vector ---*/
-    
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
-    
+        if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES){
+          DES_LengthScale = solver_container[TURB_SOL]->node[iPoint]->GetDES_LengthScale();
+        }
+      }
+      
+      /*--- Initialize the non-physical points vector ---*/
+      
+      node[iPoint]->SetNon_Physical(false);
+      
+      /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+      
+      RightSol = node[iPoint]->SetPrimVar_TDState(eddy_visc, Pressure[iBatch], SoundSpeed2[iBatch], Temperature[iBatch],
+                                                  LaminarViscosity[iBatch], ThermalConductivity[iBatch], Cp[iBatch]);
+      
+      if (RightSol) {
+        node[iPoint]->SetSecondaryVar_TDState(dPdrho_e[iBatch], dPde_rho[iBatch], dTdrho_e[iBatch], dTde_rho[iBatch],
+                                              dmudrho_T[iBatch], dmudT_rho[iBatch], dktdrho_T[iBatch], dktdT_rho[iBatch]);
+      }
+      else {
+        
+        /*--- Non-physical state, the point-wise update reverts to the old solution. ---*/
+        
+        RightSol = node[iPoint]->SetPrimVar(eddy_visc, turb_ke, FluidModel);
+        node[iPoint]->SetSecondaryVar(FluidModel);
+      }
+      
+      if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+      
+      /*--- Set the DES length scale ---*/
+      
+      node[iPoint]->SetDES_LengthScale(DES_LengthScale);
+      
+      /*--- Initialize the convective, source and viscous residual vector ---*/
+      
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+      
+    }
   }
   
   return ErrorCounter;
@@ -16841,19 +16968,31 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
       
       if (grid_movement) {
         
-        /*--- Get the grid velocity at the current boundary node ---*/
-        
-        GridVel = geometry->node[iPoint]->GetGridVel();
-        ProjGridVel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ProjGridVel += GridVel[iDim]*UnitNormal[iDim]*Area;
-        
         /*--- Retrieve other primitive quantities and viscosities ---*/
         
         Density  = node[iPoint]->GetSolution(0);
         Pressure = node[iPoint]->GetPressure();
         laminar_viscosity = node[iPoint]->GetLaminarViscosity();
         eddy_viscosity    = node[iPoint]->GetEddyViscosity();
+        
+        /*--- Preaccumulate the moving wall contributions to the energy equation. ---*/
+        
+        GridVel = geometry->node[iPoint]->GetGridVel();
+        
+        AD::StartPreacc();
+        AD::SetPreaccIn(GridVel, nDim);
+        AD::SetPreaccIn(UnitNormal, nDim); AD::SetPreaccIn(Area);
+        AD::SetPreaccIn(Pressure);
+        AD::SetPreaccIn(laminar_viscosity); AD::SetPreaccIn(eddy_viscosity);
+        AD::SetPreaccIn(&node[iPoint]->GetGradient_Primitive()[1], nDim, nDim);
+        AD::SetPreaccIn(Res_Visc[nDim+1]);
+        
+        /*--- Get the grid velocity at the current boundary node ---*/
+        
+        ProjGridVel = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          ProjGridVel += GridVel[iDim]*UnitNormal[iDim]*Area;
+        
         total_viscosity   = laminar_viscosity + eddy_viscosity;
         
         for (iDim = 0; iDim < nDim; iDim++) {
@@ -16888,6 +17027,10 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
         for (iDim = 0 ; iDim < nDim; iDim++)
           Res_Visc[nDim+1] += tau_vel[iDim]*UnitNormal[iDim]*Area;
         
+        AD::SetPreaccOut(Res_Conv[nDim+1]);
+        AD::SetPreaccOut(Res_Visc[nDim+1]);
+        AD::EndPreacc();
+        
         /*--- Implicit Jacobian contributions due to moving walls ---*/
         
         if (implicit) {
@@ -34,11 +34,25 @@
 
 #define SIZE_ARR_NORM 8
 
+/*--- Function, which returns the wall clock time in seconds. It is used to
+      measure the work of the elements, which must also be correct when
+      the task list is processed by multiple threads. ---*/
+static passivedouble WallClockTime_DG(void) {
+#if defined(HAVE_OMP)
+  return omp_get_wtime();
+#elif defined(HAVE_MPI)
+  return MPI_Wtime();
+#else
+  return passivedouble(clock())/passivedouble(CLOCKS_PER_SEC);
+#endif
+}
+
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
   FluidModel = NULL;
+  nThreadsTaskList = 1;
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
@@ -55,6 +69,22 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   Cauchy_Serie = NULL;
 
+  /*--- Initialize the counters and time steps of the implicit time integration. ---*/
+  nGhostDOFsImplicit        = 0;
+  nIterJacobianImplicit     = 0;
+  nTimeLevelsStoredImplicit = 0;
+  precondImplicitUpToDate   = false;
+  deltaTimeNImplicit = deltaTimeNm1Implicit = 0.0;
+
+  /*--- Initialize the number of elements treated simultaneously in the
+        ADER predictor step. ---*/
+  nElemSimulPredictorADER = 1;
+
+  /*--- Initialize the variables for the measurement of the work of the elements. ---*/
+  measureWorkDG          = false;
+  nTaskListCallsMeasured = 0;
+  repartitionRequestedDG = false;
+
   /*--- Initialization of the boolean symmetrizingTermsPresent. ---*/
   symmetrizingTermsPresent = true;
 
@@ -74,6 +104,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
   /*--- Basic array initialization ---*/
 
   FluidModel = NULL;
+  nThreadsTaskList = 1;
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
@@ -90,6 +121,22 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   Cauchy_Serie = NULL;
 
+  /*--- Initialize the counters and time steps of the implicit time integration. ---*/
+  nGhostDOFsImplicit        = 0;
+  nIterJacobianImplicit     = 0;
+  nTimeLevelsStoredImplicit = 0;
+  precondImplicitUpToDate   = false;
+  deltaTimeNImplicit = deltaTimeNm1Implicit = 0.0;
+
+  /*--- Initialize the number of elements treated simultaneously in the
+        ADER predictor step. ---*/
+  nElemSimulPredictorADER = 1;
+
+  /*--- Initialize the variables for the measurement of the work of the elements. ---*/
+  measureWorkDG          = false;
+  nTaskListCallsMeasured = 0;
+  repartitionRequestedDG = false;
+
   /*--- Initialization of the boolean symmetrizingTermsPresent. ---*/
   symmetrizingTermsPresent = true;
 
@@ -118,6 +165,14 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   /*--- Array initialization ---*/
   FluidModel = NULL;
 
+  /*--- Determine the number of threads used to process the list of tasks.
+        The tape of the reverse mode of AD is not thread safe, hence only
+        one thread is used in that case. ---*/
+  nThreadsTaskList = 1;
+#if defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE)
+  nThreadsTaskList = omp_get_max_threads();
+#endif
+
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL; CEff_Inv = NULL;
   CMx_Inv = NULL;   CMy_Inv = NULL;   CMz_Inv = NULL;
   CFx_Inv = NULL;   CFy_Inv = NULL;   CFz_Inv = NULL;
@@ -132,6 +187,22 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   Cauchy_Serie = NULL;
 
+  /*--- Initialize the counters and time steps of the implicit time integration. ---*/
+  nGhostDOFsImplicit        = 0;
+  nIterJacobianImplicit     = 0;
+  nTimeLevelsStoredImplicit = 0;
+  precondImplicitUpToDate   = false;
+  deltaTimeNImplicit = deltaTimeNm1Implicit = 0.0;
+
+  /*--- Initialize the number of elements treated simultaneously in the
+        ADER predictor step. ---*/
+  nElemSimulPredictorADER = 1;
+
+  /*--- Initialize the variables for the measurement of the work of the elements. ---*/
+  measureWorkDG          = false;
+  nTaskListCallsMeasured = 0;
+  repartitionRequestedDG = false;
+
   /*--- Allocate the memory for blasFunctions. ---*/
   blasFunctions = new CBlasStructure;
 
@@ -247,8 +318,18 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
           that the size estimates are for viscous computations. ---*/
     const unsigned short nTimeDOFs = config->GetnTimeDOFsADER_DG();
 
-    unsigned int sizePredictorADER = 4*nPadGemm*nDOFsMax*nTimeDOFs
-                                   +   nPadGemm*nDOFsMax;
+    /* Elements with the same standard element are treated simultaneously in
+       the predictor step, such that the time integration points of several
+       elements fill the padded N value of the matrix products. The number of
+       entities (element and time integration point) that fit in this padded
+       value is nPadGemm/nVar. Taking the same number of elements in a chunk
+       gives a multiple of this value for any number of time integration
+       points. The predictor solution and the total residual are stored per
+       element of the chunk. */
+    nElemSimulPredictorADER = max(1, nPadGemm/nVar);
+
+    unsigned int sizePredictorADER = (2 + nTimeDOFs + 2*nElemSimulPredictorADER*nTimeDOFs)
+                                   * nPadGemm*nDOFsMax;
 
     if(config->GetKind_ADER_Predictor() == ADER_ALIASED_PREDICTOR)
       sizePredictorADER += nDim*nPadGemm*nDOFsMax + nDim*nDim*nPadGemm*nIntegrationMax;
@@ -259,6 +340,20 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Add the size needed for the sum factorization of the volume terms
+        and the ADER predictor residuals of quadrilateral and hexahedral
+        elements. ---*/
+  unsigned int sizeSumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i)
+    sizeSumFact = max(sizeSumFact, standardElementsSol[i].GetSizeWorkSumFact());
+
+  sizeWorkArray += nPadGemm*sizeSumFact;
+
+  /*--- Add the size of the buffer to which the metric terms of an element
+        are converted when they are stored in single precision. ---*/
+  if( config->GetSinglePrec_Metric_DG() )
+    sizeWorkArray += nIntegrationMax*(nDim*nDim+1);
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -369,6 +464,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
     VecTotResDOFsADER.assign(nVar*nDOFsLocTot, 0.0);
     VecSolDOFsPredictorADER.resize(nTimeDOFs*nVar*nDOFsLocTot);
+    VecDeltaTimePredictorADER.assign(nVolElemOwned, 0.0);
   }
   else {
 
@@ -376,6 +472,18 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
           possibly store the new solution. ---*/
     if(config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT)
       VecSolDOFsNew.resize(nVar*nDOFsLocOwned);
+
+    /*--- Implicit time integration. The solution at the beginning of the time
+          step is stored in VecSolDOFsNew and for BDF2 also the solution of the
+          previous time step must be stored. ---*/
+    if(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
+      VecSolDOFsNew.resize(nVar*nDOFsLocOwned);
+      VecTimeCoefImplicit.assign(nVolElemOwned, 0.0);
+
+      if((config->GetUnsteady_Simulation() == TIME_STEPPING) &&
+         (config->GetTimeOrder_ImplicitDG()    == 2))
+        VecSolDOFsTimeNm1.resize(nVar*nDOFsLocOwned);
+    }
   }
 
   /*--- Determine the global number of DOFs. ---*/
@@ -411,10 +519,15 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   if(config->GetViscous() && (fabs(config->GetTheta_Interior_Penalty_DGFEM()) > 1.e-8))
     symmetrizingTermsPresent = true;
 
-  /*--- First the internal matching faces. ---*/
+  /*--- First the internal matching faces. Also store the starting location
+        in the residual of every face. ---*/
+  startLocResInternalFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
+
   unsigned long sizeVecResFaces = 0;
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    startLocResInternalFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -481,6 +594,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResInternalFaces.back() = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -679,10 +794,27 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     }
   }
 
-  /* Check if the exact Jacobian of the spatial discretization must be
-     determined. If so, the color of each DOF must be determined, which
-     is converted to the DOFs for each color. */
-  if( config->GetJacobian_Spatial_Discretization_Only() ) {
+  /* Check if the Jacobian of the spatial discretization must be determined,
+     either because only the exact Jacobian must be computed or because an
+     implicit time integration scheme is used. If so, the color of each DOF
+     must be determined, which is converted to the DOFs for each color. */
+  const bool implicitScheme = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) &&
+                             !(config->GetJacobian_Spatial_Discretization_Only());
+  if( config->GetJacobian_Spatial_Discretization_Only() || implicitScheme ) {
+
+#ifdef CODI_REVERSE_TYPE
+    if( implicitScheme )
+      SU2_MPI::Error(string("Implicit time integration of the DG solver is not possible ") +
+                     string("with reverse mode algorithmic differentiation"), CURRENT_FUNCTION);
+#endif
+
+#ifdef CODI_FORWARD_TYPE
+    /* The Jacobian is computed by seeding the forward mode derivatives, which
+       would be polluted by the derivatives of a direct differentiation. */
+    if(implicitScheme && (config->GetDirectDiff() != NO_DERIVATIVE))
+      SU2_MPI::Error(string("Implicit time integration of the DG solver cannot be ") +
+                     string("combined with DIRECT_DIFF"), CURRENT_FUNCTION);
+#endif
 
     /* Write a message that the graph coloring is performed. */
     if(rank == MASTER_NODE)
@@ -703,8 +835,10 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
            << " colors present in the graph for " << nDOFsPerRank.back()
            << " DOFs." << std::endl;
 
-    /* Determine the meta data needed for the computation of the Jacobian. */
+    /* Determine the meta data needed for the computation of the Jacobian
+       and, if needed, for the implicit time integration. */
     MetaDataJacobianComputation(DGGeometry, colorLocalDOFs);
+    if( implicitScheme ) MetaDataImplicitTimeIntegration();
   }
 
   /* Set up the persistent communication for the conservative variables and
@@ -716,10 +850,18 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
      computation of the spatial residual, while for ADER this list contains
      the tasks to be done for one space time step. */
   SetUpTaskList(config);
+
+  /* Allocate the memory to store the measured work of the owned elements for
+     every thread, if the work must be measured for a subsequent partitioning. */
+  if( config->GetnIterMeasureWorkDG() ) {
+    measureWorkDG = true;
+    measuredWorkElem.assign(nThreadsTaskList, vector<passivedouble>(nVolElemOwned, 0.0));
+  }
 }
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
+  for(unsigned long i=1; i<FluidModelThreads.size(); ++i) delete FluidModelThreads[i];
   if(FluidModel    != NULL) delete FluidModel;
   if(blasFunctions != NULL) delete blasFunctions;
 
@@ -864,6 +1006,21 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       }
       break;
 
+    case LUT_GAS:
+
+      FluidModel = new CLookUpTable(config, true);
+      if (free_stream_temp) {
+        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = FluidModel->GetDensity();
+        config->SetDensity_FreeStream(Density_FreeStream);
+      }
+      else {
+        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = FluidModel->GetTemperature();
+        config->SetTemperature_FreeStream(Temperature_FreeStream);
+      }
+      break;
+
   }
 
   Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
@@ -1027,38 +1184,55 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   Omega_FreeStreamND = Density_FreeStreamND*Tke_FreeStreamND/max((Viscosity_FreeStreamND*config->GetTurb2LamViscRatio_FreeStream()), 1.e-25);
   config->SetOmega_FreeStreamND(Omega_FreeStreamND);
 
-  /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
+  /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem.
+        A fluid model is created for every thread that processes the task list,
+        because the fluid model stores the thermodynamic state. ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  /*--- Delete the original (dimensional) FluidModel object and the
+        fluid models of the other threads before replacing. ---*/
 
   delete FluidModel;
+  for(unsigned long i=1; i<FluidModelThreads.size(); ++i) delete FluidModelThreads[i];
+  FluidModelThreads.assign(nThreadsTaskList, NULL);
 
-  switch (config->GetKind_FluidModel()) {
+  for(unsigned short iThread=0; iThread<nThreadsTaskList; ++iThread) {
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case VW_GAS:
+        FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
+
+      case PR_GAS:
+        FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
+      case LUT_GAS:
+        FluidModel = new CLookUpTable(config, false);
+        FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
+
+    }
+
+    FluidModelThreads[iThread] = FluidModel;
   }
 
+  FluidModel = FluidModelThreads[0];
+
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (viscous) {
@@ -1075,8 +1249,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    for(unsigned short iThread=0; iThread<nThreadsTaskList; ++iThread) {
+      FluidModelThreads[iThread]->SetLaminarViscosityModel(config);
+      FluidModelThreads[iThread]->SetThermalConductivityModel(config);
+    }
 
   }
 
@@ -1147,6 +1323,14 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
         cout << "Critical Temperature (non-dim) :  " << config->GetTemperature_Critical() /config->GetTemperature_Ref() << endl;
         break;
 
+      case LUT_GAS:
+        cout << "Fluid Model: Look-up table "<< endl;
+        cout << "Look-up table file: " << config->GetLUT_Filename() << endl;
+        cout << "Specific gas constant: " << config->GetGas_Constant() << " N.m/kg.K." << endl;
+        cout << "Specific gas constant (non-dim): " << config->GetGas_ConstantND()<< endl;
+        cout << "Specific Heat Ratio: "<< Gamma << endl;
+        break;
+
     }
     if (viscous) {
       switch (config->GetKind_ViscosityModel()) {
@@ -1854,6 +2038,161 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
       colorToIndEntriesJacobian[i][color] = j;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Part 4: Determine the number of non-zeros in the Jacobian matrix   ---*/
+  /*---         for the owned DOFs in cumulative storage format.           ---*/
+  /*--------------------------------------------------------------------------*/
+
+  nNonZeroEntriesJacobian.resize(nDOFsLocOwned+1);
+  nNonZeroEntriesJacobian[0] = 0;
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i)
+    nNonZeroEntriesJacobian[i+1] = nNonZeroEntriesJacobian[i]
+                                 + nonZeroEntriesJacobian[i].size();
+}
+
+void CFEM_DG_EulerSolver::MetaDataImplicitTimeIntegration(void) {
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Determine the local column indices of the Jacobian. The    ---*/
+  /*---         owned DOFs keep their local numbering, while the DOFs      ---*/
+  /*---         owned by other ranks, the ghost DOFs, are numbered         ---*/
+  /*---         consecutively after the owned DOFs.                        ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /* Easier storage of the range of global DOF IDs owned by this rank. */
+  const unsigned long DOFBeg = nDOFsPerRank[rank];
+  const unsigned long DOFEnd = nDOFsPerRank[rank+1];
+
+  /* Determine the global IDs of the ghost DOFs. As a map is sorted, the ghost
+     DOFs are automatically sorted per rank, i.e. the ghost DOFs coming from
+     the same rank are numbered contiguously. */
+  map<unsigned long, unsigned long> mapGlobalToGhostDOFs;
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+    for(unsigned long j=0; j<nonZeroEntriesJacobian[i].size(); ++j) {
+      const unsigned long jj = nonZeroEntriesJacobian[i][j];
+      if((jj < DOFBeg) || (jj >= DOFEnd)) mapGlobalToGhostDOFs[jj] = 0;
+    }
+  }
+
+  nGhostDOFsImplicit = 0;
+  map<unsigned long, unsigned long>::iterator MI;
+  for(MI=mapGlobalToGhostDOFs.begin(); MI!=mapGlobalToGhostDOFs.end(); ++MI)
+    MI->second = nDOFsLocOwned + nGhostDOFsImplicit++;
+
+  /* Set the local column indices and the indices of the diagonal blocks. */
+  colLocalEntriesJacobian.resize(nNonZeroEntriesJacobian[nDOFsLocOwned]);
+  diagEntriesJacobian.resize(nDOFsLocOwned);
+
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+    for(unsigned long j=0; j<nonZeroEntriesJacobian[i].size(); ++j) {
+      const unsigned long jj  = nonZeroEntriesJacobian[i][j];
+      const unsigned long ind = nNonZeroEntriesJacobian[i] + j;
+
+      if((jj >= DOFBeg) && (jj < DOFEnd)) colLocalEntriesJacobian[ind] = jj - DOFBeg;
+      else                                colLocalEntriesJacobian[ind] = mapGlobalToGhostDOFs[jj];
+
+      if(jj == DOFBeg+i) diagEntriesJacobian[i] = ind;
+    }
+  }
+
+  /* Allocate the memory for the work vector of the Jacobian vector products,
+     which stores both the owned and the ghost DOFs. */
+  VecWorkImplicit.assign(nVar*(nDOFsLocOwned+nGhostDOFsImplicit), 0.0);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Determine the communication pattern to obtain the data of  ---*/
+  /*---         the ghost DOFs in the Jacobian vector products. Note that  ---*/
+  /*---         this pattern differs from the halo communication, because  ---*/
+  /*---         the faces between partitions are only stored once.         ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /* Determine the number of ghost DOFs per rank. */
+  vector<int> nGhostDOFsPerRank(size, 0);
+  for(MI=mapGlobalToGhostDOFs.begin(); MI!=mapGlobalToGhostDOFs.end(); ++MI) {
+    vector<unsigned long>::iterator upp;
+    upp = upper_bound(nDOFsPerRank.begin(), nDOFsPerRank.end(), MI->first);
+    const int rankDOF = (int)(upp - nDOFsPerRank.begin()) - 1;
+    ++nGhostDOFsPerRank[rankDOF];
+  }
+
+  /* Determine the ranks from which ghost DOFs are received and the
+     starting position of their ghost DOFs. */
+  ranksRecvImplicit.clear();
+  startGhostDOFsRecvImplicit.assign(1, 0);
+  for(int i=0; i<size; ++i) {
+    if( nGhostDOFsPerRank[i] ) {
+      ranksRecvImplicit.push_back(i);
+      startGhostDOFsRecvImplicit.push_back(startGhostDOFsRecvImplicit.back()
+                                          + nGhostDOFsPerRank[i]);
+    }
+  }
+
+#ifdef HAVE_MPI
+
+  /* Inform the other ranks about the number of DOFs they must send. */
+  vector<int> nDOFsToSend(size);
+  SU2_MPI::Alltoall(nGhostDOFsPerRank.data(), 1, MPI_INT,
+                    nDOFsToSend.data(),       1, MPI_INT, MPI_COMM_WORLD);
+
+  /* Store the global IDs of the ghost DOFs in a vector and send them to the
+     ranks that own them. Use non-blocking sends to avoid deadlock. */
+  vector<unsigned long> ghostGlobalIDs;
+  ghostGlobalIDs.reserve(nGhostDOFsImplicit);
+  for(MI=mapGlobalToGhostDOFs.begin(); MI!=mapGlobalToGhostDOFs.end(); ++MI)
+    ghostGlobalIDs.push_back(MI->first);
+
+  vector<SU2_MPI::Request> sendReqs(ranksRecvImplicit.size());
+  for(unsigned long i=0; i<ranksRecvImplicit.size(); ++i) {
+    const unsigned long indBeg = startGhostDOFsRecvImplicit[i];
+    const unsigned long nDOFs  = startGhostDOFsRecvImplicit[i+1] - indBeg;
+
+    const int dest = ranksRecvImplicit[i];
+    SU2_MPI::Isend(ghostGlobalIDs.data()+indBeg, nDOFs, MPI_UNSIGNED_LONG,
+                   dest, dest, MPI_COMM_WORLD, &sendReqs[i]);
+  }
+
+  /* Loop over the ranks and receive the DOFs that must be sent to them. */
+  ranksSendImplicit.clear();
+  DOFsSendImplicit.clear();
+  for(int i=0; i<size; ++i) {
+    if( nDOFsToSend[i] ) {
+
+      ranksSendImplicit.push_back(i);
+      DOFsSendImplicit.push_back(vector<unsigned long>(nDOFsToSend[i]));
+      vector<unsigned long> &DOFs = DOFsSendImplicit.back();
+
+      SU2_MPI::Status status;
+      SU2_MPI::Recv(DOFs.data(), DOFs.size(), MPI_UNSIGNED_LONG,
+                    i, rank, MPI_COMM_WORLD, &status);
+
+      /* Convert the global IDs to local IDs and check if they are owned. */
+      for(unsigned long j=0; j<DOFs.size(); ++j) {
+        if((DOFs[j] < DOFBeg) || (DOFs[j] >= DOFEnd))
+          SU2_MPI::Error("DOF to be sent is not owned. This should not happen.",
+                         CURRENT_FUNCTION);
+        DOFs[j] -= DOFBeg;
+      }
+    }
+  }
+
+  /* Complete the non-blocking sends. */
+  SU2_MPI::Waitall(sendReqs.size(), sendReqs.data(), MPI_STATUSES_IGNORE);
+
+  /* Allocate the memory for the send buffers and the communication requests. */
+  sendBufImplicit.resize(ranksSendImplicit.size());
+  for(unsigned long i=0; i<ranksSendImplicit.size(); ++i)
+    sendBufImplicit[i].resize(nVar*DOFsSendImplicit[i].size());
+
+  commRequestsImplicit.resize(ranksSendImplicit.size() + ranksRecvImplicit.size());
+
+#else
+
+  /*--- Sequential mode. All DOFs, also the periodic ones, are owned. ---*/
+  if( nGhostDOFsImplicit )
+    SU2_MPI::Error("Ghost DOFs present in sequential mode. This should not happen.",
+                   CURRENT_FUNCTION);
+#endif
 }
 
 void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
@@ -3658,8 +3997,18 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
                                                  CNumerics **numerics, CConfig *config,
                                                  unsigned short iMesh, unsigned short RunTime_EqSystem) {
 
+  /* Determine whether only the Jacobian must be computed or whether the
+     Jacobian is needed for the implicit time integration. In the latter
+     case the Jacobian is only recomputed with the specified frequency. */
+  const bool jacobianOnly = config->GetJacobian_Spatial_Discretization_Only();
+  if( !jacobianOnly ) {
+    const bool computeJacobian = !(nIterJacobianImplicit%config->GetJacobianFreq_ImplicitDG());
+    ++nIterJacobianImplicit;
+    if( !computeJacobian ) return;
+  }
+
   /* Write a message that the Jacobian is being computed. */
-  if(rank == MASTER_NODE) {
+  if(jacobianOnly && rank == MASTER_NODE) {
     cout << endl;
     cout << "Computing the Jacobian via coloring." << endl;
     cout << endl << flush;
@@ -3673,27 +4022,44 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
   /*---         of colors and disturbing the appropriate DOFs for each     ---*/
   /*---         color. Note that for each color an additional loop over    ---*/
   /*---         the number of variables is needed to create the Jacobian.  ---*/
+  /*---         With forward mode AD the Jacobian is exact, otherwise a    ---*/
+  /*---         finite difference approximation is used.                   ---*/
   /*--------------------------------------------------------------------------*/
 
-  /* Determine the number of non-zeros in the Jacobian matrix for the owned
-     DOFs in cumulative storage format. */
-  vector<unsigned long> nNonZeroEntries(nDOFsLocOwned+1);
+  /* When only the Jacobian is computed, the working variables must still be
+     set and for finite differences the unperturbed residual is needed. For
+     the implicit scheme this has just been done in the space integration. */
+  if( jacobianOnly ) {
+    Set_OldSolution(geometry);
+#ifndef CODI_FORWARD_TYPE
+    ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+#endif
+  }
 
-  nNonZeroEntries[0] = 0;
-  for(unsigned i=0; i<nDOFsLocOwned; ++i)
-    nNonZeroEntries[i+1] = nNonZeroEntries[i] + nonZeroEntriesJacobian[i].size();
+#ifndef CODI_FORWARD_TYPE
+  /* Store the residual of the unperturbed state and determine the
+     perturbations of the conserved variables from the free-stream state. */
+  const vector<su2double> resUnperturbed(VecResDOFs.begin(),
+                                         VecResDOFs.begin() + nVar*nDOFsLocOwned);
 
-  /* Copy the solution into the working variables. */
-  Set_OldSolution(geometry);
+  const su2double sqrtEps = sqrt(numeric_limits<passivedouble>::epsilon());
+  vector<su2double> deltaSol(nVar);
+  deltaSol[0]      = sqrtEps*ConsVarFreeStream[0];
+  deltaSol[nVar-1] = sqrtEps*ConsVarFreeStream[nVar-1];
+  for(unsigned short iDim=1; iDim<=nDim; ++iDim)
+    deltaSol[iDim] = sqrtEps*sqrt(ConsVarFreeStream[0]*ConsVarFreeStream[nVar-1]);
+
+  vector<su2double> solUnperturbed;
+#endif
 
   /* Allocate the memory for local part of the Jacobian. Note that passivedouble
      must be used for the Jacobian matrix. */
-  vector<passivedouble> Jacobian(nVar2*nNonZeroEntries[nDOFsLocOwned]);
+  JacobianDG.assign(nVar2*nNonZeroEntriesJacobian[nDOFsLocOwned], 0.0);
 
   /* Loop over the colors and write a message, if needed. */
   for(int color=0; color<nGlobalColors; ++color) {
 
-    if(rank == MASTER_NODE && !(color%10)) {
+    if(jacobianOnly && rank == MASTER_NODE && !(color%10)) {
       cout << "Color " << color+1 << " out of " << nGlobalColors
            << " is computed" << endl;
     }
@@ -3702,6 +4068,9 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
     for(short var=0; var<nVar; ++var) {
 
       /* Loop over the DOFs that must be disturbed for this color. */
+#ifndef CODI_FORWARD_TYPE
+      solUnperturbed.resize(localDOFsPerColor[color].size());
+#endif
       for(unsigned long j=0; j<localDOFsPerColor[color].size(); ++j) {
         const unsigned long jj = localDOFsPerColor[color][j];
 
@@ -3710,13 +4079,18 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
 #ifdef CODI_FORWARD_TYPE
         solDOF[var].setGradient(1.0);
 #else
-        solDOF[var] += 0.001;   /* This is to avoid a compiler warning. */
+        solUnperturbed[j] = solDOF[var];
+        solDOF[var]      += deltaSol[var];
 #endif
       }
 
       /* Carry out all the tasks to compute the residual. */
       ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
 
+#ifndef CODI_FORWARD_TYPE
+      const su2double deltaInv = 1.0/deltaSol[var];
+#endif
+
       /* Loop over all the locally owned DOFs. */
       for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
 
@@ -3726,11 +4100,12 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
           /* Set the pointer to entry in Jacobian where the derivative data
              must be stored. */
           const int ind = colorToIndEntriesJacobian[i][color];
-          passivedouble *Jac = Jacobian.data() + nVar2*(nNonZeroEntries[i] + ind);
+          passivedouble *Jac = JacobianDG.data() + nVar2*(nNonZeroEntriesJacobian[i] + ind);
 
-#ifdef CODI_FORWARD_TYPE
           /* Set the pointer to the residual of the current DOF. */
           const su2double *resDOF = VecResDOFs.data() + i*nVar;
+#ifndef CODI_FORWARD_TYPE
+          const su2double *resDOFUnperturbed = resUnperturbed.data() + i*nVar;
 #endif
 
           /* Store the matrix entries. */
@@ -3738,13 +4113,14 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
 #ifdef CODI_FORWARD_TYPE
             Jac[var+j*nVar] = resDOF[j].getGradient();
 #else
-            Jac[var+j*nVar] = 0.0;   /* This is to avoid a compiler warning. */
+            Jac[var+j*nVar] = SU2_TYPE::GetValue((resDOF[j] - resDOFUnperturbed[j])*deltaInv);
 #endif
           }
         }
       }
 
-      /* Reset the disturbances for this color. */
+      /* Reset the disturbances for this color. The original values are
+         restored exactly to avoid a drift of the solution. */
       for(unsigned long j=0; j<localDOFsPerColor[color].size(); ++j) {
         const unsigned long jj = localDOFsPerColor[color][j];
 
@@ -3753,13 +4129,23 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
 #ifdef CODI_FORWARD_TYPE
         solDOF[var].setGradient(0.0);
 #else
-        solDOF[var] -= 0.001;   /* This is to avoid a compiler warning. */
+        solDOF[var] = solUnperturbed[j];
 #endif
       }
 
     }
   }
 
+#ifndef CODI_FORWARD_TYPE
+  /* Restore the residual of the unperturbed state. */
+  memcpy(VecResDOFs.data(), resUnperturbed.data(), resUnperturbed.size()*sizeof(su2double));
+#endif
+
+  /* The preconditioner of the implicit scheme must be rebuilt for the new
+     Jacobian. For the implicit scheme the Jacobian is not written. */
+  precondImplicitUpToDate = false;
+  if( !jacobianOnly ) return;
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 2: The writing of the Jacobian in Block Compressed Row        ---*/
   /*---         Storage to file.                                           ---*/
@@ -3771,11 +4157,79 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
     cout << "Writing the Jacobian Block Compressed Row Storage." << flush;
   }
 
+  /* Easier storage of the global number of DOFs. */
+  unsigned long nDOFsTot = nDOFsPerRank[size];
+
 #ifdef HAVE_MPI
-  /* Parallel mode. The parallel IO functionality is used to Write
-     the Jacobian matrix. */
-  cout << "CFEM_DG_EulerSolver::ComputeSpatialJacobian: Not implemented yet" << endl;
-  exit(1);
+  /* Easier storage of the local number of nonzero blocks. */
+  unsigned long nNonZeroLoc = nNonZeroEntriesJacobian[nDOFsLocOwned];
+
+  /* Parallel mode. The parallel IO functionality is used to write the
+     Jacobian matrix. Determine the offsets of the nonzero blocks of
+     the ranks in cumulative storage format. */
+  vector<unsigned long> nNonZeroPerRank(size+1);
+  nNonZeroPerRank[0] = 0;
+  SU2_MPI::Allgather(&nNonZeroLoc, 1, MPI_UNSIGNED_LONG, &nNonZeroPerRank[1], 1,
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  for(int i=0; i<size; ++i)
+    nNonZeroPerRank[i+1] += nNonZeroPerRank[i];
+
+  /* Remove a possibly existing file and open the file for writing. */
+  char fname[] = "Jacobian_DG.bin";
+  if(rank == MASTER_NODE) MPI_File_delete(fname, MPI_INFO_NULL);
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  MPI_File fJac;
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                           MPI_INFO_NULL, &fJac);
+  if(ierr != MPI_SUCCESS)
+    SU2_MPI::Error("Could not open the file Jacobian_DG.bin for binary writing.",
+                   CURRENT_FUNCTION);
+
+  /* The master writes the number of DOFs (Block rows in the matrix), the
+     number of variables (the dimension of each block) and the first entry
+     of the cumulative storage of the neighboring blocks. */
+  MPI_Offset disp = 0;
+  if(rank == MASTER_NODE) {
+    unsigned long zero = 0;
+    MPI_File_write_at(fJac, disp, &nDOFsTot, 1, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    disp += sizeof(unsigned long);
+    MPI_File_write_at(fJac, disp, &nVar, 1, MPI_UNSIGNED_SHORT, MPI_STATUS_IGNORE);
+    disp += sizeof(unsigned short);
+    MPI_File_write_at(fJac, disp, &zero, 1, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+  }
+  disp = sizeof(unsigned long) + sizeof(unsigned short);
+
+  /* Write the number of neighboring blocks of the owned DOFs in global
+     cumulative storage format. */
+  vector<unsigned long> nNonZeroGlobal(nDOFsLocOwned);
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i)
+    nNonZeroGlobal[i] = nNonZeroPerRank[rank] + nNonZeroEntriesJacobian[i+1];
+
+  MPI_File_write_at_all(fJac, disp + (nDOFsPerRank[rank]+1)*sizeof(unsigned long),
+                        nNonZeroGlobal.data(), nDOFsLocOwned, MPI_UNSIGNED_LONG,
+                        MPI_STATUS_IGNORE);
+  disp += (nDOFsTot+1)*sizeof(unsigned long);
+
+  /* Write the block column indices of the neighboring blocks. */
+  vector<unsigned long> colIndices;
+  colIndices.reserve(nNonZeroLoc);
+  for(unsigned long i=0; i<nDOFsLocOwned; ++i)
+    colIndices.insert(colIndices.end(), nonZeroEntriesJacobian[i].begin(),
+                      nonZeroEntriesJacobian[i].end());
+
+  MPI_File_write_at_all(fJac, disp + nNonZeroPerRank[rank]*sizeof(unsigned long),
+                        colIndices.data(), nNonZeroLoc, MPI_UNSIGNED_LONG,
+                        MPI_STATUS_IGNORE);
+  disp += nNonZeroPerRank[size]*sizeof(unsigned long);
+
+  /* Write the actual matrix elements. */
+  MPI_File_write_at_all(fJac, disp + nVar2*nNonZeroPerRank[rank]*sizeof(passivedouble),
+                        JacobianDG.data(), JacobianDG.size(), MPI_DOUBLE,
+                        MPI_STATUS_IGNORE);
+
+  /* Close the file again. */
+  MPI_File_close(&fJac);
 
 #else
   /* Sequential mode. The entire file is written by one rank,
@@ -3789,9 +4243,9 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
   /* Write the number of DOFs (Block rows in the matrix), the number of
      variables (the dimension of each block) and the number of neighboring
      blocks per DOF in cumulative storage format. */
-  fwrite(&nDOFsPerRank[1], 1, sizeof(unsigned long), fJac);
+  fwrite(&nDOFsTot, 1, sizeof(unsigned long), fJac);
   fwrite(&nVar, 1, sizeof(unsigned short), fJac);
-  fwrite(nNonZeroEntries.data(), nNonZeroEntries.size(),
+  fwrite(nNonZeroEntriesJacobian.data(), nNonZeroEntriesJacobian.size(),
          sizeof(unsigned long), fJac);
 
   /* Write the block column indices of the neighboring blocks. */
@@ -3800,7 +4254,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
            sizeof(unsigned long), fJac);
 
   /* Write the actual matrix elements. */
-  fwrite(Jacobian.data(), Jacobian.size(), sizeof(passivedouble), fJac);
+  fwrite(JacobianDG.data(), JacobianDG.size(), sizeof(passivedouble), fJac);
 
   /* Close the file again. */
   fclose(fJac);
@@ -3821,6 +4275,19 @@ void CFEM_DG_EulerSolver::Set_OldSolution(CGeometry *geometry) {
 
 void CFEM_DG_EulerSolver::Set_NewSolution(CGeometry *geometry) {
 
+  /* For BDF2 of the implicit time integration, the solution at the beginning
+     of the previous time step becomes the solution of time level n-1. Also
+     the time steps are stored to account for a variable time step. */
+  if( VecSolDOFsTimeNm1.size() ) {
+    if( nTimeLevelsStoredImplicit ) {
+      VecSolDOFsTimeNm1.swap(VecSolDOFsNew);
+      deltaTimeNm1Implicit = deltaTimeNImplicit;
+    }
+
+    if(nTimeLevelsStoredImplicit < 2) ++nTimeLevelsStoredImplicit;
+    if( nVolElemOwned ) deltaTimeNImplicit = VecDeltaTime[0];
+  }
+
   memcpy(VecSolDOFsNew.data(), VecSolDOFs.data(), VecSolDOFs.size()*sizeof(su2double));
 }
 
@@ -4018,8 +4485,14 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+#ifdef HAVE_OMP
+  /* Use the multithreaded executor if more than one thread is available. */
+  if(nThreadsTaskList > 1) {
+    ProcessTaskListThreads_DG(config, numerics);
+    if( measureWorkDG ) UpdateMeasuredWork_DG(config);
+    return;
+  }
+#endif
 
   /* Define and initialize the bool vector, that indicates whether or
      not the tasks from the list have been completed. */
@@ -4051,282 +4524,802 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
         if( taskCanBeCarriedOut ) {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+          /*--- Carry out the task for its entire range. The only tasks that
+                may fail are the completion of the non-blocking communication.
+                If that is the case the next task needs to be found. ---*/
+          unsigned long rangeBeg, rangeEnd;
+          RangeTask_DG(tasksList[i], rangeBeg, rangeEnd);
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+          if( CarryOutTask_DG(config, numerics, tasksList[i], rangeBeg,
+                              rangeEnd, j==1, workArray) )
+            taskCarriedOut = taskCompleted[i] = true;
+        }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+        /* Break the inner loop if a task has been carried out. */
+        if( taskCarriedOut ) break;
+      }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Break the outer loop if a task has been carried out. */
+      if( taskCarriedOut ) break;
+    }
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+    /* Update the value of lowestIndexInList. */
+    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+      if( !taskCompleted[lowestIndexInList] ) break;
+  }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Update the measurement of the work of the elements, if needed. */
+  if( measureWorkDG ) UpdateMeasuredWork_DG(config);
+}
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+bool CFEM_DG_EulerSolver::RangeTask_DG(const CTaskDefinition &task,
+                                       unsigned long         &rangeBeg,
+                                       unsigned long         &rangeEnd) {
+
+  /*--- Only the tasks that loop over independent elements or faces and
+        that are the most expensive ones are split into chunks. ---*/
+  const unsigned short level = task.timeLevel;
+  switch( task.task ) {
+
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      rangeBeg = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      rangeEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
+
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+      rangeBeg = nVolElemOwnedPerTimeLevel[level];
+      rangeEnd = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      return true;
+
+    case CTaskDefinition::VOLUME_RESIDUAL:
+      rangeBeg = nVolElemOwnedPerTimeLevel[level];
+      rangeEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
+
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+      rangeBeg = nMatchingInternalFacesLocalElem[level];
+      rangeEnd = nMatchingInternalFacesLocalElem[level+1];
+      return true;
+
+    default:
+      rangeBeg = rangeEnd = 0;
+      return false;
+  }
+}
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+bool CFEM_DG_EulerSolver::CarryOutTask_DG(CConfig               *config,
+                                          CNumerics             **numerics,
+                                          const CTaskDefinition &task,
+                                          const unsigned long   rangeBeg,
+                                          const unsigned long   rangeEnd,
+                                          const bool            commMustBeCompleted,
+                                          su2double             *workArray) {
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Easier storage of the number of time levels. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+  /* Store the starting time of the task, if the work is measured. */
+  const passivedouble timeStartTask = measureWorkDG ? WallClockTime_DG() : 0.0;
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /*--- Determine the actual task to be carried out and do so. ---*/
+  bool taskCarriedOut = false;
+  switch( task.task ) {
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+      /* Carry out the ADER predictor step for the elements whose
+         solution must be communicated for this time level. */
+      ADER_DG_PredictorStep(config, rangeBeg, rangeEnd, workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must not be communicated for this time level. */
+      ADER_DG_PredictorStep(config, rangeBeg, rangeEnd, workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, task.timeLevel);
+      taskCarriedOut = true;
+      break;
+    }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
+
+      /* Attempt to complete the MPI communication of the solution data.
+         If commMustBeCompleted is false, SU2_MPI::Testall will be used,
+         which returns false if not all requests can be completed. In that
+         case the next task on the list is carried out. Otherwise the next
+         tasks are waiting for this communication to be completed and
+         hence MPI_Waitall is used. */
+      if( Complete_MPI_Communication(config, task.timeLevel,
+                                     commMustBeCompleted) )
+        taskCarriedOut = true;
+      break;
+    }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, task.timeLevel);
+      taskCarriedOut = true;
+      break;
+    }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+
+      /* Attempt to complete the MPI communication of the residual data.
+         If commMustBeCompleted is false, SU2_MPI::Testall will be used,
+         which returns false if not all requests can be completed. In that
+         case the next task on the list is carried out. Otherwise the next
+         tasks are waiting for this communication to be completed and
+         hence MPI_Waitall is used. */
+      if( Complete_MPI_ReverseCommunication(config, task.timeLevel,
+                                            commMustBeCompleted) )
+        taskCarriedOut = true;
+      break;
+    }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      taskCarriedOut = true;
+      break;
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+      /*--- Compute the volume portion of the residual. ---*/
+      Volume_Residual(config, rangeBeg, rangeEnd, workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+      /* Compute the residual of the faces that only involve owned elements. */
+      unsigned long indResFaces = startLocResInternalFaces[rangeBeg];
+      ResidualFaces(config, rangeBeg, rangeEnd, indResFaces,
+                    numerics[CONV_TERM], workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = task.timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, false,
+                          workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, true,
+                          workArray);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, true);
+      taskCarriedOut = true;
+      break;
+    }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, false);
+      taskCarriedOut = true;
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, task.timeLevel,
+                                               task.intPointADER);
+      taskCarriedOut = true;
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, task.timeLevel,
+                                              task.intPointADER);
+      taskCarriedOut = true;
+      break;
+    }
+
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const unsigned short level = task.timeLevel;
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          workArray);
+      taskCarriedOut = true;
+      break;
+    }
+
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG. ---*/
+      const unsigned short level = task.timeLevel;
+      ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                        nVolElemOwnedPerTimeLevel[level+1]);
+      taskCarriedOut = true;
+      break;
+    }
+
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
+    }
+  }
+
+  /* Attribute the time of this task to the elements, if the work is measured. */
+  if(measureWorkDG && taskCarriedOut)
+    AccumulateMeasuredWork_DG(task, rangeBeg, rangeEnd,
+                              WallClockTime_DG() - timeStartTask);
+
+  return taskCarriedOut;
+}
+
+void CFEM_DG_EulerSolver::AccumulateMeasuredWork_DG(const CTaskDefinition &task,
+                                                    const unsigned long   rangeBeg,
+                                                    const unsigned long   rangeEnd,
+                                                    const passivedouble   timeTask) {
+
+  /* Determine the thread that carried out the task. */
+  int thread = 0;
+#ifdef HAVE_OMP
+  if(nThreadsTaskList > 1) thread = omp_get_thread_num();
+#endif
+  passivedouble *workElem = measuredWorkElem[thread].data();
+
+  /*--- Attribute the time to the owned elements involved in the task. The time
+        spent in the communication and in the tasks for the halo elements is
+        not attributed, because it is not work of the owned elements. ---*/
+  const unsigned short level = task.timeLevel;
+  switch( task.task ) {
+
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+    case CTaskDefinition::VOLUME_RESIDUAL: {
+
+      /* The task is carried out for the element range of the chunk. */
+      DistributeMeasuredWorkElem_DG(rangeBeg, rangeEnd, timeTask);
+      break;
+    }
+
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS:
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS:
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS:
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /* The task is carried out for all owned elements of the time level. */
+      DistributeMeasuredWorkElem_DG(nVolElemOwnedPerTimeLevel[level],
+                                    nVolElemOwnedPerTimeLevel[level+1], timeTask);
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Both elements of the faces are owned. Attribute half of the
+         time per face to each of them. */
+      if(rangeEnd > rangeBeg) {
+        const passivedouble timeHalfFace = 0.5*timeTask/(rangeEnd - rangeBeg);
+        for(unsigned long l=rangeBeg; l<rangeEnd; ++l) {
+          workElem[matchingInternalFaces[l].elemID0] += timeHalfFace;
+          workElem[matchingInternalFaces[l].elemID1] += timeHalfFace;
+        }
+      }
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Attribute the time per face to the owned element of the face. */
+      const unsigned long faceBeg = nMatchingInternalFacesWithHaloElem[level];
+      const unsigned long faceEnd = nMatchingInternalFacesWithHaloElem[level+1];
+      if(faceEnd > faceBeg) {
+        const passivedouble timeFace = timeTask/(faceEnd - faceBeg);
+        for(unsigned long l=faceBeg; l<faceEnd; ++l) {
+          const unsigned long elemID0 = matchingInternalFaces[l].elemID0;
+          const unsigned long elemID1 = matchingInternalFaces[l].elemID1;
+          if(elemID0 < nVolElemOwned) workElem[elemID0] += timeFace;
+          else                        workElem[elemID1] += timeFace;
+        }
+      }
+      break;
+    }
+
+    default:  /* Communication, halo elements and boundary conditions. */
+      break;
+  }
+}
+
+void CFEM_DG_EulerSolver::DistributeMeasuredWorkElem_DG(const unsigned long elemBeg,
+                                                        const unsigned long elemEnd,
+                                                        const passivedouble timeElem) {
+
+  /* Determine the total number of DOFs of the range of elements. */
+  unsigned long nDOFsRange = 0;
+  for(unsigned long l=elemBeg; l<elemEnd; ++l) nDOFsRange += volElem[l].nDOFsSol;
+  if(nDOFsRange == 0) return;
+
+  /* Determine the thread that carried out the task. */
+  int thread = 0;
+#ifdef HAVE_OMP
+  if(nThreadsTaskList > 1) thread = omp_get_thread_num();
+#endif
+  passivedouble *workElem = measuredWorkElem[thread].data();
+
+  /* Distribute the time proportional to the number of DOFs of the elements. */
+  const passivedouble timePerDOF = timeElem/nDOFsRange;
+  for(unsigned long l=elemBeg; l<elemEnd; ++l)
+    workElem[l] += timePerDOF*volElem[l].nDOFsSol;
+}
+
+void CFEM_DG_EulerSolver::UpdateMeasuredWork_DG(CConfig *config) {
+
+  /* Update the number of executions of the task list and check if
+     the measurement is finished. */
+  ++nTaskListCallsMeasured;
+  if(nTaskListCallsMeasured < config->GetnIterMeasureWorkDG()) return;
+
+  /* Write the measured work and release the memory of the measurement. */
+  WriteMeasuredWork_DG(config);
+
+  measureWorkDG = false;
+  vector<vector<passivedouble> >().swap(measuredWorkElem);
+
+  /* Request the repartitioning of the grid with the measured work, if desired.
+     It is carried out by the driver at the end of the current time step. */
+  repartitionRequestedDG = config->GetRepartition_Measured_Work_DG();
+}
+
+void CFEM_DG_EulerSolver::WriteMeasuredWork_DG(CConfig *config) {
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Determine the measured work per update of the elements.    ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /* Sum the contributions of the threads. */
+  vector<passivedouble> workElem(measuredWorkElem[0]);
+  for(unsigned long i=1; i<measuredWorkElem.size(); ++i)
+    for(unsigned long l=0; l<nVolElemOwned; ++l)
+      workElem[l] += measuredWorkElem[i][l];
+
+  /* Determine the elements adjacent to a boundary, for which a wall model
+     is used. These elements are distinguished, because the wall model
+     adds significantly to the work of an element. */
+  vector<bool> elemWithWallModel(nVolElemOwned, false);
+  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
+    if( boundaries[iMarker].wallModel ) {
+      const vector<CSurfaceElementFEM> &surfElem = boundaries[iMarker].surfElem;
+      for(unsigned long l=0; l<surfElem.size(); ++l)
+        elemWithWallModel[surfElem[l].volElemID] = true;
+    }
+  }
+
+  /* An element of time level i is updated 2^(nTimeLevels-1-i) times per
+     execution of the task list. Determine the work per update of the
+     elements and sum it per element type and time level. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  map<vector<unsigned short>, vector<passivedouble> > workPerType;
+  passivedouble workRank = 0.0;
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    workRank += workElem[l];
+
+    vector<unsigned short> key(5);
+    key[0] = volElem[l].VTK_Type;
+    key[1] = volElem[l].nPolySol;
+    key[2] = volElem[l].JacIsConsideredConstant;
+    key[3] = volElem[l].timeLevel;
+    key[4] = elemWithWallModel[l];
+
+    const passivedouble nUpdates = nTaskListCallsMeasured
+                                 * pow(2.0, nTimeLevels-1-volElem[l].timeLevel);
+
+    vector<passivedouble> &val = workPerType[key];
+    if( val.empty() ) val.assign(2, 0.0);
+    val[0] += 1.0;
+    val[1] += workElem[l]/nUpdates;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Gather the data of all ranks and determine the measured    ---*/
+  /*---         load imbalance.                                            ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /* Copy the data into a buffer of primitive types. Per element type
+     7 values are stored, the 5 values of the key, the number of elements
+     and the sum of the work per update. */
+  vector<su2double> locBuf;
+  map<vector<unsigned short>, vector<passivedouble> >::const_iterator MI;
+  for(MI=workPerType.begin(); MI!=workPerType.end(); ++MI) {
+    for(unsigned short i=0; i<5; ++i) locBuf.push_back(MI->first[i]);
+    locBuf.push_back(MI->second[0]);
+    locBuf.push_back(MI->second[1]);
+  }
+
+  workRank /= nTaskListCallsMeasured;
+  su2double workMax = workRank, workSum = workRank;
+  vector<su2double> globBuf = locBuf;
+
+#ifdef HAVE_MPI
+  su2double workLoc = workRank;
+  SU2_MPI::Allreduce(&workLoc, &workMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&workLoc, &workSum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  vector<int> recvCounts(size), displs(size);
+  int sizeLocal = locBuf.size();
+  SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
+                     MPI_INT, MPI_COMM_WORLD);
+
+  displs[0] = 0;
+  for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
+
+  globBuf.resize(displs.back() + recvCounts.back());
+  SU2_MPI::Allgatherv(locBuf.data(), sizeLocal, MPI_DOUBLE, globBuf.data(),
+                      recvCounts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+#endif
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: The master rank merges the data and writes the file with   ---*/
+  /*---         the measured work per update of every element type.       ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if(rank == MASTER_NODE) {
+
+    map<vector<unsigned short>, vector<passivedouble> > workGlobal;
+    for(unsigned long i=0; i<globBuf.size(); i+=7) {
+      vector<unsigned short> key(5);
+      for(unsigned short j=0; j<5; ++j)
+        key[j] = (unsigned short) SU2_TYPE::GetValue(globBuf[i+j]);
+
+      vector<passivedouble> &val = workGlobal[key];
+      if( val.empty() ) val.assign(2, 0.0);
+      val[0] += SU2_TYPE::GetValue(globBuf[i+5]);
+      val[1] += SU2_TYPE::GetValue(globBuf[i+6]);
+    }
+
+    const string fileName = config->GetWork_Weights_DG_FileName();
+    ofstream workFile(fileName.c_str());
+    if( !workFile.is_open() )
+      SU2_MPI::Error(string("Unable to open the file ") + fileName, CURRENT_FUNCTION);
+
+    workFile << "% Measured work per update of the DG elements, averaged over "
+             << nTaskListCallsMeasured << " executions of the task list." << endl;
+    workFile << "% VTK_Type nPolySol JacConstant TimeLevel WallModel nElem WorkPerUpdate" << endl;
+    workFile.precision(8);
+    for(MI=workGlobal.begin(); MI!=workGlobal.end(); ++MI) {
+      for(unsigned short j=0; j<5; ++j) workFile << MI->first[j] << " ";
+      workFile << (unsigned long) MI->second[0] << " "
+               << scientific << MI->second[1]/MI->second[0] << endl;
+    }
+    workFile.close();
+
+    const su2double workAvg = workSum/size;
+    cout << endl << "Measured work of the DG elements written to " << fileName << "." << endl;
+    if(workAvg > 0.0)
+      cout << "Measured load imbalance (max/average): " << workMax/workAvg << endl;
+    if( config->GetRepartition_Measured_Work_DG() )
+      cout << "The grid is repartitioned with these weights at the end of the time step." << endl << endl;
+    else
+      cout << "Restart with MEASURED_WORK_WEIGHTS_DG= YES to partition with these weights." << endl << endl;
+  }
+}
+
+#ifdef HAVE_OMP
+void CFEM_DG_EulerSolver::ProcessTaskListThreads_DG(CConfig   *config,
+                                                    CNumerics **numerics) {
+
+  /* Easier storage of the number of tasks and threads. */
+  const unsigned long nTasks   = tasksList.size();
+  const int           nThreads = nThreadsTaskList;
+
+  /* Minimum number of elements or faces in a chunk, such that the matrix
+     multiplications inside a chunk still have a good performance. */
+  const unsigned long nEntitiesMin = max(1, config->GetSizeMatMulPadding()/nVar);
+
+  /* The internal faces use the numerics object in the Riemann solver, unless
+     the Riemann solver is implemented in the DG solver itself. In the former
+     case the internal face tasks cannot be carried out simultaneously. */
+  const bool facesThreadSafe = (config->GetRiemann_Solver_FEM() == ROE) ||
+                               (config->GetRiemann_Solver_FEM() == LAX_FRIEDRICH);
+
+  /*--- Determine for every task the number of tasks that must be completed
+        before it can be carried out and the tasks that depend on it. All valid
+        entries of indMustBeCompleted are used, which is on the safe side. ---*/
+  vector<int> nDependOpen(nTasks, 0);
+  vector<vector<unsigned long> > dependentTasks(nTasks);
+
+  for(unsigned long i=0; i<nTasks; ++i) {
+    for(unsigned short ind=0; ind<5; ++ind) {
+      const int iDep = tasksList[i].indMustBeCompleted[ind];
+      if(iDep >= 0) {
+        ++nDependOpen[i];
+        dependentTasks[iDep].push_back(i);
+      }
+    }
+  }
+
+  /*--- Define the queues of chunks of the threads, the list of communication
+        tasks, which are only handled by the master thread, and the locks
+        to protect them. Also the number of chunks still to be completed for
+        every task and the total number of tasks still to be completed. ---*/
+  vector<deque<CTaskChunk> > queueChunks(nThreads);
+  vector<omp_lock_t>         lockQueue(nThreads);
+  for(int i=0; i<nThreads; ++i) omp_init_lock(&lockQueue[i]);
+
+  deque<unsigned long> queueComm;
+  omp_lock_t           lockComm;
+  omp_init_lock(&lockComm);
+
+  vector<long> nChunksOpen(nTasks, 0);
+  long nTasksOpen = nTasks;
+
+  /*--- Start of the parallel region. ---*/
+#pragma omp parallel num_threads(nThreads)
+  {
+    const int thread = omp_get_thread_num();
+
+    /* Allocate the work array of this thread and initialize it to zero to
+       avoid warnings in debug mode about uninitialized memory when padding
+       is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    /* The tasks that became ready to be carried out by this thread and
+       the tasks that were completed by this thread. The master thread
+       starts with the tasks that do not depend on others. */
+    vector<unsigned long> readyTasks, completedTasks;
+    if(thread == 0) {
+      for(unsigned long i=0; i<nTasks; ++i)
+        if(nDependOpen[i] == 0) readyTasks.push_back(i);
+    }
+
+    /* Loop until all tasks have been completed. */
+    for(;;) {
+
+      /*--- Split the tasks that became ready into chunks and put them in the
+            queue of this thread. The communication tasks are stored in the
+            communication queue. ---*/
+      for(unsigned long r=0; r<readyTasks.size(); ++r) {
+        const unsigned long i = readyTasks[r];
+
+        switch( tasksList[i].task ) {
+          case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+          case CTaskDefinition::COMPLETE_MPI_COMMUNICATION:
+          case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+          case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+            omp_set_lock(&lockComm);
+            queueComm.push_back(i);
+            omp_unset_lock(&lockComm);
+            break;
+          }
+
+          default: {
+            unsigned long rangeBeg, rangeEnd;
+            bool splitTask = RangeTask_DG(tasksList[i], rangeBeg, rangeEnd);
+            if((tasksList[i].task == CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS) &&
+               !facesThreadSafe) splitTask = false;
+
+            unsigned long nChunks = 1, chunkSize = rangeEnd - rangeBeg;
+            if(splitTask && (rangeEnd > rangeBeg)) {
+              const unsigned long nTarget = 4*nThreads;
+              chunkSize = max(nEntitiesMin, (rangeEnd - rangeBeg + nTarget - 1)/nTarget);
+              nChunks   = (rangeEnd - rangeBeg + chunkSize - 1)/chunkSize;
             }
 
-            default: {
+            nChunksOpen[i] = nChunks;
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
+            omp_set_lock(&lockQueue[thread]);
+            for(unsigned long c=0; c<nChunks; ++c) {
+              const unsigned long beg = rangeBeg + c*chunkSize;
+              const unsigned long end = min(rangeEnd, beg + chunkSize);
+              queueChunks[thread].push_back(CTaskChunk(i, beg, end));
             }
+            omp_unset_lock(&lockQueue[thread]);
+          }
+        }
+      }
+      readyTasks.clear();
+
+      /*--- The master thread attempts to carry out the communication tasks.
+            The completion is tested only, such that the master thread can
+            carry out other chunks while the communication is in progress. ---*/
+      if(thread == 0) {
+        omp_set_lock(&lockComm);
+        for(unsigned long r=0; r<queueComm.size();) {
+          const unsigned long i = queueComm[r];
+          if( CarryOutTask_DG(config, numerics, tasksList[i], 0, 0, false, workArray) ) {
+            completedTasks.push_back(i);
+            queueComm.erase(queueComm.begin()+r);
           }
+          else ++r;
         }
+        omp_unset_lock(&lockComm);
+      }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+      /*--- Take a chunk from the back of the own queue. If the own queue is
+            empty, steal a chunk from the front of the queue of another thread. ---*/
+      bool chunkFound = false;
+      CTaskChunk chunk;
+      for(int t=0; t<nThreads; ++t) {
+        const int tt = (thread + t)%nThreads;
+        omp_set_lock(&lockQueue[tt]);
+        if( !queueChunks[tt].empty() ) {
+          if(tt == thread) {chunk = queueChunks[tt].back();  queueChunks[tt].pop_back();}
+          else             {chunk = queueChunks[tt].front(); queueChunks[tt].pop_front();}
+          chunkFound = true;
+        }
+        omp_unset_lock(&lockQueue[tt]);
+        if( chunkFound ) break;
       }
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
-    }
+      if( chunkFound ) {
+
+        /*--- Carry out the chunk. The tasks that use shared objects, i.e. the
+              boundary conditions and the internal faces when the numerics object
+              is used for the Riemann solver, are carried out one at a time.
+              They share the same critical section, because both use the
+              numerics object of the convective term. ---*/
+        const CTaskDefinition &task = tasksList[chunk.indTask];
+        const bool faceTask = (task.task == CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS) ||
+                              (task.task == CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS);
+        const bool bcTask   = (task.task == CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED) ||
+                              (task.task == CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO);
+
+        if(bcTask || (faceTask && !facesThreadSafe)) {
+#pragma omp critical (FEM_DG_SharedNumerics)
+          CarryOutTask_DG(config, numerics, task, chunk.rangeBeg, chunk.rangeEnd, true, workArray);
+        }
+        else
+          CarryOutTask_DG(config, numerics, task, chunk.rangeBeg, chunk.rangeEnd, true, workArray);
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+        /* Make the results of this chunk visible to the other threads and
+           check whether this was the last chunk of the task. */
+#pragma omp flush
+        long nLeft;
+#pragma omp atomic capture
+        nLeft = --nChunksOpen[chunk.indTask];
+
+        if(nLeft == 0) completedTasks.push_back(chunk.indTask);
+      }
+
+      /*--- Update the dependencies of the tasks that depend on the tasks
+            completed by this thread. Tasks of which all dependencies are
+            completed are ready to be carried out. ---*/
+      for(unsigned long r=0; r<completedTasks.size(); ++r) {
+        const unsigned long i = completedTasks[r];
+        for(unsigned long k=0; k<dependentTasks[i].size(); ++k) {
+          const unsigned long iDep = dependentTasks[i][k];
+          int nOpen;
+#pragma omp atomic capture
+          nOpen = --nDependOpen[iDep];
+
+          if(nOpen == 0) readyTasks.push_back(iDep);
+        }
+
+#pragma omp atomic
+        --nTasksOpen;
+      }
+      completedTasks.clear();
+
+      /*--- Check whether all tasks have been completed. A thread without
+            work may only stop when this is the case. ---*/
+      if( chunkFound || readyTasks.size() ) continue;
+
+      long nOpenTasks;
+#pragma omp atomic read
+      nOpenTasks = nTasksOpen;
+
+      if(nOpenTasks == 0) break;
+    }
   }
+
+  /* Release the locks. */
+  for(int i=0; i<nThreads; ++i) omp_destroy_lock(&lockQueue[i]);
+  omp_destroy_lock(&lockComm);
 }
+#endif
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
                                                     CNumerics **numerics, CConfig *config,
@@ -4405,11 +5398,12 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
   const unsigned short nTimeIntegrationPoints = config->GetnTimeIntegrationADER_DG();
   const su2double     *timeIntegrationWeights = config->GetWeightsIntegrationADER_DG();
   const bool          useAliasedPredictor     = config->GetKind_ADER_Predictor() == ADER_ALIASED_PREDICTOR;
+  const bool          warmStartPredictor      = config->GetWarmStart_ADER_Predictor();
 
    /* Determine the number of solution entities that are treated simultaneously
       in the matrix products to obtain good gemm performance. A solution entity
-      can be a time integration point (to compute the fluxes) or a time DOF
-      in the actual iteration process. */
+      can be a time integration point of an element (to compute the fluxes) or
+      a time DOF in the actual iteration process. */
   const unsigned short NPad       = config->GetSizeMatMulPadding();
   const unsigned short nTimeSimul = NPad/nVar;
 
@@ -4417,17 +5411,6 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
      corresponds to 64 byte alignment. */
   const unsigned short NPadMin = 64/sizeof(passivedouble);
 
-  /* Determine the number of time integration points that are treated
-     simultaneously for better gemm performance as well as the number of
-     loops to treat all time integration points. */
-  unsigned short nTimeSimulLastInts = nTimeIntegrationPoints%nTimeSimul;
-  unsigned short nTimeIntLoop       = nTimeIntegrationPoints/nTimeSimul;
-  if(nTimeSimulLastInts == 0) nTimeSimulLastInts = nTimeSimul;
-  else                        ++nTimeIntLoop;
-
-  unsigned short NPadLastInts = nTimeSimulLastInts*nVar;
-  if( NPadLastInts%NPadMin ) NPadLastInts += NPadMin - (NPadLastInts%NPadMin);
-
   /* Idem for the time DOFs. */
   unsigned short nTimeSimulLastDOFs = nTimeDOFs%nTimeSimul;
   unsigned short nTimeDOFLoop       = nTimeDOFs/nTimeSimul;
@@ -4443,85 +5426,133 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
      mass matrix, is carried out. */
   const unsigned short NPadResTot = (nTimeDOFLoop-1)*NPad + NPadLastDOFs;
 
+  /* Vectors to store the elements of the entities that are treated
+     simultaneously in the residual computation and the elements of a
+     chunk for which the predictor solution is not converged yet. */
+  vector<CVolumeElementFEM *> elemEntity(nTimeSimul);
+  vector<unsigned short>      activeElem(nElemSimulPredictorADER);
+
   /*--------------------------------------------------------------------------*/
   /*--- Loop over the given elemen range to compute the predictor solution.---*/
   /*--- For the predictor solution only an integration over the element is ---*/
   /*--- performed to obtain the weak formulation, i.e. no integration by   ---*/
   /*--- parts. As a consequence there is no surface term and also no       ---*/
   /*--- coupling with neighboring elements. This is also the reason why    ---*/
-  /*--- the ADER scheme is only conditionally stable.                      ---*/
+  /*--- the ADER scheme is only conditionally stable. Elements with the    ---*/
+  /*--- same standard element are treated in chunks, such that the time   ---*/
+  /*--- integration points of several elements fill the padded N value of  ---*/
+  /*--- the matrix products in the residual computation. As a consequence, ---*/
+  /*--- the update of the counter l happens at the end of this loop.       ---*/
   /*--------------------------------------------------------------------------*/
 
-  for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+  for(unsigned long l=elemBeg; l<elemEnd;) {
+
+    /* Determine the end index and the number of elements of this chunk. */
+    unsigned long lEnd;
+    unsigned short ind, llEnd, NPadChunk;
+
+    MetaDataChunkOfElem(volElem, l, elemEnd, nElemSimulPredictorADER, NPadMin,
+                        lEnd, ind, llEnd, NPadChunk);
 
     /* Easier storage of the number of spatial DOFs and the total
-       number of variables for this element per time level. */
+       number of variables for an element per time level. */
     const unsigned short nDOFs     = volElem[l].nDOFsSol;
     const unsigned short nVarNDOFs = nVar*nDOFs;
+    const unsigned int   sizeSolPredElem = nVarNDOFs*nTimeDOFs;
+    const unsigned int   sizeResTotElem  = NPadResTot*nDOFs;
 
-    /* Set the pointers for the working variables. */
+    /* Set the pointers for the working variables. The predictor solution
+       and the total residual are stored for all elements of the chunk. */
     su2double *resInt  = workArray;
-    su2double *solPred = resInt  + NPad*nDOFs;
-    su2double *dSol    = solPred + nVarNDOFs*nTimeDOFs;
-    su2double *resTot  = dSol    + nVarNDOFs*nTimeDOFs;
-    su2double *solInt  = resTot  + NPadResTot*nDOFs;
-    su2double *work    = solInt  + NPad*nDOFs;
-
-    /* Initialize the predictor solution to the current solution. */
-    const su2double    *solCur = VecSolDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+    su2double *solInt  = resInt  + NPad*nDOFs;
+    su2double *dSol    = solInt  + NPad*nDOFs;
+    su2double *solPred = dSol    + sizeSolPredElem;
+    su2double *resTot  = solPred + llEnd*sizeSolPredElem;
+    su2double *work    = resTot  + llEnd*sizeResTotElem;
+
+    /* Initialize the predictor solution. For a warm start the predictor solution
+       of the previous time step is extrapolated, if available. Otherwise, or when
+       the extrapolation gives an unphysical solution, the predictor solution is
+       initialized to the current solution. */
     const unsigned long nBytes = nVarNDOFs*sizeof(su2double);
 
-    for(unsigned short j=0; j<nTimeDOFs; ++j) {
-      su2double *solPredTimeInd = solPred + j*nVarNDOFs;
-      memcpy(solPredTimeInd, solCur, nBytes);
+    for(unsigned short ll=0; ll<llEnd; ++ll) {
+      const unsigned long lInd   = l + ll;
+      const su2double    *solCur = VecSolDOFs.data() + nVar*volElem[lInd].offsetDOFsSolLocal;
+      su2double *solPredElem     = solPred + ll*sizeSolPredElem;
+
+      bool predictorInitialized = false;
+      if(warmStartPredictor && (VecDeltaTimePredictorADER[lInd] > 0.0))
+        predictorInitialized = ADER_DG_WarmStartPredictor(config, lInd, solPredElem);
+
+      if( !predictorInitialized ) {
+        for(unsigned short j=0; j<nTimeDOFs; ++j) {
+          su2double *solPredTimeInd = solPredElem + j*nVarNDOFs;
+          memcpy(solPredTimeInd, solCur, nBytes);
+        }
+      }
+
+      activeElem[ll] = ll;
     }
 
     /*-------------------------------------------------------------------------*/
     /*--- Iterative algorithm to compute the predictor solution for all     ---*/
-    /*--- the time DOFs of this element simultaneously.                     ---*/
+    /*--- the time DOFs of the elements of this chunk simultaneously. An    ---*/
+    /*--- element is removed from activeElem as soon as its predictor       ---*/
+    /*--- solution is converged, such that no work is spent on it anymore.  ---*/
     /*-------------------------------------------------------------------------*/
 
-    for(;;) {
+    unsigned short nActive = llEnd;
+    while(nActive > 0) {
 
-      /* Initialize the total residual to zero. */
-      for(unsigned short i=0; i<(NPadResTot*nDOFs); ++i) resTot[i] = 0.0;
+      /* Initialize the total residual of the active elements to zero. */
+      for(unsigned short a=0; a<nActive; ++a) {
+        su2double *resTotElem = resTot + activeElem[a]*sizeResTotElem;
+        for(unsigned int i=0; i<sizeResTotElem; ++i) resTotElem[i] = 0.0;
+      }
 
-      /* Loop, such that all time integration points are treated. Note that
-         inside this loop, several time integration points are treated
-         simultaneously. */
-      for(unsigned short timeIntLoop=0; timeIntLoop<nTimeIntLoop; ++timeIntLoop) {
+      /* Loop over the entities, i.e. the combinations of an active element and
+         a time integration point. Inside this loop, nTimeSimul entities are
+         treated simultaneously. */
+      const unsigned short nEntities = nActive*nTimeIntegrationPoints;
+      for(unsigned short entStart=0; entStart<nEntities; entStart+=nTimeSimul) {
 
-        /* Determine the starting and ending time integration point, as well as
-           the value of the padding to be applied. */
-        const unsigned short intStart = timeIntLoop*nTimeSimul;
-        const unsigned short intEnd   = (timeIntLoop == (nTimeIntLoop-1)) ?
-                                        intStart + nTimeSimulLastInts : intStart + nTimeSimul;
+        /* Determine the ending entity and the value of the padding to be applied. */
+        const unsigned short entEnd    = min(nEntities, (unsigned short) (entStart+nTimeSimul));
+        const unsigned short nEntSimul = entEnd - entStart;
 
-        const unsigned short NPadInt = (timeIntLoop == (nTimeIntLoop-1)) ? NPadLastInts : NPad;
+        unsigned short NPadInt = nEntSimul*nVar;
+        if( NPadInt%NPadMin ) NPadInt += NPadMin - (NPadInt%NPadMin);
 
         /*--------------------------------------------------------------------*/
         /*--- Interpolate the predictor solution to the time integration   ---*/
-        /*--- points to be computed. It is possible, or even likely, that  ---*/
+        /*--- points of the entities. It is possible, or even likely, that ---*/
         /*--- these integration points coincide with the locations of the  ---*/
         /*--- time DOFs. When this is the case the interpolation boils     ---*/
-        /*--- down to a copy. Note that the solution of the integration    ---*/
-        /*--- points are stored such that a simultaneous treatment of the  ---*/
-        /*--- integration points is possible.                              ---*/
+        /*--- down to a copy. Note that the solution of the entities is    ---*/
+        /*--- stored such that a simultaneous treatment is possible.       ---*/
         /*--------------------------------------------------------------------*/
 
         /* Initialize the interpolated solution to zero. */
         for(unsigned short i=0; i<(NPadInt*nDOFs); ++i) solInt[i] = 0.0;
 
-        for(unsigned short intPoint=intStart; intPoint<intEnd; ++intPoint) {
+        for(unsigned short ent=entStart; ent<entEnd; ++ent) {
+
+          /* Determine the element and the time integration point of this entity. */
+          const unsigned short ll       = activeElem[ent/nTimeIntegrationPoints];
+          const unsigned short intPoint = ent%nTimeIntegrationPoints;
+          const su2double *solPredElem  = solPred + ll*sizeSolPredElem;
+
+          elemEntity[ent-entStart] = volElem + l + ll;
 
           /* Store the interpolation data for this time integration point. */
           const su2double *DOFToThisTimeInt = timeInterpolDOFToIntegrationADER_DG
                                             + intPoint*nTimeDOFs;
 
           /* Set the pointer to the address of the 1st variable of the 1st DOF
-             for this integration point. In this way there is no need to
-             account for this offset in the actual interpolation loop. */
-          su2double *solThisInt = solInt + nVar*(intPoint - intStart);
+             for this entity. In this way there is no need to account for this
+             offset in the actual interpolation loop. */
+          su2double *solThisInt = solInt + nVar*(ent - entStart);
 
           /* Carry out the actual interpolation. Make a distinction between
              2D and 3D for performance reasons. */
@@ -4536,10 +5567,10 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
                     const unsigned int indSol  = i*NPadInt;
                     const unsigned int indPred = indPredTime + i*nVar;
 
-                    solThisInt[indSol]   += DOFToThisTimeInt[j]*solPred[indPred];
-                    solThisInt[indSol+1] += DOFToThisTimeInt[j]*solPred[indPred+1];
-                    solThisInt[indSol+2] += DOFToThisTimeInt[j]*solPred[indPred+2];
-                    solThisInt[indSol+3] += DOFToThisTimeInt[j]*solPred[indPred+3];
+                    solThisInt[indSol]   += DOFToThisTimeInt[j]*solPredElem[indPred];
+                    solThisInt[indSol+1] += DOFToThisTimeInt[j]*solPredElem[indPred+1];
+                    solThisInt[indSol+2] += DOFToThisTimeInt[j]*solPredElem[indPred+2];
+                    solThisInt[indSol+3] += DOFToThisTimeInt[j]*solPredElem[indPred+3];
                   }
                 }
               }
@@ -4557,11 +5588,11 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
                     const unsigned int indSol  = i*NPadInt;
                     const unsigned int indPred = indPredTime + i*nVar;
 
-                    solThisInt[indSol]   += DOFToThisTimeInt[j]*solPred[indPred];
-                    solThisInt[indSol+1] += DOFToThisTimeInt[j]*solPred[indPred+1];
-                    solThisInt[indSol+2] += DOFToThisTimeInt[j]*solPred[indPred+2];
-                    solThisInt[indSol+3] += DOFToThisTimeInt[j]*solPred[indPred+3];
-                    solThisInt[indSol+4] += DOFToThisTimeInt[j]*solPred[indPred+4];
+                    solThisInt[indSol]   += DOFToThisTimeInt[j]*solPredElem[indPred];
+                    solThisInt[indSol+1] += DOFToThisTimeInt[j]*solPredElem[indPred+1];
+                    solThisInt[indSol+2] += DOFToThisTimeInt[j]*solPredElem[indPred+2];
+                    solThisInt[indSol+3] += DOFToThisTimeInt[j]*solPredElem[indPred+3];
+                    solThisInt[indSol+4] += DOFToThisTimeInt[j]*solPredElem[indPred+4];
                   }
                 }
               }
@@ -4573,70 +5604,73 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
 
         /*--------------------------------------------------------------------*/
         /*--- Compute the spatial residual of the predictor step for the   ---*/
-        /*--- time integration points considered. A distinction is made    ---*/
-        /*--- between an aliased and a non-aliased evaluation of the       ---*/
-        /*--- predictor residual and between 2D and 3D. The latter is for  ---*/
+        /*--- entities considered. A distinction is made between an        ---*/
+        /*--- aliased and a non-aliased evaluation of the predictor        ---*/
+        /*--- residual and between 2D and 3D. The latter is for            ---*/
         /*--- performance reasons.                                         ---*/
         /*--------------------------------------------------------------------*/
 
-        const unsigned short nIntSimul = intEnd - intStart;
         switch( nDim ) {
           case 2: {
             if( useAliasedPredictor )
-              ADER_DG_AliasedPredictorResidual_2D(config, &volElem[l], solInt,
-                                                  nIntSimul, NPadInt, resInt, work);
+              ADER_DG_AliasedPredictorResidual_2D(config, elemEntity.data(), solInt,
+                                                  nEntSimul, NPadInt, resInt, work);
             else
-              ADER_DG_NonAliasedPredictorResidual_2D(config, &volElem[l], solInt,
-                                                     nIntSimul, NPadInt, resInt, work);
+              ADER_DG_NonAliasedPredictorResidual_2D(config, elemEntity.data(), solInt,
+                                                     nEntSimul, NPadInt, resInt, work);
             break;
           }
 
           case 3: {
             if( useAliasedPredictor )
-              ADER_DG_AliasedPredictorResidual_3D(config, &volElem[l], solInt,
-                                                  nIntSimul, NPadInt, resInt, work);
+              ADER_DG_AliasedPredictorResidual_3D(config, elemEntity.data(), solInt,
+                                                  nEntSimul, NPadInt, resInt, work);
             else
-              ADER_DG_NonAliasedPredictorResidual_3D(config, &volElem[l], solInt,
-                                                     nIntSimul, NPadInt, resInt, work);
+              ADER_DG_NonAliasedPredictorResidual_3D(config, elemEntity.data(), solInt,
+                                                     nEntSimul, NPadInt, resInt, work);
             break;
           }
         }
 
         /*--------------------------------------------------------------------*/
-        /*--- Update the total residual with the residual of the time      ---*/
-        /*--- integration points considered. Note the minus sign, because  ---*/
-        /*--- the residual is put on the RHS of the equation. Also note    ---*/
-        /*--- that the residuals are stored in such a way that a memcpy    ---*/
-        /*--- call is avoided when the multiplication takes place with the ---*/
+        /*--- Update the total residual of the elements with the residual  ---*/
+        /*--- of the entities considered. Note the minus sign, because the ---*/
+        /*--- residual is put on the RHS of the equation. Also note that   ---*/
+        /*--- the residuals are stored in such a way that a memcpy call is ---*/
+        /*--- avoided when the multiplication takes place with the         ---*/
         /*--- iteration matrix (i.e. mass matrix) later on.                ---*/
         /*--------------------------------------------------------------------*/
 
-        /* Loop such that all time DOFs are treated. Note that in this loop
-           several time DOFs are treated simultaneously. */
-        for(unsigned short timeDOFLoop=0; timeDOFLoop<nTimeDOFLoop; ++timeDOFLoop) {
+        for(unsigned short ent=entStart; ent<entEnd; ++ent) {
 
-          /* Set the pointer where the residual for this chunk of time DOFs starts. */
-          su2double *res = resTot + timeDOFLoop*NPad*nDOFs;
+          /* Determine the element and the time integration point of this entity. */
+          const unsigned short ll       = activeElem[ent/nTimeIntegrationPoints];
+          const unsigned short intPoint = ent%nTimeIntegrationPoints;
+          su2double *resTotElem         = resTot + ll*sizeResTotElem;
 
-          /* Determine the starting and ending time DOF, as well as
-             the value of the padding to be applied. */
-          const unsigned short DOFStart = timeDOFLoop*nTimeSimul;
-          const unsigned short DOFEnd   = (timeDOFLoop == (nTimeDOFLoop-1)) ?
-                                          DOFStart + nTimeSimulLastDOFs : DOFStart + nTimeSimul;
+          /* Set the pointer to the address of the 1st residual of the 1st DOF
+             for this entity. In this way there is no need to account for this
+             offset in the loop below. */
+          const su2double *resThisInt = resInt + nVar*(ent - entStart);
 
-          const unsigned short NPadDOF = (timeDOFLoop == (nTimeDOFLoop-1)) ? NPadLastDOFs : NPad;
+          /* Store the interpolation data for this time integration point. */
+          const su2double *DOFToThisTimeInt = timeInterpolDOFToIntegrationADER_DG
+                                            + intPoint*nTimeDOFs;
+
+          /* Loop such that all time DOFs are treated. Note that in this loop
+             several time DOFs are treated simultaneously. */
+          for(unsigned short timeDOFLoop=0; timeDOFLoop<nTimeDOFLoop; ++timeDOFLoop) {
 
-          /* Loop over the time integration points that are treated simultaneously. */
-          for(unsigned short intPoint=intStart; intPoint<intEnd; ++intPoint) {
+            /* Set the pointer where the residual for this chunk of time DOFs starts. */
+            su2double *res = resTotElem + timeDOFLoop*NPad*nDOFs;
 
-            /* Set the pointer to the address of the 1st residual of the 1st DOF
-               for this integration point. In this way there is no need to
-               account for this offset in the loop below. */
-            const su2double *resThisInt = resInt + nVar*(intPoint - intStart);
+            /* Determine the starting and ending time DOF, as well as
+               the value of the padding to be applied. */
+            const unsigned short DOFStart = timeDOFLoop*nTimeSimul;
+            const unsigned short DOFEnd   = (timeDOFLoop == (nTimeDOFLoop-1)) ?
+                                            DOFStart + nTimeSimulLastDOFs : DOFStart + nTimeSimul;
 
-            /* Store the interpolation data for this time integration point. */
-            const su2double *DOFToThisTimeInt = timeInterpolDOFToIntegrationADER_DG
-                                              + intPoint*nTimeDOFs;
+            const unsigned short NPadDOF = (timeDOFLoop == (nTimeDOFLoop-1)) ? NPadLastDOFs : NPad;
 
             /* Update the actual interpolation. Make a distinction between
                2D and 3D for performance reasons. */
@@ -4655,7 +5689,7 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
                        the length of the interval in parameter space, [-1..1], is 2. */
                     const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
                     const su2double w = 0.5*timeIntegrationWeights[intPoint]
-                                      * VecDeltaTime[l]*DOFToThisTimeInt[iTimeDOF];
+                                      * VecDeltaTime[l+ll]*DOFToThisTimeInt[iTimeDOF];
 
                     /* Loop over the number of spatial DOFs to update their residuals. Note
                        the minus sign, see the comment in the larger comment section above. */
@@ -4689,7 +5723,7 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
                        the length of the interval in parameter space, [-1..1], is 2. */
                     const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
                     const su2double w = 0.5*timeIntegrationWeights[intPoint]
-                                      * VecDeltaTime[l]*DOFToThisTimeInt[iTimeDOF];
+                                      * VecDeltaTime[l+ll]*DOFToThisTimeInt[iTimeDOF];
 
                     /* Loop over the number of spatial DOFs to update their residuals. Note
                        the minus sign, see the comment in the larger comment section above. */
@@ -4715,211 +5749,305 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
       }
 
       /*----------------------------------------------------------------------*/
-      /*--- Determine the updates of the solution of the time DOFs         ---*/
-      /*--- relative to the solution of the previous time step. This is    ---*/
-      /*--- accomplished by multiplying the total residual of the spatial  ---*/
-      /*--- DOFs in all time DOFs by the inverse of the mass matrix and an ---*/
-      /*--- appropriate weight (timeCoefADER_DG). The residual of the time ---*/
-      /*--- DOFs is stored such that multiple time DOFs can be treated     ---*/
-      /*--- simultaneously without the need for a memcpy. In this way the  ---*/
-      /*--- performance of the matrix multiplication is optimal.           ---*/
+      /*--- Loop over the active elements to update their predictor        ---*/
+      /*--- solution and to determine which elements remain active.        ---*/
       /*----------------------------------------------------------------------*/
 
-      /* Initialize the update to zero. */
-      for(unsigned short i=0; i<(nVarNDOFs*nTimeDOFs); ++i) dSol[i] = 0.0;
+      unsigned short nActiveNew = 0;
+      for(unsigned short a=0; a<nActive; ++a) {
+
+        /* Easier storage of the data of this element. */
+        const unsigned short ll     = activeElem[a];
+        const unsigned long  lInd   = l + ll;
+        const su2double     *solCur = VecSolDOFs.data() + nVar*volElem[lInd].offsetDOFsSolLocal;
+        su2double *solPredElem      = solPred + ll*sizeSolPredElem;
+        su2double *resTotElem       = resTot  + ll*sizeResTotElem;
+
+        /*--------------------------------------------------------------------*/
+        /*--- Determine the updates of the solution of the time DOFs       ---*/
+        /*--- relative to the solution of the previous time step. This is  ---*/
+        /*--- accomplished by multiplying the total residual of the        ---*/
+        /*--- spatial DOFs in all time DOFs by the inverse of the mass     ---*/
+        /*--- matrix and an appropriate weight (timeCoefADER_DG). The      ---*/
+        /*--- residual of the time DOFs is stored such that multiple time  ---*/
+        /*--- DOFs can be treated simultaneously without the need for a    ---*/
+        /*--- memcpy. In this way the performance of the matrix            ---*/
+        /*--- multiplication is optimal.                                   ---*/
+        /*--------------------------------------------------------------------*/
 
-      /* Loop such that all time DOFs are treated. Note that in this loop
-         several time DOFs are treated simultaneously. */
-      for(unsigned short timeDOFLoop=0; timeDOFLoop<nTimeDOFLoop; ++timeDOFLoop) {
+        /* Initialize the update to zero. */
+        for(unsigned short i=0; i<(nVarNDOFs*nTimeDOFs); ++i) dSol[i] = 0.0;
+
+        /* Loop such that all time DOFs are treated. Note that in this loop
+           several time DOFs are treated simultaneously. */
+        for(unsigned short timeDOFLoop=0; timeDOFLoop<nTimeDOFLoop; ++timeDOFLoop) {
 
-        /* Set the pointer where the residual for this chunk of time DOFs starts. */
-        su2double *res = resTot + timeDOFLoop*NPad*nDOFs;
+          /* Set the pointer where the residual for this chunk of time DOFs starts. */
+          su2double *res = resTotElem + timeDOFLoop*NPad*nDOFs;
 
-        /* Determine the starting and ending time DOF, as well as
-           the value of the padding to be applied. */
-        const unsigned short DOFStart = timeDOFLoop*nTimeSimul;
-        const unsigned short DOFEnd   = (timeDOFLoop == (nTimeDOFLoop-1)) ?
-                                        DOFStart + nTimeSimulLastDOFs : DOFStart + nTimeSimul;
+          /* Determine the starting and ending time DOF, as well as
+             the value of the padding to be applied. */
+          const unsigned short DOFStart = timeDOFLoop*nTimeSimul;
+          const unsigned short DOFEnd   = (timeDOFLoop == (nTimeDOFLoop-1)) ?
+                                          DOFStart + nTimeSimulLastDOFs : DOFStart + nTimeSimul;
 
-        const unsigned short NPadDOF = (timeDOFLoop == (nTimeDOFLoop-1)) ? NPadLastDOFs : NPad;
+          const unsigned short NPadDOF = (timeDOFLoop == (nTimeDOFLoop-1)) ? NPadLastDOFs : NPad;
 
-        /* Carry out the multiplication with the inverse of the mass matrix.
-           The result is stored in resInt as temporary storage. */
-        blasFunctions->gemm(nDOFs, NPadDOF, nDOFs, volElem[l].invMassMatrix.data(),
-                            res, resInt, config);
+          /* Carry out the multiplication with the inverse of the mass matrix.
+             The result is stored in resInt as temporary storage. */
+          blasFunctions->gemm(nDOFs, NPadDOF, nDOFs, volElem[lInd].invMassMatrix.data(),
+                              res, resInt, config);
 
-        /* Make a distinction between 2D and 3D for performance reasons. */
-        switch( nDim ) {
-          case 2: {
+          /* Make a distinction between 2D and 3D for performance reasons. */
+          switch( nDim ) {
+            case 2: {
 
-            /* Loop over the time DOFs for this chunk of time DOFs. */
-            for(unsigned short iTimeDOF=DOFStart; iTimeDOF<DOFEnd; ++iTimeDOF) {
+              /* Loop over the time DOFs for this chunk of time DOFs. */
+              for(unsigned short iTimeDOF=DOFStart; iTimeDOF<DOFEnd; ++iTimeDOF) {
 
-              /* Index of the 1st entry of the 1st spatial DOF starts for this time DOF. */
-              const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
+                /* Index of the 1st entry of the 1st spatial DOF starts for this time DOF. */
+                const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
 
-              /* Loop over all the time DOFs to compute the contribution of
-                 iTimeDOF to the update. */
-              for(unsigned short jTimeDOF=0; jTimeDOF<nTimeDOFs; ++jTimeDOF) {
+                /* Loop over all the time DOFs to compute the contribution of
+                   iTimeDOF to the update. */
+                for(unsigned short jTimeDOF=0; jTimeDOF<nTimeDOFs; ++jTimeDOF) {
 
-                /* Easier storage of the ADER coefficient of timeDOF jTimeDOF
-                   to the residual of iTimeDOF and determine the starting
-                   index for the update for timeDOF jTimeDOF. */
-                const su2double coefADER = timeCoefADER_DG[jTimeDOF*nTimeDOFs+iTimeDOF];
-                const unsigned int indDSolTimeInd = jTimeDOF*nVarNDOFs;
+                  /* Easier storage of the ADER coefficient of timeDOF jTimeDOF
+                     to the residual of iTimeDOF and determine the starting
+                     index for the update for timeDOF jTimeDOF. */
+                  const su2double coefADER = timeCoefADER_DG[jTimeDOF*nTimeDOFs+iTimeDOF];
+                  const unsigned int indDSolTimeInd = jTimeDOF*nVarNDOFs;
 
-                /* Loop over the spatial DOFs for timeDOF jTimeDOF and update dSol. */
-                for(unsigned short i=0; i<nDOFs; ++i) {
+                  /* Loop over the spatial DOFs for timeDOF jTimeDOF and update dSol. */
+                  for(unsigned short i=0; i<nDOFs; ++i) {
 
-                  const unsigned int indResInt = indResThisTimeDOF + i*NPadDOF;
-                  const unsigned int indDSol   = indDSolTimeInd    + i*nVar;
+                    const unsigned int indResInt = indResThisTimeDOF + i*NPadDOF;
+                    const unsigned int indDSol   = indDSolTimeInd    + i*nVar;
 
-                  dSol[indDSol]   += coefADER*resInt[indResInt];
-                  dSol[indDSol+1] += coefADER*resInt[indResInt+1];
-                  dSol[indDSol+2] += coefADER*resInt[indResInt+2];
-                  dSol[indDSol+3] += coefADER*resInt[indResInt+3];
+                    dSol[indDSol]   += coefADER*resInt[indResInt];
+                    dSol[indDSol+1] += coefADER*resInt[indResInt+1];
+                    dSol[indDSol+2] += coefADER*resInt[indResInt+2];
+                    dSol[indDSol+3] += coefADER*resInt[indResInt+3];
+                  }
                 }
               }
-            }
 
-            break;
-          }
+              break;
+            }
 
-          case 3: {
+            case 3: {
 
-            /* Loop over the time DOFs for this chunk of time DOFs. */
-            for(unsigned short iTimeDOF=DOFStart; iTimeDOF<DOFEnd; ++iTimeDOF) {
+              /* Loop over the time DOFs for this chunk of time DOFs. */
+              for(unsigned short iTimeDOF=DOFStart; iTimeDOF<DOFEnd; ++iTimeDOF) {
 
-              /* Index of the 1st entry of the 1st spatial DOF starts for this time DOF. */
-              const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
+                /* Index of the 1st entry of the 1st spatial DOF starts for this time DOF. */
+                const unsigned int indResThisTimeDOF = nVar*(iTimeDOF-DOFStart);
 
-              /* Loop over all the time DOFs to compute the contribution of
-                 iTimeDOF to the update. */
-              for(unsigned short jTimeDOF=0; jTimeDOF<nTimeDOFs; ++jTimeDOF) {
+                /* Loop over all the time DOFs to compute the contribution of
+                   iTimeDOF to the update. */
+                for(unsigned short jTimeDOF=0; jTimeDOF<nTimeDOFs; ++jTimeDOF) {
 
-                /* Easier storage of the ADER coefficient of timeDOF jTimeDOF
-                   to the residual of iTimeDOF and determine the starting
-                   index for the update for timeDOF jTimeDOF. */
-                const su2double coefADER = timeCoefADER_DG[jTimeDOF*nTimeDOFs+iTimeDOF];
-                const unsigned int indDSolTimeInd = jTimeDOF*nVarNDOFs;
+                  /* Easier storage of the ADER coefficient of timeDOF jTimeDOF
+                     to the residual of iTimeDOF and determine the starting
+                     index for the update for timeDOF jTimeDOF. */
+                  const su2double coefADER = timeCoefADER_DG[jTimeDOF*nTimeDOFs+iTimeDOF];
+                  const unsigned int indDSolTimeInd = jTimeDOF*nVarNDOFs;
 
-                /* Loop over the spatial DOFs for timeDOF jTimeDOF and update dSol. */
-                for(unsigned short i=0; i<nDOFs; ++i) {
+                  /* Loop over the spatial DOFs for timeDOF jTimeDOF and update dSol. */
+                  for(unsigned short i=0; i<nDOFs; ++i) {
 
-                  const unsigned int indResInt = indResThisTimeDOF + i*NPadDOF;
-                  const unsigned int indDSol   = indDSolTimeInd    + i*nVar;
+                    const unsigned int indResInt = indResThisTimeDOF + i*NPadDOF;
+                    const unsigned int indDSol   = indDSolTimeInd    + i*nVar;
 
-                  dSol[indDSol]   += coefADER*resInt[indResInt];
-                  dSol[indDSol+1] += coefADER*resInt[indResInt+1];
-                  dSol[indDSol+2] += coefADER*resInt[indResInt+2];
-                  dSol[indDSol+3] += coefADER*resInt[indResInt+3];
-                  dSol[indDSol+4] += coefADER*resInt[indResInt+4];
-                } 
-              } 
-            } 
+                    dSol[indDSol]   += coefADER*resInt[indResInt];
+                    dSol[indDSol+1] += coefADER*resInt[indResInt+1];
+                    dSol[indDSol+2] += coefADER*resInt[indResInt+2];
+                    dSol[indDSol+3] += coefADER*resInt[indResInt+3];
+                    dSol[indDSol+4] += coefADER*resInt[indResInt+4];
+                  }
+                }
+              }
 
-            break;
+              break;
+            }
           }
         }
-      }
 
-      /*----------------------------------------------------------------------*/
-      /*--- Determine whether or not the iteration process is considered   ---*/
-      /*--- converged. Make a distinction between 2D and 3D for            ---*/
-      /*--- performance reasons.                                           ---*/
-      /*----------------------------------------------------------------------*/
+        /*--------------------------------------------------------------------*/
+        /*--- Determine whether or not the iteration process is considered ---*/
+        /*--- converged for this element. Make a distinction between 2D    ---*/
+        /*--- and 3D for performance reasons.                              ---*/
+        /*--------------------------------------------------------------------*/
 
-      /* Initialize converged to true. It will be overwritten below when one
-         or more DOFs in both space and time are not considered converged. */
-      bool converged = true;
+        /* Initialize converged to true. It will be overwritten below when one
+           or more DOFs in both space and time are not considered converged. */
+        bool converged = true;
 
-      switch( nDim ) {
-        case 2: {
-          /* 2D simulation. Loop over the time DOFs to determine the new
-             solution and to determine whether or not the iteration procedure
-             is considered converged. */
-          for(unsigned short j=0; j<nTimeDOFs; ++j) {
-            su2double       *solTimeInd  = solPred + j*nVarNDOFs;
-            const su2double *dSolTimeInd = dSol    + j*nVarNDOFs;
+        switch( nDim ) {
+          case 2: {
+            /* 2D simulation. Loop over the time DOFs to determine the new
+               solution and to determine whether or not the iteration procedure
+               is considered converged. */
+            for(unsigned short j=0; j<nTimeDOFs; ++j) {
+              su2double       *solTimeInd  = solPredElem + j*nVarNDOFs;
+              const su2double *dSolTimeInd = dSol        + j*nVarNDOFs;
 
-            for(unsigned short i=0; i<nDOFs; ++i) {
-              const unsigned short off = i*nVar;
-              const su2double *ssolCur = solCur + off;
-              const su2double *ddSol   = dSolTimeInd + off;
-              su2double       *ssol    = solTimeInd  + off;
+              for(unsigned short i=0; i<nDOFs; ++i) {
+                const unsigned short off = i*nVar;
+                const su2double *ssolCur = solCur + off;
+                const su2double *ddSol   = dSolTimeInd + off;
+                su2double       *ssol    = solTimeInd  + off;
 
-              su2double solOld;
-              solOld  = ssol[0]; ssol[0] = ssolCur[0] + ddSol[0];
-              solOld -= ssol[0]; if(fabs(solOld) > TolSolADER[0]) converged = false;
+                su2double solOld;
+                solOld  = ssol[0]; ssol[0] = ssolCur[0] + ddSol[0];
+                solOld -= ssol[0]; if(fabs(solOld) > TolSolADER[0]) converged = false;
 
-              solOld  = ssol[1]; ssol[1] = ssolCur[1] + ddSol[1];
-              solOld -= ssol[1]; if(fabs(solOld) > TolSolADER[1]) converged = false;
+                solOld  = ssol[1]; ssol[1] = ssolCur[1] + ddSol[1];
+                solOld -= ssol[1]; if(fabs(solOld) > TolSolADER[1]) converged = false;
 
-              solOld  = ssol[2]; ssol[2] = ssolCur[2] + ddSol[2];
-              solOld -= ssol[2]; if(fabs(solOld) > TolSolADER[2]) converged = false;
+                solOld  = ssol[2]; ssol[2] = ssolCur[2] + ddSol[2];
+                solOld -= ssol[2]; if(fabs(solOld) > TolSolADER[2]) converged = false;
 
-              solOld  = ssol[3]; ssol[3] = ssolCur[3] + ddSol[3];
-              solOld -= ssol[3]; if(fabs(solOld) > TolSolADER[3]) converged = false;
+                solOld  = ssol[3]; ssol[3] = ssolCur[3] + ddSol[3];
+                solOld -= ssol[3]; if(fabs(solOld) > TolSolADER[3]) converged = false;
+              }
             }
-          }
 
-          break;
-        }
+            break;
+          }
 
-        case 3: {
-          /* 3D simulation. Loop over the time DOFs to determine the new
-             solution and to determine whether or not the iteration procedure
-             is considered converged. */
-          for(unsigned short j=0; j<nTimeDOFs; ++j) {
-            su2double       *solTimeInd  = solPred + j*nVarNDOFs;
-            const su2double *dSolTimeInd = dSol    + j*nVarNDOFs;
+          case 3: {
+            /* 3D simulation. Loop over the time DOFs to determine the new
+               solution and to determine whether or not the iteration procedure
+               is considered converged. */
+            for(unsigned short j=0; j<nTimeDOFs; ++j) {
+              su2double       *solTimeInd  = solPredElem + j*nVarNDOFs;
+              const su2double *dSolTimeInd = dSol        + j*nVarNDOFs;
 
-            for(unsigned short i=0; i<nDOFs; ++i) {
-              const unsigned short off = i*nVar;
-              const su2double *ssolCur = solCur + off;
-              const su2double *ddSol   = dSolTimeInd + off;
-              su2double       *ssol    = solTimeInd  + off;
+              for(unsigned short i=0; i<nDOFs; ++i) {
+                const unsigned short off = i*nVar;
+                const su2double *ssolCur = solCur + off;
+                const su2double *ddSol   = dSolTimeInd + off;
+                su2double       *ssol    = solTimeInd  + off;
 
-              su2double solOld;
-              solOld  = ssol[0]; ssol[0] = ssolCur[0] + ddSol[0];
-              solOld -= ssol[0]; if(fabs(solOld) > TolSolADER[0]) converged = false;
+                su2double solOld;
+                solOld  = ssol[0]; ssol[0] = ssolCur[0] + ddSol[0];
+                solOld -= ssol[0]; if(fabs(solOld) > TolSolADER[0]) converged = false;
 
-              solOld  = ssol[1]; ssol[1] = ssolCur[1] + ddSol[1];
-              solOld -= ssol[1]; if(fabs(solOld) > TolSolADER[1]) converged = false;
+                solOld  = ssol[1]; ssol[1] = ssolCur[1] + ddSol[1];
+                solOld -= ssol[1]; if(fabs(solOld) > TolSolADER[1]) converged = false;
 
-              solOld  = ssol[2]; ssol[2] = ssolCur[2] + ddSol[2];
-              solOld -= ssol[2]; if(fabs(solOld) > TolSolADER[2]) converged = false;
+                solOld  = ssol[2]; ssol[2] = ssolCur[2] + ddSol[2];
+                solOld -= ssol[2]; if(fabs(solOld) > TolSolADER[2]) converged = false;
 
-              solOld  = ssol[3]; ssol[3] = ssolCur[3] + ddSol[3];
-              solOld -= ssol[3]; if(fabs(solOld) > TolSolADER[3]) converged = false;
+                solOld  = ssol[3]; ssol[3] = ssolCur[3] + ddSol[3];
+                solOld -= ssol[3]; if(fabs(solOld) > TolSolADER[3]) converged = false;
 
-              solOld  = ssol[4]; ssol[4] = ssolCur[4] + ddSol[4];
-              solOld -= ssol[4]; if(fabs(solOld) > TolSolADER[4]) converged = false;
+                solOld  = ssol[4]; ssol[4] = ssolCur[4] + ddSol[4];
+                solOld -= ssol[4]; if(fabs(solOld) > TolSolADER[4]) converged = false;
+              }
             }
-          }
 
-          break;
+            break;
+          }
         }
+
+        /* Keep the element in the active set if it is not converged yet. */
+        if( !converged ) activeElem[nActiveNew++] = ll;
       }
 
-      /* Break the iteration loop if the solution is considered converged. */
-      if( converged ) break;
+      nActive = nActiveNew;
     }
 
-    /* Store the predictor solution in the correct location of
-       VecSolDOFsPredictorADER. */
-    for(unsigned short j=0; j<nTimeDOFs; ++j) {
-      su2double *solADERPred = VecSolDOFsPredictorADER.data()
-                             + nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
-      su2double *solPredTime = solPred + j*nVarNDOFs;
+    /* Store the predictor solution of the elements of this chunk in the
+       correct location of VecSolDOFsPredictorADER, together with the time
+       step for which this predictor solution is computed. */
+    for(unsigned short ll=0; ll<llEnd; ++ll) {
+      const unsigned long lInd = l + ll;
+      const su2double *solPredElem = solPred + ll*sizeSolPredElem;
+
+      for(unsigned short j=0; j<nTimeDOFs; ++j) {
+        su2double *solADERPred = VecSolDOFsPredictorADER.data()
+                               + nVar*(j*nDOFsLocTot + volElem[lInd].offsetDOFsSolLocal);
+        const su2double *solPredTime = solPredElem + j*nVarNDOFs;
 
-      memcpy(solADERPred, solPredTime, nBytes);
+        memcpy(solADERPred, solPredTime, nBytes);
+      }
+
+      VecDeltaTimePredictorADER[lInd] = VecDeltaTime[lInd];
     }
-  }
-}
+
+    /* Update the value of the counter l to the end index of the
+       current chunk. */
+    l = lEnd;
+  }
+}
+
+bool CFEM_DG_EulerSolver::ADER_DG_WarmStartPredictor(CConfig             *config,
+                                                     const unsigned long elem,
+                                                     su2double           *solPred) {
+
+  /* Get the data of the time DOFs of the ADER predictor. */
+  const unsigned short nTimeDOFs = config->GetnTimeDOFsADER_DG();
+  const su2double     *TimeDOFs  = config->GetTimeDOFsADER_DG();
+
+  /* Easier storage of the number of spatial DOFs, the total number of
+     variables per time DOF and the current solution of this element. */
+  const unsigned short nDOFs     = volElem[elem].nDOFsSol;
+  const unsigned short nVarNDOFs = nVar*nDOFs;
+  const su2double     *solCur    = VecSolDOFs.data() + nVar*volElem[elem].offsetDOFsSolLocal;
+
+  /* The previous time step corresponds to the parametric interval [-1,1].
+     Determine the ratio of the current and the previous time step, which
+     is needed to map the time DOFs of the current time step onto the
+     parametric coordinate of the previous time step. */
+  const su2double ratio = VecDeltaTime[elem]/VecDeltaTimePredictorADER[elem];
+
+  /* Loop over the time DOFs of the current time step. */
+  for(unsigned short j=0; j<nTimeDOFs; ++j) {
+
+    /* Initialize the predictor of this time DOF to the current solution. */
+    su2double *solPredTimeInd = solPred + j*nVarNDOFs;
+    for(unsigned short i=0; i<nVarNDOFs; ++i) solPredTimeInd[i] = solCur[i];
+
+    /* Parametric coordinate of this time DOF w.r.t. the previous time step. */
+    const su2double tauExt = 1.0 + ratio*(TimeDOFs[j] + 1.0);
+
+    /* Loop over the time DOFs of the previous predictor solution and add the
+       difference of its Lagrangian interpolation function between tauExt and
+       the end of the previous time step, which corresponds to the current solution. */
+    for(unsigned short k=0; k<nTimeDOFs; ++k) {
+
+      su2double lExt = 1.0, lEnd = 1.0;
+      for(unsigned short m=0; m<nTimeDOFs; ++m) {
+        if(m != k) {
+          const su2double denomInv = 1.0/(TimeDOFs[k] - TimeDOFs[m]);
+          lExt *= denomInv*(tauExt - TimeDOFs[m]);
+          lEnd *= denomInv*(1.0    - TimeDOFs[m]);
+        }
+      }
+
+      const su2double coef = lExt - lEnd;
+      const su2double *solPredOld = VecSolDOFsPredictorADER.data()
+                                  + nVar*(k*nDOFsLocTot + volElem[elem].offsetDOFsSolLocal);
+
+      for(unsigned short i=0; i<nVarNDOFs; ++i)
+        solPredTimeInd[i] += coef*solPredOld[i];
+    }
+
+    /* Check whether the density and total energy of the extrapolated
+       solution are positive. If not, a cold start must be used. */
+    for(unsigned short i=0; i<nDOFs; ++i) {
+      const su2double *sol = solPredTimeInd + i*nVar;
+      if((sol[0] <= 0.0) || (sol[nVar-1] <= 0.0)) return false;
+    }
+  }
+
+  return true;
+}
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig              *config,
-                                                              CVolumeElementFEM    *elem,
+                                                              CVolumeElementFEM   **elemEntity,
                                                               const su2double      *sol,
                                                               const unsigned short nSimul,
                                                               const unsigned short NPad,
@@ -4927,9 +6055,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                               su2double            *work) {
 
   /* Get the necessary information from the standard element. */
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
@@ -4952,6 +6080,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 5;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = gradFluxYInt + nDim*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*---          Construct the Cartesian fluxes in the DOFs.               ---*/
   /*--------------------------------------------------------------------------*/
@@ -4959,6 +6094,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
     /*--- Loop over the DOFs to compute the Cartesian fluxes in the DOFs. ---*/
     for(unsigned short i=0; i<nDOFs; ++i) {
 
@@ -4981,8 +6119,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5005,8 +6143,14 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  if( sumFact ) {
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxXDOF, gradFluxXInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxYDOF, gradFluxYInt, workSumFact);
+  }
+  else {
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  }
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5016,6 +6160,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /*--- Loop over the integration points of the element. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -5031,7 +6182,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -5068,11 +6219,21 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, false, sol, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+      /* Set the pointer to the element of this entity. */
+      const CVolumeElementFEM *elem = elemEntity[simul];
+
+      /* Set the pointers to the metric terms of this element. */
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
       /*--- Loop over the integration points of the element. ---*/
       for(unsigned short i=0; i<nInt; ++i) {
 
@@ -5085,7 +6246,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -5111,11 +6272,14 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
-                                                              CVolumeElementFEM    *elem,
+                                                              CVolumeElementFEM   **elemEntity,
                                                               const su2double      *sol,
                                                               const unsigned short nSimul,
                                                               const unsigned short NPad,
@@ -5123,9 +6287,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                               su2double            *work) {
 
   /* Get the necessary information from the standard element. */
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
@@ -5150,6 +6314,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = gradFluxZInt + nDim*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*---          Construct the Cartesian fluxes in the DOFs.               ---*/
   /*--------------------------------------------------------------------------*/
@@ -5157,6 +6328,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
     /*--- Loop over the DOFs to compute the Cartesian fluxes in the DOFs. ---*/
     for(unsigned short i=0; i<nDOFs; ++i) {
 
@@ -5181,8 +6355,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5215,9 +6389,16 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  if( sumFact ) {
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxXDOF, gradFluxXInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxYDOF, gradFluxYInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxZDOF, gradFluxZInt, workSumFact);
+  }
+  else {
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  }
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5227,6 +6408,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /*--- Loop over the integration points of the element. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -5247,7 +6435,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -5296,11 +6484,21 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, false, sol, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+      /* Set the pointer to the element of this entity. */
+      const CVolumeElementFEM *elem = elemEntity[simul];
+
+      /* Set the pointers to the metric terms of this element. */
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
       /*--- Loop over the integration points of the element. ---*/
       for(unsigned short i=0; i<nInt; ++i) {
 
@@ -5313,7 +6511,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -5342,11 +6540,14 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
-                                                                 CVolumeElementFEM    *elem,
+                                                                 CVolumeElementFEM   **elemEntity,
                                                                  const su2double      *sol,
                                                                  const unsigned short nSimul,
                                                                  const unsigned short NPad,
@@ -5359,9 +6560,9 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   su2double *divFlux       = work;
 
   /* Get the necessary information from the standard element. */
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
@@ -5381,13 +6582,23 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 5;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = solAndGradInt + (nDim+1)*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*--- Compute the solution and the derivatives w.r.t. the parametric     ---*/
   /*--- coordinates in the integration points. The first argument in       ---*/
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToInt(NPad, true, sol, solAndGradInt, workSumFact);
+  else
+    blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the inviscid fluxes, multiplied by the   ---*/
@@ -5397,6 +6608,13 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /*--- Loop over the integration points. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -5421,8 +6639,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5435,7 +6653,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5502,11 +6720,14 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
-                                                                 CVolumeElementFEM    *elem,
+                                                                 CVolumeElementFEM   **elemEntity,
                                                                  const su2double      *sol,
                                                                  const unsigned short nSimul,
                                                                  const unsigned short NPad,
@@ -5519,9 +6740,9 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   su2double *divFlux       = work;
 
   /*--- Get the necessary information from the standard element. ---*/
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
@@ -5543,17 +6764,34 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = solAndGradInt + (nDim+1)*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*--- Compute the solution and the derivatives w.r.t. the parametric     ---*/
   /*--- coordinates in the integration points. The first argument in       ---*/
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToInt(NPad, true, sol, solAndGradInt, workSumFact);
+  else
+    blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /* Set the pointers to the location where the solution and the divergence
        of the 1st DOF of this entity is stored, such that this offset does not
        need to be taken into account anymore in the loop over the integration
@@ -5587,8 +6825,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5601,7 +6839,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5688,7 +6926,10 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig             *config,
@@ -5844,6 +7085,11 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     su2double *sources = solDOFs + nDOFs*NPad;
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *workSumFact = fluxes + nInt*nDim*NPad;
+    su2double *metricBuf = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
+    /* Determine whether sum factorization can be used for this element type. */
+    const bool sumFact = standardElementsSol[ind].GetSumFactorization();
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5865,9 +7111,12 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
         memcpy(solDOFs+i*NPad+llNVar, solDOFsElem+i*nVar, nBytes);
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    /* Determine the solution in the integration points of the chunk of elements,
+       either via sum factorization or via the general matrix product. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, false, solDOFs, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5886,14 +7135,16 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
+          unsigned short strideMetric;
+          const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                             strideMetric);
 
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+            const su2double *metricTerms = metricTermsInt + i*strideMetric;
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
@@ -5918,8 +7169,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetThreadFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5975,13 +7226,15 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
+          unsigned short strideMetric;
+          const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                             strideMetric);
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+            const su2double *metricTerms = metricTermsInt + i*strideMetric;
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
@@ -6013,8 +7266,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetThreadFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6100,12 +7353,14 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     for(unsigned short ll=0; ll<llEnd; ++ll) {
       const unsigned short llNVar = ll*nVar;
       const unsigned long  lInd   = l + ll;
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                         strideMetric);
       for(unsigned short i=0; i<nInt; ++i) {
         const unsigned short iNPad = i*NPad;
 
         /* Determine the integration weight multiplied by the Jacobian. */
-        const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                     + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
         const su2double weightJac    = weights[i]*metricTerms[0];
 
         /* Set the pointer to the coordinates in this integration point and
@@ -6134,16 +7389,22 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Carry out the matrix product, either via sum factorization or via the
+       general function. Use solDOFs as a temporary storage for the result. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactIntToDOFs(NPad, true, fluxes, solDOFs, workSumFact);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Carry out the matrix product. */
+      if( sumFact )
+        standardElementsSol[ind].SumFactIntToDOFs(NPad, false, sources, solInt, workSumFact);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6197,6 +7458,11 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
 
         const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
+        /* Store the starting time, if the work is measured. The boundary
+           conditions are measured per marker, because their cost differs
+           significantly, e.g. when a wall model is used. */
+        const passivedouble timeStartBC = measureWorkDG ? WallClockTime_DG() : 0.0;
+
         /* Apply the appropriate boundary condition. */
         switch (config->GetMarker_All_KindBC(iMarker)) {
           case EULER_WALL:
@@ -6249,6 +7515,18 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
           default:
             SU2_MPI::Error("BC not implemented.", CURRENT_FUNCTION);
         }
+
+        /* Attribute the time per face to the adjacent owned element. */
+        if( measureWorkDG ) {
+          int thread = 0;
+#ifdef HAVE_OMP
+          if(nThreadsTaskList > 1) thread = omp_get_thread_num();
+#endif
+          const passivedouble timeFace = (WallClockTime_DG() - timeStartBC)
+                                       / (surfElemEnd - surfElemBeg);
+          for(unsigned long l=surfElemBeg; l<surfElemEnd; ++l)
+            measuredWorkElem[thread][surfElem[l].volElemID] += timeFace;
+        }
       }
     }
   }
@@ -7203,63 +8481,8 @@ void CFEM_DG_EulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **so
     }
   }
 
-  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
-        function cannot be used, because that is for the FV solver.    ---*/
-
-#ifdef HAVE_MPI
-  /* Parallel mode. Disable the reduce for the residual to avoid overhead if requested. */
-  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-
-    /*--- The local L2 norms must be added to obtain the
-          global value. Also check for divergence. ---*/
-    vector<su2double> rbufRes(nVar);
-    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      if (rbufRes[iVar] != rbufRes[iVar])
-        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
-
-      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRes[iVar]/nDOFsGlobal)));
-    }
-
-    /*--- The global maximum norms must be obtained. ---*/
-    rbufRes.resize(nVar*size);
-    SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
-                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-
-    vector<unsigned long> rbufPoint(nVar*size);
-    SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
-                       nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-    vector<su2double> sbufCoor(nDim*nVar);
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      for(unsigned short iDim=0; iDim<nDim; ++iDim)
-        sbufCoor[iVar*nDim+iDim] = Point_Max_Coord[iVar][iDim];
-    }
-
-    vector<su2double> rbufCoor(nDim*nVar*size);
-    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
-                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
-
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      for(int proc=0; proc<size; ++proc)
-        AddRes_Max(iVar, rbufRes[proc*nVar+iVar], rbufPoint[proc*nVar+iVar],
-                   &rbufCoor[proc*nVar*nDim+iVar*nDim]);
-    }
-  }
-
-#else
-  /*--- Sequential mode. Check for a divergence of the solver and compute
-        the L2-norm of the residuals. ---*/
-  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-
-    if(GetRes_RMS(iVar) != GetRes_RMS(iVar))
-      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
-
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(GetRes_RMS(iVar)/nDOFsGlobal)));
-  }
-
-#endif
+  /*--- Compute the global residual norms. ---*/
+  ComputeResidualNorms(config);
 }
 
 void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
@@ -7312,147 +8535,566 @@ void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **
 
   }
 
-  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
-   function cannot be used, because that is for the FV solver.    ---*/
+  /*--- Compute the global residual norms. ---*/
+  ComputeResidualNorms(config);
+}
 
-#ifdef HAVE_MPI
-  /* Parallel mode. Disable the reduce for the residual to avoid overhead if requested. */
-  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
+void CFEM_DG_EulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                                  CConfig *config) {
 
-    /*--- The local L2 norms must be added to obtain the
-          global value. Also check for divergence. ---*/
-    vector<su2double> rbufRes(nVar);
-    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Determine the coefficients of the time derivative. This is ---*/
+  /*---         backward Euler for steady problems and for the first time  ---*/
+  /*---         step. Otherwise BDF2 for a variable time step is used.     ---*/
+  /*--------------------------------------------------------------------------*/
 
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      if (rbufRes[iVar] != rbufRes[iVar])
-        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+  su2double coefNp1 = 1.0, coefN = 1.0, coefNm1 = 0.0;
+  if(nTimeLevelsStoredImplicit == 2) {
+    const su2double omega = deltaTimeNImplicit/deltaTimeNm1Implicit;
+    coefNp1 = (1.0 + 2.0*omega)/(1.0 + omega);
+    coefN   = 1.0 + omega;
+    coefNm1 = omega*omega/(1.0 + omega);
+  }
 
-      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRes[iVar]/nDOFsGlobal)));
-    }
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Compute the right hand side of the linear system, which is ---*/
+  /*---         minus the residual of the nonlinear system, and the        ---*/
+  /*---         coefficients of the time derivative in the matrix.         ---*/
+  /*--------------------------------------------------------------------------*/
 
-    /*--- The global maximum norms must be obtained. ---*/
-    rbufRes.resize(nVar*size);
-    SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
-                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
+  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+    SetRes_RMS(iVar, 0.0);
+    SetRes_Max(iVar, 0.0, 0);
+  }
 
-    vector<unsigned long> rbufPoint(nVar*size);
-    SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
-                       nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  CSysVector LinSysRes(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+  CSysVector LinSysSol(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
 
-    vector<su2double> sbufCoor(nDim*nVar);
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      for(unsigned short iDim=0; iDim<nDim; ++iDim)
-        sbufCoor[iVar*nDim+iDim] = Point_Max_Coord[iVar][iDim];
+  bool timeCoefChanged = false;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    /* Determine the coefficient of the time derivative in the matrix. */
+    const su2double dtInv    = 1.0/VecDeltaTime[l];
+    const su2double timeCoef = coefNp1*dtInv;
+    if(timeCoef != VecTimeCoefImplicit[l]) {
+      timeCoefChanged        = true;
+      VecTimeCoefImplicit[l] = timeCoef;
     }
 
-    vector<su2double> rbufCoor(nDim*nVar*size);
-    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
-                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    /* Set the pointers for the residual and solutions for this element. */
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    const su2double *res       = VecResDOFs.data()    + offset;
+    const su2double *sol       = VecSolDOFs.data()    + offset;
+    const su2double *solN      = VecSolDOFsNew.data() + offset;
+    const su2double *solNm1    = (coefNm1 != 0.0) ? VecSolDOFsTimeNm1.data() + offset : NULL;
 
-    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      for(int proc=0; proc<size; ++proc)
-        AddRes_Max(iVar, rbufRes[proc*nVar+iVar], rbufPoint[proc*nVar+iVar],
-                   &rbufCoor[proc*nVar*nDim+iVar*nDim]);
-    }
-  }
+    /* Loop over the DOFs for this element, add the contribution of the time
+       derivative to the residual and update the L2 norm. */
+    unsigned int i = 0;
+    for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
+      const unsigned long globalIndex = volElem[l].offsetDOFsSolGlobal + j;
+      const su2double *coor = volElem[l].coorSolDOFs.data() + j*nDim;
 
-#else
-  /*--- Sequential mode. Check for a divergence of the solver and compute
-   the L2-norm of the residuals. ---*/
-  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      for(unsigned short iVar=0; iVar<nVar; ++iVar, ++i) {
+        su2double resUnsteady = res[i] + dtInv*(coefNp1*sol[i] - coefN*solN[i]);
+        if( solNm1 ) resUnsteady += dtInv*coefNm1*solNm1[i];
 
-    if(GetRes_RMS(iVar) != GetRes_RMS(iVar))
-      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+        LinSysRes[offset+i] = -resUnsteady;
 
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(GetRes_RMS(iVar)/nDOFsGlobal)));
+        AddRes_RMS(iVar, resUnsteady*resUnsteady);
+        AddRes_Max(iVar, fabs(resUnsteady), globalIndex, coor);
+      }
+    }
   }
 
-#endif
-}
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Build the preconditioner, if needed, and solve the linear  ---*/
+  /*---         system with a Krylov method.                               ---*/
+  /*--------------------------------------------------------------------------*/
 
-void CFEM_DG_EulerSolver::ADER_DG_Iteration(const unsigned long elemBeg,
-                                            const unsigned long elemEnd) {
+  if(timeCoefChanged || !precondImplicitUpToDate)
+    BuildPreconditionerImplicit(config);
 
-  /*--- Update the solution by looping over the given range
-        of volume elements. ---*/
-  for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+  CFEM_DG_JacobianVectorProduct  mat_vec(this);
+  CFEM_DG_ImplicitPreconditioner precond(this, config);
+  CSysSolve system;
 
-    /* Set the pointers for the residual and solution for this element. */
-    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
-    su2double *res     = VecTotResDOFsADER.data() + offset;
-    su2double *solDOFs = VecSolDOFs.data()        + offset;
+  const su2double SolverTol = config->GetLinear_Solver_Error();
+  unsigned long MaxIter     = config->GetLinear_Solver_Iter();
+  unsigned long IterLinSol  = 0;
+  su2double Residual;
 
-    /* Loop over the DOFs for this element and update the solution.
-       Initialize the residual to zero afterwards. */
-    for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i) {
-      solDOFs[i] -= VecDeltaTime[l]*res[i];
-      res[i]      = 0.0;
+  switch( config->GetKind_Linear_Solver() ) {
+    case BCGSTAB:
+      IterLinSol = system.BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, precond,
+                                            SolverTol, MaxIter, &Residual, false);
+      break;
+    case FGMRES:
+      IterLinSol = system.FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, precond,
+                                           SolverTol, MaxIter, &Residual, false);
+      break;
+    case RESTARTED_FGMRES: {
+      const su2double Norm0 = LinSysRes.norm();
+      while (IterLinSol < config->GetLinear_Solver_Iter()) {
+        /*--- Enforce a hard limit on total number of iterations ---*/
+        MaxIter = min(config->GetLinear_Solver_Restart_Frequency(),
+                      config->GetLinear_Solver_Iter()-IterLinSol);
+        IterLinSol += system.FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, precond,
+                                              SolverTol, MaxIter, &Residual, false);
+        if ( Residual < SolverTol*Norm0 ) break;
+      }
+      break;
     }
+    default:
+      SU2_MPI::Error(string("Linear solver not available for the implicit DG solver. ") +
+                     string("Use FGMRES, RESTARTED_FGMRES or BCGSTAB."), CURRENT_FUNCTION);
   }
-}
 
-void CFEM_DG_EulerSolver::BoundaryStates_Euler_Wall(CConfig                  *config,
-                                                    const unsigned short     nFaceSimul,
-                                                    const unsigned short     NPad,
-                                                    const CSurfaceElementFEM *surfElem,
-                                                    const su2double          *solIntL,
-                                                    su2double                *solIntR) {
+  SetIterLinSolver(IterLinSol);
 
-  /*--- Apply the inviscid wall boundary conditions to compute the right
-        state in the integration points. There are two options. Either the
-        normal velocity is negated or the normal velocity is set to zero,
-        relative to the grid motion. Some experiments are needed to see which
-        formulation gives better results. ---*/
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 4: Update the solution and compute the residual norms.        ---*/
+  /*--------------------------------------------------------------------------*/
 
-  /* Get the required information from the standard element, which is the
-     same for all simultaneously treated faces. */
-  const unsigned short ind  = surfElem[0].indStandardElement;
-  const unsigned short nInt = standardBoundaryFacesSol[ind].GetNIntegration();
+  for(unsigned long i=0; i<nVar*nDOFsLocOwned; ++i)
+    VecSolDOFs[i] += LinSysSol[i];
 
-  /* Loop over the faces that are treated simultaneously. */
-  for(unsigned short l=0; l<nFaceSimul; ++l) {
-    const unsigned short llNVar = l*nVar;
+  ComputeResidualNorms(config);
+}
 
-    /* Loop over the integration points of the face. */
-    for(unsigned short i=0; i<nInt; ++i) {
+void CFEM_DG_JacobianVectorProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->JacobianVectorProduct_DG(u, v);
+}
 
-      /* Easier storage of the left and right solution, the normals and the
-         grid velocity for this integration point. */
-      const su2double *UL      = solIntL + i*NPad + llNVar;
-            su2double *UR      = solIntR + i*NPad + llNVar;
-      const su2double *normals = surfElem[l].metricNormalsFace.data() + i*(nDim+1);
-      const su2double *gridVel = surfElem[l].gridVelocities.data() + i*nDim;
+void CFEM_DG_ImplicitPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->Preconditioner_DG(config, u, v);
+}
 
-      /* Compute the normal component of the momentum variables, relative
-         to the grid motion. */
-      su2double rVn = 0.0;
-      for(unsigned short iDim=0; iDim<nDim; ++iDim)
-        rVn += (UL[iDim+1]-UL[0]*gridVel[iDim])*normals[iDim];
+void CFEM_DG_EulerSolver::JacobianVectorProduct_DG(const CSysVector &u,
+                                                   CSysVector       &v) {
 
-      /* If the normal velocity must be mirrored instead of set to zero,
-         the normal component that must be subtracted must be doubled. If the
-         normal velocity must be set to zero, simply comment this line. */
-      //rVn *= 2.0;
+  /*--- Copy the data of the owned DOFs into the work vector, which also
+        stores the data of the ghost DOFs. ---*/
+  su2double *uExt = VecWorkImplicit.data();
+  for(unsigned long i=0; i<nVar*nDOFsLocOwned; ++i)
+    uExt[i] = u[i];
 
-      /* Set the right state. The initial value of the total energy is the
-         energy of the left state. */
-      UR[0]      = UL[0];
-      UR[nDim+1] = UL[nDim+1];
-      for(unsigned short iDim=0; iDim<nDim; ++iDim)
-        UR[iDim+1] = UL[iDim+1] - rVn*normals[iDim];
+#ifdef HAVE_MPI
 
-      /*--- Actually, only the internal energy of UR is equal to UL. If the
-            kinetic energy differs for UL and UR, the difference must be
-            subtracted from the total energy of UR to obtain the correct
-            value. ---*/
-      su2double DensityInv = 1.0/UL[0];
-      su2double diffKin    = 0;
-      for(unsigned short iDim=1; iDim<=nDim; ++iDim) {
-        const su2double velL = DensityInv*UL[iDim];
-        const su2double velR = DensityInv*UR[iDim];
-        diffKin += velL*velL - velR*velR;
-      }
+  /*--- Communicate the data of the ghost DOFs. First post the non-blocking
+        receives, followed by the non-blocking sends. ---*/
+  int indComm = 0;
+  for(unsigned long i=0; i<ranksRecvImplicit.size(); ++i, ++indComm) {
+    const unsigned long indBeg = nVar*(nDOFsLocOwned + startGhostDOFsRecvImplicit[i]);
+    const int nItems = nVar*(startGhostDOFsRecvImplicit[i+1] - startGhostDOFsRecvImplicit[i]);
+
+    SU2_MPI::Irecv(uExt+indBeg, nItems, MPI_DOUBLE, ranksRecvImplicit[i], rank,
+                   MPI_COMM_WORLD, &commRequestsImplicit[indComm]);
+  }
+
+  for(unsigned long i=0; i<ranksSendImplicit.size(); ++i, ++indComm) {
+    su2double *sendBuf = sendBufImplicit[i].data();
+    for(unsigned long j=0; j<DOFsSendImplicit[i].size(); ++j) {
+      const su2double *uDOF = uExt + nVar*DOFsSendImplicit[i][j];
+      for(unsigned short k=0; k<nVar; ++k) sendBuf[j*nVar+k] = uDOF[k];
+    }
+
+    const int dest = ranksSendImplicit[i];
+    SU2_MPI::Isend(sendBuf, sendBufImplicit[i].size(), MPI_DOUBLE, dest, dest,
+                   MPI_COMM_WORLD, &commRequestsImplicit[indComm]);
+  }
+
+  SU2_MPI::Waitall(commRequestsImplicit.size(), commRequestsImplicit.data(),
+                   MPI_STATUSES_IGNORE);
+#endif
+
+  /*--- Carry out the matrix vector product, where the matrix is the sum of
+        the Jacobian and the time derivative term on the diagonal. ---*/
+  const unsigned short nVar2 = nVar*nVar;
+
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic,16) num_threads(nThreadsTaskList)
+#endif
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const su2double timeCoef = VecTimeCoefImplicit[l];
+
+    for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
+      const unsigned long i = volElem[l].offsetDOFsSolLocal + j;
+      const su2double *uDOF = uExt + nVar*i;
+      su2double       *vDOF = &v[nVar*i];
+
+      for(unsigned short k=0; k<nVar; ++k) vDOF[k] = timeCoef*uDOF[k];
+
+      for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<nNonZeroEntriesJacobian[i+1]; ++ind) {
+        const passivedouble *Jac = JacobianDG.data() + nVar2*ind;
+        const su2double *uCol    = uExt + nVar*colLocalEntriesJacobian[ind];
+
+        for(unsigned short r=0; r<nVar; ++r) {
+          su2double tmp = 0.0;
+          for(unsigned short c=0; c<nVar; ++c) tmp += Jac[r*nVar+c]*uCol[c];
+          vDOF[r] += tmp;
+        }
+      }
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::Preconditioner_DG(CConfig          *config,
+                                            const CSysVector &u,
+                                            CSysVector       &v) {
+
+  const unsigned short nVar2 = nVar*nVar;
+
+  if(config->GetKind_Linear_Solver_Prec() == ILU) {
+
+    /*--- Block ILU(0) preconditioner of the locally owned part of the matrix.
+          Forward substitution with the unit lower triangular factor. ---*/
+    vector<su2double> tmp(nVar);
+    for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+      su2double *vDOF = &v[nVar*i];
+      for(unsigned short k=0; k<nVar; ++k) vDOF[k] = u[nVar*i+k];
+
+      for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<diagEntriesJacobian[i]; ++ind) {
+        const unsigned long col = colLocalEntriesJacobian[ind];
+        if(col < i) {
+          const su2double *L    = PrecondImplicit.data() + nVar2*ind;
+          const su2double *vCol = &v[nVar*col];
+          for(unsigned short r=0; r<nVar; ++r)
+            for(unsigned short c=0; c<nVar; ++c)
+              vDOF[r] -= L[r*nVar+c]*vCol[c];
+        }
+      }
+    }
+
+    /*--- Backward substitution with the upper triangular factor. ---*/
+    for(unsigned long i=nDOFsLocOwned; i-- > 0;) {
+      su2double *vDOF = &v[nVar*i];
+      for(unsigned short k=0; k<nVar; ++k) tmp[k] = vDOF[k];
+
+      for(unsigned long ind=diagEntriesJacobian[i]+1; ind<nNonZeroEntriesJacobian[i+1]; ++ind) {
+        const unsigned long col = colLocalEntriesJacobian[ind];
+        if(col < nDOFsLocOwned) {
+          const su2double *U    = PrecondImplicit.data() + nVar2*ind;
+          const su2double *vCol = &v[nVar*col];
+          for(unsigned short r=0; r<nVar; ++r)
+            for(unsigned short c=0; c<nVar; ++c)
+              tmp[r] -= U[r*nVar+c]*vCol[c];
+        }
+      }
+
+      const su2double *DInv = invDiagBlocksILU.data() + nVar2*i;
+      for(unsigned short r=0; r<nVar; ++r) {
+        vDOF[r] = 0.0;
+        for(unsigned short c=0; c<nVar; ++c) vDOF[r] += DInv[r*nVar+c]*tmp[c];
+      }
+    }
+  }
+  else {
+
+    /*--- Element block Jacobi preconditioner. Multiply the vector with the
+          inverse of the diagonal blocks of the elements. ---*/
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic,16) num_threads(nThreadsTaskList)
+#endif
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      const int N = nVar*volElem[l].nDOFsSol;
+      const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+
+      blasFunctions->gemv(N, N, PrecondImplicit.data() + offsetPrecondElem[l],
+                          &u[offset], &v[offset]);
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::BuildPreconditionerImplicit(CConfig *config) {
+
+  const unsigned short nVar2 = nVar*nVar;
+
+  if(config->GetKind_Linear_Solver_Prec() == ILU) {
+
+    /*--------------------------------------------------------------------------*/
+    /*--- Block ILU(0) factorization of the locally owned part of the matrix,---*/
+    /*--- i.e. the coupling with the ghost DOFs is neglected. The factors    ---*/
+    /*--- are stored in PrecondImplicit, which has the layout of JacobianDG. ---*/
+    /*--------------------------------------------------------------------------*/
+
+    /* Copy the Jacobian and add the time derivative to the diagonal blocks. */
+    PrecondImplicit.resize(JacobianDG.size());
+    for(unsigned long i=0; i<JacobianDG.size(); ++i)
+      PrecondImplicit[i] = JacobianDG[i];
+
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
+        const unsigned long i = volElem[l].offsetDOFsSolLocal + j;
+        su2double *D = PrecondImplicit.data() + nVar2*diagEntriesJacobian[i];
+        for(unsigned short k=0; k<nVar; ++k) D[k*nVar+k] += VecTimeCoefImplicit[l];
+      }
+    }
+
+    /* Allocate the memory for the inverse of the diagonal blocks and the
+       help arrays for the factorization. */
+    invDiagBlocksILU.resize(nVar2*nDOFsLocOwned);
+
+    vector<long> entryOfColumn(nDOFsLocOwned, -1);
+    vector<su2double> LBlock(nVar2);
+
+    /* Loop over the rows of the matrix. */
+    for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+
+      /* Store the entries of the owned columns of this row. */
+      for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<nNonZeroEntriesJacobian[i+1]; ++ind) {
+        const unsigned long col = colLocalEntriesJacobian[ind];
+        if(col < nDOFsLocOwned) entryOfColumn[col] = ind;
+      }
+
+      /* Loop over the blocks of the lower triangular part. */
+      for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<diagEntriesJacobian[i]; ++ind) {
+        const unsigned long k = colLocalEntriesJacobian[ind];
+        if(k >= i) continue;
+
+        /* Compute the block of the lower factor, L_ik = A_ik inv(U_kk). */
+        su2double *Aik = PrecondImplicit.data() + nVar2*ind;
+        const su2double *DInv = invDiagBlocksILU.data() + nVar2*k;
+        for(unsigned short r=0; r<nVar; ++r) {
+          for(unsigned short c=0; c<nVar; ++c) {
+            su2double val = 0.0;
+            for(unsigned short m=0; m<nVar; ++m) val += Aik[r*nVar+m]*DInv[m*nVar+c];
+            LBlock[r*nVar+c] = val;
+          }
+        }
+        for(unsigned short m=0; m<nVar2; ++m) Aik[m] = LBlock[m];
+
+        /* Update the blocks of row i, which are present in the upper part of row k. */
+        for(unsigned long indK=diagEntriesJacobian[k]+1; indK<nNonZeroEntriesJacobian[k+1]; ++indK) {
+          const unsigned long j = colLocalEntriesJacobian[indK];
+          if(j >= nDOFsLocOwned) continue;
+          if(entryOfColumn[j] < 0) continue;
+
+          su2double *Aij       = PrecondImplicit.data() + nVar2*entryOfColumn[j];
+          const su2double *Ukj = PrecondImplicit.data() + nVar2*indK;
+          for(unsigned short r=0; r<nVar; ++r)
+            for(unsigned short c=0; c<nVar; ++c)
+              for(unsigned short m=0; m<nVar; ++m)
+                Aij[r*nVar+c] -= LBlock[r*nVar+m]*Ukj[m*nVar+c];
+        }
+      }
+
+      /* Invert the diagonal block. Note that the row major storage of the
+         block leads to the inverse in row major storage. */
+      const su2double *D = PrecondImplicit.data() + nVar2*diagEntriesJacobian[i];
+      vector<su2double> DInv(D, D+nVar2);
+      CFEMStandardElementBase::InverseMatrix(nVar, DInv);
+      for(unsigned short m=0; m<nVar2; ++m) invDiagBlocksILU[nVar2*i+m] = DInv[m];
+
+      /* Reset the entries of the owned columns of this row. */
+      for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<nNonZeroEntriesJacobian[i+1]; ++ind) {
+        const unsigned long col = colLocalEntriesJacobian[ind];
+        if(col < nDOFsLocOwned) entryOfColumn[col] = -1;
+      }
+    }
+  }
+  else {
+
+    /*--------------------------------------------------------------------------*/
+    /*--- Element block Jacobi preconditioner. For every owned element the   ---*/
+    /*--- dense block of the matrix that couples its DOFs is inverted.       ---*/
+    /*--------------------------------------------------------------------------*/
+
+    /* Determine the offsets of the element blocks and allocate the memory. */
+    offsetPrecondElem.resize(nVolElemOwned+1);
+    offsetPrecondElem[0] = 0;
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      const unsigned long N = nVar*volElem[l].nDOFsSol;
+      offsetPrecondElem[l+1] = offsetPrecondElem[l] + N*N;
+    }
+
+    PrecondImplicit.resize(offsetPrecondElem[nVolElemOwned]);
+
+    /* Loop over the owned elements. */
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(dynamic) num_threads(nThreadsTaskList)
+#endif
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+      /* Easier storage of the sizes and the offset of the DOFs of this element. */
+      const unsigned short nDOFs  = volElem[l].nDOFsSol;
+      const unsigned short N      = nVar*nDOFs;
+      const unsigned long  offDOF = volElem[l].offsetDOFsSolLocal;
+
+      /* Create the dense block of the matrix in row major order. */
+      vector<su2double> A(N*N, 0.0);
+      for(unsigned short j=0; j<nDOFs; ++j) {
+        const unsigned long i = offDOF + j;
+
+        for(unsigned long ind=nNonZeroEntriesJacobian[i]; ind<nNonZeroEntriesJacobian[i+1]; ++ind) {
+          const unsigned long col = colLocalEntriesJacobian[ind];
+          if((col < offDOF) || (col >= offDOF+nDOFs)) continue;
+
+          const unsigned short k = col - offDOF;
+          const passivedouble *Jac = JacobianDG.data() + nVar2*ind;
+          for(unsigned short r=0; r<nVar; ++r)
+            for(unsigned short c=0; c<nVar; ++c)
+              A[(j*nVar+r)*N + k*nVar+c] = Jac[r*nVar+c];
+        }
+
+        for(unsigned short r=0; r<nVar; ++r)
+          A[(j*nVar+r)*N + j*nVar+r] += VecTimeCoefImplicit[l];
+      }
+
+      /* Invert the block and store it. As for the diagonal blocks of ILU,
+         the inverse is obtained in row major order. */
+      CFEMStandardElementBase::InverseMatrix(N, A);
+      su2double *precElem = PrecondImplicit.data() + offsetPrecondElem[l];
+      for(int m=0; m<N*N; ++m) precElem[m] = A[m];
+    }
+  }
+
+  precondImplicitUpToDate = true;
+}
+
+void CFEM_DG_EulerSolver::ComputeResidualNorms(CConfig *config) {
+
+  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
+        function cannot be used, because that is for the FV solver.    ---*/
+
+#ifdef HAVE_MPI
+  /* Parallel mode. Disable the reduce for the residual to avoid overhead if requested. */
+  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
+
+    /*--- The local L2 norms must be added to obtain the
+          global value. Also check for divergence. ---*/
+    vector<su2double> rbufRes(nVar);
+    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      if (rbufRes[iVar] != rbufRes[iVar])
+        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+
+      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRes[iVar]/nDOFsGlobal)));
+    }
+
+    /*--- The global maximum norms must be obtained. ---*/
+    rbufRes.resize(nVar*size);
+    SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
+                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    vector<unsigned long> rbufPoint(nVar*size);
+    SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
+                       nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    vector<su2double> sbufCoor(nDim*nVar);
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        sbufCoor[iVar*nDim+iDim] = Point_Max_Coord[iVar][iDim];
+    }
+
+    vector<su2double> rbufCoor(nDim*nVar*size);
+    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
+                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      for(int proc=0; proc<size; ++proc)
+        AddRes_Max(iVar, rbufRes[proc*nVar+iVar], rbufPoint[proc*nVar+iVar],
+                   &rbufCoor[proc*nVar*nDim+iVar*nDim]);
+    }
+  }
+
+#else
+  /*--- Sequential mode. Check for a divergence of the solver and compute
+        the L2-norm of the residuals. ---*/
+  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+
+    if(GetRes_RMS(iVar) != GetRes_RMS(iVar))
+      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(GetRes_RMS(iVar)/nDOFsGlobal)));
+  }
+
+#endif
+}
+
+void CFEM_DG_EulerSolver::ADER_DG_Iteration(const unsigned long elemBeg,
+                                            const unsigned long elemEnd) {
+
+  /*--- Update the solution by looping over the given range
+        of volume elements. ---*/
+  for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+
+    /* Set the pointers for the residual and solution for this element. */
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    su2double *res     = VecTotResDOFsADER.data() + offset;
+    su2double *solDOFs = VecSolDOFs.data()        + offset;
+
+    /* Loop over the DOFs for this element and update the solution.
+       Initialize the residual to zero afterwards. */
+    for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i) {
+      solDOFs[i] -= VecDeltaTime[l]*res[i];
+      res[i]      = 0.0;
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::BoundaryStates_Euler_Wall(CConfig                  *config,
+                                                    const unsigned short     nFaceSimul,
+                                                    const unsigned short     NPad,
+                                                    const CSurfaceElementFEM *surfElem,
+                                                    const su2double          *solIntL,
+                                                    su2double                *solIntR) {
+
+  /*--- Apply the inviscid wall boundary conditions to compute the right
+        state in the integration points. There are two options. Either the
+        normal velocity is negated or the normal velocity is set to zero,
+        relative to the grid motion. Some experiments are needed to see which
+        formulation gives better results. ---*/
+
+  /* Get the required information from the standard element, which is the
+     same for all simultaneously treated faces. */
+  const unsigned short ind  = surfElem[0].indStandardElement;
+  const unsigned short nInt = standardBoundaryFacesSol[ind].GetNIntegration();
+
+  /* Loop over the faces that are treated simultaneously. */
+  for(unsigned short l=0; l<nFaceSimul; ++l) {
+    const unsigned short llNVar = l*nVar;
+
+    /* Loop over the integration points of the face. */
+    for(unsigned short i=0; i<nInt; ++i) {
+
+      /* Easier storage of the left and right solution, the normals and the
+         grid velocity for this integration point. */
+      const su2double *UL      = solIntL + i*NPad + llNVar;
+            su2double *UR      = solIntR + i*NPad + llNVar;
+      const su2double *normals = surfElem[l].metricNormalsFace.data() + i*(nDim+1);
+      const su2double *gridVel = surfElem[l].gridVelocities.data() + i*nDim;
+
+      /* Compute the normal component of the momentum variables, relative
+         to the grid motion. */
+      su2double rVn = 0.0;
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        rVn += (UL[iDim+1]-UL[0]*gridVel[iDim])*normals[iDim];
+
+      /* If the normal velocity must be mirrored instead of set to zero,
+         the normal component that must be subtracted must be doubled. If the
+         normal velocity must be set to zero, simply comment this line. */
+      //rVn *= 2.0;
+
+      /* Set the right state. The initial value of the total energy is the
+         energy of the left state. */
+      UR[0]      = UL[0];
+      UR[nDim+1] = UL[nDim+1];
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        UR[iDim+1] = UL[iDim+1] - rVn*normals[iDim];
+
+      /*--- Actually, only the internal energy of UR is equal to UL. If the
+            kinetic energy differs for UL and UR, the difference must be
+            subtracted from the total energy of UR to obtain the correct
+            value. ---*/
+      su2double DensityInv = 1.0/UL[0];
+      su2double diffKin    = 0;
+      for(unsigned short iDim=1; iDim<=nDim; ++iDim) {
+        const su2double velL = DensityInv*UL[iDim];
+        const su2double velR = DensityInv*UR[iDim];
+        diffKin += velL*velL - velR*velR;
+      }
 
       UR[nDim+1] -= 0.5*UL[0]*diffKin;
     }
@@ -7511,9 +9153,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetThreadFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetThreadFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7619,9 +9261,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetThreadFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetThreadFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7683,10 +9325,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetThreadFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetThreadFluidModel()->GetStaticEnergy()
+                                 + GetThreadFluidModel()->GetPressure()/GetThreadFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetThreadFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7713,9 +9355,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetThreadFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetThreadFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetThreadFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7745,10 +9387,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetThreadFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetThreadFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetThreadFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetThreadFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7796,10 +9438,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetThreadFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetThreadFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetThreadFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetThreadFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7893,7 +9535,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetThreadFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7908,7 +9550,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetThreadFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -7959,11 +9601,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetThreadFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetThreadFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetThreadFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8038,11 +9680,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetThreadFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetThreadFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetThreadFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9344,251 +10986,835 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
         }
       }
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
-      }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        delete [] Jacobian_i[iVar];
+        delete [] Jacobian_j[iVar];
+      }
+      delete [] Jacobian_i;
+      delete [] Jacobian_j;
+
+      Jacobian_i = NULL;
+      Jacobian_j = NULL;
+    }
+  }
+}
+
+#ifdef RINGLEB
+
+void CFEM_DG_EulerSolver::RinglebSolution(const su2double *coor,
+                                                su2double *sol) {
+
+  /* Compute several expononts involving Gamma. */
+  const su2double gm1     = Gamma_Minus_One;
+  const su2double tovgm1  = 2.0/gm1;
+  const su2double tgovgm1 = Gamma*tovgm1;
+
+  /* Easier storage of the coordinates and abbreviate y*y. */
+  const su2double x  = coor[0], y = coor[1];
+  const su2double y2 = y*y;
+
+  /* Initial guess for q (velocity magnitude) and k (streamline parameter). */
+  su2double k = 1.2;
+  su2double q = 1.0;
+
+  /* Newton algorithm to solve for the variables q and k for the given x and y. */
+  const int iterMax = 500;
+  su2double duMaxPrev = 10.0;
+
+  int iter;
+  for(iter=0; iter<iterMax; ++iter) {
+
+    /* Compute the speed of sound, the density, the parameter JJ
+       and its derivatives w.r.t. q. */
+    const su2double a   = sqrt(1.0 - 0.5*gm1*q*q);
+    const su2double rho = pow(a,tovgm1);
+    const su2double JJ  = 1.0/a + 1.0/(3.0*a*a*a) + 1.0/(5.0*a*a*a*a*a)
+                        - 0.5*log((1.0+a)/(1.0-a));
+
+    const su2double dadq   = -0.5*gm1*q/a;
+    const su2double drhodq =  2.0*rho*dadq/(gm1*a);
+    const su2double dJJdq  =  dadq/(pow(a,6)*(a*a-1.0));
+
+    /* Determine the values of the nonlinear equations to solve
+       and its corresponding Jacobian matrix. */
+    const su2double y2c = (k*k - q*q)/(k*k*k*k*rho*rho*q*q);
+    const su2double f[] = {(2.0/(k*k) - 1.0/(q*q))/(2.0*rho) - 0.5*JJ - x,
+                           y2c - y2};
+    su2double Jac[2][2];
+    Jac[0][0] = -(1.0/(k*k) - 0.50/(q*q))*drhodq/(rho*rho)
+              + 1.0/(rho*q*q*q) - 0.5*dJJdq;
+    Jac[0][1] = -2.0/(rho*k*k*k);
+    Jac[1][0] = -2.0/(k*k*rho*rho*q*q*q) - 2.0*y2c*drhodq/rho;
+    Jac[1][1] = (4.0*q*q - 2.0*k*k)/(k*k*k*k*k*rho*rho*q*q);
+
+    /* Determine the update dU. */
+    const su2double det  = Jac[0][0]*Jac[1][1] - Jac[0][1]*Jac[1][0];
+    const su2double dU[] = {(f[0]*Jac[1][1] - f[1]*Jac[0][1])/det,
+                            (f[1]*Jac[0][0] - f[0]*Jac[1][0])/det};
+
+    /* Determine the underrelaxation coefficient alp. */
+    const su2double dUMax = max(fabs(dU[0]), fabs(dU[1]));
+    su2double alp = 1.0;
+    if(     dUMax > 1.0) alp = 0.04;
+    else if(dUMax > 0.1) alp = 0.2;
+
+    /* Update q and k. */
+    q -= alp*dU[0];
+    k -= alp*dU[1];
+
+    /* Convergence check, which is independent of the precision used. */
+    if((dUMax < 1.e-3) && (dUMax >= duMaxPrev)) break;
+    duMaxPrev = dUMax;
+  }
+
+  /* Check if the Newton algorithm actually converged. */
+  if(iter == iterMax) {
+    cout << "In function CFEM_DG_EulerSolver::RinglebSolution: "
+         << "Newton algorithm did not converge." << endl << flush;
+    exit(1);
+  }
+
+  /* Compute the speed of sound, density and pressure. */
+  const su2double a   = sqrt(1.0 - 0.5*gm1*q*q);
+  const su2double rho = pow(a,tovgm1);
+  const su2double p   = pow(a,tgovgm1)/Gamma;
+
+  /* Determine the derivative of x w.r.t. q and ydxdq. */
+  const su2double dadq   = -0.5*gm1*q/a;
+  const su2double drhodq =  2.0*rho*dadq/(gm1*a);
+  const su2double dJJdq  =  dadq/(pow(a,6)*(a*a-1.0));
+
+  const su2double dxdq  = -(1.0/(k*k) - 0.5/(q*q))*drhodq/(rho*rho)
+                        +   1.0/(rho*q*q*q) - 0.5*dJJdq;
+  const su2double ydxdq = y*dxdq;
+
+  /* Determine the derivative of 1/2 y2 w.r.t. q, which is ydydq. The reason is
+     that ydydq is always well defined, while dydyq is singular for y = 0. */
+  const su2double ydydq = drhodq*(q*q-k*k)/(k*k*k*k*rho*rho*rho*q*q)
+                        - 1.0/(k*k*rho*rho*q*q*q);
+
+  /* Determine the direction of the streamline. */
+  const su2double vecLen = sqrt(ydxdq*ydxdq + ydydq*ydydq);
+
+  su2double velDir[] = {ydxdq/vecLen, ydydq/vecLen};
+  if(velDir[1] > 0.0){velDir[0] = -velDir[0]; velDir[1] = -velDir[1];}
+
+  /* Compute the conservative variables. Note that both 2D and 3D
+     cases are treated correctly. */
+  sol[0]      = rho;
+  sol[1]      = rho*q*velDir[0];
+  sol[2]      = rho*q*velDir[1];
+  sol[3]      = 0.0;
+  sol[nVar-1] = p/gm1 + 0.5*rho*q*q;
+}
+
+#endif
+
+void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
+
+  /*--- Restart the solution from file information ---*/
+  unsigned short iVar;
+  unsigned long index;
+
+  string UnstExt, text_line;
+  ifstream restart_file;
+
+  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+
+  string restart_filename = config->GetSolution_FlowFileName();
+  if (config->GetRead_Elem_Restart_DG())
+    restart_filename = config->GetSolution_Elem_DGFileName();
+
+  int counter = 0;
+  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  unsigned short rbuf_NotMatching = 0;
+  unsigned long nDOF_Read = 0;
+
+  /*--- Skip coordinates ---*/
+
+  unsigned short skipVars = geometry[MESH_0]->GetnDim();
+
+  /*--- The element based DG restart files store the solution DOFs per
+   element and are read directly into the solution vector. ---*/
+
+  if (config->GetRead_Elem_Restart_DG()) {
+    Read_SU2_Restart_Binary_DG(config, restart_filename);
+  }
+  else {
+
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+
+    if (config->GetRead_Binary_Restart()) {
+      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
+    } else {
+      Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
+    }
+
+    /*--- Load data from the restart into correct containers. ---*/
+
+    counter = 0;
+    for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+
+      /*--- Retrieve local index. If this node from the restart file lives
+       on the current processor, we will load and instantiate the vars. ---*/
+
+      iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+
+      if (iPoint_Local > -1) {
+
+        /*--- We need to store this point's data, so jump to the correct
+         offset in the buffer of data from the restart file and load it. ---*/
+
+        index = counter*Restart_Vars[1] + skipVars;
+        for (iVar = 0; iVar < nVar; iVar++) {
+          VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
+        }
+        /*--- Update the local counter nDOF_Read. ---*/
+        ++nDOF_Read;
+
+        /*--- Increment the overall counter for how many points have been loaded. ---*/
+        counter++;
+      }
+
+    }
+
+    /*--- Detect a wrong solution file ---*/
+    if(nDOF_Read < nDOFsLocOwned) rbuf_NotMatching = 1;
+
+#ifdef HAVE_MPI
+    unsigned short sbuf_NotMatching = rbuf_NotMatching;
+    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+    if (rbuf_NotMatching != 0)
+      SU2_MPI::Error(string("The solution file ") + restart_filename.data() +
+                     string(" doesn't match with the mesh file!\n") +
+                     string("It could be empty lines at the end of the file."),
+                     CURRENT_FUNCTION);
+  }
+
+  /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
+  unsigned long nBadDOFs = 0;
+
+  if( compressible ) {
+
+    for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
+      const unsigned long ii = nVar*i;
+      su2double DensityInv = 1.0/VecSolDOFs[ii];
+
+      su2double Velocity2 = 0.0;
+      for(unsigned short iDim=1; iDim<=nDim; ++iDim) {
+        const su2double vel = VecSolDOFs[ii+iDim]*DensityInv;
+        Velocity2 += vel*vel;
+      }
+
+      su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
+
+      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = FluidModel->GetPressure();
+      su2double Temperature = FluidModel->GetTemperature();
+
+      /*--- Use the values at the infinity if the state is not physical. ---*/
+      if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
+        for(unsigned short j=0; j<nVar; ++j) {
+          VecSolDOFs[ii+j] = ConsVarFreeStream[j];
+        }
+
+        ++nBadDOFs;
+      }
+    }
+  }
+
+  /*--- Warning message about non-physical points ---*/
+  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
+#ifdef HAVE_MPI
+    unsigned long nBadDOFsLoc = nBadDOFs;
+    SU2_MPI::Reduce(&nBadDOFsLoc, &nBadDOFs, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+    if((rank == MASTER_NODE) && (nBadDOFs != 0))
+      cout << "Warning. The initial solution contains "<< nBadDOFs << " DOFs that are not physical." << endl;
+  }
+
+  /*--- Delete the class memory that is used to load the restart. ---*/
+
+  if (Restart_Vars != NULL) delete [] Restart_Vars;
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Vars = NULL; Restart_Data = NULL;
+
+}
+
+/* Function to send the buffers to the other ranks and to receive the buffers
+   from the other ranks, where empty buffers are not communicated. It is used
+   for the redistribution of the solution of the DG elements over the ranks. */
+template<class T>
+static void ExchangeRestartBuffers_DG(vector<vector<T> > &sendBuf,
+                                      vector<vector<T> > &recvBuf,
+                                      SU2_MPI::Datatype  dataType) {
+
+  const int nRanks = sendBuf.size();
+  recvBuf.assign(nRanks, vector<T>());
+
+#ifdef HAVE_MPI
+
+  int myRank;
+  SU2_MPI::Comm_rank(MPI_COMM_WORLD, &myRank);
+
+  /* Determine the number of items to be received from the other ranks. */
+  vector<int> nSend(nRanks), nRecv(nRanks);
+  for(int iRank=0; iRank<nRanks; ++iRank)
+    nSend[iRank] = (int) sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT,
+                    MPI_COMM_WORLD);
+
+  /* Send and receive the buffers with non-blocking communication. */
+  vector<SU2_MPI::Request> commReqs;
+  for(int iRank=0; iRank<nRanks; ++iRank) {
+    if( nSend[iRank] ) {
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(sendBuf[iRank].data(), nSend[iRank], dataType,
+                     iRank, iRank, MPI_COMM_WORLD, &commReqs.back());
+    }
+
+    if( nRecv[iRank] ) {
+      recvBuf[iRank].resize(nRecv[iRank]);
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(recvBuf[iRank].data(), nRecv[iRank], dataType,
+                     iRank, myRank, MPI_COMM_WORLD, &commReqs.back());
+    }
+  }
+
+  SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+
+#else
+
+  /* Sequential mode. Simply copy the buffer. */
+  recvBuf[0] = sendBuf[0];
+
+#endif
+}
+
+void CFEM_DG_EulerSolver::Read_SU2_Restart_Binary_DG(CConfig *config, string val_filename) {
+
+  char fname[100];
+  strcpy(fname, val_filename.c_str());
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Read the header of the file, which contains the magic      ---*/
+  /*---         number, the number of variables, the number of ranks that  ---*/
+  /*---         wrote the file and the number of elements and DOFs of      ---*/
+  /*---         each of these ranks.                                       ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const int var_buf_size = 4;
+  int var_buf[4];
+
+#ifndef HAVE_MPI
+
+  FILE *fhw;
+  fhw = fopen(fname,"rb");
+  size_t ret;
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  ret = fread(var_buf, sizeof(int), var_buf_size, fhw);
+  if (ret != (size_t) var_buf_size) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+#else
+
+  MPI_File fhw;
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, 0, var_buf, var_buf_size, MPI_INT, MPI_STATUS_IGNORE);
+
+  SU2_MPI::Bcast(var_buf, var_buf_size, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+#endif
+
+  /*--- Check that this is a DG restart file written per element and that
+        the number of variables corresponds to the current simulation. ---*/
+
+  if (var_buf[0] != 535533) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a DG-FEM element restart file.\n") +
+                   string("These files are written with the option WRT_ELEM_RESTART_DG= YES."),
+                   CURRENT_FUNCTION);
+  }
+
+  if (var_buf[1] != nVar) {
+    SU2_MPI::Error(string("The number of variables in the solution file ") + string(fname) +
+                   string(" doesn't match with the number of variables of the solver."),
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- Read the number of elements and DOFs of the ranks that wrote the file. ---*/
+
+  const int nRanksFile = var_buf[2];
+  vector<unsigned long> rankInfo(2*nRanksFile);
+
+#ifndef HAVE_MPI
+
+  ret = fread(rankInfo.data(), sizeof(unsigned long), rankInfo.size(), fhw);
+  if (ret != rankInfo.size()) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+#else
+
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, var_buf_size*sizeof(int), rankInfo.data(), rankInfo.size(),
+                     MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+  SU2_MPI::Bcast(rankInfo.data(), rankInfo.size(), MPI_UNSIGNED_LONG,
+                 MASTER_NODE, MPI_COMM_WORLD);
+
+#endif
+
+  /*--- Determine the cumulative number of elements and DOFs of the writing
+        ranks and check the total number of elements against the mesh. ---*/
+
+  vector<unsigned long> nElemCum(nRanksFile+1, 0), nDOFsCum(nRanksFile+1, 0);
+  for(int i=0; i<nRanksFile; ++i) {
+    nElemCum[i+1] = nElemCum[i] + rankInfo[2*i];
+    nDOFsCum[i+1] = nDOFsCum[i] + rankInfo[2*i+1];
+  }
+
+  const unsigned long nElemGlobal = nElemCum[nRanksFile];
+
+  unsigned long nElemGlobalMesh = nVolElemOwned;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nVolElemOwned, &nElemGlobalMesh, 1, MPI_UNSIGNED_LONG,
+                     MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if(nElemGlobal != nElemGlobalMesh)
+    SU2_MPI::Error(string("The solution file ") + string(fname) +
+                   string(" doesn't match with the mesh file!"), CURRENT_FUNCTION);
+
+  /*--- Offsets in bytes of the element section and the solution section. ---*/
+
+  const unsigned long offsetElem = var_buf_size*sizeof(int) + rankInfo.size()*sizeof(unsigned long);
+  const unsigned long offsetSol  = offsetElem + 2*nElemGlobal*sizeof(unsigned long);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: If the file has been written with the same partitioning,   ---*/
+  /*---         every rank reads its own chunk contiguously and checks the ---*/
+  /*---         global IDs of the elements.                                ---*/
+  /*--------------------------------------------------------------------------*/
+
+  unsigned short samePartition = ((nRanksFile == size) &&
+                                  (rankInfo[2*rank]   == nVolElemOwned) &&
+                                  (rankInfo[2*rank+1] == nDOFsLocOwned));
+#ifdef HAVE_MPI
+  unsigned short sbuf = samePartition;
+  SU2_MPI::Allreduce(&sbuf, &samePartition, 1, MPI_UNSIGNED_SHORT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+  if( samePartition ) {
+
+    vector<unsigned long> elemBuf(2*nVolElemOwned);
+    vector<passivedouble> solBuf(nVar*nDOFsLocOwned);
+
+#ifndef HAVE_MPI
+    ret  = fread(elemBuf.data(), sizeof(unsigned long), elemBuf.size(), fhw);
+    ret += fread(solBuf.data(), sizeof(passivedouble), solBuf.size(), fhw);
+    if (ret != elemBuf.size() + solBuf.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+#else
+    MPI_File_read_at_all(fhw, offsetElem + 2*nElemCum[rank]*sizeof(unsigned long),
+                         elemBuf.data(), elemBuf.size(), MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    MPI_File_read_at_all(fhw, offsetSol + nVar*nDOFsCum[rank]*sizeof(passivedouble),
+                         solBuf.data(), solBuf.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+#endif
+
+    /*--- Check whether the elements are stored in the local order. ---*/
+
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      if((elemBuf[2*l]   != volElem[l].elemIDGlobal) ||
+         (elemBuf[2*l+1] != volElem[l].nDOFsSol)) samePartition = 0;
+    }
+
+#ifdef HAVE_MPI
+    sbuf = samePartition;
+    SU2_MPI::Allreduce(&sbuf, &samePartition, 1, MPI_UNSIGNED_SHORT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+    /*--- Copy the solution if the partitioning is indeed the same. ---*/
+
+    if( samePartition ) {
+      unsigned long ii = 0;
+      for(unsigned long l=0; l<nVolElemOwned; ++l) {
+        su2double *solElem = VecSolDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+        for(unsigned long i=0; i<(unsigned long)(nVar*volElem[l].nDOFsSol); ++i, ++ii)
+          solElem[i] = solBuf[ii];
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Different partitioning. The chunks of the writing ranks    ---*/
+  /*---         are distributed over the current ranks for reading. The    ---*/
+  /*---         owners of the elements are found via a directory, in which ---*/
+  /*---         the global element IDs are distributed linearly.           ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if( !samePartition ) {
+
+    /*--- Read the chunks in rounds, such that collective reads can be used.
+          Chunk iChunk is read by rank iChunk%size. ---*/
+
+    vector<unsigned long> elemRead;
+    vector<passivedouble> solRead;
+
+    const int nRounds = (nRanksFile + size - 1)/size;
+    for(int iRound=0; iRound<nRounds; ++iRound) {
+
+      const int iChunk = min(iRound*size + rank, nRanksFile);
+      unsigned long nElemChunk = 0, nDOFsChunk = 0;
+      if(iChunk < nRanksFile) {
+        nElemChunk = rankInfo[2*iChunk];
+        nDOFsChunk = rankInfo[2*iChunk+1];
+      }
+
+      const unsigned long sizeElem = elemRead.size(), sizeSol = solRead.size();
+      elemRead.resize(sizeElem + 2*nElemChunk);
+      solRead.resize(sizeSol + nVar*nDOFsChunk);
+
+#ifndef HAVE_MPI
+      fseek(fhw, offsetElem + 2*nElemCum[iChunk]*sizeof(unsigned long), SEEK_SET);
+      ret = fread(elemRead.data()+sizeElem, sizeof(unsigned long), 2*nElemChunk, fhw);
+      fseek(fhw, offsetSol + nVar*nDOFsCum[iChunk]*sizeof(passivedouble), SEEK_SET);
+      ret += fread(solRead.data()+sizeSol, sizeof(passivedouble), nVar*nDOFsChunk, fhw);
+      if (ret != 2*nElemChunk + nVar*nDOFsChunk) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+#else
+      MPI_File_read_at_all(fhw, offsetElem + 2*nElemCum[iChunk]*sizeof(unsigned long),
+                           elemRead.data()+sizeElem, 2*nElemChunk, MPI_UNSIGNED_LONG,
+                           MPI_STATUS_IGNORE);
+      MPI_File_read_at_all(fhw, offsetSol + nVar*nDOFsCum[iChunk]*sizeof(passivedouble),
+                           solRead.data()+sizeSol, nVar*nDOFsChunk, MPI_DOUBLE,
+                           MPI_STATUS_IGNORE);
+#endif
+    }
+
+    /*--- Send the read elements to their owners and copy the received
+          solution of the owned elements, which is stored in the same
+          order as VecSolDOFs. ---*/
+
+    vector<passivedouble> solOwned;
+    const unsigned long nElemLoaded = RedistributeSolutionElements_DG(nElemGlobal, nVar, 0, elemRead,
+                                                                      solRead, solOwned);
+
+    for(unsigned long i=0; i<solOwned.size(); ++i)
+      VecSolDOFs[i] = solOwned[i];
+
+    /*--- Detect a wrong solution file. ---*/
+
+    unsigned short rbuf_NotMatching = (nElemLoaded != nVolElemOwned);
+#ifdef HAVE_MPI
+    unsigned short sbuf_NotMatching = rbuf_NotMatching;
+    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#endif
 
-      Jacobian_i = NULL;
-      Jacobian_j = NULL;
-    }
+    if (rbuf_NotMatching != 0)
+      SU2_MPI::Error(string("The solution file ") + string(fname) +
+                     string(" doesn't match with the mesh file!"), CURRENT_FUNCTION);
   }
-}
 
-#ifdef RINGLEB
-
-void CFEM_DG_EulerSolver::RinglebSolution(const su2double *coor,
-                                                su2double *sol) {
+  /*--- Close the file. ---*/
 
-  /* Compute several expononts involving Gamma. */
-  const su2double gm1     = Gamma_Minus_One;
-  const su2double tovgm1  = 2.0/gm1;
-  const su2double tgovgm1 = Gamma*tovgm1;
+#ifndef HAVE_MPI
+  fclose(fhw);
+#else
+  MPI_File_close(&fhw);
+#endif
+}
 
-  /* Easier storage of the coordinates and abbreviate y*y. */
-  const su2double x  = coor[0], y = coor[1];
-  const su2double y2 = y*y;
+void CFEM_DG_EulerSolver::GetSolutionElements_DG(CConfig               *config,
+                                                 vector<unsigned long> &elemData,
+                                                 vector<passivedouble> &solData,
+                                                 vector<passivedouble> &timeData) {
 
-  /* Initial guess for q (velocity magnitude) and k (streamline parameter). */
-  su2double k = 1.2;
-  su2double q = 1.0;
+  /*--- Determine the data of the time integration scheme that must be migrated
+        together with the solution. These are the predictor solution of the
+        previous time step and its time step for a warm start of ADER and the
+        solution at the beginning of the time step for BDF2. ---*/
 
-  /* Newton algorithm to solve for the variables q and k for the given x and y. */
-  const int iterMax = 500;
-  su2double duMaxPrev = 10.0;
+  const bool migratePredictor = (config->GetKind_TimeIntScheme_Flow() == ADER_DG) &&
+                                config->GetWarmStart_ADER_Predictor();
+  const bool migrateSolTimeN  = VecSolDOFsTimeNm1.size() > 0;
 
-  int iter;
-  for(iter=0; iter<iterMax; ++iter) {
+  const unsigned short nTimeDOFs    = migratePredictor ? config->GetnTimeDOFsADER_DG() : 0;
+  const unsigned short nSolSets     = 1 + nTimeDOFs + (migrateSolTimeN ? 1 : 0);
+  const unsigned short nDataPerElem = migratePredictor ? 1 : 0;
 
-    /* Compute the speed of sound, the density, the parameter JJ
-       and its derivatives w.r.t. q. */
-    const su2double a   = sqrt(1.0 - 0.5*gm1*q*q);
-    const su2double rho = pow(a,tovgm1);
-    const su2double JJ  = 1.0/a + 1.0/(3.0*a*a*a) + 1.0/(5.0*a*a*a*a*a)
-                        - 0.5*log((1.0+a)/(1.0-a));
+  /*--- Store the global ID and the number of DOFs of the owned elements.
+        The data of an element is stored contiguously, i.e. the solution,
+        the predictor solution of the time DOFs, the solution at time level n
+        and the time step of the predictor. ---*/
 
-    const su2double dadq   = -0.5*gm1*q/a;
-    const su2double drhodq =  2.0*rho*dadq/(gm1*a);
-    const su2double dJJdq  =  dadq/(pow(a,6)*(a*a-1.0));
+  elemData.resize(2*nVolElemOwned);
+  solData.resize(nSolSets*nVar*nDOFsLocOwned + nDataPerElem*nVolElemOwned);
 
-    /* Determine the values of the nonlinear equations to solve
-       and its corresponding Jacobian matrix. */
-    const su2double y2c = (k*k - q*q)/(k*k*k*k*rho*rho*q*q);
-    const su2double f[] = {(2.0/(k*k) - 1.0/(q*q))/(2.0*rho) - 0.5*JJ - x,
-                           y2c - y2};
-    su2double Jac[2][2];
-    Jac[0][0] = -(1.0/(k*k) - 0.50/(q*q))*drhodq/(rho*rho)
-              + 1.0/(rho*q*q*q) - 0.5*dJJdq;
-    Jac[0][1] = -2.0/(rho*k*k*k);
-    Jac[1][0] = -2.0/(k*k*rho*rho*q*q*q) - 2.0*y2c*drhodq/rho;
-    Jac[1][1] = (4.0*q*q - 2.0*k*k)/(k*k*k*k*k*rho*rho*q*q);
+  unsigned long ii = 0;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    elemData[2*l]   = volElem[l].elemIDGlobal;
+    elemData[2*l+1] = volElem[l].nDOFsSol;
 
-    /* Determine the update dU. */
-    const su2double det  = Jac[0][0]*Jac[1][1] - Jac[0][1]*Jac[1][0];
-    const su2double dU[] = {(f[0]*Jac[1][1] - f[1]*Jac[0][1])/det,
-                            (f[1]*Jac[0][0] - f[0]*Jac[1][0])/det};
+    const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned long nValues = nVar*volElem[l].nDOFsSol;
 
-    /* Determine the underrelaxation coefficient alp. */
-    const su2double dUMax = max(fabs(dU[0]), fabs(dU[1]));
-    su2double alp = 1.0;
-    if(     dUMax > 1.0) alp = 0.04;
-    else if(dUMax > 0.1) alp = 0.2;
+    for(unsigned long i=0; i<nValues; ++i, ++ii)
+      solData[ii] = SU2_TYPE::GetValue(VecSolDOFs[offset+i]);
 
-    /* Update q and k. */
-    q -= alp*dU[0];
-    k -= alp*dU[1];
+    for(unsigned short j=0; j<nTimeDOFs; ++j) {
+      const su2double *solPred = VecSolDOFsPredictorADER.data() + j*nVar*nDOFsLocTot + offset;
+      for(unsigned long i=0; i<nValues; ++i, ++ii)
+        solData[ii] = SU2_TYPE::GetValue(solPred[i]);
+    }
 
-    /* Convergence check, which is independent of the precision used. */
-    if((dUMax < 1.e-3) && (dUMax >= duMaxPrev)) break;
-    duMaxPrev = dUMax;
-  }
+    if( migrateSolTimeN ) {
+      for(unsigned long i=0; i<nValues; ++i, ++ii)
+        solData[ii] = SU2_TYPE::GetValue(VecSolDOFsNew[offset+i]);
+    }
 
-  /* Check if the Newton algorithm actually converged. */
-  if(iter == iterMax) {
-    cout << "In function CFEM_DG_EulerSolver::RinglebSolution: "
-         << "Newton algorithm did not converge." << endl << flush;
-    exit(1);
+    if( migratePredictor )
+      solData[ii++] = SU2_TYPE::GetValue(VecDeltaTimePredictorADER[l]);
   }
 
-  /* Compute the speed of sound, density and pressure. */
-  const su2double a   = sqrt(1.0 - 0.5*gm1*q*q);
-  const su2double rho = pow(a,tovgm1);
-  const su2double p   = pow(a,tgovgm1)/Gamma;
+  /*--- Store the information of the previous time levels of BDF2. ---*/
 
-  /* Determine the derivative of x w.r.t. q and ydxdq. */
-  const su2double dadq   = -0.5*gm1*q/a;
-  const su2double drhodq =  2.0*rho*dadq/(gm1*a);
-  const su2double dJJdq  =  dadq/(pow(a,6)*(a*a-1.0));
+  timeData.resize(3);
+  timeData[0] = nTimeLevelsStoredImplicit;
+  timeData[1] = SU2_TYPE::GetValue(deltaTimeNImplicit);
+  timeData[2] = SU2_TYPE::GetValue(deltaTimeNm1Implicit);
+}
 
-  const su2double dxdq  = -(1.0/(k*k) - 0.5/(q*q))*drhodq/(rho*rho)
-                        +   1.0/(rho*q*q*q) - 0.5*dJJdq;
-  const su2double ydxdq = y*dxdq;
+void CFEM_DG_EulerSolver::SetSolutionElements_DG(CConfig               *config,
+                                                 vector<unsigned long> &elemData,
+                                                 vector<passivedouble> &solData,
+                                                 vector<passivedouble> &timeData) {
 
-  /* Determine the derivative of 1/2 y2 w.r.t. q, which is ydydq. The reason is
-     that ydydq is always well defined, while dydyq is singular for y = 0. */
-  const su2double ydydq = drhodq*(q*q-k*k)/(k*k*k*k*rho*rho*rho*q*q)
-                        - 1.0/(k*k*rho*rho*q*q*q);
+  /*--- Determine the data of the time integration scheme that is migrated
+        together with the solution, see GetSolutionElements_DG. ---*/
 
-  /* Determine the direction of the streamline. */
-  const su2double vecLen = sqrt(ydxdq*ydxdq + ydydq*ydydq);
+  const bool migratePredictor = (config->GetKind_TimeIntScheme_Flow() == ADER_DG) &&
+                                config->GetWarmStart_ADER_Predictor();
+  const bool migrateSolTimeN  = VecSolDOFsTimeNm1.size() > 0;
 
-  su2double velDir[] = {ydxdq/vecLen, ydydq/vecLen};
-  if(velDir[1] > 0.0){velDir[0] = -velDir[0]; velDir[1] = -velDir[1];}
+  const unsigned short nTimeDOFs    = migratePredictor ? config->GetnTimeDOFsADER_DG() : 0;
+  const unsigned short nSolSets     = 1 + nTimeDOFs + (migrateSolTimeN ? 1 : 0);
+  const unsigned short nDataPerElem = migratePredictor ? 1 : 0;
 
-  /* Compute the conservative variables. Note that both 2D and 3D
-     cases are treated correctly. */
-  sol[0]      = rho;
-  sol[1]      = rho*q*velDir[0];
-  sol[2]      = rho*q*velDir[1];
-  sol[3]      = 0.0;
-  sol[nVar-1] = p/gm1 + 0.5*rho*q*q;
-}
+  /*--- Determine the global number of elements. ---*/
 
+  unsigned long nElemGlobal = nVolElemOwned;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nVolElemOwned, &nElemGlobal, 1, MPI_UNSIGNED_LONG,
+                     MPI_SUM, MPI_COMM_WORLD);
 #endif
 
-void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
+  /*--- Send the elements of the previous partitioning to their new owners. ---*/
 
-  /*--- Restart the solution from file information ---*/
-  unsigned short iVar;
-  unsigned long index;
+  vector<passivedouble> dataOwned;
+  const unsigned long nElemLoaded = RedistributeSolutionElements_DG(nElemGlobal, nSolSets*nVar,
+                                                                    nDataPerElem, elemData,
+                                                                    solData, dataOwned);
 
-  string UnstExt, text_line;
-  ifstream restart_file;
+  /*--- Check that the data of all owned elements has been received. ---*/
 
-  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+  unsigned short rbuf_NotMatching = (nElemLoaded != nVolElemOwned);
+#ifdef HAVE_MPI
+  unsigned short sbuf_NotMatching = rbuf_NotMatching;
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#endif
 
-  string restart_filename = config->GetSolution_FlowFileName();
+  if (rbuf_NotMatching != 0)
+    SU2_MPI::Error("The solution could not be migrated to the new partitioning of the grid.",
+                   CURRENT_FUNCTION);
 
-  int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-  unsigned short rbuf_NotMatching = 0;
-  unsigned long nDOF_Read = 0;
+  /*--- Copy the received data of the owned elements, which is stored in
+        element order, into the solution and the time integration data. ---*/
 
-  /*--- Skip coordinates ---*/
+  unsigned long ii = 0;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
 
-  unsigned short skipVars = geometry[MESH_0]->GetnDim();
+    const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned long nValues = nVar*volElem[l].nDOFsSol;
 
-  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+    for(unsigned long i=0; i<nValues; ++i, ++ii)
+      VecSolDOFs[offset+i] = dataOwned[ii];
 
-  if (config->GetRead_Binary_Restart()) {
-    Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
-  } else {
-    Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
+    for(unsigned short j=0; j<nTimeDOFs; ++j) {
+      su2double *solPred = VecSolDOFsPredictorADER.data() + j*nVar*nDOFsLocTot + offset;
+      for(unsigned long i=0; i<nValues; ++i, ++ii)
+        solPred[i] = dataOwned[ii];
+    }
+
+    if( migrateSolTimeN ) {
+      for(unsigned long i=0; i<nValues; ++i, ++ii)
+        VecSolDOFsNew[offset+i] = dataOwned[ii];
+    }
+
+    if( migratePredictor )
+      VecDeltaTimePredictorADER[l] = dataOwned[ii++];
   }
 
-  /*--- Load data from the restart into correct containers. ---*/
+  /*--- Set the information of the previous time levels of BDF2. The time steps
+        are only set on ranks that owned elements, hence the maximum is taken. ---*/
 
-  counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  passivedouble timeBuf[] = {timeData[0], timeData[1], timeData[2]};
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(timeData.data(), timeBuf, 3, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  nTimeLevelsStoredImplicit = (unsigned short) timeBuf[0];
+  deltaTimeNImplicit        = timeBuf[1];
+  deltaTimeNm1Implicit      = timeBuf[2];
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+  vector<passivedouble>().swap(timeData);
+}
 
-    if (iPoint_Local > -1) {
+unsigned long CFEM_DG_EulerSolver::RedistributeSolutionElements_DG(const unsigned long   nElemGlobal,
+                                                                   const unsigned short  nDataPerDOF,
+                                                                   const unsigned short  nDataPerElem,
+                                                                   vector<unsigned long> &elemData,
+                                                                   vector<passivedouble> &solData,
+                                                                   vector<passivedouble> &dataOwned) {
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+  const unsigned long nElemData = elemData.size()/2;
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) {
-        VecSolDOFs[nVar*iPoint_Local+iVar] = Restart_Data[index+iVar];
-      }
-      /*--- Update the local counter nDOF_Read. ---*/
-      ++nDOF_Read;
+  vector<unsigned long> offsetData(nElemData+1, 0);
+  for(unsigned long i=0; i<nElemData; ++i)
+    offsetData[i+1] = offsetData[i] + nDataPerDOF*elemData[2*i+1] + nDataPerElem;
 
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+  /*--- Register the owned elements in the directory. The global IDs of
+        the elements are distributed linearly over the ranks. ---*/
 
+  const unsigned long nElemPerRank = nElemGlobal/size + 1;
+  const unsigned long dirBeg       = rank*nElemPerRank;
+
+  vector<vector<unsigned long> > sendBuf(size), recvBuf;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long elemID = volElem[l].elemIDGlobal;
+    sendBuf[min(elemID/nElemPerRank, (unsigned long) size-1)].push_back(elemID);
   }
 
-  /*--- Detect a wrong solution file ---*/
-  if(nDOF_Read < nDOFsLocOwned) rbuf_NotMatching = 1;
+  ExchangeRestartBuffers_DG(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
 
-#ifdef HAVE_MPI
-  unsigned short sbuf_NotMatching = rbuf_NotMatching;
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
-#endif
+  vector<unsigned long> dirOwner(nElemPerRank, size);
+  for(int iRank=0; iRank<size; ++iRank) {
+    for(unsigned long i=0; i<recvBuf[iRank].size(); ++i) {
+      const unsigned long ind = recvBuf[iRank][i] - dirBeg;
+      if(ind < nElemPerRank) dirOwner[ind] = iRank;
+    }
+  }
 
-  if (rbuf_NotMatching != 0)
-    SU2_MPI::Error(string("The solution file ") + restart_filename.data() +
-                   string(" doesn't match with the mesh file!\n") +
-                   string("It could be empty lines at the end of the file."),
-                   CURRENT_FUNCTION);
+  /*--- Look up the owners of the elements in the buffer of this rank. The
+        buffers with the global IDs are overwritten by the owners in the
+        directory. ---*/
 
-  /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
-  unsigned long nBadDOFs = 0;
+  vector<vector<unsigned long> > dataToDir(size), ownerBuf;
+  for(int iRank=0; iRank<size; ++iRank) sendBuf[iRank].clear();
 
-  if( compressible ) {
+  for(unsigned long i=0; i<nElemData; ++i) {
+    const unsigned long elemID = elemData[2*i];
+    const int dirRank = (int) min(elemID/nElemPerRank, (unsigned long) size-1);
+    sendBuf[dirRank].push_back(elemID);
+    dataToDir[dirRank].push_back(i);
+  }
 
-    for(unsigned long i=0; i<nDOFsLocOwned; ++i) {
-      const unsigned long ii = nVar*i;
-      su2double DensityInv = 1.0/VecSolDOFs[ii];
+  ExchangeRestartBuffers_DG(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
 
-      su2double Velocity2 = 0.0;
-      for(unsigned short iDim=1; iDim<=nDim; ++iDim) {
-        const su2double vel = VecSolDOFs[ii+iDim]*DensityInv;
-        Velocity2 += vel*vel;
-      }
+  for(int iRank=0; iRank<size; ++iRank) {
+    for(unsigned long i=0; i<recvBuf[iRank].size(); ++i) {
+      const unsigned long ind = recvBuf[iRank][i] - dirBeg;
+      recvBuf[iRank][i] = (ind < nElemPerRank) ? dirOwner[ind] : size;
+    }
+  }
 
-      su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
+  ExchangeRestartBuffers_DG(recvBuf, ownerBuf, MPI_UNSIGNED_LONG);
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+  /*--- Send the global ID, the number of DOFs and the data of the
+        elements in the buffer to their owners. ---*/
 
-      /*--- Use the values at the infinity if the state is not physical. ---*/
-      if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
-        for(unsigned short j=0; j<nVar; ++j) {
-          VecSolDOFs[ii+j] = ConsVarFreeStream[j];
-        }
+  vector<vector<unsigned long> > sendElem(size), recvElem;
+  vector<vector<passivedouble> > sendSol(size),  recvSol;
 
-        ++nBadDOFs;
+  for(int iRank=0; iRank<size; ++iRank) {
+    for(unsigned long j=0; j<dataToDir[iRank].size(); ++j) {
+      const unsigned long i     = dataToDir[iRank][j];
+      const unsigned long owner = ownerBuf[iRank][j];
+
+      if(owner < (unsigned long) size) {
+        sendElem[owner].push_back(elemData[2*i]);
+        sendElem[owner].push_back(elemData[2*i+1]);
+        sendSol[owner].insert(sendSol[owner].end(), solData.begin()+offsetData[i],
+                              solData.begin()+offsetData[i+1]);
       }
     }
   }
 
-  /*--- Warning message about non-physical points ---*/
-  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-#ifdef HAVE_MPI
-    unsigned long nBadDOFsLoc = nBadDOFs;
-    SU2_MPI::Reduce(&nBadDOFsLoc, &nBadDOFs, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-#endif
+  vector<unsigned long>().swap(elemData);
+  vector<passivedouble>().swap(solData);
 
-    if((rank == MASTER_NODE) && (nBadDOFs != 0))
-      cout << "Warning. The initial solution contains "<< nBadDOFs << " DOFs that are not physical." << endl;
-  }
+  ExchangeRestartBuffers_DG(sendElem, recvElem, MPI_UNSIGNED_LONG);
+  ExchangeRestartBuffers_DG(sendSol,  recvSol,  MPI_DOUBLE);
 
-  /*--- Delete the class memory that is used to load the restart. ---*/
+  /*--- Determine the offsets of the owned elements in dataOwned, in which
+        the data is stored in element order. ---*/
 
-  if (Restart_Vars != NULL) delete [] Restart_Vars;
-  if (Restart_Data != NULL) delete [] Restart_Data;
-  Restart_Vars = NULL; Restart_Data = NULL;
+  vector<unsigned long> offsetOwned(nVolElemOwned+1, 0);
+  for(unsigned long l=0; l<nVolElemOwned; ++l)
+    offsetOwned[l+1] = offsetOwned[l] + nDataPerDOF*volElem[l].nDOFsSol + nDataPerElem;
 
+  dataOwned.assign(offsetOwned[nVolElemOwned], 0.0);
+
+  /*--- Copy the received data into the owned elements, which are searched
+        via their sorted global IDs. ---*/
+
+  vector<pair<unsigned long, unsigned long> > globalToLocal(nVolElemOwned);
+  for(unsigned long l=0; l<nVolElemOwned; ++l)
+    globalToLocal[l] = make_pair(volElem[l].elemIDGlobal, l);
+  sort(globalToLocal.begin(), globalToLocal.end());
+
+  unsigned long nElemLoaded = 0;
+  for(int iRank=0; iRank<size; ++iRank) {
+    unsigned long ii = 0;
+    for(unsigned long k=0; k<recvElem[iRank].size()/2; ++k) {
+      const unsigned long elemID = recvElem[iRank][2*k];
+      const unsigned long nDOFs  = recvElem[iRank][2*k+1];
+
+      vector<pair<unsigned long, unsigned long> >::const_iterator low;
+      low = lower_bound(globalToLocal.begin(), globalToLocal.end(),
+                        make_pair(elemID, (unsigned long) 0));
+
+      const unsigned long nData = nDataPerDOF*nDOFs + nDataPerElem;
+
+      if((low != globalToLocal.end()) && (low->first == elemID) &&
+         (volElem[low->second].nDOFsSol == nDOFs)) {
+        passivedouble *dataElem = dataOwned.data() + offsetOwned[low->second];
+        for(unsigned long i=0; i<nData; ++i)
+          dataElem[i] = recvSol[iRank][ii+i];
+        ++nElemLoaded;
+      }
+
+      ii += nData;
+    }
+  }
+
+  return nElemLoaded;
 }
 
 CFEM_DG_NSSolver::CFEM_DG_NSSolver(void) : CFEM_DG_EulerSolver() {
@@ -10463,6 +12689,9 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
             for(unsigned short ll=0; ll<llEnd; ++ll) {
               const unsigned short llNVar = ll*nVar;
               const unsigned long  lInd   = l + ll;
+              unsigned short strideMetric;
+              const su2double *metricTermsSolDOFs = volElem[lInd].GetMetricTermsSolDOFs(nMetricPerPoint,
+                                                                                        strideMetric);
 
               /* Compute the length scale of this element and initialize the
                  inviscid and viscous spectral radii to zero. */
@@ -10510,8 +12739,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                   /* Compute the true value of the metric terms in this DOF. Note that in
                      metricTerms the metric terms scaled by the Jacobian are stored. */
-                  const su2double *metricTerms = volElem[lInd].metricTermsSolDOFs.data()
-                                               + i*nMetricPerPoint;
+                  const su2double *metricTerms = metricTermsSolDOFs + i*strideMetric;
                   const su2double JacInv       = 1.0/metricTerms[0];
 
                   const su2double drdx = JacInv*metricTerms[1];
@@ -10579,6 +12807,9 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
             for(unsigned short ll=0; ll<llEnd; ++ll) {
               const unsigned short llNVar = ll*nVar;
               const unsigned long  lInd   = l + ll;
+              unsigned short strideMetric;
+              const su2double *metricTermsSolDOFs = volElem[lInd].GetMetricTermsSolDOFs(nMetricPerPoint,
+                                                                                        strideMetric);
 
               /* Compute the length scale of this element and initialize the
                  inviscid and viscous spectral radii to zero. */
@@ -10629,8 +12860,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                   /* Compute the true value of the metric terms in this DOF. Note that in
                      metricTerms the metric terms scaled by the Jacobian are stored. */
-                  const su2double *metricTerms = volElem[lInd].metricTermsSolDOFs.data()
-                                               + i*nMetricPerPoint;
+                  const su2double *metricTerms = metricTermsSolDOFs + i*strideMetric;
                   const su2double JacInv       = 1.0/metricTerms[0];
 
                   const su2double drdx = JacInv*metricTerms[1];
@@ -10749,7 +12979,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 }
 
 void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig              *config,
-                                                           CVolumeElementFEM    *elem,
+                                                           CVolumeElementFEM   **elemEntity,
                                                            const su2double      *sol,
                                                            const unsigned short nSimul,
                                                            const unsigned short NPad,
@@ -10760,9 +12990,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
 
   /* Get the necessary information from the standard element. */
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *matDerBasisSolDOFs     = standardElementsSol[ind].GetMatDerBasisFunctionsSolDOFs();
@@ -10772,9 +13002,6 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
   if(nPoly == 0) nPoly = 1;
 
-  /* Compute the length scale of the current element for the LES. */
-  const su2double lenScale = elem->lenScale/nPoly;
-
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
      the integration points, the gradient of the solution in the DOFs and the
      divergence of the fluxes in the integration points. Note that some pointers
@@ -10796,17 +13023,37 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 5;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = gradFluxYInt + nDim*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*---          Construct the Cartesian fluxes in the DOFs.               ---*/
   /*--------------------------------------------------------------------------*/
 
   /* Compute the derivatives of the solution variables w.r.t. the parametric
      coordinates in the DOFs. */
-  blasFunctions->gemm(nDOFs*nDim, NPad, nDOFs, matDerBasisSolDOFs, sol, gradSolDOFs, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDerSolDOFs(NPad, sol, gradSolDOFs);
+  else
+    blasFunctions->gemm(nDOFs*nDim, NPad, nDOFs, matDerBasisSolDOFs, sol, gradSolDOFs, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsSolDOFs = elem->GetMetricTermsSolDOFs(nMetricPerPoint, strideMetric);
+
+    /* Compute the length scale of this element for the LES. */
+    const su2double lenScale = elem->lenScale/nPoly;
+
     /*--- Loop over the DOFs to compute the Cartesian fluxes in the DOFs. ---*/
     for(unsigned short i=0; i<nDOFs; ++i) {
 
@@ -10829,8 +13076,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          metricTerms the metric terms scaled by the Jacobian are stored. THIS
          IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED, THE
          DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTermsSolDOFs.data()
-                                   + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsSolDOFs + i*strideMetric;
       const su2double JacInv       = 1.0/metricTerms[0];
 
       const su2double drdx = JacInv*metricTerms[1];
@@ -10858,9 +13104,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetThreadFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetThreadFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -10914,8 +13160,14 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  if( sumFact ) {
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxXDOF, gradFluxXInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxYDOF, gradFluxYInt, workSumFact);
+  }
+  else {
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  }
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -10925,6 +13177,13 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /*--- Loop over the integration points of the element. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -10940,7 +13199,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -10977,11 +13236,21 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, false, sol, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+      /* Set the pointer to the element of this entity. */
+      const CVolumeElementFEM *elem = elemEntity[simul];
+
+      /* Set the pointers to the metric terms of this element. */
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
       /*--- Loop over the integration points of the element. ---*/
       for(unsigned short i=0; i<nInt; ++i) {
 
@@ -10994,7 +13263,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -11020,11 +13289,14 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
-                                                           CVolumeElementFEM    *elem,
+                                                           CVolumeElementFEM   **elemEntity,
                                                            const su2double      *sol,
                                                            const unsigned short nSimul,
                                                            const unsigned short NPad,
@@ -11035,9 +13307,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
 
   /*--- Get the necessary information from the standard element. ---*/
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *matDerBasisSolDOFs     = standardElementsSol[ind].GetMatDerBasisFunctionsSolDOFs();
@@ -11047,9 +13319,6 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
   if(nPoly == 0) nPoly = 1;
 
-  /* Compute the length scale of the current element for the LES. */
-  const su2double lenScale = elem->lenScale/nPoly;
-
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
      the integration points, the gradient of the solution in the DOFs and the
      divergence of the fluxes in the integration points. Note that some pointers
@@ -11073,17 +13342,37 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /* Store the number of metric points per integration point/DOF for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = gradFluxZInt + nDim*NPad*nInt;
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /*--------------------------------------------------------------------------*/
   /*---          Construct the Cartesian fluxes in the DOFs.               ---*/
   /*--------------------------------------------------------------------------*/
 
   /* Compute the derivatives of the solution variables w.r.t. the parametric
      coordinates in the DOFs. */
-  blasFunctions->gemm(nDOFs*nDim, NPad, nDOFs, matDerBasisSolDOFs, sol, gradSolDOFs, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDerSolDOFs(NPad, sol, gradSolDOFs);
+  else
+    blasFunctions->gemm(nDOFs*nDim, NPad, nDOFs, matDerBasisSolDOFs, sol, gradSolDOFs, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsSolDOFs = elem->GetMetricTermsSolDOFs(nMetricPerPoint, strideMetric);
+
+    /* Compute the length scale of this element for the LES. */
+    const su2double lenScale = elem->lenScale/nPoly;
+
     /*--- Loop over the DOFs to compute the Cartesian fluxes in the DOFs. ---*/
     for(unsigned short i=0; i<nDOFs; ++i) {
 
@@ -11108,8 +13397,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          metricTerms the metric terms scaled by the Jacobian are stored. THIS
          IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED, THE
          DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTermsSolDOFs.data()
-                                   + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsSolDOFs + i*strideMetric;
       const su2double JacInv       = 1.0/metricTerms[0];
 
       const su2double drdx = JacInv*metricTerms[1];
@@ -11152,9 +13440,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetThreadFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetThreadFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -11231,9 +13519,16 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  if( sumFact ) {
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxXDOF, gradFluxXInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxYDOF, gradFluxYInt, workSumFact);
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, false, fluxZDOF, gradFluxZInt, workSumFact);
+  }
+  else {
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+    blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  }
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -11243,6 +13538,13 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
     /*--- Loop over the integration points of the element. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -11263,7 +13565,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -11312,11 +13614,21 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, false, sol, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+      /* Set the pointer to the element of this entity. */
+      const CVolumeElementFEM *elem = elemEntity[simul];
+
+      /* Set the pointers to the metric terms of this element. */
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
       /*--- Loop over the integration points of the element. ---*/
       for(unsigned short i=0; i<nInt; ++i) {
 
@@ -11329,7 +13641,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -11358,11 +13670,14 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
-                                                              CVolumeElementFEM    *elem,
+                                                              CVolumeElementFEM   **elemEntity,
                                                               const su2double      *sol,
                                                               const unsigned short nSimul,
                                                               const unsigned short NPad,
@@ -11378,9 +13693,9 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   const su2double lambdaOverMu      = -TWO3;
 
   /*--- Get the necessary information from the standard element. ---*/
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *mat2ndDerBasisInt      = standardElementsSol[ind].GetMat2ndDerBasisFunctionsInt();
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
@@ -11397,9 +13712,6 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
     bodyForceY = body_force_vector[1];
   }
 
-  /* Compute the length scale of the current element for the LES. */
-  const su2double lenScale = elem->lenScale/nPoly;
-
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -11417,6 +13729,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 5;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = secDerSol + 3*NPad*nInt;  /* nDim*(nDim+1)/2*NPad*nInt. */
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /* Store the number of additional metric points per integration point, which
      are needed to compute the second derivatives. These terms take the
      non-constant metric into account. */
@@ -11431,11 +13750,17 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
 
   /* Compute the solution and the derivatives w.r.t. the parametric coordinates
      in the integration points. The first argument is nInt*(nDim+1). */
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToInt(NPad, true, sol, solAndGradInt, workSumFact);
+  else
+    blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /* Compute the second derivatives w.r.t. the parametric coordinates
      in the integration points. */
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, mat2ndDerBasisInt, sol, secDerSol, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, true, sol, secDerSol, workSumFact);
+  else
+    blasFunctions->gemm(nInt*3, NPad, nDOFs, mat2ndDerBasisInt, sol, secDerSol, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of viscous fluxes, multiplied by the        ---*/
@@ -11445,6 +13770,16 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
+    /* Compute the length scale of this element for the LES. */
+    const su2double lenScale = elem->lenScale/nPoly;
+
     /*--- Loop over the integration points. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -11475,13 +13810,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetThreadFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -11493,7 +13828,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -11701,11 +14036,14 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
-                                                              CVolumeElementFEM    *elem,
+                                                              CVolumeElementFEM   **elemEntity,
                                                               const su2double      *sol,
                                                               const unsigned short nSimul,
                                                               const unsigned short NPad,
@@ -11721,9 +14059,9 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   const su2double lambdaOverMu      = -TWO3;
 
   /*--- Get the necessary information from the standard element. ---*/
-  const unsigned short ind                = elem->indStandardElement;
+  const unsigned short ind                = elemEntity[0]->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
+  const unsigned short nDOFs              = elemEntity[0]->nDOFsSol;
   const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *mat2ndDerBasisInt      = standardElementsSol[ind].GetMat2ndDerBasisFunctionsInt();
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
@@ -11741,9 +14079,6 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
     bodyForceZ = body_force_vector[2];
   }
 
-  /* Compute the length scale of the current element for the LES. */
-  const su2double lenScale = elem->lenScale/nPoly;
-
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -11761,6 +14096,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
+  /* Determine whether sum factorization can be used for this element type
+     and set the pointers for its work array and the metric buffer after
+     the local arrays. */
+  const bool sumFact     = standardElementsSol[ind].GetSumFactorization();
+  su2double *workSumFact = secDerSol + 6*NPad*nInt;  /* nDim*(nDim+1)/2*NPad*nInt. */
+  su2double *metricBuf   = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
   /* Store the number of additional metric points per integration point, which
      are needed to compute the second derivatives. These terms take the
      non-constant metric into account. */
@@ -11775,11 +14117,17 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
 
   /* Compute the solution and the derivatives w.r.t. the parametric coordinates
      in the integration points. The first argument is nInt*(nDim+1). */
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToInt(NPad, true, sol, solAndGradInt, workSumFact);
+  else
+    blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /* Compute the second derivatives w.r.t. the parametric coordinates
      in the integration points. */
-  blasFunctions->gemm(nInt*6, NPad, nDOFs, mat2ndDerBasisInt, sol, secDerSol, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactDOFsToDerInt(NPad, true, sol, secDerSol, workSumFact);
+  else
+    blasFunctions->gemm(nInt*6, NPad, nDOFs, mat2ndDerBasisInt, sol, secDerSol, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of viscous fluxes, multiplied by the        ---*/
@@ -11789,6 +14137,16 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
 
+    /* Set the pointer to the element of this entity. */
+    const CVolumeElementFEM *elem = elemEntity[simul];
+
+    /* Set the pointers to the metric terms of this element. */
+    unsigned short strideMetric;
+    const su2double *metricTermsInt = elem->GetMetricTermsInt(nMetricPerPoint, metricBuf, strideMetric);
+
+    /* Compute the length scale of this element for the LES. */
+    const su2double lenScale = elem->lenScale/nPoly;
+
     /*--- Loop over the integration points. ---*/
     for(unsigned short i=0; i<nInt; ++i) {
 
@@ -11825,13 +14183,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetThreadFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetThreadFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetThreadFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -11843,7 +14201,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = metricTermsInt + i*strideMetric;
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -12214,7 +14572,10 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( sumFact )
+    standardElementsSol[ind].SumFactIntToDOFs(NPad, false, divFlux, res, workSumFact);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::Shock_Capturing_DG(CConfig             *config,
@@ -12317,8 +14678,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = GetThreadFluidModel()->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -12452,6 +14813,11 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     su2double *sources       = solDOFs       + nDOFs*NPad;
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
+    su2double *workSumFact   = fluxes        + nInt *NPad*nDim;
+    su2double *metricBuf     = workSumFact + NPad*standardElementsSol[ind].GetSizeWorkSumFact();
+
+    /* Determine whether sum factorization can be used for this element type. */
+    const bool sumFact = standardElementsSol[ind].GetSumFactorization();
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
@@ -12477,7 +14843,10 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
        of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDOFsToInt(NPad, true, solDOFs, solAndGradInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -12501,14 +14870,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
+          unsigned short strideMetric;
+          const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                             strideMetric);
 
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+            const su2double *metricTerms = metricTermsInt + i*strideMetric;
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
             const su2double JacInv       = 1.0/Jac;
@@ -12571,9 +14942,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetThreadFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -12664,14 +15035,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
+          unsigned short strideMetric;
+          const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                             strideMetric);
 
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+            const su2double *metricTerms = metricTermsInt + i*strideMetric;
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
             const su2double JacInv       = 1.0/Jac;
@@ -12764,9 +15137,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetThreadFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -12897,6 +15270,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     for(unsigned short ll=0; ll<llEnd; ++ll) {
       const unsigned short llNVar = ll*nVar;
       const unsigned long  lInd   = l + ll;
+      unsigned short strideMetric;
+      const su2double *metricTermsInt = volElem[lInd].GetMetricTermsInt(nMetricPerPoint, metricBuf,
+                                                                         strideMetric);
       for(unsigned short i=0; i<nInt; ++i) {
         const unsigned short iNPad = i*NPad;
 
@@ -12910,13 +15286,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         }
         const su2double StaticEnergy = sol[nVar-1]*rhoInv - kinEner;
 
-        FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-        const su2double ViscosityLam        = FluidModel->GetLaminarViscosity();
-        const su2double ThermalConductivity = FluidModel->GetThermalConductivity();
+        GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+        const su2double ViscosityLam        = GetThreadFluidModel()->GetLaminarViscosity();
+        const su2double ThermalConductivity = GetThreadFluidModel()->GetThermalConductivity();
 
         /* Determine the integration weight multiplied by the Jacobian. */
-        const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                     + i*nMetricPerPoint;
+        const su2double *metricTerms = metricTermsInt + i*strideMetric;
         const su2double weightJac    = weights[i]*metricTerms[0];
 
         /* Set the pointer to the coordinates in this integration point and
@@ -12946,16 +15321,22 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Carry out the matrix product, either via sum factorization or via the
+       general function. Use solDOFs as a temporary storage for the result. */
+    if( sumFact )
+      standardElementsSol[ind].SumFactIntToDOFs(NPad, true, fluxes, solDOFs, workSumFact);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      /* Carry out the matrix product. */
+      if( sumFact )
+        standardElementsSol[ind].SumFactIntToDOFs(NPad, false, sources, solAndGradInt, workSumFact);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -13604,8 +15985,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -13700,8 +16081,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetThreadFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetThreadFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -15580,6 +17961,21 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                         su2double          *kOverCvInt,
                                         CWallModel         *wallModel) {
 
+  /* Set the pointers for the data in the exchange points, which is needed
+     to call the batched version of the wall model. The start of workArray
+     is used for the solution interpolated from the donors, which requires
+     at most nVar*nInt entries. The size of workArray, nDim*NPad*nInt, is
+     sufficient, because NPad is at least 8. */
+  su2double *tExchange     = workArray     + nVar*nInt;
+  su2double *velExchange   = tExchange     + nInt;
+  su2double *muExchange    = velExchange   + nInt;
+  su2double *pExchange     = muExchange    + nInt;
+  su2double *tauWall       = pExchange     + nInt;
+  su2double *qWall         = tauWall       + nInt;
+  su2double *viscosityWall = qWall         + nInt;
+  su2double *kOverCvWall   = viscosityWall + nInt;
+  su2double *dirTanInt     = kOverCvWall   + nInt;
+
   /* Loop over the simultaneously treated faces. */
   for(unsigned short l=0; l<nFaceSimul; ++l) {
     const unsigned short llNVar = l*nVar;
@@ -15627,10 +18023,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        GetThreadFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+        pExchange[ii]  = GetThreadFluidModel()->GetPressure();
+        tExchange[ii]  = GetThreadFluidModel()->GetTemperature();
+        muExchange[ii] = GetThreadFluidModel()->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -15646,39 +18042,50 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
            as its direction (unit vector). */
         su2double velTan = sqrt(vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
         velTan = max(velTan,1.e-25);
+        velExchange[ii] = velTan;
 
-        su2double dirTan[] = {0.0, 0.0, 0.0};
+        su2double *dirTan = dirTanInt + ii*nDim;
         for(unsigned short k=0; k<nDim; ++k) dirTan[k] = vel[k]/velTan;
-        
-        /* Compute the wall shear stress and heat flux vector using
-           the wall model. */
-        su2double tauWall, qWall, ViscosityWall, kOverCvWall;
-        
-        wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
-                                              Wall_HeatFlux, HeatFlux_Prescribed,
-                                              Wall_Temperature, Temperature_Prescribed,
-                                              tauWall, qWall, ViscosityWall, kOverCvWall);
-        /* Determine the position where the viscous fluxes, viscosity and
-           thermal conductivity must be stored. */
-        su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
-
-        const unsigned short ind = l*nInt + ii;
-        viscosityInt[ind] = ViscosityWall;
-        kOverCvInt[ind]   = kOverCvWall;
-
-        /* Compute the prescribed velocity in tangential direction. */
-        su2double velTanPrescribed = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          velTanPrescribed += gridVel[k]*dirTan[k];
-
-        /* Compute the viscous normal flux. Note that the unscaled normals
-           must be used, hence the multiplication with normals[nDim]. */
-        normalFlux[0] = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          normalFlux[k+1] = -normals[nDim]*tauWall*dirTan[k];
-        normalFlux[nVar-1] = normals[nDim]*(qWall - tauWall*velTanPrescribed);
       }
     }
+
+    /* Compute the wall shear stress and heat flux for all the integration
+       points of this face simultaneously using the wall model. */
+    wallModel->WallShearStressAndHeatFlux(nInt, surfElem[l].indIntWallModel,
+                                          tExchange, velExchange, muExchange, pExchange,
+                                          Wall_HeatFlux, HeatFlux_Prescribed,
+                                          Wall_Temperature, Temperature_Prescribed,
+                                          tauWall, qWall, viscosityWall, kOverCvWall);
+
+    /* Loop over the integration points to compute the viscous fluxes. */
+    for(unsigned short ii=0; ii<nInt; ++ii) {
+
+      /* Determine the normal, the wall velocity and the tangential direction
+         for this integration point. */
+      const su2double *normals = surfElem[l].metricNormalsFace.data() + ii*(nDim+1);
+      const su2double *gridVel = surfElem[l].gridVelocities.data() + ii*nDim;
+      const su2double *dirTan  = dirTanInt + ii*nDim;
+
+      /* Determine the position where the viscous fluxes, viscosity and
+         thermal conductivity must be stored. */
+      su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
+
+      const unsigned short ind = l*nInt + ii;
+      viscosityInt[ind] = viscosityWall[ii];
+      kOverCvInt[ind]   = kOverCvWall[ii];
+
+      /* Compute the prescribed velocity in tangential direction. */
+      su2double velTanPrescribed = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        velTanPrescribed += gridVel[k]*dirTan[k];
+
+      /* Compute the viscous normal flux. Note that the unscaled normals
+         must be used, hence the multiplication with normals[nDim]. */
+      normalFlux[0] = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        normalFlux[k+1] = -normals[nDim]*tauWall[ii]*dirTan[k];
+      normalFlux[nVar-1] = normals[nDim]*(qWall[ii] - tauWall[ii]*velTanPrescribed);
+    }
   }
 }
 
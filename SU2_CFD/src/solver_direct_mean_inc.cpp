@@ -2550,27 +2550,48 @@ void CIncEulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
   
-  unsigned long iPoint, ErrorCounter = 0;
+  const unsigned long nPointBatch = 128;
+  unsigned long iPoint, iBatch, nBatch, jPoint, ErrorCounter = 0;
   bool physical = true;
   
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    
-    /*--- Initialize the non-physical points vector ---*/
-    
-    node[iPoint]->SetNon_Physical(false);
-    
-    /*--- Incompressible flow, primitive variables ---*/
+  su2double Temperature[nPointBatch], Density[nPointBatch], Cp[nPointBatch], Cv[nPointBatch];
+  
+  /*--- The density and specific heats are evaluated by the fluid model for batches
+   of points, instead of one virtual call per point. ---*/
+  
+  for (jPoint = 0; jPoint < nPoint; jPoint += nPointBatch) {
     
-    physical = node[iPoint]->SetPrimVar(FluidModel);
-
-    /*--- Record any non-physical points. ---*/
-
-    if (!physical) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+    nBatch = min(nPointBatch, nPoint-jPoint);
     
-    /*--- Initialize the convective, source and viscous residual vector ---*/
+    for (iBatch = 0; iBatch < nBatch; iBatch++)
+      Temperature[iBatch] = node[jPoint+iBatch]->GetSolution(nDim+1);
     
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+    FluidModel->SetTDState_T_Batch(nBatch, Temperature, Density, Cp, Cv);
     
+    for (iBatch = 0; iBatch < nBatch; iBatch++) {
+      iPoint = jPoint+iBatch;
+      
+      /*--- Initialize the non-physical points vector ---*/
+      
+      node[iPoint]->SetNon_Physical(false);
+      
+      /*--- Incompressible flow, primitive variables ---*/
+      
+      physical = node[iPoint]->SetPrimVar_TDState_Inc(Density[iBatch], Cp[iBatch], Cv[iBatch]);
+      
+      /*--- Non-physical state, the point-wise update reverts to the old solution. ---*/
+      
+      if (!physical) physical = node[iPoint]->SetPrimVar(FluidModel);
+      
+      /*--- Record any non-physical points. ---*/
+      
+      if (!physical) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+      
+      /*--- Initialize the convective, source and viscous residual vector ---*/
+      
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+      
+    }
   }
 
   return ErrorCounter;
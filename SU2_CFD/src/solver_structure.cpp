@@ -1406,6 +1406,10 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
       AD::SetPreaccIn(Gradient_i, nVar, nDim);
       AD::SetPreaccIn(Gradient_j, nVar, nDim);
       AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+      if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+        AD::SetPreaccIn(GlobalMinSolution, nVar);
+        AD::SetPreaccIn(GlobalMaxSolution, nVar);
+      }
 
       for (iVar = 0; iVar < nVar; iVar++) {
         
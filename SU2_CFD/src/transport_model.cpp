@@ -49,6 +49,21 @@ CViscosityModel::CViscosityModel(void) {
 
 CViscosityModel::~CViscosityModel(void) { }
 
+void CViscosityModel::SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                         su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho) {
+
+  /*--- Generic fallback, point by point through the scalar interface. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    SetViscosity(T[iPoint], rho[iPoint]);
+    SetDerViscosity(T[iPoint], rho[iPoint]);
+    mu[iPoint]            = Mu;
+    val_dmudrho_T[iPoint] = dmudrho_T;
+    val_dmudT_rho[iPoint] = dmudT_rho;
+  }
+
+}
+
 
 CConstantViscosity::CConstantViscosity(void) : CViscosityModel() { }
 
@@ -64,6 +79,17 @@ CConstantViscosity::CConstantViscosity(su2double mu_const) : CViscosityModel() {
 
 CConstantViscosity::~CConstantViscosity(void) { }
 
+void CConstantViscosity::SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                            su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    mu[iPoint]            = Mu;
+    val_dmudrho_T[iPoint] = 0.0;
+    val_dmudT_rho[iPoint] = 0.0;
+  }
+
+}
+
 
 
 
@@ -104,6 +130,26 @@ void CSutherland::SetDerViscosity(su2double T, su2double rho) {
 
 }
 
+void CSutherland::SetViscosity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                     su2double *mu, su2double *val_dmudrho_T, su2double *val_dmudT_rho) {
+
+  const su2double T_refInv = 1.0/T_ref;
+
+  /*--- Same expressions as SetViscosity and SetDerViscosity, without
+        the member updates so that the loop can be vectorized. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    const su2double TnonDim = T[iPoint]/T_ref;
+    const su2double TSInv   = 1.0/(T[iPoint] + S);
+
+    mu[iPoint]            = Mu_ref*TnonDim*sqrt(TnonDim)*((T_ref + S)/(T[iPoint] + S));
+    val_dmudrho_T[iPoint] = 0.0;
+    val_dmudT_rho[iPoint] = Mu_ref*(T_ref + S)*TSInv*sqrt(T_refInv*T[iPoint])
+                          * (1.5*T_refInv - T_refInv*T[iPoint]*TSInv);
+  }
+
+}
+
 CPolynomialViscosity::CPolynomialViscosity(void) : CViscosityModel() {
   nPolyCoeffs = 0;
   b           = NULL;
@@ -151,6 +197,23 @@ CConductivityModel::CConductivityModel(void) {
 
 CConductivityModel::~CConductivityModel(void) { }
 
+void CConductivityModel::SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                               const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                                               const su2double *dmudrho_T, const su2double *dmudT_rho,
+                                               su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho) {
+
+  /*--- Generic fallback, point by point through the scalar interface. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    SetConductivity(T[iPoint], rho[iPoint], mu_lam[iPoint], mu_turb, cp[iPoint]);
+    SetDerConductivity(T[iPoint], rho[iPoint], dmudrho_T[iPoint], dmudT_rho[iPoint], cp[iPoint]);
+    kt[iPoint]            = Kt;
+    val_dktdrho_T[iPoint] = dktdrho_T;
+    val_dktdT_rho[iPoint] = dktdT_rho;
+  }
+
+}
+
 
 CConstantConductivity::CConstantConductivity(void) : CConductivityModel() { }
 
@@ -166,6 +229,19 @@ CConstantConductivity::CConstantConductivity(su2double kt_const) : CConductivity
 
 CConstantConductivity::~CConstantConductivity(void) { }
 
+void CConstantConductivity::SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                                  const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                                                  const su2double *dmudrho_T, const su2double *dmudT_rho,
+                                                  su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    kt[iPoint]            = Kt;
+    val_dktdrho_T[iPoint] = 0.0;
+    val_dktdT_rho[iPoint] = 0.0;
+  }
+
+}
+
 CConstantConductivityRANS::CConstantConductivityRANS(void) : CConductivityModel() { }
 
 CConstantConductivityRANS::CConstantConductivityRANS(su2double kt_const, su2double pr_turb) : CConductivityModel() {
@@ -211,6 +287,19 @@ void CConstantPrandtl::SetDerConductivity(su2double T, su2double rho, su2double
 
 }
 
+void CConstantPrandtl::SetConductivity_Batch(unsigned long nPoints, const su2double *T, const su2double *rho,
+                                             const su2double *mu_lam, su2double mu_turb, const su2double *cp,
+                                             const su2double *dmudrho_T, const su2double *dmudT_rho,
+                                             su2double *kt, su2double *val_dktdrho_T, su2double *val_dktdT_rho) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    kt[iPoint]            = mu_lam[iPoint]*cp[iPoint]/Pr_const;
+    val_dktdrho_T[iPoint] = dmudrho_T[iPoint]*cp[iPoint]/Pr_const;
+    val_dktdT_rho[iPoint] = dmudT_rho[iPoint]*cp[iPoint]/Pr_const;
+  }
+
+}
+
 CConstantPrandtl::~CConstantPrandtl(void) { }
 
 CConstantPrandtlRANS::CConstantPrandtlRANS(void) : CConductivityModel() { }
@@ -527,6 +527,31 @@ void CEulerVariable::SetSecondaryVar(CFluidModel *FluidModel) {
 
 }
 
+bool CEulerVariable::SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2, su2double val_temperature) {
+
+  bool check_dens = false, check_press = false, check_sos = false, check_temp = false;
+
+  check_dens  = SetDensity();
+  check_press = SetPressure(val_pressure);
+  check_sos   = SetSoundSpeed(val_soundspeed2);
+  check_temp  = SetTemperature(val_temperature);
+
+  /*--- Set enthalpy ---*/
+
+  SetEnthalpy();
+
+  return !(check_dens || check_press || check_sos || check_temp);
+
+}
+
+void CEulerVariable::SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                                             su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho) {
+
+  SetdPdrho_e(val_dPdrho_e);
+  SetdPde_rho(val_dPde_rho);
+
+}
+
 CNSVariable::CNSVariable(void) : CEulerVariable() { }
 
 CNSVariable::CNSVariable(su2double val_density, su2double *val_velocity, su2double val_energy,
@@ -803,5 +828,42 @@ void CNSVariable::SetSecondaryVar(CFluidModel *FluidModel) {
 
 }
 
+bool CNSVariable::SetPrimVar_TDState(su2double eddy_visc, su2double val_pressure, su2double val_soundspeed2, su2double val_temperature,
+                                     su2double val_laminar_viscosity, su2double val_thermal_conductivity, su2double val_cp) {
+
+  bool check_dens = false, check_press = false, check_sos = false, check_temp = false;
+
+  check_dens  = SetDensity();
+  check_press = SetPressure(val_pressure);
+  check_sos   = SetSoundSpeed(val_soundspeed2);
+  check_temp  = SetTemperature(val_temperature);
+
+  SetEnthalpy();
+  SetLaminarViscosity(val_laminar_viscosity);
+  SetEddyViscosity(eddy_visc);
+  SetThermalConductivity(val_thermal_conductivity);
+  SetSpecificHeatCp(val_cp);
+
+  return !(check_dens || check_press || check_sos || check_temp);
+
+}
+
+void CNSVariable::SetSecondaryVar_TDState(su2double val_dPdrho_e, su2double val_dPde_rho, su2double val_dTdrho_e, su2double val_dTde_rho,
+                                          su2double val_dmudrho_T, su2double val_dmudT_rho, su2double val_dktdrho_T, su2double val_dktdT_rho) {
+
+  SetdPdrho_e(val_dPdrho_e);
+  SetdPde_rho(val_dPde_rho);
+
+  SetdTdrho_e(val_dTdrho_e);
+  SetdTde_rho(val_dTde_rho);
+
+  Setdmudrho_T(val_dmudrho_T);
+  SetdmudT_rho(val_dmudT_rho);
+
+  Setdktdrho_T(val_dktdrho_T);
+  SetdktdT_rho(val_dktdT_rho);
+
+}
+
 
 
@@ -410,6 +410,27 @@ bool CIncEulerVariable::SetPrimVar(CFluidModel *FluidModel) {
   
 }
 
+bool CIncEulerVariable::SetPrimVar_TDState_Inc(su2double val_density, su2double val_cp, su2double val_cv) {
+
+  bool check_dens = false, check_temp = false;
+
+  SetPressure();
+  check_temp = SetTemperature(Solution[nDim+1]);
+  check_dens = SetDensity(val_density);
+
+  if (check_dens || check_temp) return false;
+
+  /*--- Set the value of the velocity and velocity^2 (requires density) ---*/
+
+  SetVelocity();
+
+  SetSpecificHeatCp(val_cp);
+  SetSpecificHeatCv(val_cv);
+
+  return true;
+
+}
+
 CIncNSVariable::CIncNSVariable(void) : CIncEulerVariable() { }
 
 CIncNSVariable::CIncNSVariable(su2double val_pressure, su2double *val_velocity, su2double val_temperature,
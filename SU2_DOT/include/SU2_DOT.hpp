@@ -65,19 +65,25 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
 /*!
  * \brief Projection of the surface sensitivity using algorithmic differentiation (AD).
+ *        The deformation is recorded once and evaluated in reverse for each objective function.
  * \param[in] geometry - Geometrical definition of the problem.
  * \param[in] config - Definition of the particular problem.
  * \param[in] surface_movement - Surface movement class of the problem.
- * \param[in] Gradient_file - Output file to store the gradient data.
+ * \param[in] nObj_Proj - Number of objective functions projected.
+ * \param[in] Sensitivity - Volume sensitivities of each objective function (discrete adjoint).
+ * \param[in] AoA_Sens - Sensitivity of each objective function with respect to the angle of attack.
+ * \param[out] Gradient - Gradient of each objective function.
  */
 
-void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double **Gradient);
+void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                      unsigned short nObj_Proj, su2double **Sensitivity, su2double *AoA_Sens, su2double ***Gradient);
 
 /*!
  * \brief Prints the gradient information to a file.
  * \param[in] Gradient - The gradient data.
  * \param[in] config - Definition of the particular problem.
  * \param[in] Gradient_file - Output file to store the gradient data.
+ * \param[in] Kind_ObjFunc - Objective function of the gradient.
  */
 
-void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file);
+void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file, unsigned short Kind_ObjFunc);
@@ -40,17 +40,21 @@ using namespace std;
 
 int main(int argc, char *argv[]) {
   
-  unsigned short iZone, nZone = SINGLE_ZONE, iInst;
+  unsigned short iZone, nZone = SINGLE_ZONE, iInst, iDim, nDim;
   su2double StartTime = 0.0, StopTime = 0.0, UsedTime = 0.0;
   
-  char config_file_name[MAX_STRING_SIZE], *cstr = NULL;
+  char config_file_name[MAX_STRING_SIZE];
   ofstream Gradient_file;
   bool fem_solver = false;
   bool periodic   = false;
   bool multizone  = false;
 
-  su2double** Gradient;
-  unsigned short iDV, iDV_Value;
+  su2double*** Gradient;
+  su2double*** Sensitivity = NULL;
+  su2double** AoA_Sens = NULL;
+  unsigned short iDV, iDV_Value, iObj, nObj_Proj = 1;
+  unsigned long iPoint;
+  string Gradient_FileName;
   int rank, size;
 
   /*--- MPI initialization, and buffer setting ---*/
@@ -229,6 +233,28 @@ int main(int argc, char *argv[]) {
     }
   }
   
+  /*--- The sensitivities of the objective functions can be projected separately,
+   reusing a single recording of the surface deformation ---*/
+  
+  if (config_container[ZONE_0]->GetDV_Separate_ObjFunc()) {
+    if (!config_container[ZONE_0]->GetDiscrete_Adjoint() || !config_container[ZONE_0]->GetAD_Mode())
+      SU2_MPI::Error("DV_SEPARATE_OBJECTIVES requires the discrete adjoint and the AD build of SU2_DOT (SU2_DOT_AD).", CURRENT_FUNCTION);
+    if (config_container[ZONE_0]->GetSensitivity_Format() == UNORDERED_ASCII)
+      SU2_MPI::Error("DV_SEPARATE_OBJECTIVES is not available with DV_SENSITIVITY_FORMAT= UNORDERED_ASCII.", CURRENT_FUNCTION);
+    nObj_Proj = config_container[ZONE_0]->GetnObj();
+  }
+  
+  Sensitivity = new su2double**[nZone];
+  AoA_Sens    = new su2double*[nZone];
+  for (iZone = 0; iZone < nZone; iZone++) {
+    Sensitivity[iZone] = new su2double*[nObj_Proj];
+    AoA_Sens[iZone]    = new su2double[nObj_Proj];
+    for (iObj = 0; iObj < nObj_Proj; iObj++) {
+      Sensitivity[iZone][iObj] = NULL;
+      AoA_Sens[iZone][iObj]    = 0.0;
+    }
+  }
+  
   /*--- Set up a timer for performance benchmarking (preprocessing time is included) ---*/
   
 #ifdef HAVE_MPI
@@ -282,26 +308,44 @@ int main(int argc, char *argv[]) {
     if (!config_container[iZone]->GetDiscrete_Adjoint()){
       if (rank == MASTER_NODE) cout << "Reading surface sensitivities at each node from file." << endl;
       geometry_container[iZone][INST_0]->SetBoundSensitivity(config_container[iZone]);
+      AoA_Sens[iZone][0] = config_container[iZone]->GetAoA_Sens();
     } else {
 
       if (rank == MASTER_NODE)
         cout << "Reading volume sensitivities at each node from file." << endl;
       grid_movement[iZone] = new CVolumetricMovement(geometry_container[iZone][INST_0], config_container[iZone]);
 
-      /*--- Read in sensitivities from file. ---*/
-      if (config_container[ZONE_0]->GetSensitivity_Format() == UNORDERED_ASCII)
-        geometry_container[iZone][INST_0]->ReadUnorderedSensitivity(config_container[iZone]);
-      else
-        geometry_container[iZone][INST_0]->SetSensitivity(config_container[iZone]);
+      for (iObj = 0; iObj < nObj_Proj; iObj++) {
 
-      if (rank == MASTER_NODE)
-        cout << endl <<"---------------------- Mesh sensitivity computation ---------------------" << endl;
-      grid_movement[iZone]->SetVolume_Deformation(geometry_container[iZone][INST_0], config_container[iZone], false, true);
+        /*--- Read in sensitivities from file. ---*/
+        if (config_container[ZONE_0]->GetSensitivity_Format() == UNORDERED_ASCII)
+          geometry_container[iZone][INST_0]->ReadUnorderedSensitivity(config_container[iZone]);
+        else if (config_container[ZONE_0]->GetDV_Separate_ObjFunc())
+          geometry_container[iZone][INST_0]->SetSensitivity(config_container[iZone], iObj);
+        else
+          geometry_container[iZone][INST_0]->SetSensitivity(config_container[iZone]);
+
+        if (rank == MASTER_NODE)
+          cout << endl <<"---------------------- Mesh sensitivity computation ---------------------" << endl;
+        grid_movement[iZone]->SetVolume_Deformation(geometry_container[iZone][INST_0], config_container[iZone], false, true);
+
+        /*--- Store the sensitivities of this objective for the projection ---*/
+
+        nDim = geometry_container[iZone][INST_0]->GetnDim();
+        Sensitivity[iZone][iObj] = new su2double[geometry_container[iZone][INST_0]->GetnPoint()*nDim];
+        for (iPoint = 0; iPoint < geometry_container[iZone][INST_0]->GetnPoint(); iPoint++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Sensitivity[iZone][iObj][iPoint*nDim+iDim] = geometry_container[iZone][INST_0]->GetSensitivity(iPoint, iDim);
+        AoA_Sens[iZone][iObj] = config_container[iZone]->GetAoA_Sens();
+
+      }
 
     }
   }
 
-   if (config_container[ZONE_0]->GetDiscrete_Adjoint()){
+   /*--- With separate objectives the sensitivity files would only contain the last one ---*/
+
+   if (config_container[ZONE_0]->GetDiscrete_Adjoint() && !config_container[ZONE_0]->GetDV_Separate_ObjFunc()){
      if (rank == MASTER_NODE)
        cout << endl <<"------------------------ Mesh sensitivity Output ------------------------" << endl;
      output = new COutput(config_container[ZONE_0]);
@@ -311,28 +355,23 @@ int main(int argc, char *argv[]) {
    if ((config_container[ZONE_0]->GetDesign_Variable(0) != NONE) &&
        (config_container[ZONE_0]->GetDesign_Variable(0) != SURFACE_FILE)){
 
-     /*--- Initialize structure to store the gradient ---*/
+     /*--- Initialize structure to store the gradient (one per projected objective) ---*/
 
-     Gradient = new su2double*[config_container[ZONE_0]->GetnDV()];
+     Gradient = new su2double**[nObj_Proj];
 
-     for (iDV = 0; iDV  < config_container[ZONE_0]->GetnDV(); iDV++){
-       Gradient[iDV] = new su2double[config_container[ZONE_0]->GetnDV_Value(iDV)];
-       for (iDV_Value = 0; iDV_Value < config_container[ZONE_0]->GetnDV_Value(iDV); iDV_Value++){
-         Gradient[iDV][iDV_Value] = 0.0;
+     for (iObj = 0; iObj < nObj_Proj; iObj++){
+       Gradient[iObj] = new su2double*[config_container[ZONE_0]->GetnDV()];
+       for (iDV = 0; iDV  < config_container[ZONE_0]->GetnDV(); iDV++){
+         Gradient[iObj][iDV] = new su2double[config_container[ZONE_0]->GetnDV_Value(iDV)];
+         for (iDV_Value = 0; iDV_Value < config_container[ZONE_0]->GetnDV_Value(iDV); iDV_Value++){
+           Gradient[iObj][iDV][iDV_Value] = 0.0;
+         }
        }
      }
 
      if (rank == MASTER_NODE)
        cout << endl <<"---------- Start gradient evaluation using sensitivity information ----------" << endl;
 
-     /*--- Write the gradient in a external file ---*/
-
-     if (rank == MASTER_NODE) {
-       cstr = new char [config_container[ZONE_0]->GetObjFunc_Grad_FileName().size()+1];
-       strcpy (cstr, config_container[ZONE_0]->GetObjFunc_Grad_FileName().c_str());
-       Gradient_file.open(cstr, ios::out);
-     }
-
      /*--- Loop through each zone and add it's contribution to the gradient array ---*/
 
      for (iZone = 0; iZone < nZone; iZone++){
@@ -349,26 +388,48 @@ int main(int argc, char *argv[]) {
         *    otherwise we use finite differences. ---*/
 
        if (config_container[iZone]->GetAD_Mode()){
-         SetProjection_AD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
+         SetProjection_AD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone],
+                          nObj_Proj, Sensitivity[iZone], AoA_Sens[iZone], Gradient);
        }else{
-         SetProjection_FD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
+         SetProjection_FD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient[0]);
        }
      }
 
-     /*--- Print gradients to screen and file ---*/
+     /*--- Print gradients to screen and file (the extension of the objective
+      is added to the file name when the objectives are separated) ---*/
 
-     OutputGradient(Gradient, config_container[ZONE_0], Gradient_file);
+     for (iObj = 0; iObj < nObj_Proj; iObj++){
 
-     if (rank == MASTER_NODE)
-       Gradient_file.close();
+       if (rank == MASTER_NODE) {
+         Gradient_FileName = config_container[ZONE_0]->GetObjFunc_Grad_FileName();
+         if (config_container[ZONE_0]->GetDV_Separate_ObjFunc())
+           Gradient_FileName = config_container[ZONE_0]->GetObjFunc_Extension(Gradient_FileName, iObj);
+         Gradient_file.open(Gradient_FileName.c_str(), ios::out);
+       }
+
+       OutputGradient(Gradient[iObj], config_container[ZONE_0], Gradient_file, config_container[ZONE_0]->GetKind_ObjFunc(iObj));
 
-     for (iDV = 0; iDV  < config_container[ZONE_0]->GetnDV(); iDV++){
-       delete [] Gradient[iDV];
+       if (rank == MASTER_NODE)
+         Gradient_file.close();
+
+       for (iDV = 0; iDV  < config_container[ZONE_0]->GetnDV(); iDV++){
+         delete [] Gradient[iObj][iDV];
+       }
+       delete [] Gradient[iObj];
      }
      delete [] Gradient;
 
    }
 
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iObj = 0; iObj < nObj_Proj; iObj++)
+      if (Sensitivity[iZone][iObj] != NULL) delete [] Sensitivity[iZone][iObj];
+    delete [] Sensitivity[iZone];
+    delete [] AoA_Sens[iZone];
+  }
+  delete [] Sensitivity;
+  delete [] AoA_Sens;
+
   delete config;
   config = NULL;
 
@@ -425,8 +486,6 @@ int main(int argc, char *argv[]) {
   if (output != NULL) delete output;
   if (rank == MASTER_NODE) cout << "Deleted COutput class." << endl;
 
-  if (cstr != NULL) delete cstr;
-  
   /*--- Synchronization point after a single solver iteration. Compute the
    wall clock time required. ---*/
   
@@ -463,7 +522,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity,
+  su2double delta_eps, my_Gradient, *Normal, dS, *VarCoord, Sensitivity,
   dalpha[3], deps[3], dalpha_deps;
   bool *UpdatePoint, MoveSurface, Local_MoveSurface;
   CFreeFormDefBox **FFDBox;
@@ -472,6 +531,10 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   
   nDV = config->GetnDV();
   
+  /*--- Local contribution of each design variable, reduced once at the end ---*/
+  
+  vector<su2double> Local_Gradient(nDV, 0.0), Total_Gradient(nDV, 0.0);
+  
   /*--- Boolean controlling points to be updated ---*/
   
   UpdatePoint = new bool[geometry->GetnPoint()];
@@ -653,7 +716,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
       
       /*--- If the Angle of attack is not involved, reset the value of the gradient ---*/
       
-      my_Gradient = 0.0; Gradient[iDV][0] = 0.0;
+      my_Gradient = 0.0;
       
       if (MoveSurface) {
         
@@ -695,12 +758,21 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
         
       }
       
+      Local_Gradient[iDV] = my_Gradient;
+    }
+  }
+  
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if (nDV > 0)
+    SU2_MPI::Allreduce(&Local_Gradient[0], &Total_Gradient[0], nDV, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
-    localGradient = my_Gradient;
+  Total_Gradient = Local_Gradient;
 #endif
-    Gradient[iDV][0] += localGradient;
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if ((config->GetDesign_Variable(iDV) != ANGLE_OF_ATTACK) &&
+        (config->GetDesign_Variable(iDV) != FFD_ANGLE_OF_ATTACK)) {
+      Gradient[iDV][0] = Total_Gradient[iDV];
     }
   }
   
@@ -720,11 +792,12 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 }
   
 
-void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
+void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                      unsigned short nObj_Proj, su2double **Sensitivity, su2double *AoA_Sens, su2double*** Gradient){
 
-  su2double DV_Value, *VarCoord, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
-  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value;
-  unsigned long iVertex, nVertex, iPoint;
+  su2double DV_Value, *VarCoord, Sensitivity_Value, *Normal, Area = 0.0;
+  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV, nDV_Value, iObj;
+  unsigned long iVertex, nVertex, iPoint, iDV_Total, nDV_Total, iSurface, nSurface;
   
   int rank = SU2_MPI::GetRank();
 
@@ -746,7 +819,7 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   /*--- Register design variables as input and set them to zero
    * (since we want to have the derivative at alpha = 0, i.e. for the current design) ---*/
   
-  
+  nDV_Total = 0;
   
   for (iDV = 0; iDV < nDV; iDV++){
     
@@ -761,6 +834,8 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
       AD::RegisterInput(DV_Value);
       
       config->SetDV_Value(iDV, iDV_Value, DV_Value);
+      
+      nDV_Total++;
     }
   }
   
@@ -772,41 +847,26 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   
   AD::StopRecording();
   
-  /*--- Create a structure to identify points that have been already visited. 
-   * We need that to make sure to set the sensitivity of surface points only once
-   *  (Markers share points, so we would visit them more than once in the loop over the markers below) ---*/
+  /*--- Identify the surface points whose displacement seeds the reverse sweep.
+   * The sensitivity of a point is set only once (markers share points, so we
+   * would visit them more than once in the loop over the markers below) ---*/
   
   bool* visited = new bool[geometry->GetnPoint()];
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++){
     visited[iPoint] = false;
   }
   
-  /*--- Initialize the derivatives of the output of the surface deformation routine
-   * with the discrete adjoints from the CFD solution ---*/
+  vector<unsigned short> Surface_Marker;
+  vector<unsigned long> Surface_Vertex;
   
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       nVertex = geometry->nVertex[iMarker];
       for (iVertex = 0; iVertex <nVertex; iVertex++) {
-        iPoint      = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
         if (!visited[iPoint]){
-          VarCoord    = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-          Normal      = geometry->vertex[iMarker][iVertex]->GetNormal();
-          
-          Area = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++){
-            Area += Normal[iDim]*Normal[iDim];
-          }
-          Area = sqrt(Area);
-          
-          for (iDim = 0; iDim < nDim; iDim++){
-            if (config->GetDiscrete_Adjoint()){
-              Sensitivity = geometry->GetSensitivity(iPoint, iDim);
-            } else {
-              Sensitivity = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
-            }
-            SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity));
-          }
+          Surface_Marker.push_back(iMarker);
+          Surface_Vertex.push_back(iVertex);
           visited[iPoint] = true;
         }
       }
@@ -815,30 +875,85 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
   
   delete [] visited;
   
-  /*--- Compute derivatives and extract gradient ---*/
+  nSurface = Surface_Vertex.size();
   
-  AD::ComputeAdjoint();
+  /*--- The tape of the deformation is evaluated once per objective function
+   * (the surface displacement does not depend on the objective), and the
+   * local contributions of all of them are reduced together ---*/
   
-  for (iDV = 0; iDV  < nDV; iDV++){
-    nDV_Value =  config->GetnDV_Value(iDV);
+  vector<su2double> Local_Gradient(nObj_Proj*nDV_Total, 0.0), Total_Gradient(nObj_Proj*nDV_Total, 0.0);
+  
+  for (iObj = 0; iObj < nObj_Proj; iObj++) {
     
-    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++){
-      DV_Value = config->GetDV_Value(iDV, iDV_Value);
-      my_Gradient = SU2_TYPE::GetDerivative(DV_Value);
+    if (iObj > 0) AD::ClearAdjoints();
+    
+    /*--- Initialize the derivatives of the output of the surface deformation routine
+     * with the discrete adjoints from the CFD solution ---*/
+    
+    for (iSurface = 0; iSurface < nSurface; iSurface++) {
+      iMarker  = Surface_Marker[iSurface];
+      iVertex  = Surface_Vertex[iSurface];
+      iPoint   = geometry->vertex[iMarker][iVertex]->GetNode();
+      VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      Normal   = geometry->vertex[iMarker][iVertex]->GetNormal();
+      
+      Area = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++){
+        Area += Normal[iDim]*Normal[iDim];
+      }
+      Area = sqrt(Area);
+      
+      for (iDim = 0; iDim < nDim; iDim++){
+        if (config->GetDiscrete_Adjoint()){
+          Sensitivity_Value = Sensitivity[iObj][iPoint*nDim+iDim];
+        } else {
+          Sensitivity_Value = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
+        }
+        SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity_Value));
+      }
+    }
+    
+    /*--- Compute derivatives and extract the local gradient ---*/
+    
+    AD::ComputeAdjoint();
+    
+    iDV_Total = 0;
+    for (iDV = 0; iDV  < nDV; iDV++){
+      nDV_Value =  config->GetnDV_Value(iDV);
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++){
+        DV_Value = config->GetDV_Value(iDV, iDV_Value);
+        Local_Gradient[iObj*nDV_Total + iDV_Total] = SU2_TYPE::GetDerivative(DV_Value);
+        iDV_Total++;
+      }
+    }
+    
+  }
+  
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if (nObj_Proj*nDV_Total > 0)
+    SU2_MPI::Allreduce(&Local_Gradient[0], &Total_Gradient[0], nObj_Proj*nDV_Total, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
-      localGradient = my_Gradient;
+  Total_Gradient = Local_Gradient;
 #endif
-      /*--- Angle of Attack design variable (this is different,
-       the value comes form the input file) ---*/
+  
+  for (iObj = 0; iObj < nObj_Proj; iObj++) {
+    iDV_Total = 0;
+    for (iDV = 0; iDV  < nDV; iDV++){
+      nDV_Value =  config->GetnDV_Value(iDV);
       
-      if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
-          (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK))  {
-        Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++){
+        
+        /*--- Angle of Attack design variable (this is different,
+         the value comes form the input file) ---*/
+        
+        if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
+            (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK))  {
+          Gradient[iObj][iDV][iDV_Value] = AoA_Sens[iObj];
+        }
+        
+        Gradient[iObj][iDV][iDV_Value] += Total_Gradient[iObj*nDV_Total + iDV_Total];
+        iDV_Total++;
       }
-
-      Gradient[iDV][iDV_Value] += localGradient;
     }
   }
 
@@ -846,7 +961,7 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
 }
 
-void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file){
+void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file, unsigned short Kind_ObjFunc){
   
   unsigned short nDV, iDV, iDV_Value, nDV_Value;
   
@@ -872,7 +987,7 @@ void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_fi
       /*--- Print the kind of objective function to screen ---*/
       
       for (std::map<string, ENUM_OBJECTIVE>::const_iterator it = Objective_Map.begin(); it != Objective_Map.end(); ++it ){
-        if (it->second == config->GetKind_ObjFunc()){
+        if (it->second == Kind_ObjFunc){
           cout << it->first << " gradient : ";
           if (iDV == 0) Gradient_file << it->first << " gradient " << endl;
         }
@@ -50,3 +50,21 @@
 #include "../../Common/include/grid_movement_structure.hpp"
 
 using namespace std;
+
+/*!
+ * \brief Gradient of the geometrical functions using algorithmic differentiation (AD).
+ *        The surface deformation and the section evaluation are recorded once and
+ *        the derivatives with respect to all the design variables are obtained with
+ *        one reverse sweep per geometrical function.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] surface_movement - Surface movement class of the problem.
+ * \param[in] nPlane - Number of sections.
+ * \param[in] Plane_P0 - Point of each section plane.
+ * \param[in] Plane_Normal - Normal vector of each section plane.
+ * \param[in] Gradient_file - Output file to store the gradient data.
+ */
+
+void SetGeometry_Gradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                             unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                             ofstream &Gradient_file);
@@ -415,12 +415,9 @@ int main(int argc, char *argv[]) {
     
   }
   
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    
-    geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
-                                                       Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                       Variable_Airfoil[iPlane], true, config_container[ZONE_0]);
-  }
+  geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                                      Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                                                      Variable_Airfoil, true, config_container[ZONE_0]);
   
   if (rank == MASTER_NODE)
     cout << endl <<"-------------------- Objective function evaluation ----------------------" << endl;
@@ -597,7 +594,37 @@ int main(int argc, char *argv[]) {
     
   }
   
-  if (config_container[ZONE_0]->GetGeometryMode() == GRADIENT) {
+  /*--- With AD support the deformation and the sections are recorded once
+   and all the design variables are obtained from the reverse sweeps ---*/
+  
+  if ((config_container[ZONE_0]->GetGeometryMode() == GRADIENT) &&
+      (config_container[ZONE_0]->GetAD_Mode())) {
+    
+    /*--- Definition of the Class for surface deformation ---*/
+    surface_movement = new CSurfaceMovement();
+    
+    /*--- Copy coordinates to the surface structure ---*/
+    surface_movement->CopyBoundary(geometry_container[ZONE_0], config_container[ZONE_0]);
+    
+    if (rank == MASTER_NODE)
+      cout << endl << endl << "------ Gradient evaluation using algorithmic differentiation ------------" << endl;
+    
+    /*--- Write the gradient in a external file ---*/
+    if (rank == MASTER_NODE) {
+      cstr = new char [config_container[ZONE_0]->GetObjFunc_Grad_FileName().size()+1];
+      strcpy (cstr, config_container[ZONE_0]->GetObjFunc_Grad_FileName().c_str());
+      Gradient_file.open(cstr, ios::out);
+    }
+    
+    SetGeometry_Gradient_AD(geometry_container[ZONE_0], config_container[ZONE_0], surface_movement,
+                            nPlane, Plane_P0, Plane_Normal, Gradient_file);
+    
+    if (rank == MASTER_NODE)
+      Gradient_file.close();
+    
+  }
+  
+  else if (config_container[ZONE_0]->GetGeometryMode() == GRADIENT) {
     
     /*--- Definition of the Class for surface deformation ---*/
     surface_movement = new CSurfaceMovement();
@@ -848,11 +875,9 @@ int main(int argc, char *argv[]) {
         
         /*--- Create airfoil structure ---*/
         
-        for (iPlane = 0; iPlane < nPlane; iPlane++) {
-          geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
-                                                             Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                             Variable_Airfoil[iPlane], false, config_container[ZONE_0]);
-        }
+        geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                                            Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                                                            Variable_Airfoil, false, config_container[ZONE_0]);
         
       }
       
@@ -1318,3 +1343,246 @@ int main(int argc, char *argv[]) {
   return EXIT_SUCCESS;
   
 }
+
+void SetGeometry_Gradient_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement,
+                             unsigned short nPlane, su2double **Plane_P0, su2double **Plane_Normal,
+                             ofstream &Gradient_file) {
+  
+  unsigned short iDV, nDV, iDV_Value, nDV_Value, iPlane, iSection, nSection, nGlobal = 0;
+  unsigned long iFunc, nFunc, iVar, nVar;
+  su2double DV_Value, Global[13];
+  vector<su2double> *Xcoord_Airfoil, *Ycoord_Airfoil, *Zcoord_Airfoil, *Variable_Airfoil;
+  vector<su2double> GeoFunc, my_Gradient, Gradient_Value;
+  vector<passivedouble> DV_Old;
+  vector<unsigned long> DV_Index;
+  vector<string> Func_Name;
+  
+  int rank = SU2_MPI::GetRank();
+  
+  unsigned short nDim = geometry->GetnDim();
+  bool fuselage = (config->GetGeo_Description() == FUSELAGE);
+  bool nacelle  = (config->GetGeo_Description() == NACELLE);
+  
+  nDV = config->GetnDV();
+  
+  /*--- Names of the geometrical functions, in the same order as the columns
+   of the finite difference gradient file ---*/
+  
+  const char *Airfoil_Name[]  = {"AIRFOIL_AREA", "AIRFOIL_THICKNESS", "AIRFOIL_CHORD", "AIRFOIL_LE_RADIUS", "AIRFOIL_TOC", "AIRFOIL_ALPHA"};
+  const char *Fuselage_Name[] = {"FUSELAGE_VOLUME", "FUSELAGE_WETTED_AREA", "FUSELAGE_MIN_WIDTH", "FUSELAGE_MAX_WIDTH", "FUSELAGE_MIN_WATERLINE_WIDTH",
+    "FUSELAGE_MAX_WATERLINE_WIDTH", "FUSELAGE_MIN_HEIGHT", "FUSELAGE_MAX_HEIGHT", "FUSELAGE_MAX_CURVATURE"};
+  const char *Nacelle_Name[]  = {"NACELLE_VOLUME", "NACELLE_MIN_THICKNESS", "NACELLE_MAX_THICKNESS", "NACELLE_MIN_CHORD", "NACELLE_MAX_CHORD",
+    "NACELLE_MIN_LE_RADIUS", "NACELLE_MAX_LE_RADIUS", "NACELLE_MIN_TOC", "NACELLE_MAX_TOC", "NACELLE_OBJFUN_MIN_TOC", "NACELLE_MAX_TWIST"};
+  const char *Wing_Name[]     = {"WING_VOLUME", "WING_MIN_THICKNESS", "WING_MAX_THICKNESS", "WING_MIN_CHORD", "WING_MAX_CHORD",
+    "WING_MIN_LE_RADIUS", "WING_MAX_LE_RADIUS", "WING_MIN_TOC", "WING_MAX_TOC", "WING_OBJFUN_MIN_TOC", "WING_MAX_TWIST",
+    "WING_MAX_CURVATURE", "WING_MAX_DIHEDRAL"};
+  const char *Fuselage_Section[] = {"AREA", "LENGTH", "WIDTH", "WATERLINE_WIDTH", "HEIGHT"};
+  const char *Wing_Section[]     = {"AREA", "THICKNESS", "CHORD", "LE_RADIUS", "TOC", "TWIST"};
+  
+  nSection = 6;
+  if (nDim == 2) {
+    for (iSection = 0; iSection < nSection; iSection++) Func_Name.push_back(Airfoil_Name[iSection]);
+  }
+  else {
+    if (fuselage) {
+      nGlobal = 9; nSection = 5;
+      for (iFunc = 0; iFunc < nGlobal; iFunc++) Func_Name.push_back(Fuselage_Name[iFunc]);
+    }
+    else if (nacelle) {
+      nGlobal = 11;
+      for (iFunc = 0; iFunc < nGlobal; iFunc++) Func_Name.push_back(Nacelle_Name[iFunc]);
+    }
+    else {
+      nGlobal = 13;
+      for (iFunc = 0; iFunc < nGlobal; iFunc++) Func_Name.push_back(Wing_Name[iFunc]);
+    }
+    for (iSection = 0; iSection < nSection; iSection++) {
+      for (iPlane = 0; iPlane < nPlane; iPlane++) {
+        ostringstream name;
+        name << "STATION" << (iPlane+1) << "_" << (fuselage ? Fuselage_Section[iSection] : Wing_Section[iSection]);
+        Func_Name.push_back(name.str());
+      }
+    }
+  }
+  
+  nFunc = nGlobal + nSection*nPlane;
+  GeoFunc.resize(nFunc, 0.0);
+  
+  Xcoord_Airfoil   = new vector<su2double>[nPlane];
+  Ycoord_Airfoil   = new vector<su2double>[nPlane];
+  Zcoord_Airfoil   = new vector<su2double>[nPlane];
+  Variable_Airfoil = new vector<su2double>[nPlane];
+  
+  /*--- Store the design variable values, they define the direction of the
+   derivative for the design variables with more than one value ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    DV_Index.push_back(DV_Old.size());
+    nDV_Value = config->GetnDV_Value(iDV);
+    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++)
+      DV_Old.push_back(SU2_TYPE::GetValue(config->GetDV_Value(iDV, iDV_Value)));
+    if ((nDV_Value > 1) && (DV_Old[DV_Index[iDV]] == 0.0))
+      SU2_MPI::Error("The first value of a design variable with several values defines the step and cannot be zero!!", CURRENT_FUNCTION);
+  }
+  nVar = DV_Old.size();
+  
+  /*--- Start recording of operations ---*/
+  
+  AD::StartRecording();
+  
+  /*--- Register design variables as input and set them to zero
+   (since we want to have the derivative at the current design) ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    nDV_Value = config->GetnDV_Value(iDV);
+    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
+      
+      /*--- Initilization with su2double resets the index ---*/
+      
+      DV_Value = 0.0;
+      AD::RegisterInput(DV_Value);
+      config->SetDV_Value(iDV, iDV_Value, DV_Value);
+    }
+  }
+  
+  /*--- Call the surface deformation routine ---*/
+  
+  surface_movement->SetSurface_Deformation(geometry, config);
+  
+  /*--- Continuous description of the wing, fuselage or nacelle (only 3D) ---*/
+  
+  if (nDim == 3) {
+    if (fuselage)
+      geometry->Compute_Fuselage(config, false, Global[0], Global[1], Global[2], Global[3], Global[4],
+                                 Global[5], Global[6], Global[7], Global[8]);
+    else if (nacelle)
+      geometry->Compute_Nacelle(config, false, Global[0], Global[1], Global[2], Global[3], Global[4],
+                                Global[5], Global[6], Global[7], Global[8], Global[9], Global[10]);
+    else
+      geometry->Compute_Wing(config, false, Global[0], Global[1], Global[2], Global[3], Global[4],
+                             Global[5], Global[6], Global[7], Global[8], Global[9], Global[10],
+                             Global[11], Global[12]);
+    for (iFunc = 0; iFunc < nGlobal; iFunc++) GeoFunc[iFunc] = Global[iFunc];
+  }
+  
+  /*--- Sections of the deformed surface, the coordinates are gathered
+   in the master node, where the functions are evaluated ---*/
+  
+  geometry->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, NULL,
+                                    Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                                    Variable_Airfoil, false, config);
+  
+  if (rank == MASTER_NODE) {
+    for (iPlane = 0; iPlane < nPlane; iPlane++) {
+      if (Xcoord_Airfoil[iPlane].size() > 1) {
+        su2double *Func = &GeoFunc[nGlobal];
+        if (fuselage) {
+          Func[0*nPlane+iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[1*nPlane+iPlane] = geometry->Compute_Length(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[2*nPlane+iPlane] = geometry->Compute_Width(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[3*nPlane+iPlane] = geometry->Compute_WaterLineWidth(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[4*nPlane+iPlane] = geometry->Compute_Height(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+        }
+        else {
+          Func[0*nPlane+iPlane] = geometry->Compute_Area(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[1*nPlane+iPlane] = geometry->Compute_MaxThickness(Plane_P0[iPlane], Plane_Normal[iPlane], config, Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[2*nPlane+iPlane] = geometry->Compute_Chord(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[3*nPlane+iPlane] = geometry->Compute_LERadius(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+          Func[4*nPlane+iPlane] = Func[1*nPlane+iPlane]/Func[2*nPlane+iPlane];
+          Func[5*nPlane+iPlane] = geometry->Compute_Twist(Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane]);
+        }
+      }
+    }
+  }
+  
+  for (iFunc = 0; iFunc < nFunc; iFunc++) AD::RegisterOutput(GeoFunc[iFunc]);
+  
+  /*--- Stop the recording ---*/
+  
+  AD::StopRecording();
+  
+  /*--- One reverse sweep per geometrical function, the functions are seeded on
+   the master node only (the other ranks hold redundant copies) ---*/
+  
+  my_Gradient.resize(nVar);
+  Gradient_Value.resize(nVar*nFunc);
+  
+  for (iFunc = 0; iFunc < nFunc; iFunc++) {
+    
+    if (rank == MASTER_NODE) SU2_TYPE::SetDerivative(GeoFunc[iFunc], 1.0);
+    
+    AD::ComputeAdjoint();
+    
+    for (iDV = 0; iDV < nDV; iDV++) {
+      nDV_Value = config->GetnDV_Value(iDV);
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
+        DV_Value = config->GetDV_Value(iDV, iDV_Value);
+        my_Gradient[DV_Index[iDV]+iDV_Value] = SU2_TYPE::GetDerivative(DV_Value);
+      }
+    }
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&my_Gradient[0], &Gradient_Value[iFunc*nVar], nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+    for (iVar = 0; iVar < nVar; iVar++) Gradient_Value[iFunc*nVar+iVar] = my_Gradient[iVar];
+#endif
+    
+    AD::ClearAdjoints();
+    
+  }
+  
+  AD::Reset();
+  
+  /*--- Restore the design variable values ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    nDV_Value = config->GetnDV_Value(iDV);
+    for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++)
+      config->SetDV_Value(iDV, iDV_Value, DV_Old[DV_Index[iDV]+iDV_Value]);
+  }
+  
+  /*--- Screen and file output, the design variables with more than one value
+   use the derivative in the direction of the values, scaled as the finite
+   difference step (first value) ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    Gradient_file << "TITLE = \"SU2_GEO Gradient\"" << endl;
+    Gradient_file << "VARIABLES = \"DESIGN_VARIABLE\"";
+    for (iFunc = 0; iFunc < nFunc; iFunc++) Gradient_file << ",\"" << Func_Name[iFunc] << "\"";
+    Gradient_file << "\nZONE T= \"Geometrical variables (gradient)\"" << endl;
+    
+    for (iDV = 0; iDV < nDV; iDV++) {
+      
+      cout << endl << "Design variable number "<< iDV <<"." << endl;
+      Gradient_file << (iDV);
+      
+      nDV_Value = config->GetnDV_Value(iDV);
+      
+      for (iFunc = 0; iFunc < nFunc; iFunc++) {
+        
+        su2double Grad = 0.0;
+        iVar = iFunc*nVar + DV_Index[iDV];
+        if (nDV_Value == 1) Grad = Gradient_Value[iVar];
+        else {
+          for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++)
+            Grad += Gradient_Value[iVar+iDV_Value]*DV_Old[DV_Index[iDV]+iDV_Value];
+          Grad /= DV_Old[DV_Index[iDV]];
+        }
+        
+        cout << Func_Name[iFunc] << " grad.: " << Grad << ". ";
+        if ((iFunc+1)%4 == 0) cout << endl;
+        Gradient_file << "," << Grad;
+        
+      }
+      
+      cout << endl;
+      Gradient_file << endl;
+      
+    }
+    
+  }
+  
+  delete [] Xcoord_Airfoil; delete [] Ycoord_Airfoil; delete [] Zcoord_Airfoil; delete [] Variable_Airfoil;
+  
+}
@@ -212,8 +212,14 @@ def GEO(config):
     
     # must run with rank 1
     processes = konfig['NUMBER_PART']
-        
-    the_Command = 'SU2_GEO%s %s' % (quote, tempname)
+
+    # geometric gradients are obtained with one reverse sweep when AD is available
+    auto_diff = konfig.MATH_PROBLEM == 'DISCRETE_ADJOINT' or konfig.get('AUTO_DIFF','NO') == 'YES'
+
+    if auto_diff and konfig.get('GEO_MODE','FUNCTION') == 'GRADIENT':
+        the_Command = 'SU2_GEO_AD%s %s' % (quote, tempname)
+    else:
+        the_Command = 'SU2_GEO%s %s' % (quote, tempname)
     the_Command = build_command( the_Command , processes )
     run_command( the_Command )
     
@@ -59,12 +59,20 @@ threads="1"
 %include "std_vector.i"
 %include "std_map.i"
 %include "typemaps.i"
-//%include "numpy.i"
+%include "numpy.i"
 #ifdef HAVE_MPI                    //Need mpi4py only for a parallel build of the wrapper.
   %include "mpi4py/mpi4py.i"
   %mpi4py_typemap(Comm, MPI_Comm)
 #endif
 
+%init %{
+  import_array();
+%}
+
+// The marker-level accessors of CDriver work directly on the memory of contiguous
+// float64 NumPy arrays: the getters fill a preallocated array, the setters read it.
+%apply (double* INPLACE_ARRAY1, int DIM1) {(su2double *values, int nValues)};
+
 namespace std {
    %template() vector<int>;
    %template() vector<double>;
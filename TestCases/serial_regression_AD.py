@@ -100,6 +100,17 @@ def main():
     discadj_rans_naca0012_sa.tol       = 0.00001
     test_list.append(discadj_rans_naca0012_sa)
 
+    # Adjoint turbulent NACA0012 SA without preaccumulation (same sensitivities as above)
+    discadj_rans_naca0012_sa_nopreacc           = TestCase('discadj_rans_naca0012_sa_nopreacc')
+    discadj_rans_naca0012_sa_nopreacc.cfg_dir   = "disc_adj_rans/naca0012"
+    discadj_rans_naca0012_sa_nopreacc.cfg_file  = "turb_NACA0012_sa_nopreacc.cfg"
+    discadj_rans_naca0012_sa_nopreacc.test_iter = 10
+    discadj_rans_naca0012_sa_nopreacc.test_vals = [-1.751962, 0.485751, 0.182121, -0.000018] #last 4 columns
+    discadj_rans_naca0012_sa_nopreacc.su2_exec  = "SU2_CFD_AD"
+    discadj_rans_naca0012_sa_nopreacc.timeout   = 1600
+    discadj_rans_naca0012_sa_nopreacc.tol       = 0.00001
+    test_list.append(discadj_rans_naca0012_sa_nopreacc)
+
     # Adjoint turbulent NACA0012 SST
     discadj_rans_naca0012_sst           = TestCase('discadj_rans_naca0012_sst')
     discadj_rans_naca0012_sst.cfg_dir   = "disc_adj_rans/naca0012"
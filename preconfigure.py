@@ -486,6 +486,7 @@ def configure(argument_dict,
     if modes['SU2_AD']:
         print('\tSU2_CFD_AD         -> Discrete Adjoint Solver and general AD support.')
         print('\tSU2_DOT_AD         -> Mesh sensitivity computation and general AD support.')
+        print('\tSU2_GEO_AD         -> Geometric sensitivities using algorithmic differentiation.')
     if modes['SU2_DIRECTDIFF']:
         print('\tSU2_CFD_DIRECTDIFF -> Direct Differentation Mode.')
 